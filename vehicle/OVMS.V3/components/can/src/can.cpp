@@ -366,6 +366,12 @@ void can_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, c
     writer->printf("Wdg Timer: %20" PRId32 " sec(s)\n",monotonictime-sbus->m_watchdog_timer);
     }
   writer->printf("Err Resets:%20d\n",sbus->m_status.error_resets);
+
+  if (sbus->m_rxinterest.IsActive())
+    {
+    writer->printf("\nRx interest: %s\n",sbus->m_rxinterest.Info().c_str());
+    writer->printf("Rx skipped:%20" PRId32 "\n",sbus->m_rxinterest.m_dropped);
+    }
   }
 
 void can_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
@@ -569,6 +575,103 @@ std::string canfilter::Info()
   return buf.str();
   }
 
+////////////////////////////////////////////////////////////////////////
+// CAN RX interest (software based pre-filter)
+// Add() may be called while the CAN RX task is checking frames: bitmap
+// words are updated atomically, range entries are filled in before
+// they are counted, and the set becomes active after the first entry.
+////////////////////////////////////////////////////////////////////////
+
+caninterest::caninterest()
+  {
+  m_dropped = 0;
+  m_active = false;
+  m_std = NULL;
+  m_extcnt = 0;
+  }
+
+caninterest::~caninterest()
+  {
+  m_active = false;
+  if (m_std) free(m_std);
+  }
+
+void caninterest::Clear()
+  {
+  m_active = false;
+  m_extcnt = 0;
+  m_dropped = 0;
+  if (m_std) memset(m_std, 0, 64*sizeof(uint32_t));
+  }
+
+bool caninterest::Add(uint32_t id_from, uint32_t id_to)
+  {
+  if (id_to < id_from)
+    return false;
+
+  if (!m_std)
+    {
+    m_std = (uint32_t*) calloc(64, sizeof(uint32_t));
+    if (!m_std)
+      {
+      ESP_LOGE(TAG, "caninterest: out of memory");
+      return false;
+      }
+    }
+
+  if (id_from <= 0x7ff)
+    {
+    uint32_t last = (id_to > 0x7ff) ? 0x7ff : id_to;
+    for (uint32_t id = id_from; id <= last; id++)
+      m_std[id >> 5] |= (1ul << (id & 31));
+    id_from = 0x800;
+    }
+
+  if (id_to >= id_from)
+    {
+    if (m_extcnt >= CAN_INTEREST_MAXRANGES)
+      {
+      ESP_LOGE(TAG, "caninterest: too many extended ID ranges");
+      return false;
+      }
+    m_ext[m_extcnt].id_from = id_from;
+    m_ext[m_extcnt].id_to = id_to;
+    m_extcnt = m_extcnt + 1;
+    }
+
+  m_active = true;
+  return true;
+  }
+
+std::string caninterest::Info()
+  {
+  if (!m_active) return std::string("all");
+
+  std::ostringstream buf;
+  buf << std::setfill('0') << std::hex;
+  for (uint32_t id = 0; id <= 0x7ff; id++)
+    {
+    if ((m_std[id >> 5] & (1ul << (id & 31))) == 0) continue;
+    uint32_t last = id;
+    while (last < 0x7ff && (m_std[(last+1) >> 5] & (1ul << ((last+1) & 31))) != 0)
+      last++;
+    if (last == id)
+      { buf << std::setw(3) << id << ' '; }
+    else
+      { buf << std::setw(3) << id << '-' << std::setw(3) << last << ' '; }
+    id = last;
+    }
+  for (int i = 0; i < m_extcnt; i++)
+    {
+    if (m_ext[i].id_from == m_ext[i].id_to)
+      { buf << std::setw(8) << m_ext[i].id_from << ' '; }
+    else
+      { buf << std::setw(8) << m_ext[i].id_from << '-' << std::setw(8) << m_ext[i].id_to << ' '; }
+    }
+
+  return buf.str();
+  }
+
 ////////////////////////////////////////////////////////////////////////
 // CAN logging and tracing
 // These structures are involved in formatting, logging and tracing of
@@ -963,9 +1066,9 @@ void can::IncomingFrame(CAN_frame_t* p_frame)
   NotifyListeners(p_frame, false);
   }
 
-void can::RegisterListener(QueueHandle_t queue, bool txfeedback)
+void can::RegisterListener(QueueHandle_t queue, bool txfeedback, bool interest)
   {
-  m_listeners[queue] = txfeedback;
+  m_listeners[queue] = { txfeedback, interest };
   }
 
 void can::DeregisterListener(QueueHandle_t queue)
@@ -979,8 +1082,14 @@ void can::NotifyListeners(const CAN_frame_t* frame, bool tx)
   {
   for (CanListenerMap_t::iterator it = m_listeners.begin(); it != m_listeners.end(); ++it)
     {
-    if (!tx || (tx && it->second))
-      xQueueSend(it->first,frame,0);
+    if (tx && !it->second.txfeedback)
+      continue;
+    if (!tx && it->second.interest && !frame->origin->m_rxinterest.Accepts(frame->MsgID))
+      {
+      frame->origin->m_rxinterest.m_dropped++;
+      continue;
+      }
+    xQueueSend(it->first,frame,0);
     }
   }
 
@@ -233,6 +233,54 @@ class canfilter
     CAN_filter_list_t m_filters;
   };
 
+////////////////////////////////////////////////////////////////////////
+// CAN RX interest (software based pre-filter)
+// The caninterest object holds the set of CAN IDs a bus consumer (the
+// vehicle module) handles. It is checked for every received frame in
+// the CAN RX task, so standard IDs are kept in a bitmap and extended
+// IDs in a short range list. An empty (inactive) set accepts all IDs.
+////////////////////////////////////////////////////////////////////////
+
+#define CAN_INTEREST_MAXRANGES  16
+
+class caninterest
+  {
+  public:
+    caninterest();
+    ~caninterest();
+
+  public:
+    void Clear();
+    bool Add(uint32_t id_from, uint32_t id_to);
+    bool Add(uint32_t id) { return Add(id, id); }
+    bool IsActive() const { return m_active; }
+    bool Accepts(uint32_t id) const
+      {
+      if (!m_active) return true;
+      if (id <= 0x7ff)
+        return (m_std[id >> 5] & (1ul << (id & 31))) != 0;
+      for (int i = 0; i < m_extcnt; i++)
+        {
+        if (id >= m_ext[i].id_from && id <= m_ext[i].id_to) return true;
+        }
+      return false;
+      }
+    std::string Info();
+
+  public:
+    uint32_t m_dropped;           // frames not passed on to the consumer
+
+  protected:
+    volatile bool m_active;
+    uint32_t* m_std;              // standard ID bitmap, allocated on first Add()
+    struct
+      {
+      uint32_t id_from;
+      uint32_t id_to;
+      } m_ext[CAN_INTEREST_MAXRANGES];
+    volatile int m_extcnt;
+  };
+
 ////////////////////////////////////////////////////////////////////////
 // CAN logging and tracing
 // These structures are involved in formatting, logging and tracing of
@@ -335,6 +383,7 @@ class canbus : public pcp, public InternalRamAllocated
     uint32_t m_state;             // state bitset
     QueueHandle_t m_txqueue;
     int m_busnumber;
+    caninterest m_rxinterest;     // vehicle RX interest, see OvmsVehicle::RegisterCanInterest()
 
   protected:
     dbcfile *m_dbcfile;
@@ -346,7 +395,12 @@ class canbus : public pcp, public InternalRamAllocated
 // can - the CAN system controller
 ////////////////////////////////////////////////////////////////////////
 
-typedef std::map<QueueHandle_t, bool> CanListenerMap_t;
+typedef struct
+  {
+  bool txfeedback;              // also receive transmitted frames
+  bool interest;                // only receive frames accepted by the bus RX interest
+  } CanListener_t;
+typedef std::map<QueueHandle_t, CanListener_t> CanListenerMap_t;
 
 
 class CanFrameCallbackEntry
@@ -380,7 +434,7 @@ class can : public InternalRamAllocated
     QueueHandle_t m_rxqueue;
 
   public:
-    void RegisterListener(QueueHandle_t queue, bool txfeedback=false);
+    void RegisterListener(QueueHandle_t queue, bool txfeedback=false, bool interest=false);
     void DeregisterListener(QueueHandle_t queue);
     void NotifyListeners(const CAN_frame_t* frame, bool tx);
 
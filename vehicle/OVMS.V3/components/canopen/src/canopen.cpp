@@ -75,6 +75,8 @@ CANopen::CANopen()
 
     cmd_canx->RegisterCommand("info", "Show node info", shell_info, "<nodeid> [timeout_ms=50]", 1, 2);
     cmd_canx->RegisterCommand("scan", "Scan nodes", shell_scan, "[[startid=1][-][endid=127]] [timeout_ms=50]", 0, 2);
+    cmd_canx->RegisterCommand("sdobench", "Benchmark segmented vs. block SDO reads", shell_sdobench,
+      "<nodeid>[-<nodeid>] <index_hex> <subindex_hex> [count=10] [bufsize=1024] [timeout_ms=100]", 3, 6);
     }
   }
 
@@ -377,6 +379,7 @@ const std::string CANopen::GetResultString(const CANopenResult_t result)
     case COR_ERR_Timeout:               name = "Timeout"; break;
     case COR_ERR_SDO_Access:            name = "SDO access failed"; break;
     case COR_ERR_SDO_SegMismatch:       name = "SDO segment mismatch"; break;
+    case COR_ERR_SDO_CRC:               name = "SDO CRC error"; break;
 
     case COR_ERR_DeviceOffline:         name = "Device offline"; break;
     case COR_ERR_UnknownDevice:         name = "Unknown device"; break;
@@ -27,6 +27,8 @@
 #define __CANOPEN_H__
 
 #include <forward_list>
+#include <deque>
+#include <bitset>
 
 #include "can.h"
 
@@ -34,8 +36,12 @@
 #include "ovms_config.h"
 #include "ovms_metrics.h"
 #include "ovms_command.h"
+#include "ovms_mutex.h"
 
 #define CAN_INTERFACE_CNT         4
+#define CANOPEN_CHANNEL_CNT       4           // max concurrent jobs (to different nodes) per worker
+#define CANOPEN_JOBQUEUE_SIZE     20          // worker job queue size
+#define CANOPEN_SDO_BLKSIZE_MAX   64          // max segments per SDO block (≤127)
 
 #define CANopen_GeneralError      0x08000000  // check for device specific error details
 #define CANopen_BusCollision      0xffffffff  // another master is active / non-CANopen frame received
@@ -57,6 +63,7 @@ typedef enum __attribute__ ((__packed__))
   COR_ERR_Timeout,
   COR_ERR_SDO_Access,
   COR_ERR_SDO_SegMismatch,
+  COR_ERR_SDO_CRC,
   
   // General purpose application level:
   COR_ERR_DeviceOffline = 0x80,
@@ -163,6 +170,7 @@ struct __attribute__ ((__packed__)) CANopenJob
       size_t                xfersize;       // byte count sent / received
       size_t                contsize;       // content size of SDO (if indicated by slave)
       uint32_t              error;          // CANopen general error code
+      uint8_t               blksize;        // block transfer: max segments per block, 0 = off
       } sdo;
     };
   
@@ -205,9 +213,80 @@ typedef union __attribute__ ((__packed__))
     uint8_t     subindex;       // SDO register sub index
     uint32_t    data;           // abort reason / error code (little endian)
     } ctl;
+  struct __attribute__ ((__packed__))
+    {
+    uint8_t     control;        // block sequence number & last segment flag
+    uint8_t     data[7];        // block segment payload
+    } blk;
+  struct __attribute__ ((__packed__))
+    {
+    uint8_t     control;        // block transfer response
+    uint8_t     ackseq;         // last sequence number received
+    uint8_t     blksize;        // segments per block for the next block
+    uint8_t     unused[5];
+    } ack;
+  struct __attribute__ ((__packed__))
+    {
+    uint8_t     control;        // block transfer end request / response
+    uint16_t    crc;            // CRC of the data (little endian)
+    uint8_t     unused[5];
+    } end;
   } CANopenFrame_t;
 
 
+class CANopenWorker;
+
+/**
+ * A CANopenChannel executes CANopenJobs for a CANopenWorker, one at a time.
+ * 
+ * The worker runs up to CANOPEN_CHANNEL_CNT channels, so jobs addressing
+ * different nodes are processed concurrently. Jobs addressing the same node
+ * are executed in submission order.
+ */
+
+class CANopenChannel final
+  {
+  public:
+    CANopenChannel(CANopenWorker* worker, int index);
+    ~CANopenChannel();
+  
+  public:
+    void ChannelTask();
+    void IncomingFrame(CAN_frame_t* frame);
+  
+  protected:
+    void ProcessJob();
+    CANopenResult_t ProcessSendNMTJob();
+    CANopenResult_t ProcessReceiveHBJob();
+    CANopenResult_t ProcessReadSDOJob();
+    CANopenResult_t ProcessWriteSDOJob();
+    CANopenResult_t UploadSDOBlock(bool& switched);
+    CANopenResult_t DownloadSDOBlock();
+  
+  private:
+    esp_err_t SendSDORequest(TickType_t maxqueuewait=0);
+    void AbortSDORequest(uint32_t reason);
+    CANopenResult_t ExecuteSDORequest();
+    bool WaitResponse(TickType_t maxwait);
+
+  public:
+    CANopenWorker*        m_worker;
+    canbus*               m_bus;
+    
+    char                  m_taskname[16];   // "OVMS COwrk canX"
+    TaskHandle_t          m_task;           // channel task
+    QueueHandle_t         m_rxqueue;        // response frame queue
+    uint32_t              m_rxoverflow;     // response frames lost
+    
+    volatile bool         m_busy;           // m_job is being processed
+    CANopenJob            m_job;            // job currently processed
+
+  private:
+    CANopenFrame_t        m_request;
+    CANopenFrame_t        m_response;
+  };
+
+
 /**
  * A CANopenWorker processes CANopenJobs on a specific bus.
  * 
@@ -219,6 +298,7 @@ typedef union __attribute__ ((__packed__))
  */
 
 typedef std::forward_list<CANopenAsyncClient*> CANopenClientList;
+typedef std::deque<CANopenJob> CANopenJobList;
 
 class CANopenWorker final
   {
@@ -227,7 +307,6 @@ class CANopenWorker final
     ~CANopenWorker();
   
   public:
-    void JobTask();
     void IncomingFrame(CAN_frame_t* frame);
     void Open(CANopenAsyncClient* client);
     void Close(CANopenAsyncClient* client);
@@ -237,26 +316,26 @@ class CANopenWorker final
   
   public:
     CANopenResult_t SubmitJob(CANopenJob& job, TickType_t maxqueuewait=0);
+    bool IsBlockCapable(uint8_t nodeid);
+    void SetBlockCapable(uint8_t nodeid, bool capable);
   
   protected:
-    CANopenResult_t ProcessSendNMTJob();
-    CANopenResult_t ProcessReceiveHBJob();
-    CANopenResult_t ProcessReadSDOJob();
-    CANopenResult_t ProcessWriteSDOJob();
-  
-  private:
-    void SendSDORequest();
-    void AbortSDORequest(uint32_t reason);
-    CANopenResult_t ExecuteSDORequest();
+    friend class CANopenChannel;
+    bool FetchJob(CANopenChannel* channel);
+    void JobDone(CANopenChannel* channel);
+    bool IsBlocked(const CANopenJob& job, CANopenJobList::iterator upto);
+    void WakeChannel(bool create);
 
   public:
     canbus*               m_bus;            // max one worker per bus
     int                   m_clientcnt;
     CANopenClientList     m_clients;
     
-    char                  m_taskname[12];   // "COwrk canX"
-    TaskHandle_t          m_jobtask;        // worker task
     QueueHandle_t         m_jobqueue;       // job rx queue
+    CANopenJobList        m_deferred;       // jobs waiting for their node
+    CANopenChannel*       m_channel[CANOPEN_CHANNEL_CNT];
+    int                   m_channelcnt;
+    OvmsMutex             m_mutex;          // job dispatch lock
     
     uint32_t              m_nmt_rxcnt;
     uint32_t              m_emcy_rxcnt;
@@ -264,13 +343,8 @@ class CANopenWorker final
     uint32_t              m_jobcnt_timeout;
     uint32_t              m_jobcnt_error;
     
-    CANopenJob            m_job;            // job currently processed
-    
     CANopenNodeMetricsMap m_nodemetrics;    // map: nodeid → node metrics
-
-  private:
-    CANopenFrame_t        m_request;
-    CANopenFrame_t        m_response;
+    std::bitset<128>      m_noblock;        // nodes not supporting SDO block transfers
   };
 
 
@@ -318,6 +392,10 @@ class CANopenAsyncClient
       int resp_timeout_ms=100, int max_tries=3);
     void InitWriteSDO(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
       int resp_timeout_ms=100, int max_tries=3);
+    void InitReadSDOBlock(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+      int resp_timeout_ms=100, int max_tries=3, uint8_t blksize=CANOPEN_SDO_BLKSIZE_MAX);
+    void InitWriteSDOBlock(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+      int resp_timeout_ms=100, int max_tries=3);
   
   public:
     // Main API:
@@ -329,6 +407,10 @@ class CANopenAsyncClient
       int resp_timeout_ms=100, int max_tries=3);
     CANopenResult_t WriteSDO(uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
       int resp_timeout_ms=100, int max_tries=3);
+    CANopenResult_t ReadSDOBlock(uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+      int resp_timeout_ms=100, int max_tries=3);
+    CANopenResult_t WriteSDOBlock(uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+      int resp_timeout_ms=100, int max_tries=3);
   
   public:
     CANopenWorker*        m_worker;
@@ -365,6 +447,10 @@ class CANopenClient : public CANopenAsyncClient
       int resp_timeout_ms=100, int max_tries=3);
     CANopenResult_t WriteSDO(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
       int resp_timeout_ms=100, int max_tries=3);
+    CANopenResult_t ReadSDOBlock(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+      int resp_timeout_ms=100, int max_tries=3);
+    CANopenResult_t WriteSDOBlock(CANopenJob& job, uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+      int resp_timeout_ms=100, int max_tries=3);
   
   public:
     SemaphoreHandle_t m_mutex;              // thread mutex
@@ -411,6 +497,7 @@ class CANopen final
     static void shell_writesdo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void shell_info(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void shell_scan(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void shell_sdobench(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
 
   public:
     QueueHandle_t         m_rxqueue;    // CAN rx queue
@@ -26,6 +26,8 @@
 #include "ovms_log.h"
 static const char *TAG = "canopen";
 
+#include <sys/param.h>
+
 #include "canopen.h"
 
 
@@ -206,6 +208,33 @@ void CANopenAsyncClient::InitWriteSDO(CANopenJob& job,
   job.maxtries = max_tries;
   }
 
+/**
+ * InitReadSDOBlock: prepare ReadSDO command using block transfer
+ *   - blksize: max segments per block the server may send before we acknowledge
+ *     (1…CANOPEN_SDO_BLKSIZE_MAX)
+ * Hint: override for customisation
+ */
+void CANopenAsyncClient::InitReadSDOBlock(CANopenJob& job,
+    uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/, uint8_t blksize /*=CANOPEN_SDO_BLKSIZE_MAX*/)
+  {
+  InitReadSDO(job, nodeid, index, subindex, buf, bufsize, resp_timeout_ms, max_tries);
+  job.sdo.blksize = MIN(blksize, CANOPEN_SDO_BLKSIZE_MAX);
+  }
+
+/**
+ * InitWriteSDOBlock: prepare WriteSDO command using block transfer
+ *   - the block size is defined by the server
+ * Hint: override for customisation
+ */
+void CANopenAsyncClient::InitWriteSDOBlock(CANopenJob& job,
+    uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  InitWriteSDO(job, nodeid, index, subindex, buf, bufsize, resp_timeout_ms, max_tries);
+  job.sdo.blksize = CANOPEN_SDO_BLKSIZE_MAX;
+  }
+
 
 /**
  * [Main API]
@@ -292,6 +321,44 @@ CANopenResult_t CANopenAsyncClient::WriteSDO(
   }
 
 
+/**
+ * [Main API]
+ * ReadSDOBlock: read bytes from SDO server into buffer using block transfer
+ *   - same as ReadSDO(), but transfers segments in blocks without per-segment
+ *     handshake, secured by a CRC
+ *   - falls back to ReadSDO() transparently if the server doesn't support
+ *     block transfers (remembered per node)
+ * 
+ * Use this for domain / string objects of more than a few segments.
+ */
+CANopenResult_t CANopenAsyncClient::ReadSDOBlock(
+    uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  CANopenJob job;
+  InitReadSDOBlock(job, nodeid, index, subindex, buf, bufsize, resp_timeout_ms, max_tries);
+  return SubmitJob(job);
+  }
+
+
+/**
+ * [Main API]
+ * WriteSDOBlock: write bytes from buffer into SDO server using block transfer
+ *   - same as WriteSDO(), but transfers segments in blocks without per-segment
+ *     handshake, secured by a CRC
+ *   - falls back to WriteSDO() transparently for short data and if the server
+ *     doesn't support block transfers (remembered per node)
+ */
+CANopenResult_t CANopenAsyncClient::WriteSDOBlock(
+    uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  CANopenJob job;
+  InitWriteSDOBlock(job, nodeid, index, subindex, buf, bufsize, resp_timeout_ms, max_tries);
+  return SubmitJob(job);
+  }
+
+
 
 
 
@@ -424,3 +491,30 @@ CANopenResult_t CANopenClient::WriteSDO(CANopenJob& job,
   return ExecuteJob(job);
   }
 
+
+/**
+ * [Main API]
+ * ReadSDOBlock: read bytes from SDO server into buffer using block transfer
+ *   - see CANopenAsyncClient::ReadSDOBlock()
+ */
+CANopenResult_t CANopenClient::ReadSDOBlock(CANopenJob& job,
+    uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  InitReadSDOBlock(job, nodeid, index, subindex, buf, bufsize, resp_timeout_ms, max_tries);
+  return ExecuteJob(job);
+  }
+
+
+/**
+ * [Main API]
+ * WriteSDOBlock: write bytes from buffer into SDO server using block transfer
+ *   - see CANopenAsyncClient::WriteSDOBlock()
+ */
+CANopenResult_t CANopenClient::WriteSDOBlock(CANopenJob& job,
+    uint8_t nodeid, uint16_t index, uint8_t subindex, uint8_t* buf, size_t bufsize,
+    int resp_timeout_ms /*=100*/, int max_tries /*=3*/)
+  {
+  InitWriteSDOBlock(job, nodeid, index, subindex, buf, bufsize, resp_timeout_ms, max_tries);
+  return ExecuteJob(job);
+  }
@@ -28,8 +28,11 @@
 // #include "ovms_log.h"
 // static const char *TAG = "canopen";
 
+#include "esp_timer.h"
+
 #include "canopen.h"
 #include "ovms_events.h"
+#include "ovms_malloc.h"
 
 
 // Shell command:
@@ -460,3 +463,113 @@ void CANopen::shell_scan(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, in
   }
 
 
+// Shell command:
+//    co canX sdobench <nodeid>[-<nodeid>] <index_hex> <subindex_hex> [count=10] [bufsize=1024] [timeout_ms=100]
+// Reads the SDO count times from each node, first using segmented, then using
+// block transfers. Jobs for different nodes are executed concurrently.
+void CANopen::shell_sdobench(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  const char* busname = cmd->GetParent()->GetName();
+
+  canbus* bus = (canbus*)MyPcpApp.FindDeviceByName(busname);
+  if (bus == NULL)
+    {
+    writer->puts("Error: Cannot find named CAN bus");
+    return;
+    }
+
+  // parse args:
+  char *endptr;
+  int id_start = strtol(argv[0], &endptr, 10);
+  int id_end = (*endptr == '-') ? strtol(endptr+1, NULL, 10) : id_start;
+  uint16_t index = strtol(argv[1], NULL, 16);
+  uint8_t subindex = strtol(argv[2], NULL, 16);
+  int count = (argc >= 4) ? strtol(argv[3], NULL, 10) : 10;
+  int bufsize = (argc >= 5) ? strtol(argv[4], NULL, 10) : 1024;
+  int timeout = (argc >= 6) ? strtol(argv[5], NULL, 10) : 100;
+  
+  if (id_start < 1 || id_end > 127 || id_end < id_start)
+    {
+    writer->puts("Error: invalid nodeid, allowed range 1-127");
+    return;
+    }
+  if (count < 1 || bufsize < 1)
+    {
+    writer->puts("Error: invalid count / bufsize");
+    return;
+    }
+  
+  int nodecnt = id_end - id_start + 1;
+  uint8_t* buffer = (uint8_t*) ExternalRamMalloc(nodecnt * bufsize);
+  if (!buffer)
+    {
+    writer->puts("Error: out of memory");
+    return;
+    }
+  
+  CANopenAsyncClient client(bus, nodecnt);
+  CANopenJob job;
+  int64_t usec[2] = { 0, 0 };
+  
+  // execute: pass 0 = segmented, pass 1 = block transfers
+  for (int pass = 0; pass < 2; pass++)
+    {
+    int jobcnt = 0, errcnt = 0;
+    size_t bytes = 0;
+    int64_t start = esp_timer_get_time();
+    
+    for (int round = 0; round < count; round++)
+      {
+      int pending = 0;
+      for (int nodeid = id_start; nodeid <= id_end; nodeid++)
+        {
+        uint8_t* buf = buffer + (nodeid - id_start) * bufsize;
+        if (pass == 0)
+          client.InitReadSDO(job, nodeid, index, subindex, buf, bufsize, timeout);
+        else
+          client.InitReadSDOBlock(job, nodeid, index, subindex, buf, bufsize, timeout);
+        if (client.SubmitJob(job, pdMS_TO_TICKS(1000)) == COR_WAIT)
+          pending++;
+        else
+          errcnt++;
+        }
+      while (pending > 0 && client.ReceiveDone(job, pdMS_TO_TICKS(10000)) != COR_ERR_QueueEmpty)
+        {
+        pending--;
+        jobcnt++;
+        if (job.result == COR_OK)
+          bytes += job.sdo.xfersize;
+        else
+          {
+          errcnt++;
+          if (verbosity >= COMMAND_RESULT_VERBOSE && errcnt <= 5)
+            writer->printf("  #%d: %s\n", job.sdo.nodeid, CANopen::GetResultString(job).c_str());
+          }
+        }
+      if (pending > 0)
+        {
+        // The outstanding jobs may still write into the buffer, so we
+        // cannot free it here. Leak it, as this should never happen:
+        writer->printf("Error: timeout waiting for job results, aborting"
+          " (%d bytes of buffer memory lost)\n", nodecnt * bufsize);
+        return;
+        }
+      }
+    
+    usec[pass] = esp_timer_get_time() - start;
+    writer->printf("%-9s: %d jobs, %d errors, %u bytes in %.3f s = %.0f bytes/s\n",
+      (pass == 0) ? "Segmented" : "Block", jobcnt, errcnt, (unsigned) bytes,
+      (double) usec[pass] / 1e6, usec[pass] ? (double) bytes * 1e6 / usec[pass] : 0.0);
+    }
+  
+  if (usec[1])
+    writer->printf("Speedup  : %.2fx\n", (double) usec[0] / usec[1]);
+  
+  for (int nodeid = id_start; nodeid <= id_end; nodeid++)
+    {
+    if (!client.m_worker->IsBlockCapable(nodeid))
+      writer->printf("Note: node #%d does not support block transfers\n", nodeid);
+    }
+  
+  free(buffer);
+  }
@@ -26,6 +26,8 @@
 #include "ovms_log.h"
 static const char *TAG = "canopen";
 
+#include <sys/param.h>
+
 #include "ovms_metrics.h"
 #include "metrics_standard.h"
 #include "ovms_events.h"
@@ -55,14 +57,57 @@ static const char *TAG = "canopen";
 #define SDO_SegmentUnusedMask       0b00001110
 #define SDO_SegmentEnd              0b00000001
 
+// SDO block transfer commands:
+
+#define SDO_BlockUploadRequest      0b10100000
+#define SDO_BlockUploadResponse     0b11000000
+#define SDO_BlockDownloadRequest    0b11000000
+#define SDO_BlockDownloadResponse   0b10100000
+
+#define SDO_BlockCRC                0b00000100
+#define SDO_BlockSizeIndicated      0b00000010
+#define SDO_BlockSubMask            0b00000011
+#define SDO_BlockInit               0b00000000
+#define SDO_BlockEnd                0b00000001
+#define SDO_BlockAck                0b00000010
+#define SDO_BlockStart              0b00000011
+#define SDO_BlockUnusedMask         0b00011100
+
+#define SDO_BlockLastSegment        0b10000000
+#define SDO_BlockSeqNoMask          0b01111111
+
+// Protocol switch threshold: objects up to this size need less round trips
+//  with expedited / segmented transfers, so let the server switch for them:
+#define SDO_BlockPST                21
+
 // SDO abort reasons:
 
 #define SDO_Abort_SegMismatch       0x05030000
 #define SDO_Abort_Timeout           0x05040000
+#define SDO_Abort_CommandInvalid    0x05040001
+#define SDO_Abort_BlockSize         0x05040002
+#define SDO_Abort_SeqNo             0x05040003
+#define SDO_Abort_CRC               0x05040004
 #define SDO_Abort_OutOfMemory       0x05040005
 
 
-static void CANopenWorkerJobTask(void *pvParameters);
+static void CANopenChannelTask(void *pvParameters);
+
+
+/**
+ * SDOBlockCRC: CRC-16-CCITT (polynomial 0x1021, initial value 0) as
+ *  specified for SDO block transfers
+ */
+static uint16_t SDOBlockCRC(uint16_t crc, const uint8_t* data, size_t len)
+  {
+  while (len--)
+    {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (int k = 0; k < 8; k++)
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+  return crc;
+  }
 
 
 /**
@@ -88,22 +133,23 @@ CANopenWorker::CANopenWorker(canbus* bus)
   m_jobcnt_timeout = 0;
   m_jobcnt_error = 0;
   
-  m_jobqueue = xQueueCreate(20, sizeof(CANopenJob));
-  snprintf(m_taskname, sizeof(m_taskname), "OVMS COwrk %s", bus->GetName());
-  xTaskCreatePinnedToCore(CANopenWorkerJobTask, m_taskname,
-    CONFIG_OVMS_COMP_CANOPEN_WRK_STACK, (void*)this, 15, &m_jobtask, CORE(0));
-  
-  memset(&m_job, 0, sizeof(m_job));
-  m_job.type = COJT_None;
+  m_jobqueue = xQueueCreate(CANOPEN_JOBQUEUE_SIZE, sizeof(CANopenJob));
   
-  memset(&m_request, 0, sizeof(m_request));
-  memset(&m_response, 0, sizeof(m_response));
+  // start the first channel, more are added on demand:
+  for (int i=0; i < CANOPEN_CHANNEL_CNT; i++)
+    m_channel[i] = NULL;
+  m_channel[0] = new CANopenChannel(this, 0);
+  m_channelcnt = 1;
   }
 
 CANopenWorker::~CANopenWorker()
   {
+  for (int i=0; i < CANOPEN_CHANNEL_CNT; i++)
+    {
+    if (m_channel[i])
+      delete m_channel[i];
+    }
   vQueueDelete(m_jobqueue);
-  vTaskDelete(m_jobtask);
   }
 
 
@@ -132,21 +178,38 @@ bool CANopenWorker::IsClient(CANopenAsyncClient* client)
 
 void CANopenWorker::StatusReport(int verbosity, OvmsWriter* writer)
   {
+  int busy = 0, waiting;
+  uint32_t rxoverflow = 0;
+    {
+    OvmsMutexLock lock(&m_mutex);
+    for (int i=0; i < m_channelcnt; i++)
+      {
+      if (m_channel[i]->m_busy)
+        busy++;
+      rxoverflow += m_channel[i]->m_rxoverflow;
+      }
+    waiting = m_deferred.size() + uxQueueMessagesWaiting(m_jobqueue);
+    }
+  
   writer->printf(
     "  %s:\n"
     "    Active clients: %d\n"
+    "    Channels      : %d (%d busy)\n"
     "    Jobs waiting  : %d\n"
     "    Jobs processed: %" PRId32 "\n"
     "    - timeouts    : %" PRId32 "\n"
     "    - other errors: %" PRId32 "\n"
+    "    Responses lost: %" PRId32 "\n"
     "    NMT received  : %" PRId32 "\n"
     "    EMCY received : %" PRId32 "\n"
     , m_bus->GetName()
     , m_clientcnt
-    , (int)uxQueueMessagesWaiting(m_jobqueue)
+    , m_channelcnt, busy
+    , waiting
     , m_jobcnt
     , m_jobcnt_timeout
     , m_jobcnt_error
+    , rxoverflow
     , m_nmt_rxcnt
     , m_emcy_rxcnt);
   }
@@ -185,94 +248,164 @@ CANopenNodeMetrics *CANopenWorker::GetNodeMetrics(uint8_t nodeid)
 
 
 /**
- * SubmitJob: post a new job to the JobTask queue
+ * SubmitJob: post a new job to the job queue
  */
 CANopenResult_t CANopenWorker::SubmitJob(CANopenJob& job, TickType_t maxqueuewait /*=0*/)
   {
   if (xQueueSend(m_jobqueue, &job, maxqueuewait) != pdTRUE)
-    job.result = COR_ERR_QueueFull;
-  else
-    job.result = COR_WAIT;
+    return job.result = COR_ERR_QueueFull;
+  job.result = COR_WAIT;
+  
+  // wake up / add a channel if the job can be processed now:
+  OvmsMutexLock lock(&m_mutex);
+  WakeChannel(!IsBlocked(job, m_deferred.end()));
   return job.result;
   }
 
 
 /**
- * JobTask: process CANopenJobs, send results back to clients
+ * IsBlocked: check if a job needs to wait for a job in process or an
+ *  earlier job addressing the same node / CAN IDs
+ *  (call with m_mutex locked)
  */
+static uint8_t JobNodeId(const CANopenJob& job)
+  {
+  switch (job.type)
+    {
+    case COJT_SendNMT:    return job.nmt.nodeid;
+    case COJT_ReceiveHB:  return job.hb.nodeid;
+    case COJT_ReadSDO:
+    case COJT_WriteSDO:   return job.sdo.nodeid;
+    default:              return 0;
+    }
+  }
 
-static void CANopenWorkerJobTask(void *pvParameters)
+static bool JobsConflict(const CANopenJob& a, const CANopenJob& b)
   {
-  CANopenWorker *me = (CANopenWorker*)pvParameters;
-  me->JobTask();
+  uint8_t node_a = JobNodeId(a), node_b = JobNodeId(b);
+  // node 0 = broadcast / no node: conflicts with all jobs
+  return (node_a == 0 || node_b == 0 || node_a == node_b
+    || (a.rxid && a.rxid == b.rxid) || (a.txid && a.txid == b.txid));
   }
 
-void CANopenWorker::JobTask()
+bool CANopenWorker::IsBlocked(const CANopenJob& job, CANopenJobList::iterator upto)
   {
-  while(1)
+  for (int i=0; i < m_channelcnt; i++)
     {
-    // get next job:
-    if (xQueueReceive(m_jobqueue, &m_job, (portTickType)portMAX_DELAY) == pdTRUE)
+    if (m_channel[i]->m_busy && JobsConflict(job, m_channel[i]->m_job))
+      return true;
+    }
+  for (auto it = m_deferred.begin(); it != upto; ++it)
+    {
+    if (JobsConflict(job, *it))
+      return true;
+    }
+  return false;
+  }
+
+
+/**
+ * WakeChannel: signal an idle channel to fetch the next job,
+ *  optionally start a new channel if all are busy
+ *  (call with m_mutex locked)
+ */
+void CANopenWorker::WakeChannel(bool create)
+  {
+  for (int i=0; i < m_channelcnt; i++)
+    {
+    if (!m_channel[i]->m_busy)
       {
-        // check client:
-        if (!IsClient(m_job.client))
-          {
-          ESP_LOGW(TAG, "Job dropped: Client vanished");
-          continue;
-          }
-        
-        // process job:
-        switch (m_job.type)
-          {
-          case COJT_None:
-            m_job.result = COR_OK;
-            break;
-          case COJT_SendNMT:
-            ESP_LOGV(TAG, "SendNMT: %s node=%d, command=%d", m_bus->GetName(), m_job.nmt.nodeid, m_job.nmt.command);
-            m_job.result = ProcessSendNMTJob();
-            ESP_LOGV(TAG, "SendNMT result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_ReceiveHB:
-            ESP_LOGV(TAG, "ReceiveHB: %s node=%d", m_bus->GetName(), m_job.hb.nodeid);
-            m_job.result = ProcessReceiveHBJob();
-            ESP_LOGV(TAG, "ReceiveHB result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_ReadSDO:
-            ESP_LOGV(TAG, "ReadSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
-            m_job.result = ProcessReadSDOJob();
-            ESP_LOGV(TAG, "ReadSDO result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          case COJT_WriteSDO:
-            ESP_LOGV(TAG, "WriteSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
-            m_job.result = ProcessWriteSDOJob();
-            ESP_LOGV(TAG, "WriteSDO result: %s", CANopen::GetResultString(m_job).c_str());
-            break;
-          default:
-            ESP_LOGW(TAG, "Unknown job type: %d", (int)m_job.type);
-            m_job.result = COR_ERR_UnknownJobType;
-          }
-        
-        // return job to client if still valid:
-        if (!IsClient(m_job.client))
-          {
-          ESP_LOGW(TAG, "Job result lost: Client vanished");
-          }
-        else
-          {
-          if (m_job.client->SubmitDoneCallback(m_job, 0) != COR_OK)
-            ESP_LOGW(TAG, "Job result lost: Client queue is full");
-          }
-        
-        // statistics:
-        m_jobcnt++;
-        if (m_job.result == COR_ERR_Timeout)
-          m_jobcnt_timeout++;
-        else if (m_job.result != COR_OK)
-          m_jobcnt_error++;
-        
-        m_job.type = COJT_None;
+      xTaskNotifyGive(m_channel[i]->m_task);
+      return;
       }
     }
+  if (create && m_channelcnt < CANOPEN_CHANNEL_CNT)
+    {
+    m_channel[m_channelcnt] = new CANopenChannel(this, m_channelcnt);
+    m_channelcnt++;
+    ESP_LOGD(TAG, "%s: channel %d started", m_bus->GetName(), m_channelcnt);
+    }
+  }
+
+
+/**
+ * FetchJob: get the next job a channel can process
+ *    - deferred jobs first, in submission order
+ *    - then new jobs from the queue; jobs addressing a busy node are deferred
+ *  Returns false if there is nothing to do for the channel.
+ */
+bool CANopenWorker::FetchJob(CANopenChannel* channel)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  channel->m_busy = false;
+  
+  bool found = false;
+  for (auto it = m_deferred.begin(); it != m_deferred.end(); ++it)
+    {
+    if (!IsBlocked(*it, it))
+      {
+      channel->m_job = *it;
+      m_deferred.erase(it);
+      found = true;
+      break;
+      }
+    }
+  
+  if (!found)
+    {
+    CANopenJob job;
+    while (m_deferred.size() < CANOPEN_JOBQUEUE_SIZE && xQueueReceive(m_jobqueue, &job, 0) == pdTRUE)
+      {
+      if (!IsBlocked(job, m_deferred.end()))
+        {
+        channel->m_job = job;
+        found = true;
+        break;
+        }
+      m_deferred.push_back(job);
+      }
+    }
+  
+  if (found)
+    {
+    channel->m_busy = true;
+    // more work pending? pass on to the next idle channel:
+    if (!m_deferred.empty() || uxQueueMessagesWaiting(m_jobqueue) > 0)
+      WakeChannel(false);
+    }
+  return found;
+  }
+
+
+/**
+ * JobDone: update statistics
+ */
+void CANopenWorker::JobDone(CANopenChannel* channel)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  m_jobcnt++;
+  if (channel->m_job.result == COR_ERR_Timeout)
+    m_jobcnt_timeout++;
+  else if (channel->m_job.result != COR_OK)
+    m_jobcnt_error++;
+  }
+
+
+/**
+ * Block transfer support per node
+ *  (nodes answering a block transfer request with "command specifier invalid"
+ *  are excluded from further block transfer attempts)
+ */
+bool CANopenWorker::IsBlockCapable(uint8_t nodeid)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  return !m_noblock.test(nodeid & 0x7f);
+  }
+
+void CANopenWorker::SetBlockCapable(uint8_t nodeid, bool capable)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  m_noblock.set(nodeid & 0x7f, !capable);
   }
 
 
@@ -281,18 +414,15 @@ void CANopenWorker::JobTask()
  */
 void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
   {
-  // Message matching our current job?
-  if (m_job.type != COJT_None && p_frame->MsgID == m_job.rxid)
+  // Message matching a current job?
+  for (int i=0; i < m_channelcnt; i++)
     {
-    // copy payload into m_response:
-    int i;
-    for (i=0; i < p_frame->FIR.B.DLC; i++)
-      m_response.byte[i] = p_frame->data.u8[i];
-    for (; i < 8; i++)
-      m_response.byte[i] = 0;
-    
-    // signal job task:
-    xTaskNotifyGive(m_jobtask);
+    CANopenChannel* channel = m_channel[i];
+    if (channel->m_busy && channel->m_job.type != COJT_None && p_frame->MsgID == channel->m_job.rxid)
+      {
+      channel->IncomingFrame(p_frame);
+      break;
+      }
     }
   
   
@@ -349,6 +479,148 @@ void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
   } // IncomingFrame()
 
 
+/**
+ * A CANopenChannel executes CANopenJobs for a CANopenWorker, one at a time.
+ */
+
+CANopenChannel::CANopenChannel(CANopenWorker* worker, int index)
+  {
+  m_worker = worker;
+  m_bus = worker->m_bus;
+  m_rxoverflow = 0;
+  m_busy = false;
+  
+  memset(&m_job, 0, sizeof(m_job));
+  m_job.type = COJT_None;
+  
+  memset(&m_request, 0, sizeof(m_request));
+  memset(&m_response, 0, sizeof(m_response));
+  
+  // response queue: must be able to hold a full SDO block
+  m_rxqueue = xQueueCreate(CANOPEN_SDO_BLKSIZE_MAX + 2, sizeof(CANopenFrame_t));
+  
+  if (index == 0)
+    snprintf(m_taskname, sizeof(m_taskname), "OVMS COwrk %s", m_bus->GetName());
+  else
+    snprintf(m_taskname, sizeof(m_taskname), "OVMS COwk%d %s", index+1, m_bus->GetName());
+  xTaskCreatePinnedToCore(CANopenChannelTask, m_taskname,
+    CONFIG_OVMS_COMP_CANOPEN_WRK_STACK, (void*)this, 15, &m_task, CORE(0));
+  }
+
+CANopenChannel::~CANopenChannel()
+  {
+  vTaskDelete(m_task);
+  vQueueDelete(m_rxqueue);
+  }
+
+
+/**
+ * IncomingFrame: queue a response frame for the job
+ *  (called by the CANopen RX task)
+ */
+void CANopenChannel::IncomingFrame(CAN_frame_t* p_frame)
+  {
+  CANopenFrame_t response;
+  int i;
+  for (i=0; i < p_frame->FIR.B.DLC; i++)
+    response.byte[i] = p_frame->data.u8[i];
+  for (; i < 8; i++)
+    response.byte[i] = 0;
+  if (xQueueSend(m_rxqueue, &response, 0) != pdTRUE)
+    m_rxoverflow++;
+  }
+
+
+/**
+ * WaitResponse: get next response frame into m_response
+ */
+bool CANopenChannel::WaitResponse(TickType_t maxwait)
+  {
+  return (xQueueReceive(m_rxqueue, &m_response, maxwait) == pdTRUE);
+  }
+
+
+/**
+ * ChannelTask: process CANopenJobs, send results back to clients
+ */
+
+static void CANopenChannelTask(void *pvParameters)
+  {
+  CANopenChannel *me = (CANopenChannel*)pvParameters;
+  me->ChannelTask();
+  }
+
+void CANopenChannel::ChannelTask()
+  {
+  while(1)
+    {
+    // get next job:
+    if (m_worker->FetchJob(this))
+      ProcessJob();
+    else
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+  }
+
+void CANopenChannel::ProcessJob()
+  {
+  // check client:
+  if (!m_worker->IsClient(m_job.client))
+    {
+    ESP_LOGW(TAG, "Job dropped: Client vanished");
+    return;
+    }
+  
+  // discard late responses to previous jobs:
+  xQueueReset(m_rxqueue);
+  
+  // process job:
+  switch (m_job.type)
+    {
+    case COJT_None:
+      m_job.result = COR_OK;
+      break;
+    case COJT_SendNMT:
+      ESP_LOGV(TAG, "SendNMT: %s node=%d, command=%d", m_bus->GetName(), m_job.nmt.nodeid, m_job.nmt.command);
+      m_job.result = ProcessSendNMTJob();
+      ESP_LOGV(TAG, "SendNMT result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    case COJT_ReceiveHB:
+      ESP_LOGV(TAG, "ReceiveHB: %s node=%d", m_bus->GetName(), m_job.hb.nodeid);
+      m_job.result = ProcessReceiveHBJob();
+      ESP_LOGV(TAG, "ReceiveHB result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    case COJT_ReadSDO:
+      ESP_LOGV(TAG, "ReadSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+      m_job.result = ProcessReadSDOJob();
+      ESP_LOGV(TAG, "ReadSDO result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    case COJT_WriteSDO:
+      ESP_LOGV(TAG, "WriteSDO: %s node=%d adr=%04x.%02x", m_bus->GetName(), m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex);
+      m_job.result = ProcessWriteSDOJob();
+      ESP_LOGV(TAG, "WriteSDO result: %s", CANopen::GetResultString(m_job).c_str());
+      break;
+    default:
+      ESP_LOGW(TAG, "Unknown job type: %d", (int)m_job.type);
+      m_job.result = COR_ERR_UnknownJobType;
+    }
+  
+  // return job to client if still valid:
+  if (!m_worker->IsClient(m_job.client))
+    {
+    ESP_LOGW(TAG, "Job result lost: Client vanished");
+    }
+  else
+    {
+    if (m_job.client->SubmitDoneCallback(m_job, 0) != COR_OK)
+      ESP_LOGW(TAG, "Job result lost: Client queue is full");
+    }
+  
+  // statistics:
+  m_worker->JobDone(this);
+  }
+
+
 /**
  * ProcessSendNMTJob: send NMT request and optionally wait for NMT state change
  *  a.k.a. heartbeat message.
@@ -359,7 +631,7 @@ void CANopenWorker::IncomingFrame(CAN_frame_t* p_frame)
  *  even though the state has in fact changed -- there's no way to know
  *  if the node doesn't tell.
  */
-CANopenResult_t CANopenWorker::ProcessSendNMTJob()
+CANopenResult_t CANopenChannel::ProcessSendNMTJob()
   {
   // check bus:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -392,8 +664,8 @@ CANopenResult_t CANopenWorker::ProcessSendNMTJob()
     if (m_job.rxid == 0)
       return COR_OK;
     
-    // wait for response signal from IncomingFrame():
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    // wait for response from IncomingFrame():
+    if (WaitResponse(maxwait))
       {
       // expected response for command?
       if ( (m_job.nmt.command == CONC_Start      && m_response.hb.state >= 5)
@@ -421,7 +693,7 @@ CANopenResult_t CANopenWorker::ProcessSendNMTJob()
  * Use this to read the current state or synchronize to the heartbeat.
  * Note: heartbeats are optional in CANopen.
  */
-CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
+CANopenResult_t CANopenChannel::ProcessReceiveHBJob()
   {
   // check parameters:
   if (m_job.hb.nodeid < 1 || m_job.hb.nodeid > 127)
@@ -433,8 +705,8 @@ CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
     {
     m_job.trycnt++;
     
-    // wait for receive signal from IncomingFrame():
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    // wait for heartbeat from IncomingFrame():
+    if (WaitResponse(maxwait))
       {
       // return state received:
       m_job.hb.state = (CANopenNMTState_t) m_response.hb.state;
@@ -456,7 +728,7 @@ CANopenResult_t CANopenWorker::ProcessReceiveHBJob()
 /**
  * SendSDORequest: asynchronous tx of prepared CANopen SDO request
  */
-void CANopenWorker::SendSDORequest()
+esp_err_t CANopenChannel::SendSDORequest(TickType_t maxqueuewait /*=0*/)
   {
   // init tx frame:
   CAN_frame_t txframe;
@@ -470,14 +742,14 @@ void CANopenWorker::SendSDORequest()
   memcpy(txframe.data.u8, m_request.byte, 8);
   
   // send:
-  txframe.Write();
+  return txframe.Write(NULL, maxqueuewait);
   }
 
 
 /**
  * AbortSDORequest: send SDO abort command
  */
-void CANopenWorker::AbortSDORequest(uint32_t reason)
+void CANopenChannel::AbortSDORequest(uint32_t reason)
   {
   // backup request:
   uint8_t control = m_request.ctl.control;
@@ -497,7 +769,7 @@ void CANopenWorker::AbortSDORequest(uint32_t reason)
 /**
  * ExecuteSDORequest: send SDO request and wait for response
  */
-CANopenResult_t CANopenWorker::ExecuteSDORequest()
+CANopenResult_t CANopenChannel::ExecuteSDORequest()
   {
   TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
   m_job.trycnt = 0;
@@ -506,10 +778,11 @@ CANopenResult_t CANopenWorker::ExecuteSDORequest()
     {
     // send request:
     m_job.trycnt++;
+    xQueueReset(m_rxqueue);
     SendSDORequest();
 
     // wait for reply:
-    if (ulTaskNotifyTake(pdTRUE, maxwait))
+    if (WaitResponse(maxwait))
       return COR_OK;
 
     // timeout:
@@ -535,7 +808,7 @@ CANopenResult_t CANopenWorker::ExecuteSDORequest()
  *   As CANopen is little endian as ESP32, we don't need to check lengths on numerical results,
  *   i.e. anything from int8_t to uint32_t can simply be read into a uint32_t buffer.
  */
-CANopenResult_t CANopenWorker::ProcessReadSDOJob()
+CANopenResult_t CANopenChannel::ProcessReadSDOJob()
   {
   // check for CAN write access:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -554,15 +827,28 @@ CANopenResult_t CANopenWorker::ProcessReadSDOJob()
   uint8_t *buf = m_job.sdo.buf;
   m_job.sdo.xfersize = 0;
   
+  // try block transfer if requested:
+  bool switched = false;
+  if (m_job.sdo.blksize && m_worker->IsBlockCapable(m_job.sdo.nodeid))
+    {
+    CANopenResult_t res = UploadSDOBlock(switched);
+    if (res != COR_WAIT)
+      return res;
+    // else the server switched to normal upload or doesn't support block transfers
+    }
+  
   // request upload:
-  memset(&m_request, 0, sizeof(m_request));
-  m_request.exp.index = m_job.sdo.index;
-  m_request.exp.subindex = m_job.sdo.subindex;
-  m_request.exp.control = SDO_InitUploadRequest;
-  if (ExecuteSDORequest() != COR_OK)
+  if (!switched)
     {
-    m_job.sdo.error = SDO_Abort_Timeout;
-    return COR_ERR_Timeout;
+    memset(&m_request, 0, sizeof(m_request));
+    m_request.exp.index = m_job.sdo.index;
+    m_request.exp.subindex = m_job.sdo.subindex;
+    m_request.exp.control = SDO_InitUploadRequest;
+    if (ExecuteSDORequest() != COR_OK)
+      {
+      m_job.sdo.error = SDO_Abort_Timeout;
+      return COR_ERR_Timeout;
+      }
     }
 
   // check response:
@@ -666,7 +952,7 @@ CANopenResult_t CANopenWorker::ProcessReadSDOJob()
  *   As CANopen servers normally are intelligent, anything from int8_t to uint32_t can simply be
  *   sent as a uint32_t with bufsize=0, the server will know how to convert it.
  */
-CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
+CANopenResult_t CANopenChannel::ProcessWriteSDOJob()
   {
   // check for CAN write access:
   if (m_bus->m_mode != CAN_MODE_ACTIVE)
@@ -684,6 +970,15 @@ CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
   uint8_t *buf = m_job.sdo.buf;
   m_job.sdo.xfersize = 0;
   
+  // try block transfer if requested & worth it:
+  if (m_job.sdo.blksize && m_job.sdo.bufsize > SDO_BlockPST && m_worker->IsBlockCapable(m_job.sdo.nodeid))
+    {
+    CANopenResult_t res = DownloadSDOBlock();
+    if (res != COR_WAIT)
+      return res;
+    // else the server doesn't support block transfers
+    }
+  
   // request download:
   memset(&m_request, 0, sizeof(m_request));
   m_request.exp.index = m_job.sdo.index;
@@ -777,3 +1072,347 @@ CANopenResult_t CANopenWorker::ProcessWriteSDOJob()
   }
 
 
+/**
+ * UploadSDOBlock: read SDO using the block transfer protocol (CiA 301 7.2.4.3.14)
+ *   - called by ProcessReadSDOJob(), see there for buffer & result handling
+ *   - returns COR_WAIT if the job shall continue with a normal upload:
+ *     - switched=true: the server switched protocols, m_response holds its
+ *       normal upload response
+ *     - switched=false: the server doesn't support block transfers
+ */
+CANopenResult_t CANopenChannel::UploadSDOBlock(bool& switched)
+  {
+  uint8_t blksize = MIN(m_job.sdo.blksize, CANOPEN_SDO_BLKSIZE_MAX);
+  TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
+  switched = false;
+  
+  // request block upload:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.exp.control = SDO_BlockUploadRequest | SDO_BlockCRC | SDO_BlockInit;
+  m_request.exp.index = m_job.sdo.index;
+  m_request.exp.subindex = m_job.sdo.subindex;
+  m_request.exp.data[0] = blksize;
+  m_request.exp.data[1] = SDO_BlockPST;
+  if (ExecuteSDORequest() != COR_OK)
+    {
+    // node offline or ignoring block requests; try normal upload once:
+    return COR_WAIT;
+    }
+  
+  // check response:
+  if ((m_response.exp.control & SDO_CommandMask) == SDO_InitUploadResponse
+    && m_response.exp.index == m_request.exp.index
+    && m_response.exp.subindex == m_request.exp.subindex)
+    {
+    // server switched to expedited / segmented transfer:
+    switched = true;
+    return COR_WAIT;
+    }
+  if ((m_response.exp.control & (SDO_CommandMask|SDO_BlockSubMask)) != (SDO_BlockUploadResponse|SDO_BlockInit)
+    || m_response.exp.index != m_request.exp.index
+    || m_response.exp.subindex != m_request.exp.subindex)
+    {
+    if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort)
+      {
+      if (m_response.ctl.data == SDO_Abort_CommandInvalid)
+        {
+        ESP_LOGD(TAG, "ReadSDO #%d: no block transfer support, using segmented transfers", m_job.sdo.nodeid);
+        m_worker->SetBlockCapable(m_job.sdo.nodeid, false);
+        return COR_WAIT;
+        }
+      m_job.sdo.error = m_response.ctl.data;
+      }
+    else
+      m_job.sdo.error = CANopen_BusCollision;
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: InitBlockUpload failed, CANopen error code 0x%08" PRIx32,
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return COR_ERR_SDO_Access;
+    }
+  
+  bool crc_enabled = (m_response.exp.control & SDO_BlockCRC) != 0;
+  if (m_response.exp.control & SDO_BlockSizeIndicated)
+    m_job.sdo.contsize = m_response.ctl.data;
+  else
+    m_job.sdo.contsize = 0; // unknown size
+  
+  // start upload:
+  //  Segments are copied into the buffer with a delay of one segment, as the
+  //  number of valid bytes in the last segment is only known at the end.
+  uint8_t *buf = m_job.sdo.buf;
+  uint8_t held[7];              // last segment received in sequence
+  bool have_held = false;
+  bool last = false;            // last segment received in sequence
+  uint8_t ackseq = 0;           // last sequence number received in sequence
+  uint16_t crc = 0;
+  uint8_t seqno;
+  
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.ack.control = SDO_BlockUploadRequest | SDO_BlockStart;
+  xQueueReset(m_rxqueue);
+  SendSDORequest();
+  m_job.trycnt = 0;
+  
+  while (!last)
+    {
+    // receive block:
+    if (!WaitResponse(maxwait))
+      {
+      // segment(s) or our ack got lost; request repetition:
+      if (++m_job.trycnt >= m_job.maxtries)
+        {
+        AbortSDORequest(SDO_Abort_Timeout);
+        m_job.sdo.error = SDO_Abort_Timeout;
+        return COR_ERR_Timeout;
+        }
+      m_request.ack.control = SDO_BlockUploadRequest | SDO_BlockAck;
+      m_request.ack.ackseq = ackseq;
+      m_request.ack.blksize = blksize;
+      SendSDORequest();
+      ackseq = 0;
+      continue;
+      }
+    
+    if (m_response.blk.control == SDO_Abort)
+      {
+      m_job.sdo.error = m_response.ctl.data;
+      ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: block upload aborted by server, CANopen error code 0x%08" PRIx32,
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+      return COR_ERR_SDO_Access;
+      }
+    
+    seqno = m_response.blk.control & SDO_BlockSeqNoMask;
+    if (seqno == ackseq + 1)
+      {
+      // in sequence: commit previous segment, hold this one
+      if (have_held)
+        {
+        size_t n = MIN(7, m_job.sdo.bufsize - m_job.sdo.xfersize);
+        memcpy(buf, held, n);
+        buf += n;
+        m_job.sdo.xfersize += n;
+        if (n < 7)
+          {
+          ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: buffer too small, readlen=%d",
+            m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.xfersize);
+          AbortSDORequest(SDO_Abort_OutOfMemory);
+          m_job.sdo.error = SDO_Abort_OutOfMemory;
+          return COR_ERR_BufferTooSmall;
+          }
+        if (crc_enabled)
+          crc = SDOBlockCRC(crc, held, 7);
+        }
+      memcpy(held, m_response.blk.data, 7);
+      have_held = true;
+      ackseq = seqno;
+      last = (m_response.blk.control & SDO_BlockLastSegment) != 0;
+      }
+    
+    // end of block? send acknowledge:
+    if (last || seqno >= blksize)
+      {
+      m_request.ack.control = SDO_BlockUploadRequest | SDO_BlockAck;
+      m_request.ack.ackseq = ackseq;
+      m_request.ack.blksize = blksize;
+      SendSDORequest();
+      ackseq = 0;
+      m_job.trycnt = 0;
+      }
+    }
+  
+  // wait for end of transfer:
+  do
+    {
+    if (!WaitResponse(maxwait))
+      {
+      AbortSDORequest(SDO_Abort_Timeout);
+      m_job.sdo.error = SDO_Abort_Timeout;
+      return COR_ERR_Timeout;
+      }
+    }
+  while ((m_response.end.control & SDO_CommandMask) != SDO_BlockUploadResponse
+    && m_response.end.control != SDO_Abort); // skip repeated segments
+  
+  if (m_response.end.control == SDO_Abort)
+    {
+    m_job.sdo.error = m_response.ctl.data;
+    return COR_ERR_SDO_Access;
+    }
+  if ((m_response.end.control & SDO_BlockSubMask) != SDO_BlockEnd)
+    {
+    AbortSDORequest(SDO_Abort_CommandInvalid);
+    m_job.sdo.error = SDO_Abort_CommandInvalid;
+    return COR_ERR_SDO_SegMismatch;
+    }
+  
+  // commit last segment:
+  size_t dlen = 7 - ((m_response.end.control & SDO_BlockUnusedMask) >> 2);
+  if (have_held)
+    {
+    size_t n = MIN(dlen, m_job.sdo.bufsize - m_job.sdo.xfersize);
+    memcpy(buf, held, n);
+    m_job.sdo.xfersize += n;
+    if (crc_enabled)
+      crc = SDOBlockCRC(crc, held, dlen);
+    if (n < dlen)
+      {
+      ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: buffer too small, readlen=%d",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.xfersize);
+      AbortSDORequest(SDO_Abort_OutOfMemory);
+      m_job.sdo.error = SDO_Abort_OutOfMemory;
+      return COR_ERR_BufferTooSmall;
+      }
+    }
+  
+  // check CRC:
+  if (crc_enabled && crc != m_response.end.crc)
+    {
+    ESP_LOGD(TAG, "ReadSDO #%d 0x%04x.%02x: CRC error, got %04x, expected %04x",
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, crc, m_response.end.crc);
+    AbortSDORequest(SDO_Abort_CRC);
+    m_job.sdo.error = SDO_Abort_CRC;
+    return COR_ERR_SDO_CRC;
+    }
+  
+  // confirm end:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.end.control = SDO_BlockUploadRequest | SDO_BlockEnd;
+  SendSDORequest();
+  return COR_OK;
+  }
+
+
+/**
+ * DownloadSDOBlock: write SDO using the block transfer protocol (CiA 301 7.2.4.3.9)
+ *   - called by ProcessWriteSDOJob(), see there for buffer & result handling
+ *   - returns COR_WAIT if the job shall continue with a normal download
+ *     (the server doesn't support block transfers)
+ */
+CANopenResult_t CANopenChannel::DownloadSDOBlock()
+  {
+  TickType_t maxwait = pdMS_TO_TICKS(m_job.timeout_ms);
+  size_t size = m_job.sdo.bufsize;
+  
+  // request block download:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.exp.control = SDO_BlockDownloadRequest | SDO_BlockCRC | SDO_BlockSizeIndicated | SDO_BlockInit;
+  m_request.exp.index = m_job.sdo.index;
+  m_request.exp.subindex = m_job.sdo.subindex;
+  m_request.ctl.data = size;
+  if (ExecuteSDORequest() != COR_OK)
+    {
+    // node offline or ignoring block requests; try normal download once:
+    return COR_WAIT;
+    }
+  
+  // check response:
+  if ((m_response.exp.control & (SDO_CommandMask|SDO_BlockSubMask)) != (SDO_BlockDownloadResponse|SDO_BlockInit)
+    || m_response.exp.index != m_request.exp.index
+    || m_response.exp.subindex != m_request.exp.subindex)
+    {
+    if ((m_response.exp.control & SDO_CommandMask) == SDO_Abort)
+      {
+      if (m_response.ctl.data == SDO_Abort_CommandInvalid)
+        {
+        ESP_LOGD(TAG, "WriteSDO #%d: no block transfer support, using segmented transfers", m_job.sdo.nodeid);
+        m_worker->SetBlockCapable(m_job.sdo.nodeid, false);
+        return COR_WAIT;
+        }
+      m_job.sdo.error = m_response.ctl.data;
+      }
+    else
+      m_job.sdo.error = CANopen_BusCollision;
+    ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: InitBlockDownload failed, CANopen error code 0x%08" PRIx32,
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return COR_ERR_SDO_Access;
+    }
+  
+  bool crc_enabled = (m_response.exp.control & SDO_BlockCRC) != 0;
+  uint8_t blksize = m_response.exp.data[0];
+  if (blksize < 1 || blksize > 127)
+    {
+    AbortSDORequest(SDO_Abort_BlockSize);
+    m_job.sdo.error = SDO_Abort_BlockSize;
+    return COR_ERR_SDO_Access;
+    }
+  
+  // send blocks:
+  //  m_job.sdo.xfersize = data acknowledged by the server
+  uint8_t seqno;
+  size_t offset;
+  m_job.trycnt = 0;
+  while (m_job.sdo.xfersize < size)
+    {
+    xQueueReset(m_rxqueue);
+    offset = m_job.sdo.xfersize;
+    for (seqno = 1; seqno <= blksize && offset < size; seqno++)
+      {
+      size_t n = MIN(7, size - offset);
+      m_request.blk.control = seqno;
+      if (offset + n == size)
+        m_request.blk.control |= SDO_BlockLastSegment;
+      memcpy(m_request.blk.data, m_job.sdo.buf + offset, n);
+      memset(m_request.blk.data + n, 0, 7 - n);
+      if (SendSDORequest(maxwait) == ESP_FAIL)
+        break; // TX queue full: let the server request a repetition
+      offset += n;
+      }
+    
+    // wait for acknowledge:
+    if (!WaitResponse(maxwait))
+      {
+      AbortSDORequest(SDO_Abort_Timeout);
+      m_job.sdo.error = SDO_Abort_Timeout;
+      return COR_ERR_Timeout;
+      }
+    if (m_response.ack.control == SDO_Abort)
+      {
+      m_job.sdo.error = m_response.ctl.data;
+      ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: block download aborted by server, CANopen error code 0x%08" PRIx32,
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+      return COR_ERR_SDO_Access;
+      }
+    if (m_response.ack.control != (SDO_BlockDownloadResponse|SDO_BlockAck)
+      || m_response.ack.ackseq >= seqno
+      || m_response.ack.blksize < 1 || m_response.ack.blksize > 127)
+      {
+      ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: invalid block acknowledge, xfersize=%d",
+        m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.xfersize);
+      AbortSDORequest(SDO_Abort_SeqNo);
+      m_job.sdo.error = SDO_Abort_SeqNo;
+      return COR_ERR_SDO_SegMismatch;
+      }
+    
+    // repetition needed?
+    if (m_response.ack.ackseq < seqno - 1 && ++m_job.trycnt > m_job.maxtries)
+      {
+      AbortSDORequest(SDO_Abort_SeqNo);
+      m_job.sdo.error = SDO_Abort_SeqNo;
+      return COR_ERR_SDO_SegMismatch;
+      }
+    m_job.sdo.xfersize = MIN(size, m_job.sdo.xfersize + 7 * m_response.ack.ackseq);
+    blksize = m_response.ack.blksize;
+    }
+  
+  // end transfer:
+  memset(&m_request, 0, sizeof(m_request));
+  m_request.end.control = SDO_BlockDownloadRequest | SDO_BlockEnd | (((7 - size % 7) % 7) << 2);
+  if (crc_enabled)
+    m_request.end.crc = SDOBlockCRC(0, m_job.sdo.buf, size);
+  if (ExecuteSDORequest() != COR_OK)
+    {
+    m_job.sdo.error = SDO_Abort_Timeout;
+    return COR_ERR_Timeout;
+    }
+  if (m_response.end.control != (SDO_BlockDownloadResponse|SDO_BlockEnd))
+    {
+    if ((m_response.end.control & SDO_CommandMask) == SDO_Abort)
+      m_job.sdo.error = m_response.ctl.data;
+    else
+      m_job.sdo.error = CANopen_BusCollision;
+    ESP_LOGD(TAG, "WriteSDO #%d 0x%04x.%02x: EndBlockDownload failed, CANopen error code 0x%08" PRIx32,
+      m_job.sdo.nodeid, m_job.sdo.index, m_job.sdo.subindex, m_job.sdo.error);
+    return (m_job.sdo.error == SDO_Abort_CRC) ? COR_ERR_SDO_CRC : COR_ERR_SDO_Access;
+    }
+  
+  return COR_OK;
+  }
@@ -28,7 +28,25 @@
 ; THE SOFTWARE.
 */
 
+#include "ovms_log.h"
+static const char *TAG = "esp32adc";
+
+#include <stdlib.h>
+#include <string.h>
 #include "esp32adc.h"
+#if ESP_IDF_VERSION_MAJOR < 5
+#include <driver/i2s.h>
+#endif
+#include "ovms.h"
+#include "ovms_command.h"
+#include "ovms_config.h"
+#include "ovms_events.h"
+#include "ovms_peripherals.h"
+#include "ovms_utils.h"
+
+#if ESP_IDF_VERSION_MAJOR < 5
+#define ADC_I2S_NUM             I2S_NUM_0   // only I2S0 can be routed to the built in ADC
+#endif
 
 esp32adc::esp32adc(const char* name, adc1_channel_t channel, adc_bits_width_t width, adc_atten_t attn)
   : pcp(name)
@@ -39,13 +57,565 @@ esp32adc::esp32adc(const char* name, adc1_channel_t channel, adc_bits_width_t wi
 
   adc1_config_width(width);
   adc1_config_channel_atten(channel,attn);
+
+  m_factor = 195.7;
+  m_threshold = 0;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  m_dma = NULL;
+#endif
+  m_task = NULL;
+  m_running = false;
+  m_lastread = 0;
+  memset(&m_cur, 0, sizeof(m_cur));
+  memset(&m_last, 0, sizeof(m_last));
+  memset(m_pre, 0, sizeof(m_pre));
+  m_prepos = 0;
+  m_capture = NULL;
+  m_active = NULL;
+  m_activepos = 0;
+  m_captureseq = 0;
+  m_trigger = false;
+
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&esp32adc::ConfigChanged, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "config.mounted", std::bind(&esp32adc::ConfigChanged, this, _1, _2));
+  ConfigChanged("config.mounted", NULL);
   }
 
 esp32adc::~esp32adc()
   {
+  MyEvents.DeregisterEvent(TAG);
+  StopSampling();
+  if (m_capture)
+    free(m_capture);
+  }
+
+/**
+ * ConfigChanged: cache the conversion parameters, so the sampler needn't access the config
+ */
+void esp32adc::ConfigChanged(std::string event, void* data)
+  {
+  OvmsConfigParam* param = (OvmsConfigParam*) data;
+  if (param && param->GetName() != "system.adc")
+    return;
+
+  float f = MyConfig.GetParamValueFloat("system.adc", "factor12v");
+  if (f == 0) f = 195.7;
+  m_factor = f;
+
+  float threshold = MyConfig.GetParamValueFloat("system.adc", "capture.threshold", 1.0);
+  m_threshold = (uint16_t) LIMIT_MAX(threshold * m_factor * ADC_OVERSAMPLING, 65535);
+
+  bool sampling = MyConfig.GetParamValueBool("system.adc", "sampling", true);
+  if (sampling && !m_task && m_powermode != Sleep && m_powermode != DeepSleep && m_powermode != Off)
+    StartSampling();
+  else if (!sampling && m_task)
+    StopSampling();
+  }
+
+void esp32adc::SetPowerMode(PowerMode powermode)
+  {
+  pcp::SetPowerMode(powermode);
+  switch (powermode)
+    {
+    case On:
+      if (MyConfig.GetParamValueBool("system.adc", "sampling", true))
+        StartSampling();
+      break;
+    case Sleep:
+    case DeepSleep:
+    case Off:
+      StopSampling();
+      break;
+    default:
+      break;
+    }
   }
 
 int esp32adc::read()
   {
-  return adc1_get_raw(m_channel);
+  if (m_task)
+    {
+    // the ADC is owned by the sampler, return the average of the last second,
+    // or the last good reading until the first second has been sampled:
+    esp32adc_stats_t stats;
+    if (GetStats(stats))
+      m_lastread = (stats.sum / stats.cnt + ADC_OVERSAMPLING/2) / ADC_OVERSAMPLING;
+    return m_lastread;
+    }
+  m_lastread = adc1_get_raw(m_channel);
+  return m_lastread;
+  }
+
+float esp32adc::ReadVoltage()
+  {
+  return (float)read() / m_factor;
+  }
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+
+/**
+ * StartDMA / StopDMA / ReadDMA: continuous conversion driver (IDF >= 5)
+ */
+esp_err_t esp32adc::StartDMA()
+  {
+  adc_continuous_handle_cfg_t hcfg = {};
+  hcfg.max_store_buf_size = ADC_DMA_BUF_COUNT * ADC_DMA_BUF_LEN * SOC_ADC_DIGI_RESULT_BYTES;
+  hcfg.conv_frame_size = ADC_DMA_BUF_LEN * SOC_ADC_DIGI_RESULT_BYTES;
+  esp_err_t err = adc_continuous_new_handle(&hcfg, &m_dma);
+  if (err != ESP_OK)
+    {
+    m_dma = NULL;
+    return err;
+    }
+
+  adc_digi_pattern_config_t pattern = {};
+  pattern.atten = m_attn;
+  pattern.channel = m_channel;
+  pattern.unit = ADC_UNIT_1;
+  pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+
+  adc_continuous_config_t cfg = {};
+  cfg.pattern_num = 1;
+  cfg.adc_pattern = &pattern;
+  cfg.sample_freq_hz = ADC_SAMPLE_RATE;
+  cfg.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  cfg.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+
+  err = adc_continuous_config(m_dma, &cfg);
+  if (err == ESP_OK)
+    err = adc_continuous_start(m_dma);
+  if (err != ESP_OK)
+    {
+    adc_continuous_deinit(m_dma);
+    m_dma = NULL;
+    }
+  return err;
+  }
+
+void esp32adc::StopDMA()
+  {
+  if (!m_dma)
+    return;
+  adc_continuous_stop(m_dma);
+  adc_continuous_deinit(m_dma);
+  m_dma = NULL;
+  }
+
+bool esp32adc::ReadDMA(uint16_t* buf, size_t size, size_t* len)
+  {
+  uint32_t rlen = 0;
+  if (adc_continuous_read(m_dma, (uint8_t*)buf, size, &rlen, 100) != ESP_OK)
+    return false;
+  *len = rlen;
+  return true;
+  }
+
+#else
+
+/**
+ * StartDMA / StopDMA / ReadDMA: I2S ADC mode driver (IDF < 5)
+ */
+esp_err_t esp32adc::StartDMA()
+  {
+  i2s_config_t cfg = {};
+  cfg.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN);
+  cfg.sample_rate = ADC_SAMPLE_RATE;
+  cfg.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  cfg.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(4, 2, 0)
+  cfg.communication_format = I2S_COMM_FORMAT_STAND_MSB;
+#else
+  cfg.communication_format = I2S_COMM_FORMAT_I2S_MSB;
+#endif
+  cfg.intr_alloc_flags = 0;
+  cfg.dma_buf_count = ADC_DMA_BUF_COUNT;
+  cfg.dma_buf_len = ADC_DMA_BUF_LEN;
+  cfg.use_apll = false;
+
+  esp_err_t err = i2s_driver_install(ADC_I2S_NUM, &cfg, 0, NULL);
+  if (err == ESP_OK)
+    err = i2s_set_adc_mode(ADC_UNIT_1, m_channel);
+  if (err == ESP_OK)
+    err = i2s_adc_enable(ADC_I2S_NUM);
+  if (err != ESP_OK)
+    i2s_driver_uninstall(ADC_I2S_NUM);
+  return err;
+  }
+
+void esp32adc::StopDMA()
+  {
+  i2s_adc_disable(ADC_I2S_NUM);
+  i2s_driver_uninstall(ADC_I2S_NUM);
+  }
+
+bool esp32adc::ReadDMA(uint16_t* buf, size_t size, size_t* len)
+  {
+  return (i2s_read(ADC_I2S_NUM, buf, size, len, pdMS_TO_TICKS(100)) == ESP_OK);
+  }
+
+#endif // ESP_IDF_VERSION_MAJOR >= 5
+
+/**
+ * StartSampling: continuous conversion of the channel by the ADC DMA engine
+ */
+bool esp32adc::StartSampling()
+  {
+  if (m_task)
+    return true;
+
+  if (!m_capture)
+    {
+    m_capture = (esp32adc_capture_t*) ExternalRamMalloc(ADC_CAPTURE_SLOTS * sizeof(esp32adc_capture_t));
+    if (!m_capture)
+      {
+      ESP_LOGE(TAG, "StartSampling: unable to allocate capture buffers");
+      return false;
+      }
+    memset(m_capture, 0, ADC_CAPTURE_SLOTS * sizeof(esp32adc_capture_t));
+    }
+
+  esp_err_t err = StartDMA();
+  if (err != ESP_OK)
+    {
+    ESP_LOGE(TAG, "StartSampling: ADC DMA setup failed: %s", esp_err_to_name(err));
+    adc1_config_width(m_width);
+    adc1_config_channel_atten(m_channel, m_attn);
+    return false;
+    }
+
+  memset(&m_cur, 0, sizeof(m_cur));
+  m_cur.min = UINT16_MAX;
+  m_active = NULL;
+  m_running = true;
+  xTaskCreatePinnedToCore(SamplingTask, "OVMS ADC", 4*1024, (void*)this, 15, &m_task, CORE(1));
+  if (!m_task)
+    {
+    ESP_LOGE(TAG, "StartSampling: unable to create task");
+    m_running = false;
+    StopDMA();
+    adc1_config_width(m_width);
+    adc1_config_channel_atten(m_channel, m_attn);
+    return false;
+    }
+
+  ESP_LOGI(TAG, "Continuous sampling started (%d Hz, %dx oversampling)",
+    ADC_SAMPLE_RATE, ADC_OVERSAMPLING);
+  return true;
+  }
+
+void esp32adc::StopSampling()
+  {
+  if (!m_task)
+    return;
+
+  // let the task finish its current DMA read:
+  m_running = false;
+  while (m_task)
+    vTaskDelay(pdMS_TO_TICKS(10));
+
+  StopDMA();
+
+  // hand the ADC back to single conversion reads:
+  adc1_config_width(m_width);
+  adc1_config_channel_atten(m_channel, m_attn);
+
+  OvmsMutexLock lock(&m_mutex);
+  memset(&m_last, 0, sizeof(m_last));
+  if (m_active)
+    {
+    m_active->seq = 0;
+    m_active = NULL;
+    }
+  ESP_LOGI(TAG, "Continuous sampling stopped");
+  }
+
+void esp32adc::SamplingTask(void* pvParameters)
+  {
+  esp32adc* me = (esp32adc*)pvParameters;
+  me->Sampling();
+  me->m_task = NULL;
+  vTaskDelete(NULL);
+  }
+
+void esp32adc::Sampling()
+  {
+  uint16_t buf[ADC_DMA_BUF_LEN];
+  uint32_t acc = 0;
+  int acccnt = 0;
+  size_t len;
+
+  while (m_running)
+    {
+    if (!ReadDMA(buf, sizeof(buf), &len))
+      continue;
+    // The DMA delivers the 16 bit samples swapped in pairs (the order doesn't
+    // matter for the oversampling sums), the upper 4 bits carry the channel:
+    len /= sizeof(uint16_t);
+    for (size_t i = 0; i+1 < len; i += 2)
+      {
+      acc += (buf[i+1] & 0x0fff) + (buf[i] & 0x0fff);
+      acccnt += 2;
+      if (acccnt >= ADC_OVERSAMPLING)
+        {
+        ProcessSample(acc);
+        acc = 0;
+        acccnt = 0;
+        }
+      }
+    }
+  }
+
+/**
+ * ProcessSample: per second statistics & transient capture of a decimated sample
+ */
+void esp32adc::ProcessSample(uint16_t sample)
+  {
+  // Statistics:
+  if (sample < m_cur.min) m_cur.min = sample;
+  if (sample > m_cur.max) m_cur.max = sample;
+  m_cur.sum += sample;
+  if (++m_cur.cnt == ADC_DECIMATED_RATE)
+    {
+    m_mutex.Lock();
+    m_last = m_cur;
+    m_mutex.Unlock();
+    memset(&m_cur, 0, sizeof(m_cur));
+    m_cur.min = UINT16_MAX;
+    }
+
+  // Capture in progress?
+  if (m_active)
+    {
+    m_active->sample[m_activepos++] = sample;
+    if (m_activepos == ADC_CAPTURE_LEN)
+      {
+      uint16_t min = UINT16_MAX, max = 0;
+      for (int i = 0; i < ADC_CAPTURE_LEN; i++)
+        {
+        if (m_active->sample[i] < min) min = m_active->sample[i];
+        if (m_active->sample[i] > max) max = m_active->sample[i];
+        }
+      m_mutex.Lock();
+      m_active->min = min;
+      m_active->max = max;
+      m_active->seq = ++m_captureseq;
+      m_active = NULL;
+      m_mutex.Unlock();
+      ESP_LOGI(TAG, "Capture #%" PRIu32 ": min %.2fV max %.2fV", m_captureseq, ToVoltage(min), ToVoltage(max));
+      MyEvents.SignalEvent("system.adc.capture", NULL);
+      }
+    return;
+    }
+
+  // Trigger on deviation from the last second average:
+  bool trigger = m_trigger;
+  uint16_t baseline = 0;
+  if (m_last.cnt)
+    {
+    baseline = m_last.sum / m_last.cnt;
+    if (m_threshold && abs((int)sample - (int)baseline) > m_threshold)
+      trigger = true;
+    }
+
+  if (trigger && m_capture)
+    {
+    m_mutex.Lock();
+    m_active = &m_capture[m_captureseq % ADC_CAPTURE_SLOTS];
+    m_active->seq = 0;
+    m_mutex.Unlock();
+    m_active->time = time(NULL);
+    m_active->manual = m_trigger;
+    m_active->baseline = baseline;
+    // copy pre trigger history, oldest first:
+    for (int i = 0; i < ADC_CAPTURE_PRE; i++)
+      m_active->sample[i] = m_pre[(m_prepos + i) % ADC_CAPTURE_PRE];
+    m_active->sample[ADC_CAPTURE_PRE] = sample;
+    m_activepos = ADC_CAPTURE_PRE + 1;
+    m_trigger = false;
+    }
+
+  m_pre[m_prepos] = sample;
+  m_prepos = (m_prepos + 1) % ADC_CAPTURE_PRE;
+  }
+
+bool esp32adc::GetStats(esp32adc_stats_t& stats)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  stats = m_last;
+  return (stats.cnt != 0);
+  }
+
+/**
+ * GetCapture: copy a completed capture, seq 0 = latest
+ */
+bool esp32adc::GetCapture(uint32_t seq, esp32adc_capture_t* capture)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  if (!m_capture || m_captureseq == 0)
+    return false;
+  if (seq == 0)
+    seq = m_captureseq;
+  esp32adc_capture_t* slot = &m_capture[(seq-1) % ADC_CAPTURE_SLOTS];
+  if (slot->seq != seq)
+    return false;
+  memcpy(capture, slot, sizeof(esp32adc_capture_t));
+  return true;
+  }
+
+void esp32adc::ClearCaptures()
+  {
+  OvmsMutexLock lock(&m_mutex);
+  if (!m_capture)
+    return;
+  for (int i = 0; i < ADC_CAPTURE_SLOTS; i++)
+    {
+    if (&m_capture[i] != m_active)
+      m_capture[i].seq = 0;
+    }
+  }
+
+
+/**
+ * Commands
+ */
+
+static void adc_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  esp32adc* me = MyPeripherals->m_esp32adc;
+  if (!me->IsSampling())
+    {
+    writer->printf("Continuous sampling: stopped\nADC reading: %d = %.2fV\n", me->read(), me->ReadVoltage());
+    return;
+    }
+
+  writer->printf("Continuous sampling: %d Hz, %dx oversampling\n", ADC_SAMPLE_RATE, ADC_OVERSAMPLING);
+  esp32adc_stats_t stats;
+  if (me->GetStats(stats))
+    {
+    writer->printf("Last second: avg %.3fV min %.3fV max %.3fV (%" PRIu32 " samples)\n",
+      me->ToVoltage((float)stats.sum / stats.cnt), me->ToVoltage(stats.min), me->ToVoltage(stats.max), stats.cnt);
+    }
+  if (me->GetThreshold() > 0)
+    writer->printf("Capture trigger: ±%.2fV\n", me->GetThreshold());
+  else
+    writer->puts("Capture trigger: off");
+  writer->printf("Captures: %" PRIu32 "\n", me->GetCaptureCount());
+  }
+
+static void adc_start(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (MyPeripherals->m_esp32adc->StartSampling())
+    writer->puts("Continuous sampling started");
+  else
+    writer->puts("ERROR: sampling could not be started (see log)");
+  }
+
+static void adc_stop(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPeripherals->m_esp32adc->StopSampling();
+  writer->puts("Continuous sampling stopped");
+  }
+
+static void adc_capture_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  esp32adc* me = MyPeripherals->m_esp32adc;
+  esp32adc_capture_t* capture = (esp32adc_capture_t*) ExternalRamMalloc(sizeof(esp32adc_capture_t));
+  if (!capture)
+    return;
+  int cnt = 0;
+  uint32_t last = me->GetCaptureCount();
+  for (uint32_t seq = last; seq > 0 && seq + ADC_CAPTURE_SLOTS > last; seq--)
+    {
+    if (!me->GetCapture(seq, capture))
+      continue;
+    struct tm tm;
+    char tb[32];
+    localtime_r(&capture->time, &tm);
+    strftime(tb, sizeof(tb), "%Y-%m-%d %H:%M:%S", &tm);
+    writer->printf("#%" PRIu32 " %s: baseline %.2fV min %.2fV max %.2fV%s\n", seq, tb,
+      me->ToVoltage(capture->baseline), me->ToVoltage(capture->min), me->ToVoltage(capture->max),
+      capture->manual ? " (manual)" : "");
+    cnt++;
+    }
+  if (cnt == 0)
+    writer->puts("No captures");
+  free(capture);
+  }
+
+static void adc_capture_show(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  esp32adc* me = MyPeripherals->m_esp32adc;
+  uint32_t seq = (argc > 0) ? atol(argv[0]) : 0;
+  int step = (argc > 1) ? atoi(argv[1]) * ADC_DECIMATED_RATE / 1000 : 20;
+  if (step < 1) step = 1;
+
+  esp32adc_capture_t* capture = (esp32adc_capture_t*) ExternalRamMalloc(sizeof(esp32adc_capture_t));
+  if (!capture)
+    return;
+  if (!me->GetCapture(seq, capture))
+    {
+    writer->puts("ERROR: capture not available");
+    free(capture);
+    return;
+    }
+
+  // Output min/max per step, dips & spikes shorter than the step stay visible:
+  writer->printf("Capture #%" PRIu32 ": baseline %.3fV, %d ms per line\n", capture->seq,
+    me->ToVoltage(capture->baseline), step * 1000 / ADC_DECIMATED_RATE);
+  writer->puts("t[ms],min[V],max[V]");
+  for (int i = 0; i < ADC_CAPTURE_LEN; i += step)
+    {
+    uint16_t min = UINT16_MAX, max = 0;
+    for (int j = i; j < i+step && j < ADC_CAPTURE_LEN; j++)
+      {
+      if (capture->sample[j] < min) min = capture->sample[j];
+      if (capture->sample[j] > max) max = capture->sample[j];
+      }
+    writer->printf("%.1f,%.3f,%.3f\n", (float)(i - ADC_CAPTURE_PRE) * 1000 / ADC_DECIMATED_RATE,
+      me->ToVoltage(min), me->ToVoltage(max));
+    }
+  free(capture);
+  }
+
+static void adc_capture_trigger(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  esp32adc* me = MyPeripherals->m_esp32adc;
+  if (!me->IsSampling())
+    {
+    writer->puts("ERROR: continuous sampling not running");
+    return;
+    }
+  me->TriggerCapture();
+  writer->puts("Capture triggered");
+  }
+
+static void adc_capture_clear(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPeripherals->m_esp32adc->ClearCaptures();
+  writer->puts("Captures cleared");
+  }
+
+class Esp32AdcInit
+  {
+  public: Esp32AdcInit();
+} MyEsp32AdcInit  __attribute__ ((init_priority (4300)));
+
+Esp32AdcInit::Esp32AdcInit()
+  {
+  ESP_LOGI(TAG, "Initialising ESP32 ADC (4300)");
+
+  OvmsCommand* cmd_adc = MyCommandApp.RegisterCommand("adc", "ADC 12V monitor", adc_status, "", 0, 0, false);
+  cmd_adc->RegisterCommand("status", "Show 12V monitor status", adc_status);
+  cmd_adc->RegisterCommand("start", "Start continuous sampling", adc_start);
+  cmd_adc->RegisterCommand("stop", "Stop continuous sampling", adc_stop);
+  OvmsCommand* cmd_capture = cmd_adc->RegisterCommand("capture", "12V transient captures", adc_capture_list);
+  cmd_capture->RegisterCommand("list", "List captures", adc_capture_list);
+  cmd_capture->RegisterCommand("show", "Show capture", adc_capture_show,
+    "[<nr> [<ms per line>]]\n"
+    "<nr>: capture number, default/0 = latest\n"
+    "<ms per line>: output resolution, default 10 ms", 0, 2);
+  cmd_capture->RegisterCommand("trigger", "Start capture now", adc_capture_trigger);
+  cmd_capture->RegisterCommand("clear", "Clear captures", adc_capture_clear);
   }
@@ -31,9 +31,52 @@
 #ifndef __ESP32ADC_H__
 #define __ESP32ADC_H__
 
+#include <string>
+#include <time.h>
 #include "esp_err.h"
+#include "esp_idf_version.h"
 #include <driver/adc.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_adc/adc_continuous.h>
+#endif
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "pcp.h"
+#include "ovms_mutex.h"
+
+// Continuous sampling (ADC DMA via I2S0):
+#define ADC_SAMPLE_RATE         20000     // Conversion rate [Hz] (ESP32 DMA mode lower limit)
+#define ADC_OVERSAMPLING        10        // Conversions summed per decimated sample
+#define ADC_DECIMATED_RATE      (ADC_SAMPLE_RATE / ADC_OVERSAMPLING)
+#define ADC_DMA_BUF_LEN         500       // Samples per DMA buffer (25 ms)
+#define ADC_DMA_BUF_COUNT       4
+
+// Transient capture:
+#define ADC_CAPTURE_PRE         200       // Decimated samples recorded before the trigger (100 ms)
+#define ADC_CAPTURE_LEN         2000      // Decimated samples per capture (1 second)
+#define ADC_CAPTURE_SLOTS       4
+
+// Decimated samples are sums of ADC_OVERSAMPLING raw conversions,
+// i.e. raw value × ADC_OVERSAMPLING with the extra resolution gained.
+
+typedef struct
+  {
+  uint16_t      min;
+  uint16_t      max;
+  uint32_t      sum;
+  uint32_t      cnt;
+  } esp32adc_stats_t;
+
+typedef struct
+  {
+  uint32_t      seq;                      // capture number, 0 = slot unused/in progress
+  time_t        time;                     // trigger time
+  bool          manual;                   // triggered by command
+  uint16_t      baseline;                 // average of the second before the trigger
+  uint16_t      min;
+  uint16_t      max;
+  uint16_t      sample[ADC_CAPTURE_LEN];
+  } esp32adc_capture_t;
 
 class esp32adc : public pcp, public InternalRamAllocated
   {
@@ -43,11 +86,55 @@ class esp32adc : public pcp, public InternalRamAllocated
 
   public:
     int read();
+    float ReadVoltage();
+    void SetPowerMode(PowerMode powermode);
+
+  public:
+    bool StartSampling();
+    void StopSampling();
+    bool IsSampling() { return m_task != NULL; }
+    bool GetStats(esp32adc_stats_t& stats);
+    float ToVoltage(float sample) { return sample / (ADC_OVERSAMPLING * m_factor); }
+    float GetThreshold() { return ToVoltage(m_threshold); }
+    uint32_t GetCaptureCount() { return m_captureseq; }
+    bool GetCapture(uint32_t seq, esp32adc_capture_t* capture);
+    void TriggerCapture() { m_trigger = true; }
+    void ClearCaptures();
+    void ConfigChanged(std::string event, void* data);
+
+  protected:
+    esp_err_t StartDMA();
+    void StopDMA();
+    bool ReadDMA(uint16_t* buf, size_t size, size_t* len);
+    static void SamplingTask(void* pvParameters);
+    void Sampling();
+    void ProcessSample(uint16_t sample);
 
   protected:
     adc_bits_width_t m_width;
     adc1_channel_t m_channel;
     adc_atten_t m_attn;
+
+    float m_factor;                       // cached system.adc/factor12v [raw / V]
+    uint16_t m_threshold;                 // capture trigger deviation [decimated], 0 = off
+    int m_lastread;                       // last good read() result [raw]
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+    adc_continuous_handle_t m_dma;
+#endif
+    TaskHandle_t m_task;
+    volatile bool m_running;
+    OvmsMutex m_mutex;                    // protects m_last & capture slots
+
+    esp32adc_stats_t m_cur;               // second in progress
+    esp32adc_stats_t m_last;              // last completed second
+    uint16_t m_pre[ADC_CAPTURE_PRE];      // pre trigger history ring
+    int m_prepos;
+    esp32adc_capture_t* m_capture;        // capture slots (PSRAM)
+    esp32adc_capture_t* m_active;         // capture in progress
+    int m_activepos;
+    uint32_t m_captureseq;
+    volatile bool m_trigger;
   };
 
 #endif //#ifndef __ESP32ADC_H__
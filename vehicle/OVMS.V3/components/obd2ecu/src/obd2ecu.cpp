@@ -34,6 +34,7 @@ static const char *TAG = "obd2ecu";
 
 #include <string.h>
 #include <dirent.h>
+#include <sys/stat.h>
 #include "obd2ecu.h"
 #include "ovms_script.h"
 #include "ovms_config.h"
@@ -48,6 +49,7 @@ obd2pid::obd2pid(int pid, pid_t type, OvmsMetric* metric)
   m_pid = pid;
   m_type = type;
   m_script = NULL;
+  m_script_mtime = 0;
   m_metric = metric;
   }
 
@@ -115,6 +117,11 @@ void obd2pid::LoadScript(std::string path)
   fread(m_script, 1, fsz, f);
   m_script[fsz] = 0;
 
+  // Path & mtime identify the script in the Duktape bytecode cache:
+  struct stat st;
+  m_script_path = path;
+  m_script_mtime = (fstat(fileno(f), &st) == 0) ? st.st_mtime : 0;
+
   fclose(f);
   }
 
@@ -133,7 +140,8 @@ float obd2pid::Execute()
     case Script:
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
       {
-      return MyDuktape.DuktapeEvalFloatResult(m_script);
+      if (!m_script) return 0;
+      return MyDuktape.DuktapeEvalFloatResult(m_script, NULL, m_script_path.c_str(), m_script_mtime);
       }
 #else // #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
       return 0;
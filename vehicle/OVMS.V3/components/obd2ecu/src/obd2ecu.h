@@ -70,6 +70,8 @@ class obd2pid
     int m_pid;
     pid_t m_type;
     char* m_script;
+    std::string m_script_path;
+    time_t m_script_mtime;
     OvmsMetric* m_metric;
   };
 
@@ -89,10 +89,15 @@ bool OvmsBuffer::Push(uint8_t *byte, size_t count)
   if ((m_size-m_used)<count) return false;
 
   m_used += count;
-  for (size_t k=0;k<count;k++)
+  while (count > 0)
     {
-    // ESP_LOGI(TAG, "Push() %02x at %d",byte[k],m_head);
-    m_buffer[m_head++] = byte[k];
+    // copy up to end of ring, then wrap:
+    size_t n = m_size - m_head;
+    if (n > count) n = count;
+    memcpy(m_buffer+m_head, byte, n);
+    byte += n;
+    count -= n;
+    m_head += n;
     if (m_head >= m_size) m_head=0;
     }
 
@@ -116,8 +121,14 @@ size_t OvmsBuffer::Pop(size_t count, uint8_t *dest)
 
   while ((m_used>0)&&(done < count))
     {
-    m_used--;
-    dest[done++] = m_buffer[m_tail++];
+    // copy up to end of ring, then wrap:
+    size_t n = m_size - m_tail;
+    if (n > m_used) n = m_used;
+    if (n > count-done) n = count-done;
+    memcpy(dest+done, m_buffer+m_tail, n);
+    done += n;
+    m_used -= n;
+    m_tail += n;
     if (m_tail >= m_size) m_tail=0;
     }
 
@@ -145,6 +156,30 @@ size_t OvmsBuffer::Peek(size_t count, uint8_t *dest)
   return done;
   }
 
+/**
+ * PeekSpan: get the contiguous region of data at the buffer tail (zero copy access)
+ *  Returns the region length (0 = buffer empty), use Skip() to consume the data.
+ *  If the data wraps around the buffer end, the remainder can be fetched by
+ *  another PeekSpan() after Skip().
+ */
+size_t OvmsBuffer::PeekSpan(uint8_t **data)
+  {
+  if (m_used==0) return 0;
+
+  size_t n = m_size - m_tail;
+  if (n > m_used) n = m_used;
+  *data = m_buffer + m_tail;
+  return n;
+  }
+
+void OvmsBuffer::Skip(size_t count)
+  {
+  if (count > m_used) count = m_used;
+  m_used -= count;
+  m_tail += count;
+  if (m_tail >= m_size) m_tail -= m_size;
+  }
+
 void OvmsBuffer::Diagnostics()
   {
   size_t hl = HasLine();
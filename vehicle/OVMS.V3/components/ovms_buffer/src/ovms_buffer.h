@@ -53,6 +53,8 @@ class OvmsBuffer
     size_t Pop(size_t count, uint8_t *dest);
     uint8_t Peek();
     size_t Peek(size_t count, uint8_t *dest);
+    size_t PeekSpan(uint8_t **data);
+    void Skip(size_t count);
     void Diagnostics();
 
   public:
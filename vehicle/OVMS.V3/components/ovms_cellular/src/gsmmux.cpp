@@ -157,8 +157,12 @@ void GsmMuxChannel::ProcessFrame(uint8_t* frame, size_t length, size_t iframepos
     case ChanOpen:
       if (frame[1] == (GSM_UIH + GSM_PF))
         {
-        for (size_t k=iframepos;k<length;k++)
-          m_buffer.Push(frame[k]);
+        // Try direct delivery (i.e. PPP data), else buffer for the line based handlers:
+        if (m_mux->m_modem->IncomingMuxPayload(this, frame+iframepos, length-iframepos))
+          break;
+        size_t n = length-iframepos;
+        if (n > m_buffer.FreeSpace()) n = m_buffer.FreeSpace();
+        m_buffer.Push(frame+iframepos, n);
         m_mux->m_modem->IncomingMuxData(this);
         }
       break;
@@ -179,7 +183,6 @@ GsmMux::GsmMux(modem* m, int channelcount, size_t maxframesize)
   m_framepos = 0;
   m_frameipos = 0;
   m_framelen = 0;
-  m_framemorelen = false;
   m_openchannels = 0;
   m_framingerrors = 0;
   m_lastgoodrxframe = 0;
@@ -226,7 +229,6 @@ void GsmMux::Shutdown()
   m_framepos = 0;
   m_frameipos = 0;
   m_framelen = 0;
-  m_framemorelen = false;
   m_openchannels = 0;
   m_framingerrors = 0;
   m_lastgoodrxframe = 0;
@@ -272,112 +274,175 @@ uint32_t GsmMux::GoodFrameAge()
   return (m_lastgoodrxframe > 0) ? (monotonictime-m_lastgoodrxframe) : 0;
   }
 
+/**
+ * gsm_frame_header: decode frame length from header
+ *  frame[0] = SOF, [1] = address, [2] = control, [3..4] = length
+ *  Returns false if the header is not complete yet.
+ */
+static inline bool gsm_frame_header(const uint8_t* frame, size_t avail, size_t& framelen, size_t& ipos)
+  {
+  if (avail < 4) return false;
+  if (frame[3] & GSM_EA)
+    {
+    framelen = (frame[3]>>1) + 6;   // SOF, ADDR, CTRL, LEN, FCS, SOF
+    ipos = 4;
+    }
+  else
+    {
+    if (avail < 5) return false;
+    framelen = (frame[3]>>1) + (frame[4]<<7) + 7;
+    ipos = 5;
+    }
+  return true;
+  }
+
 void GsmMux::Process(OvmsBuffer* buf)
   {
-  while (buf->UsedSpace()>0)
+  uint8_t* data;
+  size_t len;
+  while ((len = buf->PeekSpan(&data)) > 0)
     {
-    if (m_framepos == m_framesize)
-      {
-      // Overflow frame
-      ESP_LOGW(TAG, "Frame overflow (%d bytes)",m_framesize);
-      MyCommandApp.HexDump(TAG, "Frame head", (const char*)m_frame, 8*16);
-      m_framepos = 0;
-      m_framelen = 0;
-      m_framemorelen = false;
-      m_framingerrors++;
-      continue;
-      }
-    uint8_t b = buf->Pop();
-    if ((m_framepos == 0)&&(b != GSM0_SOF))
-      {
-      continue; // Skip to start of frame
-      }
-    if ((m_framepos == 1)&&(b == GSM0_SOF)) continue; // We found end of previous frame, so just skip it
-    // ESP_LOGI(TAG, "Got %02x at %d (length sofar = %d)",b,m_framepos,m_framelen);
-    m_frame[m_framepos++] = b;
-    if (m_framepos == 4)
+    Process(data, len);
+    buf->Skip(len);
+    }
+  }
+
+/**
+ * Process: scan a contiguous region of the modem stream for frames
+ *  Frames completely contained in the region are processed in place,
+ *  only frames spanning multiple regions are reassembled in m_frame.
+ */
+void GsmMux::Process(uint8_t* data, size_t len)
+  {
+  uint8_t* end = data + len;
+  size_t framelen, ipos;
+
+  while (data < end)
+    {
+    if (m_framepos == 0)
       {
-      // First byte of length field
-      m_framemorelen = !(b & GSM_EA);
-      m_framelen = (b>>1);
-      if (!m_framemorelen)
+      // Skip to start of frame, skip end of previous frame / fill flags:
+      uint8_t* sof = (uint8_t*) memchr(data, GSM0_SOF, end-data);
+      if (!sof) return;
+      data = sof;
+      while ((data+1 < end) && (data[1] == GSM0_SOF)) data++;
+
+      size_t avail = end - data;
+      bool header = gsm_frame_header(data, avail, framelen, ipos);
+      if (header && framelen > m_framesize)
         {
-        m_framelen += (m_framepos+2);
-        m_frameipos = m_framepos;
+        FrameOverflow(framelen);
+        data++;
+        continue;
         }
-      else
+      if (header && framelen <= avail)
         {
-        m_framelen += (m_framepos+3);
-        m_frameipos = m_framepos+1;
+        // We have a complete frame...
+        if (data[framelen-1] == GSM0_SOF)
+          ProcessFrame(data, framelen, ipos);
+        else
+          FrameError(data, framelen);
+        data += framelen;
+        continue;
         }
-      // ESP_LOGI(TAG, "Frame length (first byte) = %d",m_framelen);
-      }
-    if ((m_framepos == 5)&&(m_framemorelen))
-      {
-      // Second byte of length field
-      m_framelen += (b<<7);
-      m_framemorelen = false;
-      // ESP_LOGI(TAG, "Frame length (second byte) = %d",m_framelen);
+
+      // Frame continues in next region, start reassembly:
+      memcpy(m_frame, data, avail);
+      m_framepos = avail;
+      if (header)
+        {
+        m_framelen = framelen;
+        m_frameipos = ipos;
+        }
+      return;
       }
-    if (m_framepos == m_framelen)
+    else if (m_framelen == 0)
       {
-      if (b == GSM0_SOF)
+      // Reassembly: complete header
+      uint8_t b = *data++;
+      if ((m_framepos == 1)&&(b == GSM0_SOF)) continue; // We found end of previous frame, so just skip it
+      m_frame[m_framepos++] = b;
+      if (gsm_frame_header(m_frame, m_framepos, framelen, ipos))
         {
-        // We have a complete frame...
-        ProcessFrame();
+        if (framelen > m_framesize)
+          {
+          FrameOverflow(framelen);
+          ResetFrame();
+          continue;
+          }
+        m_framelen = framelen;
+        m_frameipos = ipos;
         }
-      else
+      }
+    else
+      {
+      // Reassembly: collect frame body
+      size_t n = m_framelen - m_framepos;
+      if (n > (size_t)(end - data)) n = end - data;
+      memcpy(m_frame+m_framepos, data, n);
+      m_framepos += n;
+      data += n;
+      if (m_framepos == m_framelen)
         {
-        // Frame error:
-        int channel = m_frame[1] >> 2;
-        ESP_LOGW(TAG, "Frame error: EOF mismatch (CHAN=%d, ADDR=%02x, CTRL=%02x, FCS=%02x, LEN=%d)",
-          channel, m_frame[1], m_frame[2], m_frame[m_framelen-2], m_framelen);
-        MyCommandApp.HexDump(TAG, "Frame dump", (const char*)m_frame, m_framelen);
-        // find next frame:
-        m_framepos = 0;
-        m_framelen = 0;
-        m_framemorelen = false;
-        m_framingerrors++;
+        if (m_frame[m_framelen-1] == GSM0_SOF)
+          ProcessFrame(m_frame, m_framelen, m_frameipos);
+        else
+          FrameError(m_frame, m_framelen);
+        ResetFrame();
         }
       }
     }
   }
 
-void GsmMux::ProcessFrame()
+void GsmMux::ProcessFrame(uint8_t* frame, size_t framelen, size_t ipos)
   {
-  int channel = m_frame[1] >>2;
+  int channel = frame[1] >>2;
 
   ESP_LOGV(TAG, "ProcessFrame(CHAN=%d, ADDR=%02x, CTRL=%02x, FCS=%02x, LEN=%d)",
-    channel, m_frame[1], m_frame[2], m_frame[m_framelen-2], m_framelen);
+    channel, frame[1], frame[2], frame[framelen-2], framelen);
 
-  uint8_t fcs = 0xFF - gsm_fcs_add_block(FCS_INIT, m_frame+1, m_frameipos-1);
-  if (fcs != m_frame[m_framelen-2])
+  // Note: the FCS only covers the header (address, control & length), not the payload
+  uint8_t fcs = 0xFF - gsm_fcs_add_block(FCS_INIT, frame+1, ipos-1);
+  if (fcs != frame[framelen-2])
     {
-    ESP_LOGW(TAG, "FCS mismatch (%02x != %02x)",fcs,m_frame[m_framelen-2]);
-    m_framepos = 0;
-    m_frameipos = 0;
-    m_framelen = 0;
+    ESP_LOGW(TAG, "FCS mismatch (%02x != %02x)",fcs,frame[framelen-2]);
     m_framingerrors++;
-    m_framemorelen = false;
     return;
     }
 
-  GsmMuxChannel* chan = m_channels[channel];
+  GsmMuxChannel* chan = (channel < (int)m_channels.size()) ? m_channels[channel] : NULL;
   if (chan)
     {
     m_lastgoodrxframe = monotonictime;
     m_rxframecount++;
-    chan->ProcessFrame(m_frame+1,m_framelen-3,m_frameipos-1);
+    chan->ProcessFrame(frame+1,framelen-3,ipos-1);
     }
   else
     {
     ESP_LOGW(TAG, "Incoming message for unrecognised channel #%d",channel);
     }
+  }
+
+void GsmMux::FrameError(uint8_t* frame, size_t framelen)
+  {
+  int channel = frame[1] >> 2;
+  ESP_LOGW(TAG, "Frame error: EOF mismatch (CHAN=%d, ADDR=%02x, CTRL=%02x, FCS=%02x, LEN=%d)",
+    channel, frame[1], frame[2], frame[framelen-2], framelen);
+  MyCommandApp.HexDump(TAG, "Frame dump", (const char*)frame, framelen);
+  m_framingerrors++;
+  }
 
+void GsmMux::FrameOverflow(size_t framelen)
+  {
+  ESP_LOGW(TAG, "Frame overflow (%d bytes, max %d)",framelen,m_framesize);
+  m_framingerrors++;
+  }
+
+void GsmMux::ResetFrame()
+  {
   m_framepos = 0;
   m_frameipos = 0;
   m_framelen = 0;
-  m_framemorelen = false;
   }
 
 void GsmMux::txfcs(uint8_t* data, size_t size, size_t ipos)
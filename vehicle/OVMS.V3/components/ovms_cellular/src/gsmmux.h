@@ -76,7 +76,8 @@ class GsmMux : public InternalRamAllocated
     void StartChannel(int channel);
     void StopChannel(int channel);
     void Process(OvmsBuffer* buf);
-    void ProcessFrame();
+    void Process(uint8_t* data, size_t len);
+    void ProcessFrame(uint8_t* frame, size_t framelen, size_t ipos);
     size_t tx(int channel, uint8_t* data, ssize_t size);
     size_t tx(int channel, const char* data, ssize_t size = -1);
     bool IsChannelOpen(int channel);
@@ -85,6 +86,9 @@ class GsmMux : public InternalRamAllocated
 
   protected:
     void txfcs(uint8_t* data, size_t size, size_t ipos = 4);
+    void FrameError(uint8_t* frame, size_t framelen);
+    void FrameOverflow(size_t framelen);
+    void ResetFrame();
 
   public:
     enum GsmMuxState
@@ -111,7 +115,6 @@ class GsmMux : public InternalRamAllocated
     size_t m_framepos;
     size_t m_frameipos;
     size_t m_framelen;
-    bool m_framemorelen;
     std::vector<GsmMuxChannel*> m_channels;
   };
 
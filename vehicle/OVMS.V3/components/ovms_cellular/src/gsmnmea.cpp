@@ -33,7 +33,7 @@
 static const char *TAG = "gsm-nmea";
 
 #include <string>
-#include <sstream>
+#include <string.h>
 
 #include "gsmnmea.h"
 #include "ovms_command.h"
@@ -99,41 +99,134 @@ static int64_t utc_to_timestamp(const char* date, const char* time)
   }
 
 
-static bool valid_nmea_cksum(const std::string line)
+/**
+ * NmeaSentence: in-place NMEA 0183 tokenizer
+ *  Splits a sentence into field spans pointing into the line buffer and validates
+ *  the checksum in the same pass, so parsing a sentence needs no heap allocation.
+ *  Field 0 is the address ("GNGNS"), the checksum is not included in the fields.
+ *  Numeric fields can be converted directly by atof()/atoi() on the span pointer,
+ *  as every field is terminated by ',' or '*'.
+ */
+#define NMEA_MAX_FIELDS   24
+
+struct NmeaSentence
   {
-  const char *cp = line.c_str();
-  if (*cp != '$')
-    return 0;
-  ++cp;
-  const char *ep = strchr(cp, '*');
-  if (ep == NULL)
-    return 0;
-  unsigned char chk = 0;
-  while (cp < ep)
-    chk ^= (const unsigned char)*cp++;
-  unsigned char chk2 = (unsigned char)strtoul(ep + 1, NULL, 16);
-  return (chk == chk2);
+  int           count;
+  const char*   field[NMEA_MAX_FIELDS];
+  uint16_t      flen[NMEA_MAX_FIELDS];
+
+  bool Parse(const char* line, size_t len)
+    {
+    const char* end = line + len;
+    count = 0;
+    if (len < 9 || *line != '$')
+      return false;
+    const char* cp = line + 1;
+    unsigned char chk = 0;
+    field[0] = cp;
+    while (cp < end && *cp != '*')
+      {
+      chk ^= (unsigned char)*cp;
+      if (*cp == ',')
+        {
+        if (count < NMEA_MAX_FIELDS-1)
+          {
+          flen[count] = cp - field[count];
+          field[++count] = cp + 1;
+          }
+        }
+      ++cp;
+      }
+    if (end - cp < 3)
+      return false; // no or truncated checksum
+    flen[count] = cp - field[count];
+    count++;
+    int hi = hexval(cp[1]), lo = hexval(cp[2]);
+    return (hi >= 0 && lo >= 0 && chk == ((hi << 4) | lo));
+    }
+
+  static inline int hexval(char c)
+    {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+    }
+
+  inline bool IsType(const char* type) const
+    {
+    return (flen[0] == 5 && memcmp(field[0]+2, type, 3) == 0);
+    }
+  inline bool Has(int i) const
+    {
+    return (i < count && flen[i] > 0);
+    }
+  inline char Char(int i, int pos=0) const
+    {
+    return (i < count && flen[i] > pos) ? field[i][pos] : 0;
+    }
+  inline float Float(int i) const
+    {
+    return Has(i) ? atof(field[i]) : 0;
+    }
+  inline int Int(int i) const
+    {
+    return Has(i) ? atoi(field[i]) : 0;
+    }
+  };
+
+
+/**
+ * gsv_talker: map GSV talker ID to satellite collector slot
+ */
+static int gsv_talker(const char* address)
+  {
+  switch (address[1])
+    {
+    case 'P': return 0;   // GP: GPS
+    case 'L': return 1;   // GL: GLONASS
+    case 'A': return 2;   // GA: Galileo
+    case 'B':             // GB: BeiDou
+    case 'D': return 3;   // BD: BeiDou (old talker ID)
+    default:  return 4;   // GQ/GN/…
+    }
   }
 
 
-void GsmNMEA::IncomingLine(const std::string line)
+/**
+ * snr_insert: keep the strongest four SNRs (descending)
+ */
+static void snr_insert(uint8_t* snr, uint8_t val)
   {
-  std::istringstream sentence(line);
-  std::string token;
+  for (int i = 0; i < 4; i++)
+    {
+    if (val > snr[i])
+      {
+      for (int j = 3; j > i; j--)
+        snr[j] = snr[j-1];
+      snr[i] = val;
+      return;
+      }
+    }
+  }
 
-  if (!std::getline(sentence, token, ','))
-    return;
-  if (token.length() < 6 || token[0] != '$')
-    return;
-  if (!valid_nmea_cksum(line))
+
+void GsmNMEA::IncomingLine(const char* line, size_t len)
+  {
+  NmeaSentence nmea;
+
+  if (!nmea.Parse(line, len))
     {
-    ESP_LOGE(TAG, "IncomingLine: bad checksum: %s", line.c_str());
+    if (nmea.count)
+      ESP_LOGE(TAG, "IncomingLine: bad checksum: %.*s", (int)len, line);
     return;
     }
+  if (nmea.flen[0] < 5)
+    return;
 
-  if (token.substr(3) == "GNS")
+  if (nmea.IsType("GNS"))
     {
-    ESP_LOGD(TAG, "Incoming GNS: %s", line.c_str());
+    ESP_LOGD(TAG, "Incoming GNS: %.*s", (int)len, line);
     // NMEA sentence type "GNS": GNSS Position Fix Data (GPS/GLONASS/… combined position data)
     //  $..GNS,<Time>,<Latitude>,<NS>,<Longitude>,<EW>,<Mode>,<SatCnt>,<HDOP>,<Altitude>,<GeoidalSep>,<DiffAge>,<Chksum>
     // Example:
@@ -150,29 +243,17 @@ void GsmNMEA::IncomingLine(const std::string line)
     char mode[3] = {0,0,0};
     int satcnt=0;
 
-    // Parse sentence:
-
-    if (std::getline(sentence, token, ','))
-      {;} // Time ignored here, see RMC handler
-    if (std::getline(sentence, token, ','))
-      lat = gps2latlon(token.c_str());
-    if (std::getline(sentence, token, ','))
-      ns = token[0];
-    if (std::getline(sentence, token, ','))
-      lon = gps2latlon(token.c_str());
-    if (std::getline(sentence, token, ','))
-      ew = token[0];
-    if (std::getline(sentence, token, ','))
-      {
-      mode[0] = token[0];
-      mode[1] = token[1];
-      }
-    if (std::getline(sentence, token, ','))
-      satcnt = atoi(token.c_str());
-    if (std::getline(sentence, token, ','))
-      hdop = atof(token.c_str());
-    if (std::getline(sentence, token, ','))
-      alt = atof(token.c_str());
+    // Parse sentence (time ignored here, see RMC handler):
+
+    lat = nmea.Has(2) ? gps2latlon(nmea.field[2]) : 0;
+    ns = nmea.Char(3);
+    lon = nmea.Has(4) ? gps2latlon(nmea.field[4]) : 0;
+    ew = nmea.Char(5);
+    mode[0] = nmea.Char(6, 0);
+    mode[1] = nmea.Char(6, 1);
+    satcnt = nmea.Int(7);
+    hdop = nmea.Float(8);
+    alt = nmea.Float(9);
 
     // Check:
 
@@ -228,71 +309,134 @@ void GsmNMEA::IncomingLine(const std::string line)
     // END "GNS" handler
     }
 
-  else if (token.substr(3) == "RMC")
+  else if (nmea.IsType("RMC"))
     {
-    ESP_LOGD(TAG, "Incoming RMC: %s", line.c_str());
+    ESP_LOGD(TAG, "Incoming RMC: %.*s", (int)len, line);
     // NMEA sentence type "RMC": Recommended Minimum Specific GNSS Data
     //  $..RMC,<Time>,<Status>,<Latitude>,<NS>,<Longitude>,<EW>,<SpeedKnots>,<Direction>,<Date>,<MagVar>,<MagVarEW>,<Mode>,<Chksum>
     // Example:
     //  $GPRMC,085320.0,A,5118.138139,N,00723.398844,E,0.0,265.5,101217,,,A*62
 
-    char date[6] = {0}, time[6] = {0};
-    float direction=0, speed=0;
-
-    // Parse sentence:
-
-    if (std::getline(sentence, token, ','))
-      strncpy(time, token.c_str(), 6);
-    bool speedok = false, directionok = false;
-    if (std::getline(sentence, token, ','))
-      {;} // Status
-    if (std::getline(sentence, token, ','))
-      {;} // Latitude
-    if (std::getline(sentence, token, ','))
-      {;} // NS
-    if (std::getline(sentence, token, ','))
-      {;} // Longitude
-    if (std::getline(sentence, token, ','))
-      {;} // EW
-    if (std::getline(sentence, token, ','))
-      {
-        speedok = !token.empty();
-        if (speedok)
-          speed = atof(token.c_str()) * 1.852;
-      }
-    if (std::getline(sentence, token, ','))
-      {
-      directionok = !token.empty();
-      if (directionok)
-        direction = atof(token.c_str());
-      }
-    if (std::getline(sentence, token, ','))
-      strncpy(date, token.c_str(), 6);
-
     // Check:
 
-    if (!date[0] || !time[0])
+    if (nmea.count < 10 || nmea.flen[1] < 6 || nmea.flen[9] < 6)
       return; // malformed/empty sentence
 
     // Data complete, store:
 
     if (m_gpstime_enabled)
       {
-      auto tm = utc_to_timestamp(date, time);
+      auto tm = utc_to_timestamp(nmea.field[9], nmea.field[1]);
       if (tm < 1572735600) // 2019-11-03 00:00:00
         tm += (1024*7*86400); // Nasty kludge to workaround SIM5360 week rollover
-      MyTime.Set(TAG, 2, true, tm);
+      if (tm != m_gpstime_last)
+        {
+        // only set once per second at higher NMEA rates:
+        m_gpstime_last = tm;
+        MyTime.Set(TAG, 2, true, tm);
+        }
       }
 
-    if (directionok)
-      *StdMetrics.ms_v_pos_direction = (float) direction;
+    if (nmea.Has(8))
+      *StdMetrics.ms_v_pos_direction = nmea.Float(8);
 
-    if (speedok)
-      *StdMetrics.ms_v_pos_gpsspeed = speed;
+    if (nmea.Has(7))
+      *StdMetrics.ms_v_pos_gpsspeed = nmea.Float(7) * 1.852;
 
     // END "RMC" handler
     }
 
+  else if (nmea.IsType("GSA"))
+    {
+    ESP_LOGD(TAG, "Incoming GSA: %.*s", (int)len, line);
+    // NMEA sentence type "GSA": GNSS DOP and Active Satellites
+    //  $..GSA,<Mode>,<FixType>,<SV1>,…,<SV12>,<PDOP>,<HDOP>,<VDOP>[,<SystemID>],<Chksum>
+    // Example:
+    //  $GNGSA,A,3,05,13,15,18,20,23,24,,,,,,1.4,0.9,1.1*2E
+    // Notes:
+    //  Multi constellation receivers send one GSA per system with identical DOP values.
+    //  <FixType>: 1 = no fix, 2 = 2D, 3 = 3D
+
+    if (nmea.count < 18 || nmea.Char(2) < '2')
+      return; // malformed sentence or no fix
+
+    *StdMetrics.ms_v_pos_gpspdop = nmea.Float(15);
+    *StdMetrics.ms_v_pos_gpsvdop = nmea.Float(17);
+
+    // END "GSA" handler
+    }
+
+  else if (nmea.IsType("GSV"))
+    {
+    // NMEA sentence type "GSV": GNSS Satellites in View
+    //  $..GSV,<MsgCnt>,<MsgNum>,<SatCnt>{,<PRN>,<Elevation>,<Azimuth>,<SNR>}*4[,<SignalID>],<Chksum>
+    // Example:
+    //  $GPGSV,3,1,11,05,47,291,38,13,62,188,42,15,30,053,35,18,21,110,29*7A
+    // Notes:
+    //  Satellites are reported in groups of up to four per sentence, the group is
+    //  complete with <MsgNum> = <MsgCnt>. <SNR> is empty for satellites not tracked.
+
+    if (nmea.count < 4)
+      return; // malformed sentence
+
+    int msgcnt = nmea.Int(1);
+    int msgnum = nmea.Int(2);
+    int talker = gsv_talker(nmea.field[0]);
+
+    if (msgnum == 1)
+      {
+      m_gsv_talker = talker;
+      memset(m_gsv_snr, 0, sizeof(m_gsv_snr));
+      }
+    else if (talker != m_gsv_talker)
+      return; // missed start of group
+
+    for (int i = 7; i < nmea.count && i <= 19; i += 4)
+      {
+      if (nmea.Has(i))
+        snr_insert(m_gsv_snr, (uint8_t) LIMIT_MAX(nmea.Int(i), 99));
+      }
+
+    if (msgnum >= msgcnt)
+      {
+      gsv_state_t& gsv = m_gsv[talker];
+      gsv.inview = (uint8_t) LIMIT_MAX(nmea.Int(3), 255);
+      memcpy(gsv.snr, m_gsv_snr, sizeof(gsv.snr));
+      gsv.time = monotonictime;
+      m_gsv_talker = -1;
+      UpdateSatInfo();
+      }
+
+    // END "GSV" handler
+    }
+
+  }
+
+
+/**
+ * UpdateSatInfo: combine GSV groups of all active talkers into the satellite metrics
+ */
+void GsmNMEA::UpdateSatInfo()
+  {
+  int inview = 0;
+  uint8_t snr[4] = {0,0,0,0};
+
+  for (int t = 0; t < (int)DIM(m_gsv); t++)
+    {
+    gsv_state_t& gsv = m_gsv[t];
+    if (gsv.time == 0 || monotonictime - gsv.time > 10)
+      continue; // talker silent
+    inview += gsv.inview;
+    for (int i = 0; i < 4 && gsv.snr[i]; i++)
+      snr_insert(snr, gsv.snr[i]);
+    }
+
+  int snrcnt = 0, snrsum = 0;
+  for (int i = 0; i < 4 && snr[i]; i++, snrcnt++)
+    snrsum += snr[i];
+
+  *StdMetrics.ms_v_pos_satinview = inview;
+  *StdMetrics.ms_v_pos_gpssnr = (snrcnt > 0) ? (float) snrsum / snrcnt : 0.0f;
   }
 
 
@@ -301,6 +445,9 @@ void GsmNMEA::Startup()
   ESP_LOGI(TAG, "Startup");
 
   m_gpstime_enabled = MyConfig.GetParamValueBool("modem", "enable.gpstime", false);
+  m_gpstime_last = 0;
+  memset(m_gsv, 0, sizeof(m_gsv));
+  m_gsv_talker = -1;
   m_connected = true;
   }
 
@@ -313,6 +460,10 @@ void GsmNMEA::Shutdown(bool hard)
   *StdMetrics.ms_v_pos_gpsspeed = (float) 0;
   *StdMetrics.ms_v_pos_satcount = (int) 0;
   *StdMetrics.ms_v_pos_gpshdop = (float) 500;
+  *StdMetrics.ms_v_pos_gpspdop = (float) 500;
+  *StdMetrics.ms_v_pos_gpsvdop = (float) 500;
+  *StdMetrics.ms_v_pos_satinview = (int) 0;
+  *StdMetrics.ms_v_pos_gpssnr = (float) 0;
   *StdMetrics.ms_v_pos_gpssq = (int) 0;
 
   if (StdMetrics.ms_v_pos_gpslock->AsBool())
@@ -332,6 +483,10 @@ GsmNMEA::GsmNMEA(GsmMux* mux, int channel_nmea, int channel_cmd)
   m_channel_cmd = channel_cmd;
   m_connected = false;
   m_gpstime_enabled = false;
+  m_gpstime_last = 0;
+  memset(m_gsv, 0, sizeof(m_gsv));
+  memset(m_gsv_snr, 0, sizeof(m_gsv_snr));
+  m_gsv_talker = -1;
   }
 
 GsmNMEA::~GsmNMEA()
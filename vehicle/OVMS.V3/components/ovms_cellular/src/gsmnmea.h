@@ -45,7 +45,8 @@ class GsmNMEA : public InternalRamAllocated
     ~GsmNMEA();
 
   public:
-    void IncomingLine(const std::string line);
+    void IncomingLine(const char* line, size_t len);
+    void IncomingLine(const std::string& line) { IncomingLine(line.data(), line.size()); }
     void Startup();
     void Shutdown(bool hard=false);
 
@@ -55,6 +56,20 @@ class GsmNMEA : public InternalRamAllocated
     int           m_channel_cmd;
     bool          m_connected;
     bool          m_gpstime_enabled;
+    int64_t       m_gpstime_last;               // last RMC time set, to skip repeats at rates > 1 Hz
+
+  protected:
+    // GSV satellites in view, collected per talker (GP/GL/GA/GB/other):
+    struct gsv_state_t
+      {
+      uint8_t     inview;                       // satellites in view reported by the talker
+      uint8_t     snr[4];                       // strongest four SNRs of the current/last group [dB-Hz]
+      uint32_t    time;                         // monotonictime of last completed group
+      };
+    gsv_state_t   m_gsv[5];
+    uint8_t       m_gsv_snr[4];                 // collector for the group in progress
+    int           m_gsv_talker;                 // talker index of the group in progress (-1 = none)
+    void UpdateSatInfo();
   };
 
 #endif //#ifndef __GSM_NMEA__
@@ -31,6 +31,10 @@
 #include "ovms_log.h"
 static const char *TAG = "gsm-ppp";
 
+// To enable verbose hex dumps of all PPP frames, uncomment:
+// (Note: formatting is costly, the dumps are created even if the log level is not verbose)
+// #define GSM_PPPOS_HEXDUMP
+
 #include <lwip/ip_addr.h>
 #include <lwip/netif.h>
 #include <lwip/dns.h>
@@ -46,7 +50,9 @@ static u32_t GsmPPPOS_OutputCallback(ppp_pcb *pcb, u8_t *data, u32_t len, void *
   {
   GsmPPPOS* me = (GsmPPPOS*)ctx;
 
+#ifdef GSM_PPPOS_HEXDUMP
   MyCommandApp.HexDump(TAG, "tx", (const char*)data, len);
+#endif
   return me->m_mux->tx(me->m_channel, data, len);
   }
 
@@ -189,7 +195,9 @@ GsmPPPOS::~GsmPPPOS()
 
 void GsmPPPOS::IncomingData(uint8_t *data, size_t len)
   {
+#ifdef GSM_PPPOS_HEXDUMP
   MyCommandApp.HexDump(TAG, "rx", (const char*)data, len);
+#endif
   pppos_input_tcpip(m_ppp, (u8_t*)data, (int)len);
   }
 
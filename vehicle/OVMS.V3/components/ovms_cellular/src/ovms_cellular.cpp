@@ -1529,6 +1529,19 @@ void modem::ConfigChanged(std::string event, void* data)
     }
   }
 
+bool modem::IncomingMuxPayload(GsmMuxChannel* channel, uint8_t* data, size_t len)
+  {
+  // Called by the MUX with the frame payload (in place) before buffering it.
+  // PPP data is passed on directly, returns true if the payload has been consumed.
+  if ((channel->m_channel == m_mux_channel_DATA)&&(m_state1 == NetMode)&&
+      (m_ppp != NULL)&&(channel->m_buffer.UsedSpace() == 0))
+    {
+    m_ppp->IncomingData(data,len);
+    return true;
+    }
+  return false;
+  }
+
 void modem::IncomingMuxData(GsmMuxChannel* channel)
   {
   // The MUX has indicated there is data on the specified channel
@@ -1548,11 +1561,12 @@ void modem::IncomingMuxData(GsmMuxChannel* channel)
     {
     if (m_state1 == NetMode)
       {
-      uint8_t buf[32];
+      uint8_t* data;
       size_t n;
-      while ((m_ppp != NULL)&&(n = channel->m_buffer.Pop(sizeof(buf),buf)) > 0)
+      while ((m_ppp != NULL)&&(n = channel->m_buffer.PeekSpan(&data)) > 0)
         {
-        m_ppp->IncomingData(buf,n);
+        m_ppp->IncomingData(data,n);
+        channel->m_buffer.Skip(n);
         }
       }
     else
@@ -1916,4 +1930,6 @@ CellularModemInit::CellularModemInit()
   //   'enable.net': Is NET enabled? yes/no (default: yes)
   //   'enable.gps': Is GPS enabled? yes/no (default: no)
   //   'enable.gpstime': use GPS time as system time? yes/no (default: no)
+  //   'gps.rate': NMEA update rate [Hz] if supported by the modem (default: 1)
+  //   'gps.satinfo': subscribe to GSA/GSV for DOP & satellite metrics? yes/no (default: no)
   }
@@ -217,6 +217,7 @@ class modem : public pcp, public InternalRamAllocated
     void EventListener(std::string event, void* data);
     void ConfigChanged(std::string event, void *data);
     void IncomingMuxData(GsmMuxChannel* channel);
+    bool IncomingMuxPayload(GsmMuxChannel* channel, uint8_t* data, size_t len);
     void SendSetState1(modem_state1_t newstate);
     bool IsStarted();
     void SetNetworkRegistration(network_regtype_t regtype, network_registration_t netreg);
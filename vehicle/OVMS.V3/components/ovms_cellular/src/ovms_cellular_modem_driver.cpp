@@ -133,8 +133,18 @@ void modemdriver::StartupNMEA()
   // Switch on GPS, subscribe to NMEA sentences…
   //   2 = $..RMC -- UTC time & date
   //  64 = $..GNS -- Position & fix data
+  // …and with config modem gps.satinfo=yes:
+  //   4 = $..GSV -- Satellites in view
+  //   8 = $..GSA -- DOP & active satellites
+  int nmeamask = 66;
+  if (MyConfig.GetParamValueBool("modem", "gps.satinfo", false))
+    nmeamask |= 4 + 8;
   if (m_modem->m_mux != NULL)
-    { m_modem->muxtx(GetMuxChannelCMD(), "AT+CGPSNMEA=66;+CGPS=1,1\r\n"); }
+    {
+    char buf[40];
+    snprintf(buf, sizeof(buf), "AT+CGPSNMEA=%d;+CGPS=1,1\r\n", nmeamask);
+    m_modem->muxtx(GetMuxChannelCMD(), buf);
+    }
   else
     { ESP_LOGE(TAG, "Attempt to transmit on non running mux"); }
   }
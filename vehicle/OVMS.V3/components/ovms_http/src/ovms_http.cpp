@@ -42,10 +42,10 @@ OvmsHttpClient::OvmsHttpClient()
   m_responsecode = 0;
   }
 
-OvmsHttpClient::OvmsHttpClient(std::string url, const char* method)
+OvmsHttpClient::OvmsHttpClient(std::string url, const char* method, const char* headers)
   {
   m_buf = NULL;
-  Request(url, method);
+  Request(url, method, headers);
   }
 
 OvmsHttpClient::~OvmsHttpClient()
@@ -57,7 +57,7 @@ OvmsHttpClient::~OvmsHttpClient()
     }
   }
 
-bool OvmsHttpClient::Request(std::string url, const char* method)
+bool OvmsHttpClient::Request(std::string url, const char* method, const char* headers)
   {
   m_bodysize = 0;
   m_responsecode = 0;
@@ -111,7 +111,13 @@ bool OvmsHttpClient::Request(std::string url, const char* method)
   req.append(server);
   req.append("\r\nUser-Agent: ");
   req.append(get_user_agent());
-  req.append("\r\n\r\n");
+  req.append("\r\n");
+  if (headers != NULL)
+    {
+    // Additional request headers, each terminated by CRLF
+    req.append(headers);
+    }
+  req.append("\r\n");
   if (Write(req.c_str(), req.length()) < 0)
     {
     ESP_LOGE(TAG, "Unable to write to server connection");
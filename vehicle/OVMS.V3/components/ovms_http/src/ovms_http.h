@@ -39,14 +39,14 @@ class OvmsHttpClient : public OvmsNetTcpConnection
   {
   public:
     OvmsHttpClient();
-    OvmsHttpClient(std::string url, const char* method = "GET");
+    OvmsHttpClient(std::string url, const char* method = "GET", const char* headers = NULL);
     virtual ~OvmsHttpClient();
 
   public:
     virtual void Disconnect();
 
   public:
-    bool Request(std::string url, const char* method = "GET");
+    bool Request(std::string url, const char* method = "GET", const char* headers = NULL);
     size_t BodyRead(void *buf, size_t nbyte);
     int BodyHasLine();
     std::string BodyReadLine();
@@ -45,6 +45,7 @@ static const char *TAG = "ota";
 #include <spi_flash_mmap.h>
 #endif
 #include "ovms_ota.h"
+#include "ovms_ota_pipeline.h"
 #include "ovms_command.h"
 #include "ovms_boot.h"
 #include "ovms_config.h"
@@ -195,52 +196,26 @@ void ota_flash_vfs(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc
     return;
     }
 
-  MyOTA.SetFlashStatus("OTA Flash VFS: Preparing flash partition...");
-  writer->puts(MyOTA.GetFlashStatus());
-  esp_ota_handle_t otah;
-  esp_err_t err = esp_ota_begin(target, ds.st_size, &otah);
-  if (err != ESP_OK)
-    {
-    MyOTA.ClearFlashStatus();
-    writer->printf("Error: ESP32 error #%d when starting OTA operation\n",err);
-    fclose(f);
-    return;
-    }
-
   MyOTA.SetFlashStatus("OTA Flash VFS: Flashing image partition...");
   writer->puts(MyOTA.GetFlashStatus());
-  char buf[512];
-  size_t done = 0;
-  while(size_t n = fread(buf, sizeof(char), sizeof(buf), f))
+  OvmsOTAPipeline ota("OTA Flash VFS", target, writer);
+  bool ok = ota.FlashFile(f, ds.st_size, OvmsOTAPipeline::IsCompressedName(argv[0]));
+  fclose(f);
+  if (ok)
     {
-    err = esp_ota_write(otah, buf, n);
-    if (err != ESP_OK)
-      {
-      MyOTA.ClearFlashStatus();
-      writer->printf("Error: ESP32 error #%d when writing to flash - state is inconsistent\n",err);
-      esp_ota_end(otah);
-      fclose(f);
-      return;
-      }
-    done += n;
-    MyOTA.SetFlashPerc((done*100)/ds.st_size);
+    MyOTA.SetFlashStatus("OTA Flash VFS: Finalising flash write");
+    ok = ota.Finish();
     }
-  fclose(f);
-
-  MyOTA.SetFlashStatus("OTA Flash VFS: Finalising flash write");
-  err = esp_ota_end(otah);
-  if (err != ESP_OK)
+  if (!ok)
     {
     MyOTA.ClearFlashStatus();
-    writer->printf("Error: ESP32 error #%d finalising OTA operation - state is inconsistent\n",err);
+    writer->printf("Error: %s\n", ota.GetError().c_str());
     return;
     }
 
-  fclose(f);
-
   MyOTA.SetFlashStatus("OTA Flash VFS: Setting boot partition...");
   writer->puts(MyOTA.GetFlashStatus());
-  err = esp_ota_set_boot_partition(target);
+  esp_err_t err = esp_ota_set_boot_partition(target);
   MyOTA.ClearFlashStatus();
   if (err != ESP_OK)
     {
@@ -290,22 +265,7 @@ void ota_flash_http(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int arg
   if (argc == 0)
     {
     // Automatically build the URL based on firmware
-    std::string tag = MyConfig.GetParamValue("ota","tag");
-
-    url = MyConfig.GetParamValue("ota","server");
-    if (url.empty())
-      url = "api.openvehicles.com/firmware/ota";
-
-    url.append("/");
-    url.append(GetOVMSProduct());
-    url.append("/");
-
-    if (tag.empty())
-      url.append(CONFIG_OVMS_VERSION_TAG);
-    else
-      url.append(tag);
-
-    url.append("/ovms3.bin");
+    url = OvmsOTA::GetFirmwareURL(writer);
     }
   else
     {
@@ -313,92 +273,26 @@ void ota_flash_http(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int arg
     }
   writer->printf("Download firmware from %s to %s\n",url.c_str(),target->label);
 
-  // HTTP client request...
-  OvmsHttpClient http(url);
-  if (!http.IsOpen())
-    {
-    writer->puts("Error: Request failed");
-    return;
-    }
-
-  size_t expected = http.BodySize();
-  if (expected < 32)
-    {
-    writer->printf("Error: Expected download file size (%d) is invalid\n",expected);
-    return;
-    }
-
-  writer->printf("Expected file size is %d\n",expected);
-
-  MyOTA.SetFlashStatus("OTA Flash HTTP: Preparing flash partition...");
-  writer->puts(MyOTA.GetFlashStatus());
-  esp_ota_handle_t otah;
-  esp_err_t err = esp_ota_begin(target, expected, &otah);
-  if (err != ESP_OK)
-    {
-    MyOTA.ClearFlashStatus();
-    writer->printf("Error: ESP32 error #%d when starting OTA operation\n",err);
-    http.Disconnect();
-    return;
-    }
-
-  // Now, process the body
-  uint8_t rbuf[512];
-  size_t filesize = 0;
-  size_t sofar = 0;
   MyOTA.SetFlashStatus("OTA Flash HTTP: Downloading OTA image...");
-  while (int k = http.BodyRead(rbuf,512))
-    {
-    filesize += k;
-    sofar += k;
-    MyOTA.SetFlashPerc((filesize*100)/expected);
-    if (sofar > 100000)
-      {
-      writer->printf("Downloading... (%d bytes so far)\n",filesize);
-      sofar = 0;
-      }
-    if (filesize > target->size)
-      {
-      MyOTA.ClearFlashStatus();
-      writer->printf("Error: Download firmware is bigger than available partition space - state is inconsistent\n");
-      esp_ota_end(otah);
-      http.Disconnect();
-      return;
-      }
-    err = esp_ota_write(otah, rbuf, k);
-    if (err != ESP_OK)
-      {
-      MyOTA.ClearFlashStatus();
-      writer->printf("Error: ESP32 error #%d when writing to flash - state is inconsistent\n",err);
-      esp_ota_end(otah);
-      http.Disconnect();
-      return;
-      }
-    }
-  http.Disconnect();
-  writer->printf("Download complete (at %d bytes)\n",filesize);
-
-  if (filesize != expected)
+  writer->puts(MyOTA.GetFlashStatus());
+  OvmsOTAPipeline ota("OTA Flash HTTP", target, writer);
+  bool ok = ota.Download(url, MyConfig.GetParamValueInt("ota", "http.retries", OTA_PIPELINE_RETRIES));
+  if (ok)
     {
-    MyOTA.ClearFlashStatus();
-    writer->printf("Error: Download file size (%d) does not match expected (%d)\n",filesize,expected);
-    esp_ota_end(otah);
-    return;
+    MyOTA.SetFlashStatus("OTA Flash HTTP: Finalising flash write");
+    ok = ota.Finish();
     }
-
-  MyOTA.SetFlashStatus("OTA Flash HTTP: Finalising flash write");
-  err = esp_ota_end(otah);
-  if (err != ESP_OK)
+  if (!ok)
     {
     MyOTA.ClearFlashStatus();
-    writer->printf("Error: ESP32 error #%d finalising OTA operation - state is inconsistent\n",err);
+    writer->printf("Error: %s\n", ota.GetError().c_str());
     return;
     }
 
   // All done
   MyOTA.SetFlashStatus("OTA Flash HTTP: Setting boot partition...");
   writer->puts(MyOTA.GetFlashStatus());
-  err = esp_ota_set_boot_partition(target);
+  esp_err_t err = esp_ota_set_boot_partition(target);
   MyOTA.ClearFlashStatus();
   if (err != ESP_OK)
     {
@@ -406,8 +300,8 @@ void ota_flash_http(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int arg
     return;
     }
 
-  writer->printf("OTA flash was successful\n  Flashed %d bytes from %s\n  Next boot will be from '%s'\n",
-                 http.BodySize(),url.c_str(),target->label);
+  writer->printf("OTA flash was successful\n  Flashed %d bytes from %s (%d resumes)\n  Next boot will be from '%s'\n",
+                 ota.GetWritten(),url.c_str(),ota.GetResumes(),target->label);
   MyConfig.SetParamValue("ota", "http.mru", url);
   }
 
@@ -639,7 +533,7 @@ void ota_copy(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, con
 #ifdef CONFIG_OVMS_COMP_SDCARD
 void OvmsOTA::CheckFlashSD(std::string event, void* data)
   {
-  if (path_exists("/sd/ovms3.bin"))
+  if (path_exists("/sd/ovms3.bin") || path_exists("/sd/ovms3.bin.gz"))
     {
     LaunchAutoFlash(OTA_FlashCfg_FromSD);
     }
@@ -647,7 +541,14 @@ void OvmsOTA::CheckFlashSD(std::string event, void* data)
 
 bool OvmsOTA::AutoFlashSD()
   {
-  FILE* f = fopen("/sd/ovms3.bin", "r");
+  const char* path = "/sd/ovms3.bin";
+  bool compressed = false;
+  if (!path_exists(path))
+    {
+    path = "/sd/ovms3.bin.gz";
+    compressed = true;
+    }
+  FILE* f = fopen(path, "r");
   if (f == NULL) return false;
 
   const esp_partition_t *running = esp_ota_get_running_partition();
@@ -685,56 +586,32 @@ bool OvmsOTA::AutoFlashSD()
     }
 
   struct stat ds;
-  if (stat("/sd/ovms3.bin", &ds) != 0)
+  if (stat(path, &ds) != 0)
     {
     ESP_LOGE(TAG, "AutoFlashSD Error: Cannot stat file");
     fclose(f);
     return false;
     }
-  ESP_LOGW(TAG, "AutoFlashSD Source image is %d bytes in size",(int)ds.st_size);
+  ESP_LOGW(TAG, "AutoFlashSD Source image %s is %d bytes in size",path,(int)ds.st_size);
 
-  SetFlashStatus("OTA Auto Flash SD: Preparing flash partition...",0,true);
-  esp_ota_handle_t otah;
-  esp_err_t err = esp_ota_begin(target, ds.st_size, &otah);
-  if (err != ESP_OK)
-    {
-    ClearFlashStatus();
-    ESP_LOGE(TAG, "AutoFlashSD Error: ESP32 error #%d when starting OTA operation",err);
-    fclose(f);
-    return false;
-    }
-
-  SetFlashStatus("OTA Auto Flash SD: Flashing image paritition...",0,true);
-  char buf[512];
-  size_t done = 0;
-  while(size_t n = fread(buf, sizeof(char), sizeof(buf), f))
+  SetFlashStatus("OTA Auto Flash SD: Flashing image partition...",0,true);
+  OvmsOTAPipeline ota("AutoFlashSD", target);
+  bool ok = ota.FlashFile(f, ds.st_size, compressed);
+  fclose(f);
+  if (ok)
     {
-    err = esp_ota_write(otah, buf, n);
-    if (err != ESP_OK)
-      {
-      ClearFlashStatus();
-      ESP_LOGE(TAG, "AutoFlashSD Error: ESP32 error #%d when writing to flash - state is inconsistent",err);
-      esp_ota_end(otah);
-      fclose(f);
-      return false;
-      }
-    done += n;
-    SetFlashPerc((done*100)/ds.st_size);
+    SetFlashStatus("OTA Auto Flash SD: Finalising flash image...",0,true);
+    ok = ota.Finish();
     }
-
-  fclose(f);
-
-  SetFlashStatus("OTA Auto Flash SD: Finalising flash image...",0,true);
-  err = esp_ota_end(otah);
-  if (err != ESP_OK)
+  if (!ok)
     {
     ClearFlashStatus();
-    ESP_LOGE(TAG, "AutoFlashSD Error: ESP32 error #%d finalising OTA operation - state is inconsistent",err);
+    ESP_LOGE(TAG, "AutoFlashSD Error: %s", ota.GetError().c_str());
     return false;
     }
 
   SetFlashStatus("OTA Auto Flash SD: Setting boot partition...",0,true);
-  err = esp_ota_set_boot_partition(target);
+  esp_err_t err = esp_ota_set_boot_partition(target);
   ClearFlashStatus();
   if (err != ESP_OK)
     {
@@ -743,14 +620,14 @@ bool OvmsOTA::AutoFlashSD()
     }
 
   remove("/sd/ovms3.done"); // Ensure the target is removed first
-  if (rename("/sd/ovms3.bin","/sd/ovms3.done") != 0)
+  if (rename(path,"/sd/ovms3.done") != 0)
     {
-    ESP_LOGE(TAG, "AutoFlashSD Error: ovms3.bin could not be renamed to ovms3.done - check before rebooting");
+    ESP_LOGE(TAG, "AutoFlashSD Error: %s could not be renamed to ovms3.done - check before rebooting", path);
     return false;
     }
 
   ESP_LOGW(TAG, "AutoFlashSD OTA flash successful: Flashed %d bytes, and booting from '%s'",
-                 (int)ds.st_size,target->label);
+                 (int)ota.GetWritten(),target->label);
   return true;
   }
 #endif // #ifdef CONFIG_OVMS_COMP_SDCARD
@@ -875,6 +752,48 @@ void OvmsOTA::GetStatus(ota_info& info, bool check_update /*=true*/)
     }
   }
 
+/**
+ * GetFirmwareURL: build the server firmware image URL from the OTA config
+ *  - with "ota gz" enabled, the compressed image is used if the server
+ *    provides one (checked by a HEAD request), else falls back to the
+ *    uncompressed image
+ *  - writer (optional): receives the fallback notice
+ */
+std::string OvmsOTA::GetFirmwareURL(OvmsWriter* writer /*=NULL*/)
+  {
+  std::string tag = MyConfig.GetParamValue("ota","tag");
+  std::string url = MyConfig.GetParamValue("ota","server");
+  if (url.empty())
+    url = "api.openvehicles.com/firmware/ota";
+
+  url.append("/");
+  url.append(GetOVMSProduct());
+  url.append("/");
+
+  if (tag.empty())
+    url.append(CONFIG_OVMS_VERSION_TAG);
+  else
+    url.append(tag);
+  url.append("/ovms3.bin");
+  if (MyConfig.GetParamValueBool("ota", "gz", false))
+    {
+    // Use the compressed image if the server provides one:
+    OvmsHttpClient probe(url + ".gz", "HEAD");
+    if (probe.IsOpen() && probe.ResponseCode() == 200)
+      {
+      url.append(".gz");
+      }
+    else
+      {
+      ESP_LOGW(TAG, "GetFirmwareURL: compressed image not available, using uncompressed");
+      if (writer)
+        writer->puts("Compressed image not available, using uncompressed");
+      }
+    probe.Disconnect();
+    }
+  return url;
+  }
+
 void OvmsOTA::Ticker600(std::string event, void* data)
   {
   if (MyConfig.GetParamValueBool("auto", "ota", true) == false)
@@ -1037,20 +956,7 @@ bool OvmsOTA::AutoFlash(bool force)
     return false;
     }
 
-  std::string tag = MyConfig.GetParamValue("ota","tag");
-  std::string url = MyConfig.GetParamValue("ota","server");
-  if (url.empty())
-    url = "api.openvehicles.com/firmware/ota";
-
-  url.append("/");
-  url.append(GetOVMSProduct());
-  url.append("/");
-
-  if (tag.empty())
-    url.append(CONFIG_OVMS_VERSION_TAG);
-  else
-    url.append(tag);
-  url.append("/ovms3.bin");
+  std::string url = GetFirmwareURL();
 
   ESP_LOGI(TAG, "AutoFlash: Update %s to %s (%s)",
     target->label,
@@ -1058,91 +964,32 @@ bool OvmsOTA::AutoFlash(bool force)
     url.c_str());
   MyNotify.NotifyStringf("info", "ota.update", "New OTA firmware %s is now being downloaded", info.version_server.c_str());
 
-  // HTTP client request...
-  OvmsHttpClient http(url);
-  if (!http.IsOpen())
-    {
-    ESP_LOGE(TAG, "AutoFlash: http://%s request failed", url.c_str());
-    m_lastcheckday = -1; // Allow to try again within the same day
-    return false;
-    }
-
-  size_t expected = http.BodySize();
-  if (expected < 32)
+  SetFlashStatus("OTA Auto Flash: Downloading OTA image...",0,true);
+  OvmsOTAPipeline ota("AutoFlash", target);
+  bool ok = ota.Download(url, MyConfig.GetParamValueInt("ota", "http.retries", OTA_PIPELINE_RETRIES));
+  if (ok)
     {
-    ESP_LOGE(TAG, "AutoFlash: Expected download file size (%d) is invalid", expected);
-    m_lastcheckday = -1; // Allow to try again within the same day
-    return false;
-    }
-
-  SetFlashStatus("OTA Auto Flash: Preparing flash partition...",0,true);
-  esp_ota_handle_t otah;
-  esp_err_t err = esp_ota_begin(target, expected, &otah);
-  if (err != ESP_OK)
-    {
-    ClearFlashStatus();
-    ESP_LOGE(TAG, "AutoFlash: ESP32 error #%d when starting OTA operation", err);
-    http.Disconnect();
-    return false;
+    SetFlashStatus("OTA Auto Flash: Finalising flash partition...");
+    ok = ota.Finish();
     }
-
-  // Now, process the body
-  SetFlashStatus("OTA Auto Flash: Downloading OTA image...");
-  uint8_t rbuf[512];
-  size_t filesize = 0;
-  while (int k = http.BodyRead(rbuf,512))
-    {
-    filesize += k;
-    SetFlashPerc((filesize*100)/expected);
-    if (filesize > target->size)
-      {
-      ClearFlashStatus();
-      ESP_LOGE(TAG, "AutoFlash: Download firmware is bigger than available partition space - state is inconsistent");
-      esp_ota_end(otah);
-      http.Disconnect();
-      return false;
-      }
-    err = esp_ota_write(otah, rbuf, k);
-    if (err != ESP_OK)
-      {
-      ClearFlashStatus();
-      ESP_LOGE(TAG, "AutoFlash: ESP32 error #%d when writing to flash - state is inconsistent", err);
-      esp_ota_end(otah);
-      http.Disconnect();
-      return false;
-      }
-    }
-  http.Disconnect();
-  ESP_LOGI(TAG, "AutoFlash:: Download complete (at %d bytes)", filesize);
-
-  if (filesize != expected)
-    {
-    ClearFlashStatus();
-    ESP_LOGE(TAG, "AutoFlash: Download file size (%d) does not match expected (%d)", filesize, expected);
-    esp_ota_end(otah);
-    m_lastcheckday = -1; // Allow to try again within the same day
-    return false;
-    }
-
-  SetFlashStatus("OTA Auto Flash: Finalising flash partition...");
-  err = esp_ota_end(otah);
   ClearFlashStatus();
-  if (err != ESP_OK)
+  if (!ok)
     {
-    ESP_LOGE(TAG, "AutoFlash: ESP32 error #%d finalising OTA operation - state is inconsistent", err);
+    ESP_LOGE(TAG, "AutoFlash: %s", ota.GetError().c_str());
+    m_lastcheckday = -1; // Allow to try again within the same day
     return false;
     }
 
   // All done
   ESP_LOGI(TAG, "AutoFlash: Setting boot partition...");
-  err = esp_ota_set_boot_partition(target);
+  esp_err_t err = esp_ota_set_boot_partition(target);
   if (err != ESP_OK)
     {
     ESP_LOGE(TAG, "AutoFlash: ESP32 error #%d setting boot partition - check before rebooting", err);
     return false;
     }
 
-  ESP_LOGI(TAG, "AutoFlash: Success flash of %d bytes from %s", http.BodySize(), url.c_str());
+  ESP_LOGI(TAG, "AutoFlash: Success flash of %d bytes from %s (%d resumes)", ota.GetWritten(), url.c_str(), ota.GetResumes());
   MyNotify.NotifyStringf("info", "ota.update", "OTA firmware %s has been updated (OVMS will restart)", info.version_server.c_str());
   MyConfig.SetParamValue("ota", "http.mru", url);
 
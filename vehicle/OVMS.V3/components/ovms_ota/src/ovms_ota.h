@@ -36,6 +36,8 @@
 #include "ovms_events.h"
 #include "ovms_mutex.h"
 
+class OvmsWriter;
+
 struct ota_info
   {
   std::string hardware_info;
@@ -63,6 +65,7 @@ class OvmsOTA
 
   public:
     static void GetStatus(ota_info& info, bool check_update=true);
+    static std::string GetFirmwareURL(OvmsWriter* writer=NULL);
 
   public:
     void LaunchAutoFlash(ota_flashcfg_t cfg=OTA_FlashCfg_Default);
@@ -0,0 +1,611 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "ota";
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <inttypes.h>
+#include <sys/socket.h>
+#include "ovms.h"
+#include "ovms_ota.h"
+#include "ovms_ota_pipeline.h"
+#include "ovms_command.h"
+#include "ovms_http.h"
+#include "ovms_malloc.h"
+
+// ESP32 app image header fields (see esp_image_format.h):
+#define OTA_IMAGE_MAGIC             0xE9
+#define OTA_IMAGE_HASH_APPENDED_OFS 23
+
+OvmsOTAPipeline::OvmsOTAPipeline(const char* name, const esp_partition_t* target, OvmsWriter* writer /*=NULL*/)
+  {
+  m_name = name;
+  m_target = target;
+  m_writer = writer;
+  m_otah = 0;
+  m_started = false;
+  m_failed = false;
+  for (int k=0; k<OTA_PIPELINE_BUFCOUNT; k++)
+    m_buf[k] = NULL;
+  m_fillindex = -1;
+  m_fillpos = 0;
+  m_freequeue = NULL;
+  m_fullqueue = NULL;
+  m_done = NULL;
+  m_task = NULL;
+  m_expected = 0;
+  m_received = 0;
+  m_staged = 0;
+  m_written = 0;
+  m_resumes = 0;
+  mbedtls_md_init(&m_md);
+  m_hashcheck = false;
+  m_hashtailfill = 0;
+  m_compressed = false;
+#ifdef CONFIG_OVMS_SC_ZIP
+  memset(&m_zs, 0, sizeof(m_zs));
+  m_zsinit = false;
+  m_zsdone = false;
+  m_zsout = NULL;
+#endif // CONFIG_OVMS_SC_ZIP
+  }
+
+OvmsOTAPipeline::~OvmsOTAPipeline()
+  {
+  Abort();
+  for (int k=0; k<OTA_PIPELINE_BUFCOUNT; k++)
+    {
+    if (m_buf[k]) free(m_buf[k]);
+    m_buf[k] = NULL;
+    }
+  if (m_freequeue) vQueueDelete(m_freequeue);
+  if (m_fullqueue) vQueueDelete(m_fullqueue);
+  if (m_done) vSemaphoreDelete(m_done);
+  mbedtls_md_free(&m_md);
+#ifdef CONFIG_OVMS_SC_ZIP
+  if (m_zsinit) inflateEnd(&m_zs);
+  if (m_zsout) free(m_zsout);
+#endif // CONFIG_OVMS_SC_ZIP
+  }
+
+void OvmsOTAPipeline::SetError(const char* fmt, ...)
+  {
+  char buf[128];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, args);
+  va_end(args);
+  m_error = buf;
+  m_failed = true;
+  }
+
+#ifdef CONFIG_OVMS_SC_ZIP
+static voidpf ota_zalloc(voidpf opaque, uInt items, uInt size)
+  {
+  return ExternalRamCalloc(items, size);
+  }
+
+static void ota_zfree(voidpf opaque, voidpf address)
+  {
+  free(address);
+  }
+#endif // CONFIG_OVMS_SC_ZIP
+
+bool OvmsOTAPipeline::IsCompressedName(const std::string& name)
+  {
+  return (name.size() > 3 && name.compare(name.size()-3, 3, ".gz") == 0);
+  }
+
+/**
+ * Begin: prepare the OTA partition and launch the flash writer task
+ *  expected: input size, 0 = unknown
+ *  compressed: input is a gzip/zlib compressed image
+ */
+bool OvmsOTAPipeline::Begin(size_t expected, bool compressed /*=false*/)
+  {
+  if (m_started)
+    return true;
+  if (m_target == NULL)
+    {
+    SetError("Target partition cannot be determined");
+    return false;
+    }
+  if (expected > m_target->size)
+    {
+    SetError("Image size (%d) exceeds partition size (%" PRIu32 ")", expected, m_target->size);
+    return false;
+    }
+
+  m_expected = expected;
+  m_received = 0;
+  m_staged = 0;
+  m_written = 0;
+  m_failed = false;
+  m_error.clear();
+  m_compressed = compressed;
+
+  if (m_compressed)
+    {
+#ifdef CONFIG_OVMS_SC_ZIP
+    m_zs.zalloc = ota_zalloc;
+    m_zs.zfree = ota_zfree;
+    m_zs.opaque = NULL;
+    // windowBits + 32: automatic gzip / zlib header detection
+    if (inflateInit2(&m_zs, OTA_PIPELINE_WINDOWBITS + 32) != Z_OK)
+      {
+      SetError("Cannot initialise inflater");
+      return false;
+      }
+    m_zsinit = true;
+    m_zsdone = false;
+    m_zsout = (uint8_t*) ExternalRamMalloc(OTA_PIPELINE_INFLATESIZE);
+    if (m_zsout == NULL)
+      {
+      SetError("Out of memory (inflater)");
+      return false;
+      }
+#else
+    SetError("Compressed images not supported (ZIP support disabled)");
+    return false;
+#endif // CONFIG_OVMS_SC_ZIP
+    }
+
+  m_freequeue = xQueueCreate(OTA_PIPELINE_BUFCOUNT, sizeof(int));
+  m_fullqueue = xQueueCreate(OTA_PIPELINE_BUFCOUNT+1, sizeof(ota_chunk_t));
+  m_done = xSemaphoreCreateBinary();
+  if (!m_freequeue || !m_fullqueue || !m_done)
+    {
+    SetError("Out of memory (queues)");
+    return false;
+    }
+  for (int k=0; k<OTA_PIPELINE_BUFCOUNT; k++)
+    {
+    m_buf[k] = (uint8_t*) ExternalRamMalloc(OTA_PIPELINE_BUFSIZE);
+    if (m_buf[k] == NULL)
+      {
+      SetError("Out of memory (buffers)");
+      return false;
+      }
+    xQueueSend(m_freequeue, &k, 0);
+    }
+
+  if (mbedtls_md_setup(&m_md, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 0) != 0 ||
+      mbedtls_md_starts(&m_md) != 0)
+    {
+    SetError("SHA256 init failed");
+    return false;
+    }
+
+  // The decompressed size is unknown, so for compressed images we need to
+  // erase the partition as we go (or all of it on older IDF versions):
+  size_t imagesize = (expected > 0 && !compressed) ? expected : OTA_SIZE_UNKNOWN;
+#ifdef OTA_WITH_SEQUENTIAL_WRITES
+  if (imagesize == OTA_SIZE_UNKNOWN)
+    imagesize = OTA_WITH_SEQUENTIAL_WRITES;
+#endif
+  esp_err_t err = esp_ota_begin(m_target, imagesize, &m_otah);
+  if (err != ESP_OK)
+    {
+    SetError("ESP32 error #%d when starting OTA operation", err);
+    return false;
+    }
+  m_started = true;
+
+  if (xTaskCreatePinnedToCore(WriterTaskEntry, "OVMS OTAWriter",
+      4096, (void*)this, 5, &m_task, CORE(1)) != pdPASS)
+    {
+    m_task = NULL;
+    SetError("Cannot create flash writer task");
+    esp_ota_end(m_otah);
+    m_started = false;
+    return false;
+    }
+
+  return true;
+  }
+
+/**
+ * Feed: producer side, pass input data into the pipeline
+ *  Blocks while all buffers are in use by the writer (back pressure).
+ */
+bool OvmsOTAPipeline::Feed(const uint8_t* data, size_t len)
+  {
+  if (!m_started || m_failed)
+    return false;
+  m_received += len;
+  if (!m_compressed)
+    return Stage(data, len);
+
+  if (m_expected > 0)
+    MyOTA.SetFlashPerc((m_received*100)/m_expected);
+  return Inflate(data, len);
+  }
+
+/**
+ * Inflate: decompress input data and stage the output
+ */
+bool OvmsOTAPipeline::Inflate(const uint8_t* data, size_t len)
+  {
+#ifdef CONFIG_OVMS_SC_ZIP
+  m_zs.next_in = (Bytef*) data;
+  m_zs.avail_in = len;
+  do
+    {
+    if (m_zsdone)
+      {
+      SetError("Trailing data after end of compressed image");
+      return false;
+      }
+    m_zs.next_out = m_zsout;
+    m_zs.avail_out = OTA_PIPELINE_INFLATESIZE;
+    int res = inflate(&m_zs, Z_NO_FLUSH);
+    if (res == Z_STREAM_END)
+      m_zsdone = true;
+    else if (res == Z_BUF_ERROR)
+      break; // no progress possible, need more input
+    else if (res != Z_OK)
+      {
+      SetError("Inflate error %d (%s)", res, m_zs.msg ? m_zs.msg : "corrupted data");
+      return false;
+      }
+    size_t n = OTA_PIPELINE_INFLATESIZE - m_zs.avail_out;
+    if (n > 0 && !Stage(m_zsout, n))
+      return false;
+    // Continue while input is left or the output buffer was filled completely
+    // (the inflater may hold more pending output):
+    } while (m_zs.avail_in > 0 || (m_zs.avail_out == 0 && !m_zsdone));
+  return true;
+#else
+  return false;
+#endif // CONFIG_OVMS_SC_ZIP
+  }
+
+/**
+ * Stage: copy image data into the stage buffers
+ */
+bool OvmsOTAPipeline::Stage(const uint8_t* data, size_t len)
+  {
+  if (m_staged + len > m_target->size)
+    {
+    SetError("Image is bigger than available partition space");
+    return false;
+    }
+
+  while (len > 0)
+    {
+    if (m_fillindex < 0)
+      {
+      xQueueReceive(m_freequeue, &m_fillindex, portMAX_DELAY);
+      m_fillpos = 0;
+      if (m_failed)
+        return false;
+      }
+    size_t n = OTA_PIPELINE_BUFSIZE - m_fillpos;
+    if (n > len) n = len;
+    memcpy(m_buf[m_fillindex] + m_fillpos, data, n);
+    m_fillpos += n;
+    m_staged += n;
+    data += n;
+    len -= n;
+    if (m_fillpos == OTA_PIPELINE_BUFSIZE)
+      Submit();
+    }
+
+  return !m_failed;
+  }
+
+bool OvmsOTAPipeline::Submit()
+  {
+  if (m_fillindex < 0)
+    return true;
+  ota_chunk_t chunk = { m_fillindex, m_fillpos };
+  m_fillindex = -1;
+  m_fillpos = 0;
+  if (chunk.len == 0)
+    return (xQueueSend(m_freequeue, &chunk.index, portMAX_DELAY) == pdTRUE);
+  return (xQueueSend(m_fullqueue, &chunk, portMAX_DELAY) == pdTRUE);
+  }
+
+void OvmsOTAPipeline::WriterTaskEntry(void* pvParameters)
+  {
+  OvmsOTAPipeline* me = (OvmsOTAPipeline*)pvParameters;
+  me->WriterTask();
+  }
+
+void OvmsOTAPipeline::WriterTask()
+  {
+  ota_chunk_t chunk;
+  while (xQueueReceive(m_fullqueue, &chunk, portMAX_DELAY) == pdTRUE)
+    {
+    if (chunk.index < 0)
+      break; // end of stream
+
+    const uint8_t* data = m_buf[chunk.index];
+    if (!m_failed)
+      {
+      if (m_written == 0)
+        {
+        m_hashcheck = (chunk.len > OTA_IMAGE_HASH_APPENDED_OFS &&
+                       data[0] == OTA_IMAGE_MAGIC &&
+                       data[OTA_IMAGE_HASH_APPENDED_OFS] == 1);
+        }
+      HashUpdate(data, chunk.len);
+      esp_err_t err = esp_ota_write(m_otah, data, chunk.len);
+      if (err != ESP_OK)
+        {
+        SetError("ESP32 error #%d when writing to flash - state is inconsistent", err);
+        }
+      else
+        {
+        m_written += chunk.len;
+        if (m_expected > 0 && !m_compressed)
+          MyOTA.SetFlashPerc((m_written*100)/m_expected);
+        }
+      }
+
+    // Return buffer to producer:
+    xQueueSend(m_freequeue, &chunk.index, portMAX_DELAY);
+    }
+
+  m_task = NULL;
+  xSemaphoreGive(m_done);
+  vTaskDelete(NULL);
+  }
+
+/**
+ * HashUpdate: feed the SHA256 digest, holding back the last 32 bytes seen
+ *  (the appended digest is not part of the hashed data)
+ */
+void OvmsOTAPipeline::HashUpdate(const uint8_t* data, size_t len)
+  {
+  if (!m_hashcheck)
+    return;
+  if (len >= OTA_PIPELINE_HASHLEN)
+    {
+    mbedtls_md_update(&m_md, m_hashtail, m_hashtailfill);
+    mbedtls_md_update(&m_md, data, len - OTA_PIPELINE_HASHLEN);
+    memcpy(m_hashtail, data + len - OTA_PIPELINE_HASHLEN, OTA_PIPELINE_HASHLEN);
+    m_hashtailfill = OTA_PIPELINE_HASHLEN;
+    }
+  else
+    {
+    if (m_hashtailfill + len > OTA_PIPELINE_HASHLEN)
+      {
+      size_t out = m_hashtailfill + len - OTA_PIPELINE_HASHLEN;
+      mbedtls_md_update(&m_md, m_hashtail, out);
+      memmove(m_hashtail, m_hashtail + out, m_hashtailfill - out);
+      m_hashtailfill -= out;
+      }
+    memcpy(m_hashtail + m_hashtailfill, data, len);
+    m_hashtailfill += len;
+    }
+  }
+
+bool OvmsOTAPipeline::HashVerify()
+  {
+  if (!m_hashcheck)
+    return true;
+  uint8_t digest[OTA_PIPELINE_HASHLEN];
+  if (m_hashtailfill != OTA_PIPELINE_HASHLEN || mbedtls_md_finish(&m_md, digest) != 0)
+    return false;
+  return (memcmp(digest, m_hashtail, OTA_PIPELINE_HASHLEN) == 0);
+  }
+
+/**
+ * Finish: flush buffers, wait for the writer, verify & finalise the partition
+ */
+bool OvmsOTAPipeline::Finish()
+  {
+  if (!m_started)
+    return false;
+
+  if (!m_failed)
+    Submit();
+  if (m_task)
+    {
+    ota_chunk_t eos = { -1, 0 };
+    xQueueSend(m_fullqueue, &eos, portMAX_DELAY);
+    xSemaphoreTake(m_done, portMAX_DELAY);
+    }
+
+#ifdef CONFIG_OVMS_SC_ZIP
+  if (!m_failed && m_compressed && !m_zsdone)
+    SetError("Compressed image is truncated");
+#endif // CONFIG_OVMS_SC_ZIP
+  if (!m_failed && m_written != m_staged)
+    SetError("Image size (%d) does not match expected (%d)", m_written, m_staged);
+  if (!m_failed && m_expected > 0 && m_received != m_expected)
+    SetError("Input size (%d) does not match expected (%d)", m_received, m_expected);
+  if (!m_failed && !HashVerify())
+    SetError("Image SHA256 digest mismatch - download corrupted");
+
+  m_started = false;
+  esp_err_t err = esp_ota_end(m_otah);
+  if (!m_failed && err != ESP_OK)
+    SetError("ESP32 error #%d finalising OTA operation - state is inconsistent", err);
+
+  if (!m_failed)
+    ESP_LOGI(TAG, "%s: flashed %d bytes from %d bytes input%s", m_name, m_written, m_received,
+      m_hashcheck ? ", SHA256 verified" : "");
+  return !m_failed;
+  }
+
+void OvmsOTAPipeline::Abort()
+  {
+  if (m_task)
+    {
+    m_failed = true;
+    ota_chunk_t eos = { -1, 0 };
+    xQueueSend(m_fullqueue, &eos, portMAX_DELAY);
+    xSemaphoreTake(m_done, portMAX_DELAY);
+    }
+  if (m_started)
+    {
+    esp_ota_end(m_otah);
+    m_started = false;
+    }
+  }
+
+/**
+ * FlashFile: flash an image from an open file
+ */
+bool OvmsOTAPipeline::FlashFile(FILE* f, size_t size, bool compressed /*=false*/)
+  {
+  if (!Begin(size, compressed))
+    return false;
+
+  uint8_t rbuf[1024];
+  while (size_t n = fread(rbuf, sizeof(char), sizeof(rbuf), f))
+    {
+    if (!Feed(rbuf, n))
+      return false;
+    }
+  return true;
+  }
+
+/**
+ * Download: flash an image from an HTTP server
+ *  URLs ending in ".gz" are treated as compressed images.
+ *  If the connection drops, the download is resumed using a Range request
+ *  (up to <retries> times). Servers not supporting ranges get the already
+ *  received part skipped.
+ */
+bool OvmsOTAPipeline::Download(const std::string& url, int retries /*=OTA_PIPELINE_RETRIES*/)
+  {
+  int attempt = 0;
+  size_t sofar = 0;
+  uint8_t rbuf[1024];
+
+  while (true)
+    {
+    char range[40];
+    size_t skip = 0;
+    if (m_started)
+      snprintf(range, sizeof(range), "Range: bytes=%u-\r\n", (unsigned)m_received);
+    OvmsHttpClient http(url, "GET", m_started ? range : NULL);
+
+    if (!http.IsOpen())
+      {
+      if (!m_started || ++attempt > retries)
+        {
+        SetError("HTTP request failed");
+        return false;
+        }
+      ESP_LOGW(TAG, "%s: reconnect failed, retry %d/%d", m_name, attempt, retries);
+      vTaskDelay(pdMS_TO_TICKS(attempt*2000));
+      continue;
+      }
+
+    if (!m_started)
+      {
+      if (http.ResponseCode() != 200)
+        {
+        SetError("HTTP request failed (response %d)", http.ResponseCode());
+        return false;
+        }
+      size_t expected = http.BodySize();
+      if (expected < 32)
+        {
+        SetError("Expected download file size (%d) is invalid", expected);
+        return false;
+        }
+      if (m_writer)
+        m_writer->printf("Expected file size is %d\n", expected);
+      if (!Begin(expected, IsCompressedName(url)))
+        return false;
+      }
+    else if (http.ResponseCode() == 206 && http.BodySize() == m_expected - m_received)
+      {
+      ESP_LOGI(TAG, "%s: resuming download at %d/%d bytes", m_name, m_received, m_expected);
+      if (m_writer)
+        m_writer->printf("Resuming download at %d bytes\n", m_received);
+      m_resumes++;
+      }
+    else if (http.ResponseCode() == 200 && http.BodySize() == m_expected)
+      {
+      ESP_LOGW(TAG, "%s: server does not support ranges, skipping %d bytes", m_name, m_received);
+      skip = m_received;
+      m_resumes++;
+      }
+    else
+      {
+      SetError("Cannot resume download (response %d, size %d)", http.ResponseCode(), http.BodySize());
+      return false;
+      }
+
+    // Detect stalled connections:
+    struct timeval tv = { OTA_PIPELINE_RXTIMEOUT, 0 };
+    setsockopt(http.Socket(), SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    size_t k;
+    while ((k = http.BodyRead(rbuf, sizeof(rbuf))) > 0 && k != (size_t)-1)
+      {
+      const uint8_t* data = rbuf;
+      if (skip > 0)
+        {
+        size_t n = (k < skip) ? k : skip;
+        skip -= n;
+        data += n;
+        k -= n;
+        if (k == 0) continue;
+        }
+      if (!Feed(data, k))
+        {
+        http.Disconnect();
+        return false;
+        }
+      sofar += k;
+      if (m_writer && sofar > 100000)
+        {
+        m_writer->printf("Downloading... (%d bytes so far)\n", m_received);
+        sofar = 0;
+        }
+      }
+    http.Disconnect();
+
+    if (m_received >= m_expected)
+      break;
+    if (++attempt > retries)
+      {
+      SetError("Download interrupted at %d of %d bytes", m_received, m_expected);
+      return false;
+      }
+    ESP_LOGW(TAG, "%s: download interrupted at %d/%d bytes, retry %d/%d",
+      m_name, m_received, m_expected, attempt, retries);
+    vTaskDelay(pdMS_TO_TICKS(attempt*2000));
+    }
+
+  if (m_writer)
+    m_writer->printf("Download complete (at %d bytes)\n", m_received);
+  return true;
+  }
@@ -0,0 +1,151 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __OTA_PIPELINE_H__
+#define __OTA_PIPELINE_H__
+
+#include <string>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include <esp_ota_ops.h>
+#include "mbedtls/md.h"
+#ifdef CONFIG_OVMS_SC_ZIP
+#include "zlib.h"
+#endif // CONFIG_OVMS_SC_ZIP
+
+class OvmsWriter;
+
+#define OTA_PIPELINE_BUFSIZE        16384   // Size of each PSRAM stage buffer
+#define OTA_PIPELINE_BUFCOUNT       3       // Number of stage buffers
+#define OTA_PIPELINE_HASHLEN        32      // SHA256 digest appended to the image
+#define OTA_PIPELINE_RETRIES        5       // Default HTTP resume attempts
+#define OTA_PIPELINE_RXTIMEOUT      30      // Socket receive timeout [s]
+#define OTA_PIPELINE_WINDOWBITS     15      // Inflate window size (32 KB, allocated in PSRAM)
+#define OTA_PIPELINE_INFLATESIZE    4096    // Inflate output chunk size
+
+// OvmsOTAPipeline: two stage OTA flash pipeline
+//
+// The producer (network or file reader, running in the caller's task) fills
+// large PSRAM buffers via Feed(), while a dedicated writer task drains them
+// into the OTA partition. Flash erase/write and network/file reads thereby
+// run in parallel, with the number of buffers limiting the read-ahead.
+//
+// The writer task also hashes the image on the fly and checks the SHA256
+// digest appended to the image by esptool, so a corrupted transfer is
+// detected before the boot partition is switched.
+//
+// Download() adds HTTP Range based resumption of interrupted transfers, so
+// a dropped connection only costs the bytes not yet received.
+//
+// Compressed images (gzip or zlib format, i.e. "ovms3.bin.gz") are inflated
+// in the producer stage before being staged for the writer. The gzip/zlib
+// checksum of the decompressed stream is validated by the inflater.
+
+class OvmsOTAPipeline
+  {
+  public:
+    OvmsOTAPipeline(const char* name, const esp_partition_t* target, OvmsWriter* writer=NULL);
+    ~OvmsOTAPipeline();
+
+  public:
+    bool Begin(size_t expected, bool compressed=false);
+    bool Feed(const uint8_t* data, size_t len);
+    bool Finish();
+    void Abort();
+
+  public:
+    bool Download(const std::string& url, int retries=OTA_PIPELINE_RETRIES);
+    bool FlashFile(FILE* f, size_t size, bool compressed=false);
+    static bool IsCompressedName(const std::string& name);
+
+  public:
+    const std::string& GetError() { return m_error; }
+    size_t GetReceived() { return m_received; }
+    size_t GetWritten() { return m_written; }
+    bool IsCompressed() { return m_compressed; }
+    int GetResumes() { return m_resumes; }
+
+  protected:
+    void SetError(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
+    bool Stage(const uint8_t* data, size_t len);
+    bool Inflate(const uint8_t* data, size_t len);
+    bool Submit();
+    static void WriterTaskEntry(void* pvParameters);
+    void WriterTask();
+    void HashUpdate(const uint8_t* data, size_t len);
+    bool HashVerify();
+
+  protected:
+    typedef struct
+      {
+      int index;
+      size_t len;
+      } ota_chunk_t;
+
+  protected:
+    const char* m_name;
+    const esp_partition_t* m_target;
+    OvmsWriter* m_writer;
+    esp_ota_handle_t m_otah;
+    bool m_started;
+    std::string m_error;
+    volatile bool m_failed;
+
+    uint8_t* m_buf[OTA_PIPELINE_BUFCOUNT];
+    int m_fillindex;                    // Buffer currently being filled, -1 = none
+    size_t m_fillpos;
+    QueueHandle_t m_freequeue;          // Indices of empty buffers
+    QueueHandle_t m_fullqueue;          // Filled chunks to be written
+    SemaphoreHandle_t m_done;
+    TaskHandle_t m_task;
+
+    size_t m_expected;                  // Expected input size (0 = unknown)
+    size_t m_received;                  // Input bytes received
+    size_t m_staged;                    // Image bytes passed to the writer
+    size_t m_written;                   // Image bytes written to flash
+    int m_resumes;
+
+    mbedtls_md_context_t m_md;
+    bool m_hashcheck;                   // Image has an appended digest to check
+    uint8_t m_hashtail[OTA_PIPELINE_HASHLEN];
+    size_t m_hashtailfill;
+
+    bool m_compressed;
+#ifdef CONFIG_OVMS_SC_ZIP
+    z_stream m_zs;
+    bool m_zsinit;
+    bool m_zsdone;
+    uint8_t* m_zsout;
+#endif // CONFIG_OVMS_SC_ZIP
+  };
+
+#endif //#ifndef __OTA_PIPELINE_H__
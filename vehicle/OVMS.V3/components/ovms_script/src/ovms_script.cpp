@@ -37,6 +37,7 @@ static const char *TAG = "script";
 #include <string.h>
 #include <stdio.h>
 #include <dirent.h>
+#include <sys/stat.h>
 #include <esp_task_wdt.h>
 #include "ovms_malloc.h"
 #include "ovms_module.h"
@@ -71,6 +72,22 @@ static void script_compact(int verbosity, OvmsWriter* writer, OvmsCommand* cmd,
   MyDuktape.DuktapeCompact();
   }
 
+static void script_cache_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyDuktape.BytecodeStatus(writer);
+  }
+
+static void script_cache_clear(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyDuktape.BytecodeClear();
+  writer->puts("Bytecode cache cleared");
+  }
+
+static void script_stats(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyDuktape.DuktapeHeapStatus(writer);
+  }
+
 static void script_meminfo(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   MyDuktape.DuktapeEvalNoResult("JSON.print(meminfo())", writer);
@@ -88,6 +105,8 @@ static void script_ovms(int verbosity, OvmsWriter* writer,
     {
     // Javascript script
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+    struct stat st;
+    time_t mtime = (fstat(fileno(sf), &st) == 0) ? st.st_mtime : 0;
     fseek(sf,0,SEEK_END);
     long slen = ftell(sf);
     fseek(sf,0,SEEK_SET);
@@ -95,7 +114,7 @@ static void script_ovms(int verbosity, OvmsWriter* writer,
     memset(script,0,slen+1);
     fread(script,1,slen,sf);
     MyDuktape.NotifyDuktapeModuleLoad(spath);
-    MyDuktape.DuktapeEvalNoResult(script, writer, spath);
+    MyDuktape.DuktapeEvalNoResult(script, writer, spath, mtime);
     MyDuktape.NotifyDuktapeModuleUnload(spath);
     delete [] script;
 #else // #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
@@ -241,6 +260,10 @@ OvmsScripts::OvmsScripts()
   cmd_script->RegisterCommand("eval","Eval some javascript code",script_eval,"<code>",1,1);
   cmd_script->RegisterCommand("compact","Compact javascript heap",script_compact);
   cmd_script->RegisterCommand("meminfo","Show heap memory status",script_meminfo);
+  cmd_script->RegisterCommand("stats","Show heap, GC & allocation statistics",script_stats);
+  OvmsCommand* cmd_cache = cmd_script->RegisterCommand("cache","Compiled script bytecode cache");
+  cmd_cache->RegisterCommand("status","Show bytecode cache status",script_cache_status);
+  cmd_cache->RegisterCommand("clear","Clear bytecode cache",script_cache_clear);
 #endif // #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   MyCommandApp.RegisterCommand(".","Run a script",script_run,"<path>",1,1, true, vfs_file_validate);
   }
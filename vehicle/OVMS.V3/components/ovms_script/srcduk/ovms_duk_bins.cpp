@@ -0,0 +1,258 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "ovms-duktape";
+
+#include <string.h>
+#include <inttypes.h>
+#include "ovms_malloc.h"
+#include "ovms_duk_bins.h"
+
+#define DUKBIN_FREE           0xff
+
+// Slot sizes (multiples of 8 to keep doubles aligned):
+static const uint16_t dukbin_size[DUKBIN_CLASSES] = { 16, 24, 32, 48, 64, 96, 128, 192, 256 };
+
+static inline int dukbin_class(size_t size)
+  {
+  for (int cls = 0; cls < DUKBIN_CLASSES; cls++)
+    {
+    if (size <= dukbin_size[cls])
+      return cls;
+    }
+  return -1;
+  }
+
+DuktapeBins::DuktapeBins()
+  {
+  m_base = m_end = NULL;
+  m_owned = false;
+  m_pages = NULL;
+  m_pagecnt = 0;
+  m_freepages = NULL;
+  memset(m_partial, 0, sizeof(m_partial));
+  memset(m_used, 0, sizeof(m_used));
+  memset(m_pagesused, 0, sizeof(m_pagesused));
+  m_allocs = m_misses = 0;
+  }
+
+DuktapeBins::~DuktapeBins()
+  {
+  Deinit();
+  }
+
+/**
+ * Init: set up the page area
+ *  mem: memory to use (page aligned), NULL = allocate
+ *  size: page area size, rounded down to full pages
+ */
+bool DuktapeBins::Init(void* mem, size_t size)
+  {
+  Deinit();
+  m_pagecnt = size / DUKBIN_PAGESIZE;
+  if (m_pagecnt == 0)
+    return false;
+
+  m_pages = (dukbin_page_t*) ExternalRamCalloc(m_pagecnt, sizeof(dukbin_page_t));
+  if (!m_pages)
+    {
+    m_pagecnt = 0;
+    return false;
+    }
+  if (mem)
+    {
+    m_base = (uint8_t*) mem;
+    m_owned = false;
+    }
+  else
+    {
+    m_base = (uint8_t*) ExternalRamMalloc(m_pagecnt * DUKBIN_PAGESIZE);
+    m_owned = true;
+    if (!m_base)
+      {
+      ESP_LOGE(TAG, "DuktapeBins: unable to allocate %d pages", m_pagecnt);
+      free(m_pages);
+      m_pages = NULL;
+      m_pagecnt = 0;
+      return false;
+      }
+    }
+  m_end = m_base + m_pagecnt * DUKBIN_PAGESIZE;
+
+  for (int i = m_pagecnt-1; i >= 0; i--)
+    {
+    m_pages[i].cls = DUKBIN_FREE;
+    m_pages[i].next = m_freepages;
+    m_freepages = &m_pages[i];
+    }
+
+  ESP_LOGI(TAG, "DuktapeBins: %d pages, %u bytes", m_pagecnt, (unsigned)(m_end - m_base));
+  return true;
+  }
+
+void DuktapeBins::Deinit()
+  {
+  if (m_owned && m_base)
+    free(m_base);
+  if (m_pages)
+    free(m_pages);
+  m_base = m_end = NULL;
+  m_owned = false;
+  m_pages = NULL;
+  m_pagecnt = 0;
+  m_freepages = NULL;
+  memset(m_partial, 0, sizeof(m_partial));
+  memset(m_used, 0, sizeof(m_used));
+  memset(m_pagesused, 0, sizeof(m_pagesused));
+  }
+
+void DuktapeBins::ListInsert(dukbin_page_t** list, dukbin_page_t* pg)
+  {
+  pg->prev = NULL;
+  pg->next = *list;
+  if (*list)
+    (*list)->prev = pg;
+  *list = pg;
+  }
+
+void DuktapeBins::ListRemove(dukbin_page_t** list, dukbin_page_t* pg)
+  {
+  if (pg->prev)
+    pg->prev->next = pg->next;
+  else
+    *list = pg->next;
+  if (pg->next)
+    pg->next->prev = pg->prev;
+  pg->next = pg->prev = NULL;
+  }
+
+/**
+ * Alloc: allocate a slot for size bytes
+ *  Returns NULL if the size exceeds DUKBIN_MAXSIZE or no page is available,
+ *  the caller then falls back to the general heap.
+ */
+void* DuktapeBins::Alloc(size_t size)
+  {
+  int cls = dukbin_class(size);
+  if (cls < 0 || !m_base)
+    return NULL;
+
+  dukbin_page_t* pg = m_partial[cls];
+  if (!pg)
+    {
+    // Assign a free page to the class:
+    pg = m_freepages;
+    if (!pg)
+      {
+      m_misses++;
+      return NULL;
+      }
+    m_freepages = pg->next;
+    size_t slotsize = dukbin_size[cls];
+    uint8_t* mem = PageMem(pg);
+    pg->cls = cls;
+    pg->used = 0;
+    pg->freelist = NULL;
+    for (int i = DUKBIN_PAGESIZE / slotsize - 1; i >= 0; i--)
+      {
+      void** slot = (void**)(mem + i * slotsize);
+      *slot = pg->freelist;
+      pg->freelist = slot;
+      }
+    ListInsert(&m_partial[cls], pg);
+    m_pagesused[cls]++;
+    }
+
+  void** slot = (void**) pg->freelist;
+  pg->freelist = *slot;
+  pg->used++;
+  if (!pg->freelist)
+    ListRemove(&m_partial[cls], pg);   // page full
+  m_used[cls]++;
+  m_allocs++;
+  return slot;
+  }
+
+void DuktapeBins::Free(void* ptr)
+  {
+  dukbin_page_t* pg = &m_pages[((uint8_t*)ptr - m_base) / DUKBIN_PAGESIZE];
+  int cls = pg->cls;
+  bool wasfull = (pg->freelist == NULL);
+
+  *(void**)ptr = pg->freelist;
+  pg->freelist = ptr;
+  pg->used--;
+  m_used[cls]--;
+
+  if (pg->used == 0)
+    {
+    // Return page to the free pool:
+    if (!wasfull)
+      ListRemove(&m_partial[cls], pg);
+    pg->cls = DUKBIN_FREE;
+    pg->next = m_freepages;
+    m_freepages = pg;
+    m_pagesused[cls]--;
+    }
+  else if (wasfull)
+    {
+    ListInsert(&m_partial[cls], pg);
+    }
+  }
+
+size_t DuktapeBins::GetSize(const void* ptr)
+  {
+  dukbin_page_t* pg = &m_pages[((const uint8_t*)ptr - m_base) / DUKBIN_PAGESIZE];
+  return dukbin_size[pg->cls];
+  }
+
+size_t DuktapeBins::GetUsedSize()
+  {
+  size_t used = 0;
+  for (int cls = 0; cls < DUKBIN_CLASSES; cls++)
+    used += m_used[cls] * dukbin_size[cls];
+  return used;
+  }
+
+void DuktapeBins::Status(OvmsWriter* writer)
+  {
+  if (!m_base)
+    {
+    writer->puts("Bins: disabled");
+    return;
+    }
+  int freepages = m_pagecnt;
+  for (int cls = 0; cls < DUKBIN_CLASSES; cls++)
+    freepages -= m_pagesused[cls];
+  writer->printf("Bins: %d/%d pages used, %u bytes in use, %" PRIu32 " allocs, %" PRIu32 " fallbacks\n",
+    m_pagecnt - freepages, m_pagecnt, (unsigned)GetUsedSize(), m_allocs, m_misses);
+  for (int cls = 0; cls < DUKBIN_CLASSES; cls++)
+    {
+    if (m_pagesused[cls] == 0) continue;
+    uint32_t slots = m_pagesused[cls] * (DUKBIN_PAGESIZE / dukbin_size[cls]);
+    writer->printf("  %3u bytes: %3d pages, %5" PRIu32 "/%5" PRIu32 " slots used (%u%%)\n",
+      dukbin_size[cls], m_pagesused[cls], m_used[cls], slots, (unsigned)(m_used[cls] * 100 / slots));
+    }
+  }
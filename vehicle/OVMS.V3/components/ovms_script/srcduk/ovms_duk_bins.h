@@ -0,0 +1,95 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __OVMS_DUK_BINS_H__
+#define __OVMS_DUK_BINS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "ovms_command.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// DuktapeBins: size class allocator for small Duktape heap objects
+//
+// Duktape allocates lots of small, short lived objects (strings, objects,
+// property tables). Serving these from fixed size slots in dedicated pages
+// keeps them from fragmenting the general heap, and allocation & free are
+// O(1) list operations. Pages are assigned to a size class on demand and
+// returned to the free page pool when their last slot is freed.
+//
+// Not thread safe: only used by the Duktape task.
+
+#define DUKBIN_PAGESIZE       2048
+#define DUKBIN_CLASSES        9
+#define DUKBIN_MAXSIZE        256
+
+typedef struct dukbin_page_s
+  {
+  struct dukbin_page_s* next;           // partial page list / free page list
+  struct dukbin_page_s* prev;
+  void* freelist;                       // free slots in this page
+  uint16_t used;                        // slots in use
+  uint8_t cls;                          // size class, DUKBIN_FREE = unassigned
+  } dukbin_page_t;
+
+class DuktapeBins
+  {
+  public:
+    DuktapeBins();
+    ~DuktapeBins();
+
+  public:
+    bool Init(void* mem, size_t size);
+    void Deinit();
+    bool IsActive() { return m_base != NULL; }
+    bool Owns(const void* ptr) { return (const uint8_t*)ptr >= m_base && (const uint8_t*)ptr < m_end; }
+    void* Alloc(size_t size);
+    void Free(void* ptr);
+    size_t GetSize(const void* ptr);
+
+  public:
+    size_t GetTotalSize() { return m_end - m_base; }
+    size_t GetUsedSize();
+    void Status(OvmsWriter* writer);
+
+  protected:
+    uint8_t* PageMem(dukbin_page_t* pg) { return m_base + (pg - m_pages) * DUKBIN_PAGESIZE; }
+    void ListInsert(dukbin_page_t** list, dukbin_page_t* pg);
+    void ListRemove(dukbin_page_t** list, dukbin_page_t* pg);
+
+  protected:
+    uint8_t* m_base;                    // page area
+    uint8_t* m_end;
+    bool m_owned;                       // page area allocated by Init()
+    dukbin_page_t* m_pages;             // page descriptors
+    int m_pagecnt;
+    dukbin_page_t* m_freepages;         // unassigned pages
+    dukbin_page_t* m_partial[DUKBIN_CLASSES]; // pages with free slots per class
+    uint32_t m_used[DUKBIN_CLASSES];    // slots in use per class
+    int m_pagesused[DUKBIN_CLASSES];    // pages assigned per class
+    uint32_t m_allocs;                  // allocations served
+    uint32_t m_misses;                  // allocations not served (no free page)
+  };
+
+#endif //#ifndef __OVMS_DUK_BINS_H__
@@ -171,6 +171,13 @@ static duk_ret_t DukOvmsMemInfo(duk_context *ctx)
     dc.Push(heapinfo.total_blocks);               dc.PutProp(obj_idx, "sysTotalBlocks");
   #endif
 
+  // Small object bins (not included in the heap figures above):
+  size_t bintotal, binused;
+  MyDuktape.GetBinInfo(bintotal, binused);
+  dc.Push((unsigned int)bintotal);                dc.PutProp(obj_idx, "binTotalBytes");
+  dc.Push((unsigned int)binused);                 dc.PutProp(obj_idx, "binUsedBytes");
+  dc.Push((unsigned int)(bintotal - binused));    dc.PutProp(obj_idx, "binFreeBytes");
+
   return 1;
   }
 
@@ -32,15 +32,23 @@
 static const char *TAG = "ovms-duktape";
 
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <string.h>
 #include <stdio.h>
 #include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include <esp_task_wdt.h>
 #include "ovms_malloc.h"
 #include "ovms_module.h"
 #include "ovms_duktape.h"
+#include "ovms_duk_bins.h"
+#include "ovms_version.h"
+#include "metrics_standard.h"
+#include "esp_timer.h"
 #include "ovms_config.h"
 #include "ovms_command.h"
 #include "ovms_events.h"
@@ -61,8 +69,27 @@ OvmsWriter* duktapewriter = NULL;
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
   #include "umm_malloc.c"
   static void *umm_memory = NULL;
+#else
+  #include "esp_heap_caps.h"
 #endif
 
+static DuktapeBins duk_bins;
+
+#define DUKTAPE_GC_IDLETIME   50        // ms idle time before running a due GC
+
+static void duk__record_timing(duktape_timing_t& t, uint32_t us)
+  {
+  static const uint32_t limit_ms[DUKTAPE_HIST_SLOTS-1] = { 1, 2, 5, 10, 20, 50, 100, 200, 500 };
+  int slot = 0;
+  while (slot < DUKTAPE_HIST_SLOTS-1 && us >= limit_ms[slot] * 1000)
+    slot++;
+  t.hist[slot]++;
+  t.count++;
+  t.total_us += us;
+  if (us > t.max_us) t.max_us = us;
+  if (us > t.period_max_us) t.period_max_us = us;
+  }
+
 ////////////////////////////////////////////////////////////////////////////////
 // Duktape utility functions
 
@@ -184,7 +211,9 @@ static duk_ret_t duk__handle_require(duk_context *ctx)
 		duk_int_t ret;
 
 		/* [ ... module source ] */
+		duktape_allocstats_t* owner = MyDuktape.SetAllocOwner(id);
 		ret = duk_safe_call(ctx, duk__eval_module_source, NULL, 2, 1);
+		MyDuktape.RestoreAllocOwner(owner);
 		if (ret != DUK_EXEC_SUCCESS)
       {
 			duk__del_cached_module(ctx, id);
@@ -399,6 +428,13 @@ void DukTapeLaunchTask(void *pvParameters)
 
 void* DukOvmsAlloc(void *udata, duk_size_t size)
   {
+  ((OvmsDuktape*)udata)->AccountAlloc(size);
+
+  // Small objects are served by the size class bins if possible:
+  void* ptr = duk_bins.Alloc(size);
+  if (ptr)
+    return ptr;
+
   #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
     return umm_malloc(size);
   #else
@@ -408,6 +444,29 @@ void* DukOvmsAlloc(void *udata, duk_size_t size)
 
 void* DukOvmsRealloc(void *udata, void *ptr, duk_size_t size)
   {
+  if (ptr == NULL)
+    return DukOvmsAlloc(udata, size);
+
+  if (duk_bins.Owns(ptr))
+    {
+    size_t slotsize = duk_bins.GetSize(ptr);
+    if (size == 0)
+      {
+      duk_bins.Free(ptr);
+      return NULL;
+      }
+    if (size <= slotsize)
+      return ptr;
+    void* newptr = DukOvmsAlloc(udata, size);
+    if (newptr)
+      {
+      memcpy(newptr, ptr, slotsize);
+      duk_bins.Free(ptr);
+      }
+    return newptr;
+    }
+
+  ((OvmsDuktape*)udata)->AccountAlloc(size);
   #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
     return umm_realloc(ptr, size);
   #else
@@ -417,6 +476,11 @@ void* DukOvmsRealloc(void *udata, void *ptr, duk_size_t size)
 
 void DukOvmsFree(void *udata, void *ptr)
   {
+  if (duk_bins.Owns(ptr))
+    {
+    duk_bins.Free(ptr);
+    return;
+    }
   #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
     umm_free(ptr);
   #else
@@ -963,6 +1027,18 @@ OvmsDuktape::OvmsDuktape()
   m_dukctx = NULL;
   m_duktaskid = NULL;
   m_duktaskqueue = NULL;
+  m_bcsize = 0;
+  m_bchits = 0;
+  m_bcmisses = 0;
+  m_bcpersist = false;
+  m_bcmaxsize = 128 * 1024;
+  m_allocowner = NULL;
+  m_allocsincegc = 0;
+  m_gcthreshold = 0;
+  m_compactpending = false;
+  memset(&m_gcminor, 0, sizeof(m_gcminor));
+  memset(&m_gcmajor, 0, sizeof(m_gcmajor));
+  memset(&m_jobs, 0, sizeof(m_jobs));
 
   // Register standard modules...
   extern const char mod_pubsub_js_start[]     asm("_binary_pubsub_js_start");
@@ -1047,6 +1123,9 @@ void OvmsDuktape::AutoInitDuktape()
   // Registering the event here rather than the constructor since MyDuktape gets constructed before
   // MyEvents.
   MyEvents.RegisterEvent(TAG,"system.shuttingdown",std::bind(&OvmsDuktape::EventSystemShuttingDown, this, _1, _2));
+  MyEvents.RegisterEvent(TAG,"config.mounted",std::bind(&OvmsDuktape::BytecodeConfigChanged, this, _1, _2));
+  MyEvents.RegisterEvent(TAG,"config.changed",std::bind(&OvmsDuktape::BytecodeConfigChanged, this, _1, _2));
+  BytecodeConfigChanged("config.mounted", NULL);
 
   if (MyConfig.GetParamValueBool("auto", "scripting", true))
     {
@@ -1085,8 +1164,12 @@ void OvmsDuktape::EventScript(std::string event, void* data)
 
   if (event == "ticker.60")
     {
-    // request garbage collection once per minute:
-    DuktapeCompact(false);
+    // request garbage collection & compaction once per minute, this is done
+    // by the Duktape task when idle; if it hasn't been idle for a minute, force:
+    if (m_compactpending)
+      DuktapeCompact(false);
+    else
+      m_compactpending = true;
     }
   }
 
@@ -1121,7 +1204,8 @@ void OvmsDuktape::DuktapeDispatchWait(duktape_queue_t* msg)
     }
   }
 
-void OvmsDuktape::DuktapeEvalNoResult(const char* text, OvmsWriter* writer, const char* filename /*=NULL*/)
+void OvmsDuktape::DuktapeEvalNoResult(const char* text, OvmsWriter* writer,
+  const char* filename /*=NULL*/, time_t mtime /*=0*/)
   {
   duktape_queue_t dmsg;
   memset(&dmsg, 0, sizeof(dmsg));
@@ -1129,10 +1213,12 @@ void OvmsDuktape::DuktapeEvalNoResult(const char* text, OvmsWriter* writer, cons
   dmsg.writer = writer;
   dmsg.body.dt_evalnoresult.text = text;
   dmsg.body.dt_evalnoresult.filename = filename;
+  dmsg.body.dt_evalnoresult.mtime = mtime;
   DuktapeDispatchWait(&dmsg);
   }
 
-float OvmsDuktape::DuktapeEvalFloatResult(const char* text, OvmsWriter* writer)
+float OvmsDuktape::DuktapeEvalFloatResult(const char* text, OvmsWriter* writer,
+  const char* filename /*=NULL*/, time_t mtime /*=0*/)
   {
   float result = 0;
   duktape_queue_t dmsg;
@@ -1141,11 +1227,14 @@ float OvmsDuktape::DuktapeEvalFloatResult(const char* text, OvmsWriter* writer)
   dmsg.writer = writer;
   dmsg.body.dt_evalfloatresult.text = text;
   dmsg.body.dt_evalfloatresult.result = &result;
+  dmsg.body.dt_evalfloatresult.filename = filename;
+  dmsg.body.dt_evalfloatresult.mtime = mtime;
   DuktapeDispatchWait(&dmsg);
   return result;
   }
 
-int OvmsDuktape::DuktapeEvalIntResult(const char* text, OvmsWriter* writer)
+int OvmsDuktape::DuktapeEvalIntResult(const char* text, OvmsWriter* writer,
+  const char* filename /*=NULL*/, time_t mtime /*=0*/)
   {
   int result = 0;
   duktape_queue_t dmsg;
@@ -1154,6 +1243,8 @@ int OvmsDuktape::DuktapeEvalIntResult(const char* text, OvmsWriter* writer)
   dmsg.writer = writer;
   dmsg.body.dt_evalintresult.text = text;
   dmsg.body.dt_evalintresult.result = &result;
+  dmsg.body.dt_evalintresult.filename = filename;
+  dmsg.body.dt_evalintresult.mtime = mtime;
   DuktapeDispatchWait(&dmsg);
   return result;
   }
@@ -1177,6 +1268,15 @@ void OvmsDuktape::DuktapeCompact(bool wait /*=true*/)
     DuktapeDispatch(&dmsg, 0);
   }
 
+void OvmsDuktape::DuktapeHeapStatus(OvmsWriter* writer)
+  {
+  duktape_queue_t dmsg;
+  memset(&dmsg, 0, sizeof(dmsg));
+  dmsg.type = DUKTAPE_heapstats;
+  dmsg.writer = writer;
+  DuktapeDispatchWait(&dmsg);
+  }
+
 void OvmsDuktape::DuktapeRequestCallback(DuktapeObject* instance, const char* method, void* data)
   {
   duktape_queue_t dmsg;
@@ -1466,6 +1566,7 @@ void OvmsDuktape::DukTapeUnload(bool unload_modules)
       NotifyDuktapeModuleUnloadAll(m_dukctx);
     ESP_LOGI(TAG,"Duktape: Clearing existing context");
     duk_destroy_heap(m_dukctx);
+    duk_bins.Deinit();
     #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
       if (umm_memory != NULL)
         {
@@ -1479,26 +1580,41 @@ void OvmsDuktape::DukTapeUnload(bool unload_modules)
 
 void OvmsDuktape::DukTapeInit()
   {
+  // Size class bins for small objects:
+  int binsize = MyConfig.GetParamValueInt("module", "duktape.binsize", 128) * 1024;
+  if (binsize < 0)
+    binsize = 0;
+
   #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
-    // Allocate dedicated UMM heap space:
+    // Allocate dedicated UMM heap space, with the bins placed in front of it:
     int memsize = MyConfig.GetParamValueInt("module", "duktape.heapsize",
       CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM_DEFAULTSIZE) * 1024;
     if (memsize <= 0)
       memsize = 512 * 1024;
     else if (memsize > UMM_MAX_BLOCKS * UMM_BLOCK_BODY_SIZE)
       memsize = UMM_MAX_BLOCKS * UMM_BLOCK_BODY_SIZE;
-    ESP_LOGI(TAG, "Duktape: Creating heap (size: %u bytes)", memsize);
-    umm_memory = ExternalRamMalloc(memsize);
+    if (binsize > memsize / 2)
+      binsize = memsize / 2;
+    binsize -= binsize % DUKBIN_PAGESIZE;
+    ESP_LOGI(TAG, "Duktape: Creating heap (size: %u bytes, bins: %u bytes)", memsize, binsize);
+    umm_memory = ExternalRamMalloc(binsize + memsize);
     if (!umm_memory)
       {
-      ESP_LOGE(TAG, "Duktape: unable to allocate %u bytes for the heap", memsize);
+      ESP_LOGE(TAG, "Duktape: unable to allocate %u bytes for the heap", binsize + memsize);
       return;
       }
-    umm_init_heap(umm_memory, memsize);
+    if (binsize > 0)
+      duk_bins.Init(umm_memory, binsize);
+    umm_init_heap((uint8_t*)umm_memory + binsize, memsize);
   #else
-    ESP_LOGI(TAG, "Duktape: Creating heap");
+    ESP_LOGI(TAG, "Duktape: Creating heap (bins: %u bytes)", binsize);
+    if (binsize > 0)
+      duk_bins.Init(NULL, binsize);
   #endif
 
+  m_gcthreshold = MyConfig.GetParamValueInt("module", "duktape.gc.threshold", 64) * 1024;
+  m_allocsincegc = 0;
+
   m_dukctx = duk_create_heap(DukOvmsAlloc,
     DukOvmsRealloc,
     DukOvmsFree,
@@ -1600,24 +1716,452 @@ void OvmsDuktape::DukTapeTask()
 
   while(1)
     {
-    if (xQueueReceive(m_duktaskqueue, &msg, pdMS_TO_TICKS(5000))==pdTRUE)
+    // GC due? Then only wait a short idle time for the next job, and run the
+    // GC if none arrives, so collections don't delay event & callback handling:
+    bool gcdue = (m_dukctx != NULL) &&
+      (m_compactpending || (m_gcthreshold > 0 && m_allocsincegc >= m_gcthreshold));
+    TickType_t wait = gcdue ? pdMS_TO_TICKS(DUKTAPE_GC_IDLETIME) : pdMS_TO_TICKS(5000);
+    if (xQueueReceive(m_duktaskqueue, &msg, wait)==pdTRUE)
       {
       esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
+      int64_t start = esp_timer_get_time();
       ProcessJob(msg);
+      duk__record_timing(m_jobs, esp_timer_get_time() - start);
       if (msg.waitcompletion)
         {
         // Signal the completion...
         xSemaphoreGive(msg.waitcompletion);
         }
       }
+    else if (gcdue)
+      {
+      RunGC(m_compactpending);
+      }
     esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
     }
   }
 
+////////////////////////////////////////////////////////////////////////////////
+// Bytecode cache
+
+#define BYTECODE_DIR        "/store/.bytecode"
+#define BYTECODE_MAGIC      0x4342564f  // "OVBC"
+
+typedef struct
+  {
+  uint32_t magic;
+  uint32_t build;                       // firmware build hash
+  int64_t mtime;                        // source file modification time
+  uint32_t srcsize;                     // source size
+  uint32_t keysize;                     // key (path) length, key follows header
+  uint32_t size;                        // bytecode size, bytecode follows key
+  } duktape_bytecode_file_t;
+
+static uint32_t duk__fnv1a(const char* data, size_t len, uint32_t hash=2166136261u)
+  {
+  while (len--)
+    {
+    hash ^= (uint8_t) *data++;
+    hash *= 16777619u;
+    }
+  return hash;
+  }
+
+static uint32_t duk__build_hash()
+  {
+  // The bytecode format depends on the Duktape version & configuration,
+  // so persisted bytecode is only valid for the firmware build that created it:
+  static uint32_t hash = 0;
+  if (hash == 0)
+    {
+    std::string build = GetOVMSVersion();
+    build.append(DUK_GIT_DESCRIBE);
+    hash = duk__fnv1a(build.data(), build.size());
+    }
+  return hash;
+  }
+
+static duk_ret_t duk__load_function(duk_context *ctx, void *udata)
+  {
+  duk_load_function(ctx);
+  return 1;
+  }
+
+/**
+ * DukCompile: compile script text as eval code
+ *  If a filename and mtime are given, the compiled function is looked up in /
+ *  stored to the bytecode cache.
+ *  Returns 0 with the function on the value stack, or != 0 with the error.
+ */
+duk_int_t OvmsDuktape::DukCompile(const char* text, const char* filename, time_t mtime)
+  {
+  size_t srcsize = strlen(text);
+  bool usecache = (filename && mtime);
+
+  if (usecache && BytecodeLoad(filename, mtime, srcsize))
+    return 0;
+
+  duk_push_lstring(m_dukctx, text, srcsize);
+  duk_push_string(m_dukctx, filename ? filename : "eval");
+  duk_int_t res = duk_pcompile(m_dukctx, DUK_COMPILE_EVAL);
+  if (res == 0 && usecache)
+    BytecodeStore(filename, mtime, srcsize);
+  return res;
+  }
+
+std::string OvmsDuktape::BytecodePath(const std::string& key)
+  {
+  char name[16];
+  snprintf(name, sizeof(name), "/%08" PRIx32 ".dbc", duk__fnv1a(key.data(), key.size()));
+  return std::string(BYTECODE_DIR).append(name);
+  }
+
+void OvmsDuktape::BytecodeConfigChanged(std::string event, void* data)
+  {
+  OvmsConfigParam* param = (OvmsConfigParam*) data;
+  if (param && param->GetName() != "scripting")
+    return;
+  OvmsMutexLock lock(&m_bcmutex);
+  m_bcpersist = MyConfig.GetParamValueBool("scripting", "bytecode.persist", false);
+  m_bcmaxsize = MyConfig.GetParamValueInt("scripting", "bytecode.cachesize", 128) * 1024;
+  }
+
+bool OvmsDuktape::BytecodeLoad(const std::string& key, time_t mtime, size_t srcsize)
+  {
+  OvmsMutexLock lock(&m_bcmutex);
+
+  auto it = m_bcmap.find(key);
+  if (it != m_bcmap.end() && (it->second.mtime != mtime || it->second.srcsize != srcsize))
+    {
+    ESP_LOGD(TAG, "Bytecode: %s changed, recompiling", key.c_str());
+    m_bcsize -= it->second.size;
+    free(it->second.data);
+    m_bcmap.erase(it);
+    it = m_bcmap.end();
+    }
+
+  if (it == m_bcmap.end() && m_bcpersist)
+    {
+    // Try to load from persistent cache:
+    std::string path = BytecodePath(key);
+    FILE* f = fopen(path.c_str(), "r");
+    if (f)
+      {
+      duktape_bytecode_file_t hdr;
+      uint8_t* data = NULL;
+      if (fread(&hdr, sizeof(hdr), 1, f) == 1
+          && hdr.magic == BYTECODE_MAGIC && hdr.build == duk__build_hash()
+          && hdr.mtime == (int64_t)mtime && hdr.srcsize == srcsize
+          && hdr.keysize == key.size() && hdr.size > 0)
+        {
+        std::string fkey(hdr.keysize, 0);
+        if (fread(&fkey[0], 1, hdr.keysize, f) == hdr.keysize && fkey == key
+            && (data = (uint8_t*)ExternalRamMalloc(hdr.size)) != NULL
+            && fread(data, 1, hdr.size, f) == hdr.size)
+          {
+          duktape_bytecode_t& bc = m_bcmap[key];
+          bc.mtime = mtime;
+          bc.srcsize = srcsize;
+          bc.data = data;
+          bc.size = hdr.size;
+          bc.hits = 0;
+          m_bcsize += bc.size;
+          it = m_bcmap.find(key);
+          ESP_LOGD(TAG, "Bytecode: %s loaded from %s", key.c_str(), path.c_str());
+          }
+        else if (data)
+          {
+          free(data);
+          }
+        }
+      fclose(f);
+      }
+    }
+
+  if (it == m_bcmap.end())
+    {
+    m_bcmisses++;
+    return false;
+    }
+
+  // Load function from bytecode (copies the data into the Duktape heap):
+  duktape_bytecode_t& bc = it->second;
+  duk_push_external_buffer(m_dukctx);
+  duk_config_buffer(m_dukctx, -1, bc.data, bc.size);
+  if (duk_safe_call(m_dukctx, duk__load_function, NULL, 1, 1) != 0)
+    {
+    ESP_LOGW(TAG, "Bytecode: %s: load failed: %s", key.c_str(), duk_safe_to_string(m_dukctx, -1));
+    duk_pop(m_dukctx);
+    m_bcsize -= bc.size;
+    free(bc.data);
+    m_bcmap.erase(it);
+    m_bcmisses++;
+    return false;
+    }
+
+  bc.hits++;
+  m_bchits++;
+  return true;
+  }
+
+void OvmsDuktape::BytecodeStore(const std::string& key, time_t mtime, size_t srcsize)
+  {
+  // Dump the function on the stack top:
+  duk_dup_top(m_dukctx);
+  duk_dump_function(m_dukctx);
+  duk_size_t size;
+  const void* dump = duk_get_buffer(m_dukctx, -1, &size);
+
+  OvmsMutexLock lock(&m_bcmutex);
+
+  uint8_t* data = NULL;
+  if (m_bcsize + size > m_bcmaxsize)
+    {
+    ESP_LOGD(TAG, "Bytecode: cache full, %s not cached", key.c_str());
+    }
+  else if ((data = (uint8_t*)ExternalRamMalloc(size)) == NULL)
+    {
+    ESP_LOGW(TAG, "Bytecode: out of memory, %s not cached", key.c_str());
+    }
+  else
+    {
+    memcpy(data, dump, size);
+    duktape_bytecode_t& bc = m_bcmap[key];
+    bc.mtime = mtime;
+    bc.srcsize = srcsize;
+    bc.data = data;
+    bc.size = size;
+    bc.hits = 0;
+    m_bcsize += size;
+    ESP_LOGD(TAG, "Bytecode: %s cached, %u bytes", key.c_str(), (unsigned)size);
+
+    if (m_bcpersist)
+      {
+      std::string path = BytecodePath(key);
+      mkpath(BYTECODE_DIR);
+      FILE* f = fopen(path.c_str(), "w");
+      if (f)
+        {
+        duktape_bytecode_file_t hdr;
+        hdr.magic = BYTECODE_MAGIC;
+        hdr.build = duk__build_hash();
+        hdr.mtime = mtime;
+        hdr.srcsize = srcsize;
+        hdr.keysize = key.size();
+        hdr.size = size;
+        bool ok = (fwrite(&hdr, sizeof(hdr), 1, f) == 1
+                   && fwrite(key.data(), 1, key.size(), f) == key.size()
+                   && fwrite(data, 1, size, f) == size);
+        fclose(f);
+        if (!ok)
+          {
+          ESP_LOGW(TAG, "Bytecode: failed to write %s", path.c_str());
+          unlink(path.c_str());
+          }
+        }
+      }
+    }
+
+  duk_pop(m_dukctx);
+  }
+
+void OvmsDuktape::BytecodeClear()
+  {
+  OvmsMutexLock lock(&m_bcmutex);
+  for (auto& it : m_bcmap)
+    free(it.second.data);
+  m_bcmap.clear();
+  m_bcsize = 0;
+  m_bchits = 0;
+  m_bcmisses = 0;
+  if (!m_bcpersist)
+    return;
+
+  DIR *dir = opendir(BYTECODE_DIR);
+  if (dir)
+    {
+    struct dirent *dp;
+    while ((dp = readdir(dir)) != NULL)
+      {
+      if (dp->d_name[0] == '.') continue;
+      std::string path(BYTECODE_DIR "/");
+      path.append(dp->d_name);
+      unlink(path.c_str());
+      }
+    closedir(dir);
+    }
+  }
+
+void OvmsDuktape::BytecodeStatus(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_bcmutex);
+  writer->printf("Bytecode cache: %u scripts, %u bytes, %" PRIu32 " hits, %" PRIu32 " compilations\n",
+    (unsigned)m_bcmap.size(), (unsigned)m_bcsize, m_bchits, m_bcmisses);
+  for (auto& it : m_bcmap)
+    {
+    writer->printf("  %6u bytes %8" PRIu32 " hits  %s\n",
+      (unsigned)it.second.size, it.second.hits, it.first.c_str());
+    }
+  }
+
+////////////////////////////////////////////////////////////////////////////////
+// Heap & GC statistics
+
+duktape_allocstats_t* OvmsDuktape::SetAllocOwner(const char* owner)
+  {
+  duktape_allocstats_t* prev = m_allocowner;
+  m_allocowner = &m_allocstats[owner];
+  return prev;
+  }
+
+void OvmsDuktape::RunGC(bool compact)
+  {
+  duktape_allocstats_t* owner = SetAllocOwner("gc"); // finalizers may allocate
+  int64_t start = esp_timer_get_time();
+  duk_gc(m_dukctx, 0);
+  if (compact)
+    {
+    // second pass frees objects released by finalizers & compacts the rest:
+    duk_gc(m_dukctx, DUK_GC_COMPACT);
+    }
+  uint32_t us = esp_timer_get_time() - start;
+  RestoreAllocOwner(owner);
+
+  duk__record_timing(compact ? m_gcmajor : m_gcminor, us);
+  m_allocsincegc = 0;
+  if (compact)
+    {
+    ESP_LOGD(TAG, "Duktape: Compacting DukTape memory done in %" PRIu32 " ms", us / 1000);
+    m_compactpending = false;
+    UpdateHeapMetrics();
+    }
+  }
+
+static void duk__heap_info(size_t &total, size_t &used, size_t &largest)
+  {
+  #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
+    umm_info(NULL, false);
+    total = ummHeapInfo.totalBlocks * CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM_BLOCKSIZE;
+    used = ummHeapInfo.usedBlocks * CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM_BLOCKSIZE;
+    largest = ummHeapInfo.maxFreeContiguousBlocks * CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM_BLOCKSIZE;
+  #else
+    multi_heap_info_t heapinfo;
+    heap_caps_get_info(&heapinfo, MALLOC_CAP_SPIRAM);
+    total = heapinfo.total_free_bytes + heapinfo.total_allocated_bytes;
+    used = heapinfo.total_allocated_bytes;
+    largest = heapinfo.largest_free_block;
+  #endif
+  }
+
+static float duk__fragmentation(size_t total, size_t used, size_t largest)
+  {
+  size_t free = total - used;
+  return (free > 0) ? 100.0f - (float)largest * 100.0f / free : 0.0f;
+  }
+
+void OvmsDuktape::GetBinInfo(size_t &total, size_t &used)
+  {
+  total = duk_bins.GetTotalSize();
+  used = duk_bins.GetUsedSize();
+  }
+
+void OvmsDuktape::UpdateHeapMetrics()
+  {
+  size_t total, used, largest;
+  duk__heap_info(total, used, largest);
+  StdMetrics.ms_m_js_heap_frag->SetValue(duk__fragmentation(total, used, largest));
+  total += duk_bins.GetTotalSize();
+  used += duk_bins.GetUsedSize();
+  StdMetrics.ms_m_js_heap_used->SetValue((int)used);
+  StdMetrics.ms_m_js_heap_free->SetValue((int)(total - used));
+  StdMetrics.ms_m_js_gc_count->SetValue((int)(m_gcminor.count + m_gcmajor.count));
+
+  uint32_t gcmax = std::max(m_gcminor.period_max_us, m_gcmajor.period_max_us);
+  StdMetrics.ms_m_js_gc_pause->SetValue(gcmax / 1e6f, Seconds);
+  StdMetrics.ms_m_js_job_max->SetValue(m_jobs.period_max_us / 1e6f, Seconds);
+  m_gcminor.period_max_us = m_gcmajor.period_max_us = m_jobs.period_max_us = 0;
+  }
+
+void OvmsDuktape::HeapStatus(OvmsWriter* writer)
+  {
+  size_t total, used, largest;
+  duk__heap_info(total, used, largest);
+  #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE_HEAP_UMM
+    writer->printf("Heap: umm, %u bytes, %u used, %u free, largest free %u, fragmentation %.0f%%\n",
+  #else
+    writer->printf("Heap: sys (SPIRAM), %u bytes, %u used, %u free, largest free %u, fragmentation %.0f%%\n",
+  #endif
+    (unsigned)total, (unsigned)used, (unsigned)(total - used), (unsigned)largest,
+    duk__fragmentation(total, used, largest));
+  duk_bins.Status(writer);
+
+  writer->printf("\nGC: %u KB allocated since last run, idle threshold %u KB%s\n",
+    (unsigned)(m_allocsincegc / 1024), (unsigned)(m_gcthreshold / 1024),
+    m_compactpending ? ", compaction pending" : "");
+  writer->puts("Durations [ms]     count    avg    max |    <1    <2    <5   <10   <20   <50  <100  <200  <500 >=500");
+  struct { const char* name; duktape_timing_t* t; } timings[] =
+    {
+    { "GC idle", &m_gcminor },
+    { "GC compact", &m_gcmajor },
+    { "Jobs", &m_jobs },
+    };
+  for (auto& tm : timings)
+    {
+    duktape_timing_t& t = *tm.t;
+    writer->printf("%-14s %9" PRIu32 " %6.1f %6.1f |", tm.name, t.count,
+      t.count ? (float)t.total_us / t.count / 1000 : 0.0f, t.max_us / 1000.0f);
+    for (int i = 0; i < DUKTAPE_HIST_SLOTS; i++)
+      writer->printf(" %5" PRIu32, t.hist[i]);
+    writer->puts("");
+    }
+
+  // Allocations by origin, sorted by bytes:
+  std::vector<std::pair<std::string, duktape_allocstats_t>> origins(m_allocstats.begin(), m_allocstats.end());
+  std::sort(origins.begin(), origins.end(),
+    [](const std::pair<std::string, duktape_allocstats_t>& a, const std::pair<std::string, duktape_allocstats_t>& b)
+      { return a.second.bytes > b.second.bytes; });
+  writer->puts("\nAllocations     count        bytes  origin");
+  for (auto& it : origins)
+    {
+    writer->printf("          %10" PRIu32 " %12llu  %s\n",
+      it.second.count, (unsigned long long)it.second.bytes, it.first.c_str());
+    }
+  }
+
 void OvmsDuktape::ProcessJob(duktape_queue_t& msg)
   {
   duktapewriter = msg.writer;
 
+  // Allocation accounting origin:
+  switch(msg.type)
+    {
+    case DUKTAPE_autoinit:
+    case DUKTAPE_reload:
+      SetAllocOwner("init");
+      break;
+    case DUKTAPE_event:
+      SetAllocOwner("event");
+      break;
+    case DUKTAPE_evalnoresult:
+      SetAllocOwner(msg.body.dt_evalnoresult.filename ? msg.body.dt_evalnoresult.filename : "eval");
+      break;
+    case DUKTAPE_evalfloatresult:
+      SetAllocOwner(msg.body.dt_evalfloatresult.filename ? msg.body.dt_evalfloatresult.filename : "eval");
+      break;
+    case DUKTAPE_evalintresult:
+      SetAllocOwner(msg.body.dt_evalintresult.filename ? msg.body.dt_evalintresult.filename : "eval");
+      break;
+    case DUKTAPE_callback:
+      SetAllocOwner("callback");
+      break;
+    case DUKTAPE_command:
+      SetAllocOwner("command");
+      break;
+    default:
+      m_allocowner = NULL;
+      break;
+    }
+
   switch(msg.type)
     {
     case DUKTAPE_autoinit:
@@ -1640,11 +2184,7 @@ void OvmsDuktape::ProcessJob(duktape_queue_t& msg)
       // Compact DUKTAPE memory
       if (m_dukctx != NULL)
         {
-        ESP_LOGV(TAG,"Duktape: Compacting DukTape memory");
-        uint32_t ts = esp_log_timestamp();
-        duk_gc(m_dukctx, 0);
-        duk_gc(m_dukctx, 0);
-        ESP_LOGD(TAG, "Duktape: Compacting DukTape memory done in %" PRIu32 " ms", esp_log_timestamp()-ts);
+        RunGC(true);
         }
       }
       break;
@@ -1680,12 +2220,10 @@ void OvmsDuktape::ProcessJob(duktape_queue_t& msg)
         {
         // Execute script text (without result)
         const char* filename = msg.body.dt_evalnoresult.filename;
-        if (!filename) filename = "eval";
-        duk_push_string(m_dukctx, msg.body.dt_evalnoresult.text);
-        duk_push_string(m_dukctx, filename);
-        if (duk_pcompile(m_dukctx, DUK_COMPILE_EVAL) != 0 || duk_pcall(m_dukctx, 0) != 0)
+        if (DukCompile(msg.body.dt_evalnoresult.text, filename, msg.body.dt_evalnoresult.mtime) != 0
+            || duk_pcall(m_dukctx, 0) != 0)
           {
-          DukOvmsErrorHandler(m_dukctx, -1, msg.writer, filename);
+          DukOvmsErrorHandler(m_dukctx, -1, msg.writer, filename ? filename : "eval");
           }
         duk_pop(m_dukctx);
         }
@@ -1702,8 +2240,14 @@ void OvmsDuktape::ProcessJob(duktape_queue_t& msg)
       if (m_dukctx != NULL)
         {
         // Execute script text (float result)
-        duk_push_string(m_dukctx, msg.body.dt_evalfloatresult.text);
-        if (duk_peval(m_dukctx) != 0)
+        duk_int_t res = DukCompile(msg.body.dt_evalfloatresult.text,
+          msg.body.dt_evalfloatresult.filename, msg.body.dt_evalfloatresult.mtime);
+        if (res == 0)
+          {
+          duk_push_global_object(m_dukctx); // 'this' binding as for duk_peval()
+          res = duk_pcall_method(m_dukctx, 0);
+          }
+        if (res != 0)
           {
           DukOvmsErrorHandler(m_dukctx, -1, msg.writer);
           *msg.body.dt_evalfloatresult.result = 0;
@@ -1728,8 +2272,14 @@ void OvmsDuktape::ProcessJob(duktape_queue_t& msg)
       if (m_dukctx != NULL)
         {
         // Execute script text (int result)
-        duk_push_string(m_dukctx, msg.body.dt_evalintresult.text);
-        if (duk_peval(m_dukctx) != 0)
+        duk_int_t res = DukCompile(msg.body.dt_evalintresult.text,
+          msg.body.dt_evalintresult.filename, msg.body.dt_evalintresult.mtime);
+        if (res == 0)
+          {
+          duk_push_global_object(m_dukctx); // 'this' binding as for duk_peval()
+          res = duk_pcall_method(m_dukctx, 0);
+          }
+        if (res != 0)
           {
           DukOvmsErrorHandler(m_dukctx, -1, msg.writer);
           *msg.body.dt_evalintresult.result = 0;
@@ -1768,11 +2318,18 @@ void OvmsDuktape::ProcessJob(duktape_queue_t& msg)
       DukTapeUnload();
       }
       break;
+    case DUKTAPE_heapstats:
+      {
+      if (msg.writer)
+        HeapStatus(msg.writer);
+      }
+      break;
 
     default:
       ESP_LOGE(TAG,"Duktape: Unrecognised msg type 0x%04x",msg.type);
       break;
     }
 
+  m_allocowner = NULL;
   duktapewriter = NULL;
   }
@@ -39,6 +39,7 @@
 #include "freertos/semphr.h"
 
 #include "duktape.h"
+#include "ovms_mutex.h"
 #include <list>
 #include <utility>
 
@@ -102,7 +103,8 @@ typedef enum
   DUKTAPE_evalintresult,        // Execute script text (int result)
   DUKTAPE_callback,             // DuktapeObject callback
   DUKTAPE_command,              // Duktape command
-  DUKTAPE_shutdown              // Shutdown Duktape
+  DUKTAPE_shutdown,             // Shutdown Duktape
+  DUKTAPE_heapstats             // Output heap & GC statistics
   } duktape_msg_t;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -168,16 +170,21 @@ typedef struct
       {
       const char* text;
       const char* filename;
+      time_t mtime;
       } dt_evalnoresult;
     struct
       {
       const char* text;
       float* result;
+      const char* filename;
+      time_t mtime;
       } dt_evalfloatresult;
     struct
       {
       const char* text;
       int* result;
+      const char* filename;
+      time_t mtime;
       } dt_evalintresult;
     struct
       {
@@ -294,6 +301,49 @@ class DuktapeConsoleCommand : public DuktapeObject
     std::string m_module;
   };
 
+////////////////////////////////////////////////////////////////////////////////
+// Bytecode cache
+//
+// Script files evaluated repeatedly (event scripts, obd2ecu PID scripts) are
+// compiled once, the compiled function is kept as a bytecode dump (duk_dump_function)
+// in PSRAM, keyed by the script path and validated by the file modification time and
+// source size. Optionally the cache is persisted in /store/.bytecode.
+
+typedef struct
+  {
+  time_t mtime;                         // source file modification time
+  size_t srcsize;                       // source size
+  uint8_t* data;                        // bytecode dump (PSRAM)
+  size_t size;                          // bytecode dump size
+  uint32_t hits;                        // cache hits
+  } duktape_bytecode_t;
+
+typedef std::map<std::string, duktape_bytecode_t> DuktapeBytecodeMap;
+
+////////////////////////////////////////////////////////////////////////////////
+// Heap & GC statistics
+
+// Duration histogram slots: <1, <2, <5, <10, <20, <50, <100, <200, <500, >=500 ms
+#define DUKTAPE_HIST_SLOTS    10
+
+typedef struct
+  {
+  uint32_t count;
+  uint32_t hist[DUKTAPE_HIST_SLOTS];
+  uint32_t max_us;                      // max duration overall
+  uint32_t period_max_us;               // max duration in current metrics period
+  uint64_t total_us;
+  } duktape_timing_t;
+
+// Allocation accounting per origin (module / script / job type):
+typedef struct
+  {
+  uint32_t count;                       // allocations
+  uint64_t bytes;                       // bytes allocated
+  } duktape_allocstats_t;
+
+typedef std::map<std::string, duktape_allocstats_t> DuktapeAllocStatsMap;
+
 ////////////////////////////////////////////////////////////////////////////////
 // OvmsDuktape
 //
@@ -324,16 +374,47 @@ class OvmsDuktape
 
     void Ticker1_Shutdown(std::string event, void* data);
   public:
-    void  DuktapeEvalNoResult(const char* text, OvmsWriter* writer=NULL, const char* filename=NULL);
-    float DuktapeEvalFloatResult(const char* text, OvmsWriter* writer=NULL);
-    int   DuktapeEvalIntResult(const char* text, OvmsWriter* writer=NULL);
+    // Note: passing a filename & mtime enables the bytecode cache for the script
+    void  DuktapeEvalNoResult(const char* text, OvmsWriter* writer=NULL, const char* filename=NULL, time_t mtime=0);
+    float DuktapeEvalFloatResult(const char* text, OvmsWriter* writer=NULL, const char* filename=NULL, time_t mtime=0);
+    int   DuktapeEvalIntResult(const char* text, OvmsWriter* writer=NULL, const char* filename=NULL, time_t mtime=0);
     void DuktapeEvalCommand(OvmsWriter* writer, const char *command, DuktapeConsoleCommand* dcc, int argc, const char* const* argv);
     void  DuktapeReload();
     void  DuktapeCompact(bool wait=true);
+    void  DuktapeHeapStatus(OvmsWriter* writer);
     void  DuktapeRequestCallback(DuktapeObject* instance, const char* method, void* data);
     OvmsWriter* GetDuktapeWriter();
     void DukGetCallInfo(duk_context *ctx, std::string *filename, int *linenumber, std::string *function);
 
+  protected:
+    duk_int_t DukCompile(const char* text, const char* filename, time_t mtime);
+    bool BytecodeLoad(const std::string& key, time_t mtime, size_t srcsize);
+    void BytecodeStore(const std::string& key, time_t mtime, size_t srcsize);
+    std::string BytecodePath(const std::string& key);
+    void BytecodeConfigChanged(std::string event, void* data);
+  public:
+    void BytecodeClear();
+    void BytecodeStatus(OvmsWriter* writer);
+
+  public:
+    // Heap accounting & GC scheduling (Duktape task only):
+    inline void AccountAlloc(size_t size)
+      {
+      if (m_allocowner)
+        {
+        m_allocowner->count++;
+        m_allocowner->bytes += size;
+        }
+      m_allocsincegc += size;
+      }
+    duktape_allocstats_t* SetAllocOwner(const char* owner);
+    void RestoreAllocOwner(duktape_allocstats_t* owner) { m_allocowner = owner; }
+    void GetBinInfo(size_t &total, size_t &used);
+  protected:
+    void RunGC(bool compact);
+    void UpdateHeapMetrics();
+    void HeapStatus(OvmsWriter* writer);
+
   protected:
     void NotifyDuktapeModuleUnloadAll(duk_context *ctx);
   public:
@@ -361,6 +442,21 @@ class OvmsDuktape
     DuktapeFunctionMap m_fnmap;
     DuktapeModuleMap m_modmap;
     DuktapeObjectMap m_obmap;
+    OvmsMutex m_bcmutex;
+    DuktapeBytecodeMap m_bcmap;
+    size_t m_bcsize;                    // total bytecode size cached
+    uint32_t m_bchits;                  // cache hits
+    uint32_t m_bcmisses;                // cache misses (compilations)
+    bool m_bcpersist;                   // config scripting bytecode.persist
+    size_t m_bcmaxsize;                 // config scripting bytecode.cachesize [bytes]
+    DuktapeAllocStatsMap m_allocstats;
+    duktape_allocstats_t* m_allocowner; // current allocation origin
+    size_t m_allocsincegc;              // bytes allocated since last GC
+    size_t m_gcthreshold;               // idle GC threshold [bytes]
+    volatile bool m_compactpending;     // compaction requested (ticker.60)
+    duktape_timing_t m_gcminor;         // idle GC runs
+    duktape_timing_t m_gcmajor;         // compaction runs
+    duktape_timing_t m_jobs;            // job processing (includes voluntary GC)
 
   public:
     typedef std::map<OvmsCommand*, DuktapeConsoleCommand*> DuktapeCommandMap;
@@ -987,6 +987,40 @@ void OvmsServerV2::SendLogin(struct mg_connection *nc)
   m_connretry = 60; // Give the server 60 seconds to respond
   }
 
+// "S" message metrics, see m_stat_snapshot:
+enum
+  {
+  ST_BAT_SOC = 0,
+  ST_CHARGE_VOLTAGE,
+  ST_CHARGE_CURRENT,
+  ST_CHARGE_STATE,
+  ST_CHARGE_MODE,
+  ST_BAT_RANGE_IDEAL,
+  ST_BAT_RANGE_EST,
+  ST_CHARGE_CLIMIT,
+  ST_CHARGE_TIME,
+  ST_CHARGE_KWH,
+  ST_CHARGE_SUBSTATE,
+  ST_CHARGE_TIMERMODE,
+  ST_CHARGE_TIMERSTART,
+  ST_BAT_CAC,
+  ST_CHARGE_DURATION_FULL,
+  ST_CHARGE_DURATION_RANGE,
+  ST_CHARGE_DURATION_SOC,
+  ST_CHARGE_INPROGRESS,
+  ST_CHARGE_LIMIT_RANGE,
+  ST_CHARGE_LIMIT_SOC,
+  ST_ENV_COOLING,
+  ST_BAT_RANGE_FULL,
+  ST_BAT_POWER,
+  ST_BAT_VOLTAGE,
+  ST_BAT_SOH,
+  ST_CHARGE_POWER,
+  ST_CHARGE_EFFICIENCY,
+  ST_BAT_CURRENT,
+  ST_BAT_RANGE_SPEED,
+  };
+
 void OvmsServerV2::TransmitMsgStat(bool always)
   {
   m_now_stat = false;
@@ -1024,9 +1058,13 @@ void OvmsServerV2::TransmitMsgStat(bool always)
   // Quick exit if nothing modified
   if ((!always)&&(!modified)) return;
 
-  int mins_range = StandardMetrics.ms_v_charge_duration_range->AsInt();
-  int mins_soc = StandardMetrics.ms_v_charge_duration_soc->AsInt();
-  bool charging = StandardMetrics.ms_v_charge_inprogress->AsBool();
+  // Read all values at once for a consistent record:
+  m_stat_snapshot->Read(m_stat_record);
+  const OvmsMetricSnapshotRecord& rec = m_stat_record;
+
+  int mins_range = rec.AsInt(ST_CHARGE_DURATION_RANGE);
+  int mins_soc = rec.AsInt(ST_CHARGE_DURATION_SOC);
+  bool charging = rec.AsBool(ST_CHARGE_INPROGRESS);
   metric_unit_t units_speed = (m_units_distance == Miles) ? Mph : Kph;
 
   extram::ostringstream buffer;
@@ -1034,53 +1072,53 @@ void OvmsServerV2::TransmitMsgStat(bool always)
     << std::fixed
     << std::setprecision(2)
     << "MP-0 S"
-    << StandardMetrics.ms_v_bat_soc->AsString("0", Other, 1)
+    << rec.Format(ST_BAT_SOC, "0", Other, 1)
     << ","
     << ((m_units_distance == Kilometers) ? "K" : "M")
     << ","
-    << StandardMetrics.ms_v_charge_voltage->AsInt()
+    << rec.AsInt(ST_CHARGE_VOLTAGE)
     << ","
-    << StandardMetrics.ms_v_charge_current->AsFloat()
+    << rec.AsFloat(ST_CHARGE_CURRENT)
     << ","
-    << StandardMetrics.ms_v_charge_state->AsString("stopped")
+    << rec.Format(ST_CHARGE_STATE, "stopped")
     << ","
-    << StandardMetrics.ms_v_charge_mode->AsString("standard")
+    << rec.Format(ST_CHARGE_MODE, "standard")
     << ","
-    << StandardMetrics.ms_v_bat_range_ideal->AsInt(0, m_units_distance)
+    << rec.AsInt(ST_BAT_RANGE_IDEAL, 0, m_units_distance)
     << ","
-    << StandardMetrics.ms_v_bat_range_est->AsInt(0, m_units_distance)
+    << rec.AsInt(ST_BAT_RANGE_EST, 0, m_units_distance)
     << ","
-    << StandardMetrics.ms_v_charge_climit->AsInt()
+    << rec.AsInt(ST_CHARGE_CLIMIT)
     << ","
-    << StandardMetrics.ms_v_charge_time->AsInt(0,Seconds)
+    << rec.AsInt(ST_CHARGE_TIME, 0, Seconds)
     << ","
     << "0"  // car_charge_b4
     << ","
-    << (int)(StandardMetrics.ms_v_charge_kwh->AsFloat() * 10)
+    << (int)(rec.AsFloat(ST_CHARGE_KWH) * 10)
     << ","
-    << chargesubstate_key(StandardMetrics.ms_v_charge_substate->AsString(""))
+    << chargesubstate_key(rec.AsString(ST_CHARGE_SUBSTATE, ""))
     << ","
-    << chargestate_key(StandardMetrics.ms_v_charge_state->AsString("stopped"))
+    << chargestate_key(rec.AsString(ST_CHARGE_STATE, "stopped"))
     << ","
-    << chargemode_key(StandardMetrics.ms_v_charge_mode->AsString("standard"))
+    << chargemode_key(rec.AsString(ST_CHARGE_MODE, "standard"))
     << ","
-    << StandardMetrics.ms_v_charge_timermode->AsBool()
+    << rec.AsBool(ST_CHARGE_TIMERMODE)
     << ","
-    << StandardMetrics.ms_v_charge_timerstart->AsInt()
+    << rec.AsInt(ST_CHARGE_TIMERSTART)
     << ","
     << "0"  // car_stale_timer
     << ","
-    << StandardMetrics.ms_v_bat_cac->AsFloat()
+    << rec.AsFloat(ST_BAT_CAC)
     << ","
-    << StandardMetrics.ms_v_charge_duration_full->AsInt()
+    << rec.AsInt(ST_CHARGE_DURATION_FULL)
     << ","
     << (((mins_range >= 0) && (mins_range < mins_soc)) ? mins_range : mins_soc)
     << ","
-    << (int) StandardMetrics.ms_v_charge_limit_range->AsFloat(0, m_units_distance)
+    << (int) rec.AsFloat(ST_CHARGE_LIMIT_RANGE, 0, m_units_distance)
     << ","
-    << StandardMetrics.ms_v_charge_limit_soc->AsInt()
+    << rec.AsInt(ST_CHARGE_LIMIT_SOC)
     << ","
-    << (StandardMetrics.ms_v_env_cooling->AsBool() ? 0 : -1)
+    << (rec.AsBool(ST_ENV_COOLING) ? 0 : -1)
     << ","
     << "0"  // car_cooldown_tbattery
     << ","
@@ -1092,24 +1130,24 @@ void OvmsServerV2::TransmitMsgStat(bool always)
     << ","
     << mins_soc
     << ","
-    << StandardMetrics.ms_v_bat_range_full->AsInt(0, m_units_distance)
+    << rec.AsInt(ST_BAT_RANGE_FULL, 0, m_units_distance)
     << ","
     << "0"  // car_chargetype
     << ","
-    << (charging ? -StandardMetrics.ms_v_bat_power->AsFloat() : 0)
+    << (charging ? -rec.AsFloat(ST_BAT_POWER) : 0)
     << ","
-    << StandardMetrics.ms_v_bat_voltage->AsFloat()
+    << rec.AsFloat(ST_BAT_VOLTAGE)
     << ","
-    << StandardMetrics.ms_v_bat_soh->AsFloat()
+    << rec.AsFloat(ST_BAT_SOH)
     << ","
-    << StandardMetrics.ms_v_charge_power->AsFloat()
+    << rec.AsFloat(ST_CHARGE_POWER)
     << ","
-    << StandardMetrics.ms_v_charge_efficiency->AsFloat()
+    << rec.AsFloat(ST_CHARGE_EFFICIENCY)
     << ","
-    << StandardMetrics.ms_v_bat_current->AsFloat()
+    << rec.AsFloat(ST_BAT_CURRENT)
     << ","
     << std::setprecision(1)
-    << StandardMetrics.ms_v_bat_range_speed->AsFloat(0, units_speed)
+    << rec.AsFloat(ST_BAT_RANGE_SPEED, 0, units_speed)
     ;
 
   Transmit(buffer.str().c_str());
@@ -1166,13 +1204,13 @@ void OvmsServerV2::TransmitMsgGen(bool always)
     << ","
     << StandardMetrics.ms_v_gen_efficiency->AsFloat()
     << ","
-    << StandardMetrics.ms_v_gen_type->AsString("")
+    << StandardMetrics.ms_v_gen_type->Format("")
     << ","
-    << StandardMetrics.ms_v_gen_state->AsString("stopped")
+    << StandardMetrics.ms_v_gen_state->Format("stopped")
     << ","
-    << StandardMetrics.ms_v_gen_substate->AsString("")
+    << StandardMetrics.ms_v_gen_substate->Format("")
     << ","
-    << StandardMetrics.ms_v_gen_mode->AsString("standard")
+    << StandardMetrics.ms_v_gen_mode->Format("standard")
     << ","
     << StandardMetrics.ms_v_gen_climit->AsFloat()
     << ","
@@ -1242,39 +1280,39 @@ void OvmsServerV2::TransmitMsgGPS(bool always)
   extram::ostringstream buffer;
   buffer
     << "MP-0 L"
-    << StandardMetrics.ms_v_pos_latitude->AsString("0",Other,6)
+    << StandardMetrics.ms_v_pos_latitude->Format("0",Other,6)
     << ","
-    << StandardMetrics.ms_v_pos_longitude->AsString("0",Other,6)
+    << StandardMetrics.ms_v_pos_longitude->Format("0",Other,6)
     << ","
-    << StandardMetrics.ms_v_pos_direction->AsString("0")
+    << StandardMetrics.ms_v_pos_direction->Format("0")
     << ","
-    << StandardMetrics.ms_v_pos_altitude->AsString("0")
+    << StandardMetrics.ms_v_pos_altitude->Format("0")
     << ","
     << StandardMetrics.ms_v_pos_gpslock->AsBool(false)
     << ((stale)?",0,":",1,")
-    << StandardMetrics.ms_v_pos_speed->AsString("0", units_speed, 1)
+    << StandardMetrics.ms_v_pos_speed->Format("0", units_speed, 1)
     << ","
     << int(StandardMetrics.ms_v_pos_trip->AsFloat(0, m_units_distance)*10)
     << ","
     << drivemode
     << ","
-    << StandardMetrics.ms_v_bat_power->AsString("0",Other,3)
+    << StandardMetrics.ms_v_bat_power->Format("0",Other,3)
     << ","
-    << StandardMetrics.ms_v_bat_energy_used->AsString("0",Other,3)
+    << StandardMetrics.ms_v_bat_energy_used->Format("0",Other,3)
     << ","
-    << StandardMetrics.ms_v_bat_energy_recd->AsString("0",Other,3)
+    << StandardMetrics.ms_v_bat_energy_recd->Format("0",Other,3)
     << ","
     << StandardMetrics.ms_v_inv_power->AsFloat()
     << ","
     << StandardMetrics.ms_v_inv_efficiency->AsFloat()
     << ","
-    << StandardMetrics.ms_v_pos_gpsmode->AsString()
+    << StandardMetrics.ms_v_pos_gpsmode->Format()
     << ","
     << StandardMetrics.ms_v_pos_satcount->AsInt()
     << ","
-    << StandardMetrics.ms_v_pos_gpshdop->AsString("0", Native, 1)
+    << StandardMetrics.ms_v_pos_gpshdop->Format("0", Native, 1)
     << ","
-    << StandardMetrics.ms_v_pos_gpsspeed->AsString("0", units_speed, 1)
+    << StandardMetrics.ms_v_pos_gpsspeed->Format("0", units_speed, 1)
     << ","
     << StandardMetrics.ms_v_pos_gpssq->AsInt()
     ;
@@ -1331,22 +1369,22 @@ void OvmsServerV2::TransmitMsgTPMS(bool always)
     << ","
     << StandardMetrics.ms_v_tpms_pressure->GetSize()
     << (StandardMetrics.ms_v_tpms_pressure->GetSize() ? "," : "")
-    << StandardMetrics.ms_v_tpms_pressure->AsString("", kPa, 1)
+    << StandardMetrics.ms_v_tpms_pressure->Format("", kPa, 1)
     << "," << defstale_pressure
     << ","
     << StandardMetrics.ms_v_tpms_temp->GetSize()
     << (StandardMetrics.ms_v_tpms_temp->GetSize() ? "," : "")
-    << StandardMetrics.ms_v_tpms_temp->AsString("", Celcius, 1)
+    << StandardMetrics.ms_v_tpms_temp->Format("", Celcius, 1)
     << "," << defstale_temp
     << ","
     << StandardMetrics.ms_v_tpms_health->GetSize()
     << (StandardMetrics.ms_v_tpms_health->GetSize() ? "," : "")
-    << StandardMetrics.ms_v_tpms_health->AsString("", Percentage, 1)
+    << StandardMetrics.ms_v_tpms_health->Format("", Percentage, 1)
     << "," << defstale_health
     << ","
     << StandardMetrics.ms_v_tpms_alert->GetSize()
     << (StandardMetrics.ms_v_tpms_alert->GetSize() ? "," : "")
-    << StandardMetrics.ms_v_tpms_alert->AsString("")
+    << StandardMetrics.ms_v_tpms_alert->Format("")
     << "," << defstale_alert
     ;
   Transmit(buffer.str().c_str());
@@ -1432,17 +1470,17 @@ void OvmsServerV2::TransmitMsgFirmware(bool always)
     << ","
     << mp_encode(StandardMetrics.ms_v_vin->AsString(""))
     << ","
-    << StandardMetrics.ms_m_net_sq->AsString("0",sq)
+    << StandardMetrics.ms_m_net_sq->Format("0",sq)
     << ","
     << MyConfig.GetParamValue("vehicle", "canwrite", "0")
     << ","
-    << StandardMetrics.ms_v_type->AsString("")
+    << StandardMetrics.ms_v_type->Format("")
     << ","
     << mp_encode(StandardMetrics.ms_m_net_provider->AsString(""))
     << ","
-    << StandardMetrics.ms_v_env_service_range->AsString("-1", Kilometers, 0)
+    << StandardMetrics.ms_v_env_service_range->Format("-1", Kilometers, 0)
     << ","
-    << StandardMetrics.ms_v_env_service_time->AsString("-1", Seconds, 0)
+    << StandardMetrics.ms_v_env_service_time->Format("-1", Seconds, 0)
     << ","
     << mp_encode(StandardMetrics.ms_m_hardware->AsString(""))
     ;
@@ -1576,21 +1614,21 @@ void OvmsServerV2::TransmitMsgEnvironment(bool always)
     << ","
     << (StandardMetrics.ms_v_env_locked->AsBool()?"4":"5")
     << ","
-    << StandardMetrics.ms_v_inv_temp->AsString("0")
+    << StandardMetrics.ms_v_inv_temp->Format("0")
     << ","
-    << StandardMetrics.ms_v_mot_temp->AsString("0")
+    << StandardMetrics.ms_v_mot_temp->Format("0")
     << ","
-    << StandardMetrics.ms_v_bat_temp->AsString("0")
+    << StandardMetrics.ms_v_bat_temp->Format("0")
     << ","
     << int(StandardMetrics.ms_v_pos_trip->AsFloat(0, m_units_distance)*10)
     << ","
     << int(StandardMetrics.ms_v_pos_odometer->AsFloat(0, m_units_distance)*10)
     << ","
-    << StandardMetrics.ms_v_pos_speed->AsString("0")
+    << StandardMetrics.ms_v_pos_speed->Format("0")
     << ","
-    << StandardMetrics.ms_v_env_parktime->AsString("0")
+    << StandardMetrics.ms_v_env_parktime->Format("0")
     << ","
-    << StandardMetrics.ms_v_env_temp->AsString("0")
+    << StandardMetrics.ms_v_env_temp->Format("0")
     << ","
     << (int)Doors3()
     << ","
@@ -1598,19 +1636,19 @@ void OvmsServerV2::TransmitMsgEnvironment(bool always)
     << ","
     << (StandardMetrics.ms_v_env_temp->IsStale() ? "0" : "1")
     << ","
-    << StandardMetrics.ms_v_bat_12v_voltage->AsString("0")
+    << StandardMetrics.ms_v_bat_12v_voltage->Format("0")
     << ","
     << (int)Doors4()
     << ","
-    << StandardMetrics.ms_v_bat_12v_voltage_ref->AsString("0")
+    << StandardMetrics.ms_v_bat_12v_voltage_ref->Format("0")
     << ","
     << (int)Doors5()
     << ","
-    << StandardMetrics.ms_v_charge_temp->AsString("0")
+    << StandardMetrics.ms_v_charge_temp->Format("0")
     << ","
-    << StandardMetrics.ms_v_bat_12v_current->AsString("0")
+    << StandardMetrics.ms_v_bat_12v_current->Format("0")
     << ","
-    << StandardMetrics.ms_v_env_cabintemp->AsString("0")
+    << StandardMetrics.ms_v_env_cabintemp->Format("0")
     ;
 
   Transmit(buffer.str().c_str());
@@ -1726,18 +1764,21 @@ void OvmsServerV2::TransmitNotifyData()
   int cnt = 0;
   size_t size = 0;
 
-  while(1)
+  // Fetch the next batch of entries
+  OvmsNotifyEntry* batch[5];
+  size_t batchsize = data->FetchUnread(MyOvmsServerV2Reader, m_pending_notify_data_last, batch, 5);
+  if (batchsize == 0)
     {
-    // Find the first entry
-    OvmsNotifyEntry* e = data->FirstUnreadEntry(MyOvmsServerV2Reader, m_pending_notify_data_last);
-    if (e == NULL)
-      {
-      m_pending_notify_data = false;
-      // if we have sent something, check for retransmissions in 10 seconds:
-      if (m_pending_notify_data_last)
-        m_pending_notify_data_retransmit = 10;
-      return;
-      }
+    m_pending_notify_data = false;
+    // if we have sent something, check for retransmissions in 10 seconds:
+    if (m_pending_notify_data_last)
+      m_pending_notify_data_retransmit = 10;
+    return;
+    }
+
+  for (size_t i = 0; i < batchsize; i++)
+    {
+    OvmsNotifyEntry* e = batch[i];
 
     extram::string msg = e->GetValue();
     ESP_LOGD(TAG, "TransmitNotifyData: msg=%s", msg.c_str());
@@ -1782,6 +1823,8 @@ void OvmsServerV2::HandleNotifyDataAck(uint32_t ack)
   OvmsNotifyType* data = MyNotify.GetType("data");
   if (data == NULL) return;
 
+  // Only the acknowledged record is done, records rejected or not stored
+  // by the server are retransmitted:
   OvmsNotifyEntry* e = data->FindEntry(ack);
   if (e)
     {
@@ -2111,6 +2154,37 @@ OvmsServerV2::OvmsServerV2(const char* name)
     }
 
   m_buffer = new OvmsBuffer(1024);
+  m_stat_snapshot = new OvmsMetricSnapshot({
+    StandardMetrics.ms_v_bat_soc,
+    StandardMetrics.ms_v_charge_voltage,
+    StandardMetrics.ms_v_charge_current,
+    StandardMetrics.ms_v_charge_state,
+    StandardMetrics.ms_v_charge_mode,
+    StandardMetrics.ms_v_bat_range_ideal,
+    StandardMetrics.ms_v_bat_range_est,
+    StandardMetrics.ms_v_charge_climit,
+    StandardMetrics.ms_v_charge_time,
+    StandardMetrics.ms_v_charge_kwh,
+    StandardMetrics.ms_v_charge_substate,
+    StandardMetrics.ms_v_charge_timermode,
+    StandardMetrics.ms_v_charge_timerstart,
+    StandardMetrics.ms_v_bat_cac,
+    StandardMetrics.ms_v_charge_duration_full,
+    StandardMetrics.ms_v_charge_duration_range,
+    StandardMetrics.ms_v_charge_duration_soc,
+    StandardMetrics.ms_v_charge_inprogress,
+    StandardMetrics.ms_v_charge_limit_range,
+    StandardMetrics.ms_v_charge_limit_soc,
+    StandardMetrics.ms_v_env_cooling,
+    StandardMetrics.ms_v_bat_range_full,
+    StandardMetrics.ms_v_bat_power,
+    StandardMetrics.ms_v_bat_voltage,
+    StandardMetrics.ms_v_bat_soh,
+    StandardMetrics.ms_v_charge_power,
+    StandardMetrics.ms_v_charge_efficiency,
+    StandardMetrics.ms_v_bat_current,
+    StandardMetrics.ms_v_bat_range_speed,
+    });
   SetStatus("Server has been started", false, WaitNetwork);
   m_now_stat = false;
   m_now_gen = false;
@@ -2193,6 +2267,7 @@ OvmsServerV2::~OvmsServerV2()
     delete m_buffer;
     m_buffer = NULL;
     }
+  delete m_stat_snapshot;
   MyEvents.SignalEvent("server.v2.stopped", NULL);
   }
 
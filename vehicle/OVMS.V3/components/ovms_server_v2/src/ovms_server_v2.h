@@ -163,6 +163,9 @@ class OvmsServerV2 : public OvmsServer
     bool m_pending_notify_data;
     uint32_t m_pending_notify_data_last;
     int m_pending_notify_data_retransmit;
+
+    OvmsMetricSnapshot* m_stat_snapshot;      // consistent "S" message values
+    OvmsMetricSnapshotRecord m_stat_record;
   };
 
 class OvmsServerV2Init
@@ -274,9 +274,9 @@ void OvmsServerV3::TransmitAllMetrics()
   while (metric != NULL)
     {
     metric->ClearModified(MyOvmsServerV3Modifier);
-    if (!metric->AsString().empty())
+    if (metric->IsDefined())
       {
-      TransmitMetric(metric);
+      TransmitMetric(metric, true);
       }
     metric = metric->m_next;
     }
@@ -299,18 +299,25 @@ void OvmsServerV3::TransmitModifiedMetrics()
     }
   }
 
-void OvmsServerV3::TransmitMetric(OvmsMetric* metric)
+void OvmsServerV3::TransmitMetric(OvmsMetric* metric, bool skip_empty)
   {
   std::string metric_name(metric->m_name);
 
   if (!m_metrics_filter.CheckFilter(metric_name))
     return;
 
-  std::string topic(m_topic_prefix);
+  // Reuse the topic & value buffers, as this is called for every metric update:
+  std::string& topic = m_metric_topic;
+  topic.assign(m_topic_prefix);
   topic.append("metric/");
   topic.append(mqtt_topic(metric_name));
 
-  std::string val = metric->AsString();
+  std::string& val = m_metric_value;
+  val.clear();
+  OvmsMetricBuffer buf(val);
+  metric->AppendTo(buf);
+  if (skip_empty && val.empty())
+    return;
 
   mg_mqtt_publish(m_mgconn, topic.c_str(), m_msgid++,
     MG_MQTT_QOS(0) | MG_MQTT_RETAIN, val.c_str(), val.length());
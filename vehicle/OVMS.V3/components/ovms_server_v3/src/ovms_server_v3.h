@@ -90,6 +90,8 @@ class OvmsServerV3 : public OvmsServer
     std::string m_port;
     bool m_tls;
     std::string m_topic_prefix;
+    std::string m_metric_topic;
+    std::string m_metric_value;
     std::string m_will_topic;
     std::string m_conn_topic[MQTT_CONN_NTOPICS];
     struct mg_connection *m_mgconn;
@@ -142,7 +144,7 @@ class OvmsServerV3 : public OvmsServer
     void CountClients();
 
   private:
-    void TransmitMetric(OvmsMetric* metric);
+    void TransmitMetric(OvmsMetric* metric, bool skip_empty=false);
 
     IdIncludeExcludeFilter m_metrics_filter;
   };
@@ -36,13 +36,16 @@ static const char *TAG = "webcommand";
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
+#include <algorithm>
 #include "buffered_shell.h"
-#include "log_buffers.h"
 #include "ovms_webserver.h"
 #include "ovms_script.h"
 #include "ovms_module.h"
 
 
+// Number of full chunks queued for transmission before the command task blocks:
+#define HCS_QUEUE_SIZE    4
+
 struct hcs_writebuf
 {
   char* data;
@@ -70,7 +73,7 @@ HttpCommandStream::HttpCommandStream(mg_connection* nc, extram::string command,
   SetSecure(true); // Note: assuming user is admin
 
   // create write queue & command task:
-  m_writequeue = xQueueCreate(30, sizeof(hcs_writebuf));
+  m_writequeue = xQueueCreate(HCS_QUEUE_SIZE, sizeof(hcs_writebuf));
   char name[configMAX_TASK_NAME_LEN];
   snprintf(name, sizeof(name), "%s", command.c_str());
   xTaskCreatePinnedToCore(CommandTask, name,
@@ -87,6 +90,8 @@ HttpCommandStream::~HttpCommandStream()
       free(wbuf.data);
     vQueueDelete(m_writequeue);
   }
+  if (m_wbuf)
+    free(m_wbuf);
 }
 
 
@@ -140,6 +145,7 @@ void HttpCommandStream::ProcessQueue()
 {
   size_t txlen = 0;
   hcs_writebuf wbuf;
+  bool done = m_done;
 
   if (m_writequeue) {
     while (txlen < XFER_CHUNK_SIZE && xQueueReceive(m_writequeue, &wbuf, 0) == pdTRUE) {
@@ -150,6 +156,26 @@ void HttpCommandStream::ProcessQueue()
       free(wbuf.data);
     }
 
+    // queue empty: take over the current partial chunk to minimize latency
+    //  (the command task will continue with a new chunk)
+    if (txlen == 0 && m_wlen) {
+      wbuf.data = NULL;
+      if (m_wbufmutex.Lock()) {
+        wbuf.data = m_wbuf;
+        wbuf.len = m_wlen;
+        m_wbuf = NULL;
+        m_wlen = 0;
+        m_wbufmutex.Unlock();
+      }
+      if (wbuf.data) {
+        if (m_nc && wbuf.len) {
+          mg_send_http_chunk(m_nc, wbuf.data, wbuf.len);
+          txlen += wbuf.len;
+        }
+        free(wbuf.data);
+      }
+    }
+
     if (txlen) {
       m_sent += txlen;
       ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] ProcessQueue txlen=%d, qlen=%d done=%d sent=%d ack=%d",
@@ -157,7 +183,7 @@ void HttpCommandStream::ProcessQueue()
     }
   }
 
-  if (m_done && m_sent == m_ack) {
+  if (done && txlen == 0 && m_sent == m_ack) {
     ESP_EARLY_LOGD(TAG, "HttpCommandStream[%p] DONE, %d bytes sent, %d bytes free",
       m_nc, m_sent, heap_caps_get_free_size(MALLOC_CAP_8BIT));
     if (m_nc) {
@@ -243,31 +269,135 @@ ssize_t HttpCommandStream::write(const void *buf, size_t nbyte)
   if (!m_writequeue)
     return nbyte;
 
+  const char* src = (const char*) buf;
+  size_t todo = nbyte;
   hcs_writebuf wbuf;
-  wbuf.data = (char*) ExternalRamMalloc(nbyte);
-  wbuf.len = nbyte;
-  memcpy(wbuf.data, buf, nbyte);
 
-  if (xQueueSend(m_writequeue, &wbuf, portMAX_DELAY) != pdTRUE) {
-    free(wbuf.data);
-    return nbyte;
-  }
+  while (todo > 0 && m_nc) {
+    // fill current chunk:
+    wbuf.data = NULL;
+    if (!m_wbufmutex.Lock())
+      break;
+    if (!m_wbuf) {
+      m_wbuf = (char*) ExternalRamMalloc(XFER_CHUNK_SIZE);
+      m_wlen = 0;
+      if (!m_wbuf) {
+        m_wbufmutex.Unlock();
+        break;
+      }
+    }
+    size_t n = std::min(todo, (size_t)XFER_CHUNK_SIZE - m_wlen);
+    memcpy(m_wbuf + m_wlen, src, n);
+    m_wlen += n;
+    src += n;
+    todo -= n;
+    if (m_wlen == XFER_CHUNK_SIZE) {
+      wbuf.data = m_wbuf;
+      wbuf.len = m_wlen;
+      m_wbuf = NULL;
+      m_wlen = 0;
+    }
+    m_wbufmutex.Unlock();
 
+    // queue full chunk, block while the queue is full:
+    if (wbuf.data) {
+      if (xQueueSend(m_writequeue, &wbuf, portMAX_DELAY) != pdTRUE) {
+        free(wbuf.data);
+        break;
+      }
 #if MG_ENABLE_BROADCAST && WEBSRV_USE_MG_BROADCAST
-  if (uxQueueMessagesWaiting(m_writequeue) == 1) {
-    ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] RequestPoll, qlen=1 done=%d sent=%d ack=%d", m_nc, m_done, m_sent, m_ack);
-    RequestPoll();
-    ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] RequestPollDone, qlen=%d done=%d sent=%d ack=%d", m_nc, uxQueueMessagesWaiting(m_writequeue), m_done, m_sent, m_ack);
-  }
-  else
+      if (uxQueueMessagesWaiting(m_writequeue) == 1) {
+        ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] RequestPoll, qlen=1 done=%d sent=%d ack=%d", m_nc, m_done, m_sent, m_ack);
+        RequestPoll();
+        ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] RequestPollDone, qlen=%d done=%d sent=%d ack=%d", m_nc, uxQueueMessagesWaiting(m_writequeue), m_done, m_sent, m_ack);
+      }
+      else
 #endif // MG_ENABLE_BROADCAST && WEBSRV_USE_MG_BROADCAST
-    ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] AddQueue, qlen=%d done=%d sent=%d ack=%d", m_nc, uxQueueMessagesWaiting(m_writequeue), m_done, m_sent, m_ack);
+        ESP_EARLY_LOGV(TAG, "HttpCommandStream[%p] AddQueue, qlen=%d done=%d sent=%d ack=%d", m_nc, uxQueueMessagesWaiting(m_writequeue), m_done, m_sent, m_ack);
+    }
+  }
 
   return nbyte;
 }
 
-void HttpCommandStream::Log(LogBuffers* message)
+
+/**
+ * HttpChunkShell: synchronous command execution within a page handler
+ */
+
+HttpChunkShell::HttpChunkShell(mg_connection* nc, bool html /*=true*/, int verbosity /*=COMMAND_RESULT_NORMAL*/)
+  : OvmsShell(verbosity)
+{
+  m_nc = nc;
+  m_html = html;
+  Initialize(false);
+}
+
+HttpChunkShell::~HttpChunkShell()
+{
+  Flush();
+}
+
+void HttpChunkShell::Initialize(bool print)
+{
+  OvmsShell::Initialize(print);
+  ProcessChar('\n');
+}
+
+void HttpChunkShell::Flush()
 {
-  // writing could block, logging is done via the websocket stream
-  message->release();
+  if (m_len) {
+    mg_send_http_chunk(m_nc, m_buf, m_len);
+    m_sent += m_len;
+    m_len = 0;
+  }
+}
+
+int HttpChunkShell::puts(const char* s)
+{
+  write(s, strlen(s));
+  write("\n", 1);
+  return 0;
+}
+
+int HttpChunkShell::printf(const char* fmt, ...)
+{
+  char *buffer = NULL;
+  va_list args;
+  va_start(args, fmt);
+  int ret = vasprintf(&buffer, fmt, args);
+  va_end(args);
+  if (ret >= 0) {
+    write(buffer, ret);
+    free(buffer);
+  }
+  return ret;
+}
+
+ssize_t HttpChunkShell::write(const void *buf, size_t nbyte)
+{
+  const char* src = (const char*) buf;
+  for (size_t i = 0; i < nbyte; i++) {
+    const char* ent = NULL;
+    if (m_html) {
+      switch (src[i]) {
+        case '\"': ent = "&quot;"; break;
+        case '\'': ent = "&#x27;"; break;
+        case '<':  ent = "&lt;";   break;
+        case '>':  ent = "&gt;";   break;
+        case '&':  ent = "&amp;";  break;
+        default:   break;
+      }
+    }
+    size_t len = ent ? strlen(ent) : 1;
+    if (m_len + len > sizeof(m_buf))
+      Flush();
+    if (ent) {
+      memcpy(m_buf + m_len, ent, len);
+      m_len += len;
+    } else {
+      m_buf[m_len++] = src[i];
+    }
+  }
+  return nbyte;
 }
@@ -39,6 +39,10 @@ static const char *TAG = "webserver";
 #include <string.h>
 #include <stdio.h>
 #include <fstream>
+#include <algorithm>
+#include <inttypes.h>
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
 #include "ovms_webserver.h"
 #include "ovms_config.h"
 #include "ovms_metrics.h"
@@ -52,6 +56,11 @@ static const char *TAG = "webserver";
 
 OvmsWebServer MyWebServer __attribute__ ((init_priority (8200)));
 
+static void webserver_stats(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+{
+  MyWebServer.StatsOutput(writer, (argc > 0 && strcmp(argv[0], "reset") == 0));
+}
+
 OvmsWebServer::OvmsWebServer()
 {
   ESP_LOGI(TAG, "Initialising WEBSERVER (8200)");
@@ -82,6 +91,13 @@ OvmsWebServer::OvmsWebServer()
   MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&OvmsWebServer::ConfigChanged, this, _1, _2));
   MyEvents.RegisterEvent(TAG, "config.mounted", std::bind(&OvmsWebServer::ConfigChanged, this, _1, _2));
   MyEvents.RegisterEvent(TAG, "*", std::bind(&OvmsWebServer::EventListener, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "ticker.60", std::bind(&OvmsWebServer::StatsTicker, this, _1, _2));
+
+  OvmsCommand* cmd_webserver = MyCommandApp.RegisterCommand("webserver", "Web server framework");
+  cmd_webserver->RegisterCommand("stats", "Show page handler statistics", webserver_stats, "[reset]", 0, 1);
+
+  // page index: reserve buckets to avoid rehashing on registrations while serving
+  m_pageindex.reserve(128);
 
   // register standard framework URIs:
   RegisterPage("/", "OVMS", HandleRoot);
@@ -101,6 +117,7 @@ OvmsWebServer::OvmsWebServer()
   // register standard API calls:
   RegisterPage("/api/execute", "Execute command", HandleCommand, PageMenu_None, PageAuth_Cookie);
   RegisterPage("/api/file", "Load/Save file", HandleFile, PageMenu_None, PageAuth_Cookie);
+  RegisterPage("/api/history", "Metric history", HandleHistory, PageMenu_None, PageAuth_Cookie);
 
   // register standard public pages:
   RegisterPage("/dashboard", "Dashboard", HandleDashboard, PageMenu_Main, PageAuth_None);
@@ -352,21 +369,127 @@ void OvmsWebServer::RegisterPage(std::string uri, std::string label, PageHandler
       }
     }
   }
-  m_pagemap.insert_after(prev, PageEntry(uri, label, handler, menu, auth));
+  auto it = m_pagemap.insert_after(prev, PageEntry(uri, label, handler, menu, auth));
+  m_pageindex[uri] = &(*it);
 }
 
 void OvmsWebServer::DeregisterPage(std::string uri)
 {
+  m_pageindex.erase(uri);
   m_pagemap.remove_if([uri](PageEntry &e){ return (e.uri == uri); });
 }
 
 PageEntry* OvmsWebServer::FindPage(std::string uri)
 {
+  auto it = m_pageindex.find(uri);
+  if (it == m_pageindex.end())
+    return NULL;
+  return it->second;
+}
+
+/**
+ * UpdatePageIndex: rebuild the uri lookup index after bulk page map changes
+ */
+void OvmsWebServer::UpdatePageIndex()
+{
+  m_pageindex.clear();
+  for (PageEntry& e : m_pagemap)
+    m_pageindex[e.uri] = &e;
+}
+
+
+/**
+ * ServePage: call page handler & collect statistics
+ *  Note: bytes & heap usage only cover the synchronous handler call, output
+ *  done asynchronously (i.e. by a HttpDataSender or HttpCommandStream) is not included.
+ */
+void OvmsWebServer::ServePage(PageEntry* page, PageContext_t& c)
+{
+  size_t bytes = c.nc->send_mbuf.len;
+  size_t heap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  int64_t start = esp_timer_get_time();
+
+  page->Serve(c);
+
+  uint32_t time = esp_timer_get_time() - start;
+  int32_t heapuse = (int32_t)heap - (int32_t)heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  page->stat_requests++;
+  if (c.nc->send_mbuf.len > bytes)
+    page->stat_bytes += c.nc->send_mbuf.len - bytes;
+  page->stat_time += time;
+  if (time > page->stat_time_max)
+    page->stat_time_max = time;
+  if (heapuse > page->stat_heap_max)
+    page->stat_heap_max = heapuse;
+
+  m_stat_requests++;
+  if (time > m_stat_winmax) {
+    OvmsMutexLock lock(&m_stat_mutex);
+    if (time > m_stat_winmax) {
+      m_stat_winmax = time;
+      m_stat_winuri = page->uri;
+    }
+  }
+}
+
+/**
+ * StatsOutput: page handler statistics, sorted by total handler time
+ */
+void OvmsWebServer::StatsOutput(OvmsWriter* writer, bool reset /*=false*/)
+{
+  std::vector<PageEntry*> pages;
   for (PageEntry& e : m_pagemap) {
-    if (e.uri == uri)
-      return &e;
+    if (e.stat_requests)
+      pages.push_back(&e);
+  }
+  std::sort(pages.begin(), pages.end(), [](const PageEntry* a, const PageEntry* b) {
+    return a->stat_time > b->stat_time;
+  });
+
+  writer->printf("Page requests: %" PRIu32 " (%u pages registered, %u used)\n",
+    m_stat_requests, (unsigned) m_pageindex.size(), (unsigned) pages.size());
+  if (!pages.empty()) {
+    writer->printf("%-32s %7s %10s %9s %9s %9s %8s\n",
+      "URI", "Count", "Bytes", "Avg[ms]", "Max[ms]", "Tot[s]", "Heap+");
+    for (PageEntry* e : pages) {
+      writer->printf("%-32.32s %7" PRIu32 " %10" PRIu64 " %9.1f %9.1f %9.1f %8" PRId32 "\n",
+        e->uri.c_str(), e->stat_requests, e->stat_bytes,
+        (double) e->stat_time / e->stat_requests / 1000,
+        (double) e->stat_time_max / 1000,
+        (double) e->stat_time / 1000000,
+        e->stat_heap_max);
+    }
+  }
+
+  if (reset) {
+    for (PageEntry& e : m_pagemap) {
+      e.stat_requests = 0;
+      e.stat_bytes = 0;
+      e.stat_time = 0;
+      e.stat_time_max = 0;
+      e.stat_heap_max = 0;
+    }
+    m_stat_requests = 0;
+    writer->puts("Statistics reset.");
   }
-  return NULL;
+}
+
+/**
+ * StatsTicker: publish request metrics, start new max time window
+ */
+void OvmsWebServer::StatsTicker(std::string event, void* data)
+{
+  uint32_t winmax;
+  std::string winuri;
+  {
+    OvmsMutexLock lock(&m_stat_mutex);
+    winmax = m_stat_winmax;
+    winuri.swap(m_stat_winuri);
+    m_stat_winmax = 0;
+  }
+  StandardMetrics.ms_m_web_req_count->SetValue((int) m_stat_requests);
+  StandardMetrics.ms_m_web_req_max->SetValue((float) winmax / 1000000);
+  StandardMetrics.ms_m_web_req_slowest->SetValue(winuri);
 }
 
 
@@ -374,17 +497,17 @@ PageEntry* OvmsWebServer::FindPage(std::string uri)
  * Plugin Registry
  */
 
-void PagePluginContent::LoadContent()
+std::string PagePluginContent::GetFilePath()
 {
-  std::string path;
   if (m_pluginstore)
-    {
-    path = "/store/plugins/" + m_path;
-    }
+    return "/store/plugins/" + m_path;
   else
-    {
-    path = "/store/plugin/" + m_path;
-    }
+    return "/store/plugin/" + m_path;
+}
+
+void PagePluginContent::LoadContent()
+{
+  std::string path = GetFilePath();
   std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
 
   ESP_LOGD(TAG,"Plugin LoadContent: %s = %s",m_path.c_str(),path.c_str());
@@ -408,6 +531,33 @@ void PagePluginContent::LoadContent()
       ESP_LOGD(TAG, "Plugin file loaded: '%s', %u bytes", path.c_str(), (size_t)size);
     }
   }
+
+  m_etag = PageContext::make_etag(m_content.data(), m_content.size());
+}
+
+void PagePluginContent::LoadContentGz()
+{
+  std::string path = GetFilePath() + ".gz";
+  std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+
+  m_gz_checked = true;
+  m_content_gz.clear();
+  m_etag_gz.clear();
+
+  if (!file.is_open())
+    return;
+  auto size = file.tellg();
+  if (size <= 0)
+    return;
+  m_content_gz.resize(size, '\0');
+  file.seekg(0);
+  if (!file.read(&m_content_gz[0], size)) {
+    ESP_LOGE(TAG, "Plugin file '%s': read failed", path.c_str());
+    m_content_gz.clear();
+    return;
+  }
+  m_etag_gz = PageContext::make_etag(m_content_gz.data(), m_content_gz.size());
+  ESP_LOGD(TAG, "Plugin file loaded: '%s', %u bytes", path.c_str(), (size_t)size);
 }
 
 void OvmsWebServer::RegisterPlugins()
@@ -466,6 +616,7 @@ void OvmsWebServer::RegisterPlugins()
 void OvmsWebServer::DeregisterPlugins()
 {
   m_pagemap.remove_if([](PageEntry& e){ return e.handler == PluginHandler; });
+  UpdatePageIndex();
   m_plugin_pages.clear();
   DeregisterCallbacks("http.plugin");
   m_plugin_parts.clear();
@@ -477,10 +628,14 @@ void OvmsWebServer::ReloadPlugin(std::string path)
     path = path.substr(14);
   else if (startsWith(path, "/store/plugins/"))
     path = path.substr(15);
+  if (endsWith(path, ".gz"))
+    path = path.substr(0, path.length() - 3);
 
   for (auto i = m_plugin_pages.begin(); i != m_plugin_pages.end(); i++) {
-    if (i->second.m_path == path)
+    if (i->second.m_path == path) {
       i->second.LoadContent();
+      i->second.m_gz_checked = false;     // recheck precompressed variant on next request
+    }
   }
 
   for (auto i = m_plugin_parts.begin(); i != m_plugin_parts.end(); i++) {
@@ -495,8 +650,35 @@ void OvmsWebServer::PluginHandler(PageEntry_t& p, PageContext_t& c)
   if (i == MyWebServer.m_plugin_pages.end())
     return;
 
-  extram::string& content = i->second.GetContent();
-  c.head(200);
+  PagePluginContent& plugin = i->second;
+
+  // serve a precompressed "<file>.gz" variant if the client accepts it:
+  if (c.acceptgzip() && !plugin.GetContentGz().empty()) {
+    const char* headers =
+      "Content-Type: text/html; charset=utf-8\r\n"
+      "Content-Encoding: gzip\r\n"
+      "Vary: Accept-Encoding\r\n"
+      "Cache-Control: no-cache";
+    if (c.notmodified(plugin.m_etag_gz, headers))
+      return;
+    std::string head = headers;
+    head += "\r\nETag: " + plugin.m_etag_gz;
+    c.head(200, head.c_str());
+    c.print(plugin.m_content_gz);
+    c.done();
+    return;
+  }
+
+  extram::string& content = plugin.GetContent();
+  const char* headers =
+    "Content-Type: text/html; charset=utf-8\r\n"
+    "Vary: Accept-Encoding\r\n"
+    "Cache-Control: no-cache";
+  if (c.notmodified(plugin.m_etag, headers))
+    return;
+  std::string head = headers;
+  head += "\r\nETag: " + plugin.m_etag;
+  c.head(200, head.c_str());
   c.print(content);
   c.done();
 }
@@ -554,7 +736,7 @@ void OvmsWebServer::EventHandler(mg_connection *nc, int ev, void *p)
         PageEntry* page = MyWebServer.FindPage(c.uri.c_str());
         if (page) {
           // serve by page handler:
-          page->Serve(c);
+          MyWebServer.ServePage(page, c);
         }
 #if MG_ENABLE_FILESYSTEM
         else if (MyWebServer.m_file_enable) {
@@ -38,6 +38,7 @@
 #include <memory>
 #include <utility>
 #include <map>
+#include <unordered_map>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/timers.h"
@@ -50,6 +51,7 @@
 #include "ovms_shell.h"
 #include "ovms_netmanager.h"
 #include "ovms_utils.h"
+#include "ovms_mutex.h"
 #include "log_buffers.h"
 
 // The setup wizard currently is tailored to be used with a WiFi enabled module:
@@ -148,10 +150,14 @@ struct PageContext : public ExternalRamAllocated
   static extram::string encode_html(const extram::string& text);
   static std::string make_id(const char* text);
   static std::string make_id(const std::string text);
+  static std::string make_etag(const void* data, size_t size);
+  bool acceptgzip();
 
   // output:
   void error(int code, const char* text);
   void head(int code, const char* headers=NULL);
+  bool notmodified(const std::string& etag, const char* headers=NULL);
+  size_t execute(const std::string& command, bool html=true, int verbosity=COMMAND_RESULT_NORMAL);
   void print(const std::string text);
   void print(const extram::string text);
   void print(const char* text);
@@ -223,6 +229,13 @@ struct PageEntry
   PageAuth_t auth;
   PageCallbackMap_t callbacklist;
 
+  // statistics (handler call, see OvmsWebServer::EventHandler):
+  uint32_t stat_requests = 0;           // number of requests served
+  uint64_t stat_bytes = 0;              // bytes output by the handler call
+  uint64_t stat_time = 0;               // total handler time [us]
+  uint32_t stat_time_max = 0;           // max handler time [us]
+  int32_t stat_heap_max = 0;            // max heap usage increase over handler call [bytes]
+
   PageEntry(std::string _uri, std::string _label, PageHandler_t _handler, PageMenu_t _menu=PageMenu_None, PageAuth_t _auth=PageAuth_None)
   {
     uri = _uri;
@@ -240,6 +253,7 @@ struct PageEntry
 };
 
 typedef std::forward_list<PageEntry> PageMap_t;
+typedef std::unordered_map<std::string, PageEntry*> PageIndex_t;
 
 
 /**
@@ -251,6 +265,10 @@ struct PagePluginContent
   bool              m_pluginstore;
   std::string       m_path;
   extram::string    m_content;
+  std::string       m_etag;
+  extram::string    m_content_gz;           // precompressed variant ("<file>.gz"), optional
+  std::string       m_etag_gz;
+  bool              m_gz_checked = false;
 
   PagePluginContent(std::string path, bool pluginstore=false) {
     m_path = path;
@@ -263,7 +281,15 @@ struct PagePluginContent
     return m_content;
   }
 
+  extram::string& GetContentGz() {
+    if (!m_gz_checked)
+      LoadContentGz();
+    return m_content_gz;
+  }
+
+  std::string GetFilePath();
   void LoadContent();
+  void LoadContentGz();
 };
 
 typedef std::map<std::string, PagePluginContent> PagePluginMap;
@@ -366,7 +392,7 @@ enum WebSocketTxJobType
   WSTX_MetricsUpdate,         // payload: -
   WSTX_Config,                // payload: config (todo)
   WSTX_Notify,                // payload: notification
-  WSTX_LogBuffers,            // payload: logbuffers
+  WSTX_Log,                   // payload: - (reads log ring)
   WSTX_UnitMetricUpdate,      // payload: -
   WSTX_UnitPrefsUpdate,       // payload: -
 };
@@ -379,7 +405,6 @@ struct WebSocketTxJob
     char*                     event;
     OvmsConfigParam*          config;
     OvmsNotifyEntry*          notification;
-    LogBuffers*               logbuffers;
   };
 
   void clear(size_t client);
@@ -418,14 +443,14 @@ class WebSocketHandler : public MgHandler, public OvmsWriter
     void UnitsCheckSubscribe();
     void UnitsCheckVehicleSubscribe();
 
-  // OvmsWriter:
   public:
-    void Log(LogBuffers* message);
+    static bool LogRingNotify(void* ctx);
 
   public:
     size_t                    m_slot = 0;
     size_t                    m_modifier = 0;         // "our" metrics modifier
     size_t                    m_reader = 0;           // "our" notification reader id
+    int                       m_logreader = -1;       // "our" log ring reader id
     QueueHandle_t             m_jobqueue = NULL;
     uint32_t                  m_jobqueue_overflow_status = 0;
     uint32_t                  m_jobqueue_overflow_logged = 0;
@@ -452,6 +477,11 @@ typedef std::vector<WebSocketSlot> WebSocketSlots;
 
 /**
  * HttpCommandStream: execute command, stream output to HTTP connection
+ *
+ * The command runs in a separate task. Output is collected into chunks of
+ * XFER_CHUNK_SIZE bytes and passed to the mongoose task through a short queue,
+ * the command task blocks while the queue is full (backpressure), so memory
+ * usage is bounded by the chunk size, not by the output size.
  */
 
 class HttpCommandStream : public OvmsShell, public MgHandler
@@ -470,7 +500,10 @@ class HttpCommandStream : public OvmsShell, public MgHandler
     bool                      m_javascript = false;
     TaskHandle_t              m_cmdtask = NULL;
     QueueHandle_t             m_writequeue = NULL;
-    bool                      m_done = false;
+    OvmsMutex                 m_wbufmutex;            // protects the current chunk buffer
+    char*                     m_wbuf = NULL;          // current (partial) chunk
+    size_t                    m_wlen = 0;             // fill level of current chunk
+    volatile bool             m_done = false;
     size_t                    m_sent = 0;
     int                       m_ack = 0;
 
@@ -480,7 +513,36 @@ class HttpCommandStream : public OvmsShell, public MgHandler
     int puts(const char* s);
     int printf(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
     ssize_t write(const void *buf, size_t nbyte);
-    void Log(LogBuffers* message);
+};
+
+
+/**
+ * HttpChunkShell: execute a command within a page handler, output is sent
+ *  directly as HTTP chunks (optionally HTML encoded) via a XFER_CHUNK_SIZE
+ *  buffer instead of capturing it in a string first.
+ *  Use PageContext::execute() to run a command.
+ */
+
+class HttpChunkShell : public OvmsShell
+{
+  public:
+    HttpChunkShell(mg_connection* nc, bool html=true, int verbosity=COMMAND_RESULT_NORMAL);
+    ~HttpChunkShell();
+
+  public:
+    void Initialize(bool print);
+    virtual bool IsInteractive() { return false; }
+    int puts(const char* s);
+    int printf(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
+    ssize_t write(const void *buf, size_t nbyte);
+    void Flush();
+
+  public:
+    mg_connection*            m_nc;
+    bool                      m_html;
+    size_t                    m_len = 0;
+    size_t                    m_sent = 0;
+    char                      m_buf[XFER_CHUNK_SIZE];
 };
 
 
@@ -515,6 +577,10 @@ class OvmsWebServer : public ExternalRamAllocated
       PageMenu_t menu=PageMenu_None, PageAuth_t auth=PageAuth_None, int priority=0);
     void DeregisterPage(std::string uri);
     PageEntry* FindPage(std::string uri);
+    void ServePage(PageEntry* page, PageContext_t& c);
+    void UpdatePageIndex();
+    void StatsOutput(OvmsWriter* writer, bool reset=false);
+    void StatsTicker(std::string event, void* data);
     bool RegisterCallback(std::string caller, std::string uri, PageCallback_t handler, int priority=0);
     void DeregisterCallbacks(std::string caller);
     void RegisterPlugins();
@@ -551,6 +617,7 @@ class OvmsWebServer : public ExternalRamAllocated
     static void HandleStatus(PageEntry_t& p, PageContext_t& c);
     static void HandleCommand(PageEntry_t& p, PageContext_t& c);
     static void HandleFile(PageEntry_t& p, PageContext_t& c);
+    static void HandleHistory(PageEntry_t& p, PageContext_t& c);
     static void HandleShell(PageEntry_t& p, PageContext_t& c);
     static void HandleDashboard(PageEntry_t& p, PageContext_t& c);
     static void HandleBmsCellMonitor(PageEntry_t& p, PageContext_t& c);
@@ -601,7 +668,13 @@ class OvmsWebServer : public ExternalRamAllocated
     mg_serve_http_opts        m_file_opts;
 #endif //MG_ENABLE_FILESYSTEM
 
-    PageMap_t                 m_pagemap;
+    PageMap_t                 m_pagemap;                    // pages in registration (menu) order
+    PageIndex_t               m_pageindex;                  // uri → page lookup index
+
+    uint32_t                  m_stat_requests = 0;          // total page requests served
+    uint32_t                  m_stat_winmax = 0;            // max handler time in current minute [us]
+    std::string               m_stat_winuri;                // … for uri
+    OvmsMutex                 m_stat_mutex;                 // protects m_stat_winmax & m_stat_winuri
     PagePluginMap             m_plugin_pages;
     PagePluginMultiMap        m_plugin_parts;
 
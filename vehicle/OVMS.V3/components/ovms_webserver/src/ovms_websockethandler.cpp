@@ -78,14 +78,13 @@ WebSocketHandler::WebSocketHandler(mg_connection* nc, size_t slot, size_t modifi
   MyMetrics.InitialiseSlot(m_slot);
   MyUnitConfig.InitialiseSlot(m_slot);
   
-  // Register as logging console:
-  SetMonitoring(true);
-  MyCommandApp.RegisterConsole(this);
+  // Register as log ring reader:
+  m_logreader = MyCommandApp.GetLogRing()->AddReader("WebSocket", LogRingNotify, this);
 }
 
 WebSocketHandler::~WebSocketHandler()
 {
-  MyCommandApp.DeregisterConsole(this);
+  MyCommandApp.GetLogRing()->RemoveReader(m_logreader);
   if (m_jobqueue) {
     while (xQueueReceive(m_jobqueue, &m_job, 0) == pdTRUE)
       ClearTxJob(m_job);
@@ -136,6 +135,7 @@ void WebSocketHandler::ProcessTxJob()
         std::string msg;
         msg.reserve(2*XFER_CHUNK_SIZE+128);
         msg = "{\"metrics\":{";
+        OvmsMetricBuffer buf(msg);
         for (i=0; m && msg.size() < XFER_CHUNK_SIZE; m=m->m_next) {
           ++m_last;
           if (m->IsModifiedAndClear(m_modifier) || m_job.type == WSTX_MetricsAll) {
@@ -143,7 +143,7 @@ void WebSocketHandler::ProcessTxJob()
             msg += '\"';
             msg += m->m_name;
             msg += "\":";
-            msg += m->AsJSON();
+            m->AppendJSONTo(buf);
             i++;
           }
         }
@@ -336,25 +336,38 @@ void WebSocketHandler::ProcessTxJob()
       break;
     }
     
-    case WSTX_LogBuffers:
+    case WSTX_Log:
     {
-      // Note: this sender loops over the buffered lines by index (kept in m_sent)
+      // Note: this sender reads the log ring in place, sending one line per call.
       // Single log lines may be longer than our nominal XFER_CHUNK_SIZE, but that is
       // very rarely the case, so we shouldn't need to additionally chunk them.
-      LogBuffers* lb = m_job.logbuffers;
-
-      // find next line:
-      int i;
-      LogBuffers::iterator it;
-      for (i=0, it=lb->begin(); i < m_sent && it != lb->end(); it++, i++);
+      LogRing* ring = MyCommandApp.GetLogRing();
+      if (!m_last) {
+        // reenable notification, new lines will queue a new job:
+        ring->Acknowledge(m_logreader);
+        m_last = 1;
+      }
       
-      if (it != lb->end()) {
-        // encode & send:
-        std::string msg;
-        msg.reserve(strlen(*it)+128);
-        msg = "{\"log\":\"";
-        msg += json_encode(stripesc(*it));
-        msg += "\"}";
+      // get next line, skip lines overwritten while encoding:
+      std::string msg;
+      const char* text;
+      size_t len;
+      uint32_t lost = ring->GetLost(m_logreader);
+      if (lost) {
+        msg = string_format("{\"log\":\"[%" PRIu32 " log messages lost]\\n\"}", lost);
+      }
+      while (msg.empty() && ring->Peek(m_logreader, &text, &len)) {
+        std::string line(text, len);
+        if (ring->Advance(m_logreader)) {
+          msg.reserve(len+128);
+          msg = "{\"log\":\"";
+          msg += json_encode(stripesc(line.c_str()));
+          msg += "\"}";
+        }
+      }
+      
+      if (!msg.empty()) {
+        // send:
         mg_send_websocket_frame(m_nc, WEBSOCKET_OP_TEXT, msg.data(), msg.size());
         m_sent++;
       }
@@ -398,10 +411,6 @@ void WebSocketTxJob::clear(size_t client)
         if (mt) mt->MarkRead(slot.reader, notification);
       }
       break;
-    case WSTX_LogBuffers:
-      if (logbuffers)
-        logbuffers->release();
-      break;
     default:
       break;
   }
@@ -544,16 +553,16 @@ void WebSocketHandler::HandleIncomingMsg(std::string msg)
 
 
 /**
- * OvmsWriter interface
+ * Log ring interface
  */
 
-void WebSocketHandler::Log(LogBuffers* message)
+bool WebSocketHandler::LogRingNotify(void* ctx)
 {
+  WebSocketHandler* me = (WebSocketHandler*) ctx;
   WebSocketTxJob job;
-  job.type = WSTX_LogBuffers;
-  job.logbuffers = message;
-  if (!AddTxJob(job))
-    message->release();
+  job.type = WSTX_Log;
+  // Note: no RequestPoll here, the job is started by the next MG_EV_POLL
+  return me->AddTxJob(job, false);
 }
 
 
@@ -41,6 +41,7 @@ static const char *TAG = "webserver";
 #include "ovms_config.h"
 #include "ovms_metrics.h"
 #include "metrics_standard.h"
+#include "metrics_history.h"
 #include "vehicle.h"
 #include "ovms_housekeeping.h"
 #include "ovms_peripherals.h"
@@ -147,10 +148,12 @@ void OvmsWebServer::HandleStatus(PageEntry_t& p, PageContext_t& c)
     "<div class=\"col-sm-6 col-lg-4\">");
 
   c.panel_start("primary", "Vehicle");
-  output = ExecuteCommand("stat");
-  c.printf("<samp class=\"monitor\" id=\"vehicle-status\" data-updcmd=\"stat\" data-events=\"vehicle.charge\">%s</samp>", _html(output));
-  output = ExecuteCommand("location status");
-  c.printf("<samp class=\"monitor\" data-updcmd=\"location status\" data-events=\"gps.lock|gps.sq|location\">%s</samp>", _html(output));
+  c.print("<samp class=\"monitor\" id=\"vehicle-status\" data-updcmd=\"stat\" data-events=\"vehicle.charge\">");
+  c.execute("stat");
+  c.print("</samp>");
+  c.print("<samp class=\"monitor\" data-updcmd=\"location status\" data-events=\"gps.lock|gps.sq|location\">");
+  c.execute("location status");
+  c.print("</samp>");
   c.panel_end(
     "<ul class=\"list-inline\">"
       "<li><button type=\"button\" class=\"btn btn-default btn-sm\" data-target=\"#vehicle-cmdres\" data-cmd=\"charge start\">Start charge</button></li>"
@@ -183,8 +186,9 @@ void OvmsWebServer::HandleStatus(PageEntry_t& p, PageContext_t& c)
     "<div class=\"col-sm-6 col-lg-4\">");
 
   c.panel_start("primary", "SD Card");
-  output = ExecuteCommand("sd status");
-  c.printf("<samp class=\"monitor\" data-updcmd=\"sd status\" data-events=\"^sd\\.\">%s</samp>", _html(output));
+  c.print("<samp class=\"monitor\" data-updcmd=\"sd status\" data-events=\"^sd\\.\">");
+  c.execute("sd status");
+  c.print("</samp>");
   c.panel_end(
     "<ul class=\"list-inline\">"
       "<li><button type=\"button\" class=\"btn btn-default btn-sm\" data-target=\"#sd-cmdres\" data-cmd=\"sd mount\">Mount</button></li>"
@@ -197,11 +201,13 @@ void OvmsWebServer::HandleStatus(PageEntry_t& p, PageContext_t& c)
     "<div class=\"col-sm-6 col-lg-4\">");
 
   c.panel_start("primary", "Module");
-  output = ExecuteCommand("boot status");
-  c.printf("<samp id=\"boot-status-cmdres\">%s</samp>", _html(output));
+  c.print("<samp id=\"boot-status-cmdres\">");
+  c.execute("boot status");
+  c.print("</samp>");
   c.print("<hr>");
-  output = ExecuteCommand("ota status nocheck");
-  c.printf("<samp>%s</samp>", _html(output));
+  c.print("<samp>");
+  c.execute("ota status nocheck");
+  c.print("</samp>");
   c.panel_end(
     "<ul class=\"list-inline\">"
       "<li><button type=\"button\" class=\"btn btn-default btn-sm\" name=\"action\" value=\"reboot\">Reboot</button></li>"
@@ -212,9 +218,28 @@ void OvmsWebServer::HandleStatus(PageEntry_t& p, PageContext_t& c)
     "</div>"
     "<div class=\"col-sm-6 col-lg-4\">");
 
+#ifdef CONFIG_OVMS_COMP_ADC
+  c.panel_start("primary", "12V Monitor");
+  c.print("<samp class=\"monitor\" data-updcmd=\"adc status\" data-events=\"^ticker\\.10$|^system\\.adc\\.\">");
+  c.execute("adc status");
+  c.print("</samp>");
+  c.panel_end(
+    "<ul class=\"list-inline\">"
+      "<li><button type=\"button\" class=\"btn btn-default btn-sm\" data-target=\"#adc-cmdres\" data-cmd=\"adc capture list\">List captures</button></li>"
+      "<li><button type=\"button\" class=\"btn btn-default btn-sm\" data-target=\"#adc-cmdres\" data-cmd=\"adc capture show\">Show latest</button></li>"
+      "<li><button type=\"button\" class=\"btn btn-default btn-sm\" data-target=\"#adc-cmdres\" data-cmd=\"adc capture trigger\">Capture now</button></li>"
+    "</ul>"
+    "<samp id=\"adc-cmdres\"></samp>");
+
+  c.print(
+    "</div>"
+    "<div class=\"col-sm-6 col-lg-4\">");
+#endif // CONFIG_OVMS_COMP_ADC
+
   c.panel_start("primary", "Network");
-  output = ExecuteCommand("network status");
-  c.printf("<samp class=\"monitor\" data-updcmd=\"network status\" data-events=\"^network\">%s</samp>", _html(output));
+  c.print("<samp class=\"monitor\" data-updcmd=\"network status\" data-events=\"^network\">");
+  c.execute("network status");
+  c.print("</samp>");
   c.panel_end(
     "<ul class=\"list-inline\">"
       "<li><button type=\"button\" class=\"btn btn-default btn-sm\" name=\"action\" value=\"network restart\">Restart network</button></li>"
@@ -225,8 +250,9 @@ void OvmsWebServer::HandleStatus(PageEntry_t& p, PageContext_t& c)
     "<div class=\"col-sm-6 col-lg-4\">");
 
   c.panel_start("primary", "Wifi");
-  output = ExecuteCommand("wifi status");
-  c.printf("<samp class=\"monitor\" data-updcmd=\"wifi status\" data-events=\"\\.wifi\\.\">%s</samp>", _html(output));
+  c.print("<samp class=\"monitor\" data-updcmd=\"wifi status\" data-events=\"\\.wifi\\.\">");
+  c.execute("wifi status");
+  c.print("</samp>");
   c.panel_end(
     "<ul class=\"list-inline\">"
       "<li><button type=\"button\" class=\"btn btn-default btn-sm\" name=\"action\" value=\"wifi reconnect\">Reconnect Wifi</button></li>"
@@ -237,8 +263,9 @@ void OvmsWebServer::HandleStatus(PageEntry_t& p, PageContext_t& c)
     "<div class=\"col-sm-6 col-lg-4\">");
 
   c.panel_start("primary", "Cellular Modem");
-  output = ExecuteCommand("cellular status");
-  c.printf("<samp class=\"monitor\" data-updcmd=\"cellular status\" data-events=\"\\.modem\\.\">%s</samp>", _html(output));
+  c.print("<samp class=\"monitor\" data-updcmd=\"cellular status\" data-events=\"\\.modem\\.\">");
+  c.execute("cellular status");
+  c.print("</samp>");
   c.panel_end(
     "<ul class=\"list-inline\">"
       "<li><button type=\"button\" class=\"btn btn-default btn-sm\" data-target=\"#modem-cmdres\" data-cmd=\"power cellular on\">Start modem</button></li>"
@@ -336,10 +363,6 @@ void OvmsWebServer::HandleCommand(PageEntry_t& p, PageContext_t& c)
 void OvmsWebServer::HandleShell(PageEntry_t& p, PageContext_t& c)
 {
   std::string command = c.getvar("command", 2000);
-  std::string output;
-
-  if (command != "")
-    output = ExecuteCommand(command);
 
   // generate form:
   c.head(200);
@@ -366,8 +389,13 @@ void OvmsWebServer::HandleShell(PageEntry_t& p, PageContext_t& c)
       "<label><input type=\"checkbox\" id=\"logmonitor\" checked accesskey=\"L\"> <u>L</u>og Monitor</label>"
     "</div>");
 
+  // stream command output:
+  c.print("<pre class=\"receiver get-window-resize\" id=\"output\">");
+  if (command != "")
+    c.execute(command);
+  c.print("</pre>");
+
   c.printf(
-    "<pre class=\"receiver get-window-resize\" id=\"output\">%s</pre>"
     "<form id=\"shellform\" method=\"post\" action=\"#\">"
       "<div class=\"input-group\">"
         "<label class=\"input-group-addon hidden-xs\" for=\"input-command\">OVMS#</label>"
@@ -377,7 +405,7 @@ void OvmsWebServer::HandleShell(PageEntry_t& p, PageContext_t& c)
         "</div>"
       "</div>"
     "</form>"
-    , _html(output.c_str()), _attr(command.c_str()));
+    , _attr(command.c_str()));
 
   c.print(
     "<script>(function(){"
@@ -3023,6 +3051,8 @@ void OvmsWebServer::HandleCfgLogging(PageEntry_t& p, PageContext_t& c)
       pmap["file.keepdays"] = c.getvar("file_keepdays");
     if (c.getvar("file_syncperiod") != "")
       pmap["file.syncperiod"] = c.getvar("file_syncperiod");
+    if (c.getvar("file_format") == "binary")
+      pmap["file.format"] = "binary";
 
     file_path = c.getvar("file_path");
     pmap["file.path"] = file_path;
@@ -3093,6 +3123,13 @@ void OvmsWebServer::HandleCfgLogging(PageEntry_t& p, PageContext_t& c)
   }
   c.input_info("Download", download.c_str());
 
+  c.input_radiobtn_start("File format", "file_format");
+  c.input_radiobtn_option("file_format", "Text", "", pmap["file.format"] != "binary");
+  c.input_radiobtn_option("file_format", "Binary", "binary", pmap["file.format"] == "binary");
+  c.input_radiobtn_end(
+    "<p>Binary logging defers message formatting, reducing the logging overhead. "
+    "Binary log files need to be converted to text by <code>log decode</code>.</p>");
+
   c.input("number", "Sync period", "file_syncperiod", pmap["file.syncperiod"].c_str(), "Default: 3",
     "<p>How often to flush log buffer to SD: 0 = never/auto, &lt;0 = every n messages, &gt;0 = after n/2 seconds idle</p>",
     "min=\"-1\" step=\"1\"");
@@ -4408,3 +4445,74 @@ void OvmsWebServer::HandleFile(PageEntry_t& p, PageContext_t& c)
 
   c.done();
 }
+
+
+/**
+ * HandleHistory: metric history API
+ *
+ *  URL: /api/history
+ *
+ *  @param metric
+ *    Metric name
+ *  @param tier
+ *    1s / 1m (default) / 15m
+ *  @param span
+ *    Max age in seconds, default all
+ *
+ *  @return
+ *    Status: 200 (OK) / 400 (Error) / 404 (No history for metric)
+ *    Body: JSON object { metric, units, tier, period, resolution, data, time }
+ *      data: values (1s) or [min,max,avg] arrays (1m, 15m), null = no data
+ *      time: start of the first slot (UTC seconds)
+ */
+void OvmsWebServer::HandleHistory(PageEntry_t& p, PageContext_t& c)
+{
+  std::string metric = c.getvar("metric");
+  std::string tiername = c.getvar("tier");
+  uint32_t span = atol(c.getvar("span").c_str());
+
+  std::string headers =
+    "Content-Type: application/json; charset=utf-8\r\n"
+    "Cache-Control: no-cache";
+
+  metric_history_tier_t tier = tiername.empty() ? MHT_1m : OvmsMetricHistory::TierFromName(tiername.c_str());
+  if (metric.empty() || tier == MHT_Count) {
+    c.head(400, headers.c_str());
+    c.print("{\"error\":\"Missing metric or invalid tier\"}");
+    c.done();
+    return;
+  }
+
+  OvmsMutexLock lock(&MyMetricsHistory.m_mutex);
+  OvmsMetricHistory* h = MyMetricsHistory.Find(metric);
+  if (!h) {
+    c.head(404, headers.c_str());
+    c.print("{\"error\":\"No history for metric\"}");
+    c.done();
+    return;
+  }
+
+  int prec = h->GetPrecision();
+  c.head(200, headers.c_str());
+  c.printf("{\"metric\":\"%s\",\"units\":\"%s\",\"tier\":\"%s\",\"period\":%" PRIu32 ",\"resolution\":%g,\"data\":[",
+    json_encode(h->m_name).c_str(), OvmsMetricUnitName(h->m_units),
+    OvmsMetricHistory::TierName(tier), OvmsMetricHistory::TierPeriod(tier), h->m_resolution);
+
+  int cnt = 0;
+  time_t start = 0;
+  h->Foreach(tier, span, [&c, &cnt, &start, tier, prec](const metric_history_point_t& pt) {
+    if (cnt++ == 0)
+      start = pt.time;
+    else
+      c.print(",");
+    if (!pt.defined)
+      c.print("null");
+    else if (tier == MHT_1s)
+      c.printf("%.*f", prec, pt.avg);
+    else
+      c.printf("[%.*f,%.*f,%.*f]", prec, pt.min, prec, pt.max, prec, pt.avg);
+  });
+
+  c.printf("],\"time\":%ld}", (long) start);
+  c.done();
+}
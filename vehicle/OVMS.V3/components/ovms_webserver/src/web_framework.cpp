@@ -31,6 +31,7 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <inttypes.h>
 #include "ovms_webserver.h"
 #include "ovms_config.h"
 #include "ovms_metrics.h"
@@ -140,6 +141,32 @@ std::string PageContext::make_id(std::string text) {
   return make_id(text.c_str());
 }
 
+/**
+ * make_etag: derive a strong entity tag from the content (FNV-1a hash & size)
+ */
+std::string PageContext::make_etag(const void* data, size_t size) {
+  const uint8_t* p = (const uint8_t*) data;
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    hash ^= p[i];
+    hash *= 16777619u;
+  }
+  char buf[32];
+  snprintf(buf, sizeof(buf), "\"%08" PRIx32 "-%x\"", hash, (unsigned) size);
+  return std::string(buf);
+}
+
+/**
+ * acceptgzip: check if the client accepts gzip content encoding
+ */
+bool PageContext::acceptgzip() {
+  struct mg_str *hdr = mg_get_http_header(hm, "Accept-Encoding");
+  if (!hdr)
+    return false;
+  std::string val(hdr->p, hdr->len);
+  return (val.find("gzip") != std::string::npos);
+}
+
 
 std::string PageContext::getvar(const std::string& name, size_t maxlen /*=200*/) {
   std::string res;
@@ -186,6 +213,39 @@ void PageContext::head(int code, const char* headers /*=NULL*/) {
   mg_send_head(nc, code, -1, headers);
 }
 
+/**
+ * notmodified: check If-None-Match against the current entity tag,
+ *  send a 304 response on match.
+ *  headers: additional headers (i.e. Cache-Control) to repeat in the 304 response
+ */
+bool PageContext::notmodified(const std::string& etag, const char* headers /*=NULL*/) {
+  struct mg_str *hdr = mg_get_http_header(hm, "If-None-Match");
+  if (!hdr || etag.empty())
+    return false;
+  std::string val(hdr->p, hdr->len);
+  if (val != "*" && val.find(etag) == std::string::npos)
+    return false;
+  mg_send_response_line(nc, 304, headers);
+  mg_printf(nc, "ETag: %s\r\n\r\n", etag.c_str());
+  return true;
+}
+
+/**
+ * execute: run a command, stream the output into the current chunked response
+ *  html: encode output for HTML
+ *  Returns the output size sent.
+ */
+size_t PageContext::execute(const std::string& command, bool html /*=true*/, int verbosity /*=COMMAND_RESULT_NORMAL*/) {
+  HttpChunkShell* shell = new HttpChunkShell(nc, html, verbosity);
+  shell->SetSecure(true);
+  shell->ProcessChars(command.data(), command.size());
+  shell->ProcessChar('\n');
+  shell->Flush();
+  size_t sent = shell->m_sent;
+  delete shell;
+  return sent;
+}
+
 void PageContext::print(const std::string text) {
   mg_send_http_chunk(nc, text.data(), text.size());
 }
@@ -770,6 +830,11 @@ void OvmsWebServer::OutputReconnect(PageEntry_t& p, PageContext_t& c, const char
 /**
  * HandleAsset: output gzip assets
  * Note: no check for Accept-Encoding, we can't unzip & a modern browser is required anyway
+ *
+ * Entity tags are derived from the asset content, so a client revalidation
+ * results in a 304 without transmitting the asset again. Versioned URLs
+ * (see URL_ASSETS_*) are served as immutable, unversioned URLs need to be
+ * revalidated by the client on each use.
  */
 
 extern const uint8_t script_js_gz_start[]     asm("_binary_script_js_gz_start");
@@ -792,38 +857,46 @@ void OvmsWebServer::HandleAsset(PageEntry_t& p, PageContext_t& c)
   time_t mtime;
   const char* type;
   bool gzip_encoded = true;
+  int asset;
+  static std::string etags[6];
 
   if (c.uri == "/assets/style.css") {
+    asset = 0;
     data = style_css_gz_start;
     size = style_css_gz_end - style_css_gz_start;
     mtime = MTIME_ASSETS_STYLE_CSS;
     type = "text/css";
   }
   else if (c.uri == "/assets/script.js") {
+    asset = 1;
     data = script_js_gz_start;
     size = script_js_gz_end - script_js_gz_start;
     mtime = MTIME_ASSETS_SCRIPT_JS;
     type = "application/javascript";
   }
   else if (c.uri == "/assets/charts.js") {
+    asset = 2;
     data = charts_js_gz_start;
     size = charts_js_gz_end - charts_js_gz_start;
     mtime = MTIME_ASSETS_CHARTS_JS;
     type = "application/javascript";
   }
   else if (c.uri == "/assets/tables.js") {
+    asset = 3;
     data = tables_js_gz_start;
     size = tables_js_gz_end - tables_js_gz_start;
     mtime = MTIME_ASSETS_TABLES_JS;
     type = "application/javascript";
   }
   else if (c.uri == "/assets/zones.json") {
+    asset = 4;
     data = zones_json_gz_start;
     size = zones_json_gz_end - zones_json_gz_start;
     mtime = MTIME_ASSETS_ZONES_JSON;
     type = "application/json";
   }
   else if (c.uri == "/favicon.ico" || c.uri == "/apple-touch-icon.png") {
+    asset = 5;
     data = favicon_png_start;
     size = favicon_png_end - favicon_png_start;
     mtime = MTIME_ASSETS_FAVICON_PNG;
@@ -835,10 +908,26 @@ void OvmsWebServer::HandleAsset(PageEntry_t& p, PageContext_t& c)
     return;
   }
 
-  char etag[50], current_time[50], last_modified[50];
+  // compute entity tag once per asset (the content is in flash, so it won't change):
+  std::string& etag = etags[asset];
+  if (etag.empty())
+    etag = PageContext::make_etag(data, size);
+
+  // versioned URL with the current version => allow clients to cache forever:
+  char version[20];
+  const char* cache_control;
+  if (mg_get_http_var(&c.hm->query_string, "v", version, sizeof(version)) > 0 &&
+      strtoul(version, NULL, 10) == (unsigned long) mtime)
+    cache_control = "Cache-Control: public, max-age=31536000, immutable";
+  else
+    cache_control = "Cache-Control: no-cache";
+
+  if (c.notmodified(etag, cache_control))
+    return;
+
+  char current_time[50], last_modified[50];
   time_t t = (time_t) mg_time();
   struct tm timeinfo;
-  snprintf(etag, sizeof(etag), "\"%lx.%" PRId64 "\"", (unsigned long) mtime, (int64_t) size);
   strftime(current_time, sizeof(current_time), "%a, %d %b %Y %H:%M:%S GMT", gmtime_r(&t, &timeinfo));
   strftime(last_modified, sizeof(last_modified), "%a, %d %b %Y %H:%M:%S GMT", gmtime_r(&mtime, &timeinfo));
 
@@ -850,12 +939,14 @@ void OvmsWebServer::HandleAsset(PageEntry_t& p, PageContext_t& c)
     "%s"
     "Transfer-Encoding: chunked\r\n"
     "Etag: %s\r\n"
+    "%s\r\n"
     "\r\n"
     , current_time
     , last_modified
     , type
     , gzip_encoded ? "Content-Encoding: gzip\r\n" : ""
-    , etag);
+    , etag.c_str()
+    , cache_control);
 
   // start chunked transfer:
   new HttpDataSender(c.nc, data, size);
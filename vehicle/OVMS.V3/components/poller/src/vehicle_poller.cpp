@@ -123,6 +123,28 @@ void OvmsPoller::Incoming(CAN_frame_t &frame, bool success)
     }
   }
 
+/**
+ * WantsFrame: check if a received frame may be a response to the current poll
+ *  This is called in the CAN RX task context to pass poll responses through
+ *  the vehicle's CAN RX interest filter, so it mirrors the checks of Incoming()
+ *  without taking any locks.
+ */
+bool OvmsPoller::WantsFrame(const CAN_frame_t &frame) const
+  {
+  if (m_poll.type == VEHICLE_POLL_TYPE_NONE)
+    return false;
+  if (frame.origin == m_poll_vwtp.bus && frame.MsgID == m_poll_vwtp.rxid)
+    return true;
+  if (frame.origin != m_poll.bus)
+    return false;
+  uint32_t msgid;
+  if (m_poll.protocol == ISOTP_EXTADR)
+    msgid = frame.MsgID << 8 | frame.data.u8[0];
+  else
+    msgid = frame.MsgID;
+  return (msgid >= m_poll.moduleid_low && msgid <= m_poll.moduleid_high);
+  }
+
 OvmsPoller::~OvmsPoller()
   {
   }
@@ -362,7 +384,11 @@ void OvmsPoller::PollerSend(poller_source_t source)
     {
     // Timer ticker call: check response timeout
     if (m_poll_wait > 0)
+      {
       m_poll_wait--;
+      if (m_poll_wait == 0 && m_poll.type != VEHICLE_POLL_TYPE_NONE && m_parent->IsRecording())
+        PollTrace(OvmsPollTraceEvent::Timeout, m_poll_txmsgid);
+      }
 
     // Protocol specific ticker calls:
     PollerVWTPTicker();
@@ -501,6 +527,8 @@ void OvmsPoller::Outgoing(const CAN_frame_t &frame, bool success)
   // On failure, try to speed up the current poll timeout:
   if (!success)
     {
+    if (m_parent->IsRecording())
+      PollTrace(OvmsPollTraceEvent::TxFail, frame.MsgID);
     m_poll_wait = 0;
     OvmsRecMutexLock lock(&m_poll_mutex);
     m_polls.IncomingError(m_poll, POLLSINGLE_TXFAILURE);
@@ -653,6 +681,9 @@ void OvmsPoller::DoPollerSendSuccess( void * pvParamCan, uint32_t ticker ) // St
 //: Call when poll Succeeded and no more is expected.
 void OvmsPoller::PollerSucceededPollNext()
   {
+  if (m_parent->IsRecording())
+    PollTrace(OvmsPollTraceEvent::Done, m_poll.moduleid_rec);
+
   // Not expecting any more .. so short-cut the poll receive.
   m_poll.type = VEHICLE_POLL_TYPE_NONE;
 
@@ -776,7 +807,11 @@ OvmsPollers::OvmsPollers()
     m_ready(false),
     m_paused(false),
     m_user_paused(false),
-    m_trace(trace_Off)
+    m_trace(trace_Off),
+    m_tracerec(nullptr),
+    m_tracerec_size(0),
+    m_tracerec_count(0),
+    m_tracerec_frametime(0)
   {
   ESP_LOGI(TAG, "Initialising Poller (7000)");
   for (int idx = 0; idx < VEHICLE_MAXBUSSES; ++idx)
@@ -817,6 +852,13 @@ OvmsPollers::OvmsPollers()
   cmd_times->RegisterCommand("off","Turn off Poll-Time Tracing",poller_times);
   cmd_times->RegisterCommand("status","Show timing status",poller_times);
   cmd_times->RegisterCommand("reset","Reset Poll-Time Tracing",poller_times);
+  OvmsCommand* cmd_record = cmd_poller->RegisterCommand("record","OBD Poll trace recorder",poller_record);
+  cmd_record->RegisterCommand("start","Start recording",poller_record);
+  cmd_record->RegisterCommand("stop","Stop recording (keeps the records)",poller_record);
+  cmd_record->RegisterCommand("clear","Discard the records",poller_record);
+  cmd_record->RegisterCommand("status","Show recorder status",poller_record);
+  cmd_record->RegisterCommand("list","List the latest records",poller_record_list,"[<count>]",0,1);
+  cmd_record->RegisterCommand("dump","Write the records to a binary file",poller_record_dump,"<path>",1,1);
 
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
   DuktapeObjectRegistration* dto = new DuktapeObjectRegistration("OvmsPoller");
@@ -1337,7 +1379,11 @@ void OvmsPollers::PollerTask()
         auto poller = GetPoller(entry.entry_FrameRxTx.frame.origin);
         IFTRACE(Poller) ESP_LOGV(TAG, "Pollers: FrameRx(bus=%d)", GetBusNo(entry.entry_FrameRxTx.frame.origin));
         if (poller)
+          {
+          SetTraceFrameTime(entry.entry_FrameRxTx.time);
           poller->Incoming(entry.entry_FrameRxTx.frame, entry.entry_FrameRxTx.success);
+          m_tracerec_frametime = 0;
+          }
         PollerFrameRx(entry.entry_FrameRxTx.frame);
         }
         break;
@@ -1346,7 +1392,11 @@ void OvmsPollers::PollerTask()
         auto poller = GetPoller(entry.entry_FrameRxTx.frame.origin);
         IFTRACE(Poller) ESP_LOGV(TAG, "Pollers: FrameTx(bus=%d)", GetBusNo(entry.entry_FrameRxTx.frame.origin));
         if (poller)
+          {
+          SetTraceFrameTime(entry.entry_FrameRxTx.time);
           poller->Outgoing(entry.entry_FrameRxTx.frame, entry.entry_FrameRxTx.success);
+          m_tracerec_frametime = 0;
+          }
         }
         break;
       case OvmsPoller::OvmsPollEntryType::Poll:
@@ -1702,12 +1752,29 @@ void OvmsPollers::Queue_PollerFrame(const CAN_frame_t &frame, bool success, bool
     return;
   if (!m_pollqueue)
     return;
+  if (!istx && !frame.origin->m_rxinterest.Accepts(frame.MsgID))
+    {
+    // Not handled by the vehicle, only queue if it may be a poll response:
+    bool wanted = false;
+    for (int i = 0 ; i < VEHICLE_MAXBUSSES && !wanted; ++i)
+      {
+      auto cur = m_pollers[i];
+      wanted = (cur && cur->WantsFrame(frame));
+      }
+    if (!wanted)
+      {
+      frame.origin->m_rxinterest.m_dropped++;
+      return;
+      }
+    }
   // Queues the frame
   OvmsPoller::poll_queue_entry_t entry;
   memset(&entry, 0, sizeof(entry));
   entry.entry_type = istx ? OvmsPoller::OvmsPollEntryType::FrameTx : OvmsPoller::OvmsPollEntryType::FrameRx;
   entry.entry_FrameRxTx.frame = frame;
   entry.entry_FrameRxTx.success = success;
+  if (IsRecording())
+    entry.entry_FrameRxTx.time = (uint32_t) esp_timer_get_time();
 
   IFTRACE(TXRX) ESP_LOGV(TAG, "Poller: Queue PollerFrame(%s, %s)", (success ? "OK" : "Fail"), ( istx ? "TX" : "RX") );
   if (xQueueSend(m_pollqueue, &entry, 0) != pdPASS)
@@ -68,6 +68,9 @@
 
 // OBD/UDS Negative Response Code
 #define UDS_RESP_TYPE_NRC               0x7F  // see ISO 14229 Annex A.1
+#define UDS_RESP_NRC_SNS                0x11  // … serviceNotSupported
+#define UDS_RESP_NRC_BRR                0x21  // … busyRepeatRequest
+#define UDS_RESP_NRC_ROOR               0x31  // … requestOutOfRange
 #define UDS_RESP_NRC_RCRRP              0x78  // … requestCorrectlyReceived-ResponsePending
 
 // Poll list PID xargs utility (see info above):
@@ -106,6 +109,39 @@ typedef struct
   uint32_t                lastused;         // Timestamp of last channel access
   } vwtp_channel_t;
 
+// Poll trace recorder event types:
+enum class OvmsPollTraceEvent : uint8_t
+  {
+  // Events timed when they occur:
+  Request = 1,                            // Request single/first frame sent; info = request length
+  RequestCF,                              // Request consecutive frame sent; info = frame index
+  FlowCtrlTx,                             // Flow control sent; info = separation time
+  Timeout,                                // Response timeout
+  // Events timed by the frame reception / TX callback:
+  TxFail,                                 // Frame transmission failed
+  FlowCtrlRx,                             // Flow control received; info = command
+  Single,                                 // Single frame response; info = length
+  First,                                  // First frame response; info = length (max 255)
+  Consecutive,                            // Consecutive frame response; info = frame index
+  Pending,                                // Negative response 0x78 (response pending)
+  Error,                                  // Negative response; info = code
+  Done,                                   // Response complete
+  Ignored,                                // Unexpected / out of sequence / mismatching frame
+  };
+
+// Poll trace record (16 bytes, little endian, also the dump file format):
+typedef struct __attribute__ ((packed))
+  {
+  uint32_t                time_lo;          // Timestamp [us] (esp_timer_get_time), low 32 bits
+  uint16_t                time_hi;          // … high 16 bits
+  OvmsPollTraceEvent      event;
+  uint8_t                 bus;              // Bus number (1…4)
+  uint32_t                canid;            // TX ID for sent frames, RX ID for received frames
+  uint16_t                pid;
+  uint8_t                 type;             // Poll type
+  uint8_t                 info;             // Event specific, see OvmsPollTraceEvent
+  } poll_trace_record_t;
+
 class OvmsPollers;
 
 class OvmsPoller : public InternalRamAllocated {
@@ -582,10 +618,13 @@ class OvmsPoller : public InternalRamAllocated {
     void PollerVWTPTicker();
     void PollerVWTPTxCallback(const CAN_frame_t* frame, bool success);
 
+    void PollTrace(OvmsPollTraceEvent event, uint32_t canid, uint8_t info = 0);
+
     static void DoPollerSendSuccess( void * pvParameter1, uint32_t ulParameter2 );
 
   public:
     bool HasBus(canbus* bus) { return bus == m_poll.bus;}
+    bool WantsFrame(const CAN_frame_t &frame) const;
     uint8_t CanBusNo() { return m_poll.bus_no;}
 
     uint8_t PollState() { return m_poll_state;}
@@ -625,6 +664,7 @@ class OvmsPoller : public InternalRamAllocated {
     typedef struct {
         CAN_frame_t frame;
         bool success;
+        uint32_t time;    // Queue time [us] (low 32 bits), only set while recording
     } poll_frame_entry_t;
     typedef struct {
       OvmsPollCommand cmd;
@@ -725,8 +765,13 @@ class OvmsPollers : public InternalRamAllocated {
     bool              m_ready;
     bool              m_paused;
     bool              m_user_paused;
-    typedef enum {trace_Off = 0x00, trace_Poller = 0x1, trace_TXRX = 0x2, trace_Times = 0x4, trace_All= 0x3} tracetype_t;
+    typedef enum {trace_Off = 0x00, trace_Poller = 0x1, trace_TXRX = 0x2, trace_Times = 0x4, trace_All= 0x3, trace_Record = 0x8} tracetype_t;
     uint8_t           m_trace;                // Current Trace flags.
+
+    poll_trace_record_t* m_tracerec;          // Trace recorder ring buffer (PSRAM)
+    uint32_t          m_tracerec_size;        // … capacity [records], power of 2
+    volatile uint32_t m_tracerec_count;       // … records written since start/clear
+    int64_t           m_tracerec_frametime;   // Reception time of the frame in process, 0 = none
     uint32_t          m_overflow_count[2];    // Keep track of overflows.
 
     void PollerTxCallback(const CAN_frame_t* frame, bool success);
@@ -743,6 +788,9 @@ class OvmsPollers : public InternalRamAllocated {
     static void vehicle_pause_off(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void vehicle_poller_trace(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
     static void poller_times(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void poller_record(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void poller_record_dump(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
+    static void poller_record_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv);
 
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     // OvmsPoller Object
@@ -786,9 +834,24 @@ class OvmsPollers : public InternalRamAllocated {
     void PollerStatus(int verbosity, OvmsWriter* writer);
     void SetUserPauseStatus(bool paused, int verbosity, OvmsWriter* writer);
     bool LoadTimesTrace( metric_unit_t ratio_unit, times_trace_t &trace);
+    bool TraceRecordStart();
+    void TraceRecordStop();
+    void TraceRecordClear();
+    bool TraceRecordDump(const char* path, OvmsWriter* writer);
+    void TraceRecordList(OvmsWriter* writer, int count);
+    void TraceRecordStatus(OvmsWriter* writer);
+    void SetTraceFrameTime(uint32_t time);
   public:
     bool PollerTimesTrace( OvmsWriter* writer);
     bool IsTracingTimes() { return (m_trace & trace_Times) != 0; }
+    bool IsRecording() { return (m_trace & trace_Record) != 0; }
+    void TraceRecord(const poll_trace_record_t &rec)
+      {
+      if (!m_tracerec) return;
+      uint32_t index = Atomic_Increment(m_tracerec_count, (uint32_t)1);
+      m_tracerec[index & (m_tracerec_size - 1)] = rec;
+      }
+    int64_t TraceFrameTime() { return m_tracerec_frametime; }
     typedef std::function<void(canbus*, void *)> PollCallback;
     typedef std::function<void(const CAN_frame_t &)> FrameCallback;
   private:
@@ -167,6 +167,8 @@ void OvmsPoller::PollerISOTPStart(bool fromTicker)
   m_poll.mlremain = 0;
   m_poll_wait = 2;
 
+  if (m_parent->IsRecording())
+    PollTrace(OvmsPollTraceEvent::Request, txframe.MsgID, LIMIT_MAX(tp_len, 255));
   m_poll.bus->Write(&txframe);
   }
 
@@ -269,6 +271,9 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       return false;
       }
 
+    if (m_parent->IsRecording())
+      PollTrace(OvmsPollTraceEvent::FlowCtrlRx, msgid, tp_fc_command);
+
     if (tp_fc_command == 1)
       {
       // add some wait time:
@@ -331,6 +336,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
         memcpy(&tx_data[1], m_poll_tx_data+m_poll_tx_offset, tx_datasent);
         if (tx_datasent < tx_datalen)
           memset(&tx_data[1+tx_datasent], 0x55, tx_datalen-tx_datasent);
+        if (m_parent->IsRecording())
+          PollTrace(OvmsPollTraceEvent::RequestCF, tx_frame.MsgID, m_poll_tx_frame);
         tx_frame.Write();
         m_poll_tx_offset += tx_datasent;
         m_poll_tx_remain -= tx_datasent;
@@ -369,6 +376,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
               msgid, tp_frameindex, m_poll.mlframe & 0x0f, m_poll.type, m_poll.pid,
               hexdump ? hexdump : "-");
       if (hexdump) free(hexdump);
+      if (m_parent->IsRecording())
+        PollTrace(OvmsPollTraceEvent::Ignored, msgid, tp_frameindex);
       m_poll.moduleid_low = m_poll.moduleid_high = 0; // ignore further frames
       m_poll_wait = 2; // give the bus time to let remaining frames pass
       return true;
@@ -435,6 +444,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       // Info: requestCorrectlyReceived-ResponsePending (server busy processing the request)
       ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: got OBD/UDS info %02X(%X) code=%02X (pending)",
                m_poll.bus_no, msgid, m_poll.type, m_poll.pid, error_code);
+      if (m_parent->IsRecording())
+        PollTrace(OvmsPollTraceEvent::Pending, msgid, error_code);
       // add some wait time:
       m_poll_wait++;
       return true;
@@ -444,6 +455,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       // Error: forward to application:
       ESP_LOGD(TAG, "[%" PRIu8 "]PollerISOTPReceive[%03" PRIX32 "]: process OBD/UDS error %02X(%X) code=%02X",
                m_poll.bus_no, msgid, m_poll.type, m_poll.pid, error_code);
+      if (m_parent->IsRecording())
+        PollTrace(OvmsPollTraceEvent::Error, msgid, error_code);
       // Running single poll?
       {
       OvmsRecMutexLock lock(&m_poll_mutex);
@@ -464,6 +477,14 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
     ESP_LOGD(TAG, "PollerISOTPReceive[%03" PRIX32 "]: process OBD/UDS response %02" PRIX16 "(%" PRIX16 ") frm=%u len=%u off=%u rem=%u",
              msgid, m_poll.type, m_poll.pid,
              m_poll.mlframe, response_datalen, m_poll.mloffset, m_poll.mlremain);
+    if (m_parent->IsRecording())
+      {
+      if (tp_frametype == ISOTP_FT_CONSECUTIVE)
+        PollTrace(OvmsPollTraceEvent::Consecutive, msgid, tp_frameindex);
+      else
+        PollTrace((tp_frametype == ISOTP_FT_FIRST) ? OvmsPollTraceEvent::First : OvmsPollTraceEvent::Single,
+                  msgid, LIMIT_MAX(tp_len, 255));
+      }
 
       {
       OvmsRecMutexLock lock(&m_poll_mutex);
@@ -478,6 +499,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
     ESP_LOGW(TAG, "PollerISOTPReceive[%03" PRIX32 "]: OBD/UDS response type/PID mismatch, got %02X(%X) vs %02X(%X) => ignoring: %s",
              msgid, response_type, response_pid, 0x40+m_poll.type, m_poll.pid, hexdump ? hexdump : "-");
     if (hexdump) free(hexdump);
+    if (m_parent->IsRecording())
+      PollTrace(OvmsPollTraceEvent::Ignored, msgid, response_type);
     return false;
     }
 
@@ -527,6 +550,8 @@ bool OvmsPoller::PollerISOTPReceive(CAN_frame_t* frame, uint32_t msgid)
       txdata[0] = 0x30;                // flow control frame type
       txdata[1] = 0x00;                // request all frames available
       txdata[2] = m_poll_fc_septime;   // with configured separation timing (default 25 ms)
+      if (m_parent->IsRecording())
+        PollTrace(OvmsPollTraceEvent::FlowCtrlTx, txframe.MsgID, m_poll_fc_septime);
       txframe.Write();
       m_poll.mlframe = 1;
       }
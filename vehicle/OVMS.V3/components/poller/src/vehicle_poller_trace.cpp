@@ -0,0 +1,280 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "vehicle-poll";
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "esp_timer.h"
+#include "ovms_config.h"
+#include "ovms_malloc.h"
+#include "ovms_utils.h"
+#include "vehicle.h"
+
+// Poll trace recorder
+//
+// While recording, the poller stores a 16 byte record per request, frame and
+// completion into a ring buffer in PSRAM. Frames are timed by the time the CAN
+// callback queued them, not by the time the poller task processed them.
+// The ring can be listed or dumped into a binary file for offline analysis
+// (see components/poller/tools/pollertrace.pl).
+
+#define POLL_TRACE_MAGIC          "OVMSPTR"
+#define POLL_TRACE_VERSION        1
+
+// Dump file header, followed by <count> poll_trace_record_t, oldest first:
+typedef struct __attribute__ ((packed))
+  {
+  char      magic[8];                     // "OVMSPTR\0"
+  uint16_t  version;
+  uint16_t  recsize;                      // sizeof(poll_trace_record_t)
+  uint32_t  count;                        // Number of records
+  uint32_t  lost;                         // Records overwritten before the dump
+  uint32_t  bitrate[VEHICLE_MAXBUSSES];   // Bus bit rates [bit/s], 0 = not in use
+  int64_t   time_us;                      // esp_timer_get_time() at dump
+  int64_t   time_unix;                    // Wall clock at dump, 0 = unknown
+  } poll_trace_header_t;
+
+static const char* const trace_event_names[] =
+  {
+  "-", "request", "request-cf", "fc-tx", "timeout",
+  "tx-fail", "fc-rx", "single", "first", "consec",
+  "pending", "error", "done", "ignored",
+  };
+
+static const char* TraceEventName(OvmsPollTraceEvent event)
+  {
+  size_t i = (size_t)event;
+  return (i < sizeof_array(trace_event_names)) ? trace_event_names[i] : "?";
+  }
+
+
+/**
+ * PollTrace: add a record for the current poll
+ *  (call only if MyPollers.IsRecording())
+ */
+void OvmsPoller::PollTrace(OvmsPollTraceEvent event, uint32_t canid, uint8_t info)
+  {
+  int64_t time = 0;
+  if (event >= OvmsPollTraceEvent::TxFail)
+    time = m_parent->TraceFrameTime();
+  if (time == 0)
+    time = esp_timer_get_time();
+
+  poll_trace_record_t rec;
+  rec.time_lo = (uint32_t) time;
+  rec.time_hi = (uint16_t) (time >> 32);
+  rec.event = event;
+  rec.bus = m_poll.bus_no;
+  rec.canid = canid;
+  rec.pid = m_poll.pid;
+  rec.type = m_poll.type;
+  rec.info = info;
+  m_parent->TraceRecord(rec);
+  }
+
+
+/**
+ * Recorder control
+ */
+
+void OvmsPollers::SetTraceFrameTime(uint32_t time)
+  {
+  if (time == 0 || !IsRecording())
+    m_tracerec_frametime = 0;
+  else
+    {
+    // Extend the 32 bit queue time (wraps every ~72 minutes) by the current time:
+    int64_t now = esp_timer_get_time();
+    m_tracerec_frametime = now - (uint32_t)((uint32_t)now - time);
+    }
+  }
+
+bool OvmsPollers::TraceRecordStart()
+  {
+  if (!m_tracerec)
+    {
+    // Capacity: power of 2 for the ring index mask
+    int size = MyConfig.GetParamValueInt("log", "poller.record.size", 8192);
+    uint32_t cap = 256;
+    while (cap < 65536 && cap * 2 <= (uint32_t)size)
+      cap *= 2;
+    m_tracerec = (poll_trace_record_t*) ExternalRamMalloc(cap * sizeof(poll_trace_record_t));
+    if (!m_tracerec)
+      {
+      ESP_LOGE(TAG, "Poll trace recorder: can't allocate %" PRIu32 " records", cap);
+      return false;
+      }
+    m_tracerec_size = cap;
+    m_tracerec_count = 0;
+    }
+  m_trace |= trace_Record;
+  return true;
+  }
+
+void OvmsPollers::TraceRecordStop()
+  {
+  // The records are kept for listing / dumping:
+  m_trace &= ~trace_Record;
+  }
+
+void OvmsPollers::TraceRecordClear()
+  {
+  // Clear in place: the poller task may be about to write a record even if
+  // recording has just been stopped, so the ring buffer is kept allocated
+  // (and reused by the next start) once created.
+  m_tracerec_count = 0;
+  }
+
+void OvmsPollers::TraceRecordStatus(OvmsWriter* writer)
+  {
+  uint32_t count = m_tracerec_count;
+  writer->printf("Poll trace recorder: %s, %" PRIu32 " records (%" PRIu32 " lost) in %" PRIu32 " slots\n",
+    IsRecording() ? "recording" : "stopped",
+    std::min(count, m_tracerec_size),
+    (count > m_tracerec_size) ? count - m_tracerec_size : 0,
+    m_tracerec_size);
+  }
+
+void OvmsPollers::TraceRecordList(OvmsWriter* writer, int count)
+  {
+  if (!m_tracerec)
+    {
+    writer->puts("No records");
+    return;
+    }
+  uint32_t end = m_tracerec_count;
+  uint32_t avail = std::min(end, m_tracerec_size);
+  if (count <= 0 || (uint32_t)count > avail)
+    count = avail;
+  int64_t last = 0;
+  writer->printf("%-13s %8s %-3s %-10s %-8s %-2s %-4s %s\n",
+    "time [ms]", "delta", "bus", "event", "canid", "ty", "pid", "info");
+  for (uint32_t i = end - count; i != end; i++)
+    {
+    poll_trace_record_t rec = m_tracerec[i & (m_tracerec_size - 1)];
+    int64_t time = (int64_t)rec.time_hi << 32 | rec.time_lo;
+    writer->printf("%13.3f %8.3f %-3u %-10s %08" PRIx32 " %02x %04x %u\n",
+      time / 1000.0, last ? (time - last) / 1000.0 : 0.0,
+      rec.bus, TraceEventName(rec.event), rec.canid, rec.type, rec.pid, rec.info);
+    last = time;
+    }
+  }
+
+bool OvmsPollers::TraceRecordDump(const char* path, OvmsWriter* writer)
+  {
+  if (!m_tracerec || m_tracerec_count == 0)
+    {
+    writer->puts("No records");
+    return false;
+    }
+  if (MyConfig.ProtectedPath(path))
+    {
+    writer->printf("Error: path '%s' is protected\n", path);
+    return false;
+    }
+  FILE* file = fopen(path, "w");
+  if (!file)
+    {
+    writer->printf("Error: can't write to '%s'\n", path);
+    return false;
+    }
+
+  // Pause recording during the dump, so the ring isn't overwritten while
+  // we read it:
+  bool recording = IsRecording();
+  m_trace &= ~trace_Record;
+
+  poll_trace_header_t header = {};
+  strncpy(header.magic, POLL_TRACE_MAGIC, sizeof(header.magic));
+  header.version = POLL_TRACE_VERSION;
+  header.recsize = sizeof(poll_trace_record_t);
+  uint32_t end = m_tracerec_count;
+  header.count = std::min(end, m_tracerec_size);
+  header.lost = end - header.count;
+  for (int i = 0; i < VEHICLE_MAXBUSSES; i++)
+    {
+    canbus* bus = m_canbusses[i].can;
+    header.bitrate[i] = bus ? MAP_CAN_SPEED(bus->m_speed) : 0;
+    }
+  header.time_us = esp_timer_get_time();
+  time_t now = time(NULL);
+  header.time_unix = (now > 1600000000) ? now : 0;
+
+  bool ok = (fwrite(&header, sizeof(header), 1, file) == 1);
+
+  // Write in up to two contiguous chunks (ring wrap):
+  uint32_t first = (end - header.count) & (m_tracerec_size - 1);
+  uint32_t n1 = std::min(header.count, m_tracerec_size - first);
+  if (ok && n1)
+    ok = (fwrite(&m_tracerec[first], sizeof(poll_trace_record_t), n1, file) == n1);
+  if (ok && header.count > n1)
+    ok = (fwrite(&m_tracerec[0], sizeof(poll_trace_record_t), header.count - n1, file) == header.count - n1);
+  if (fclose(file) != 0)
+    ok = false;
+
+  if (recording)
+    m_trace |= trace_Record;
+
+  if (ok)
+    writer->printf("%" PRIu32 " records written to '%s'\n", header.count, path);
+  else
+    writer->printf("Error: write to '%s' failed\n", path);
+  return ok;
+  }
+
+
+/**
+ * Shell commands
+ */
+
+void OvmsPollers::poller_record(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (strcmp(cmd->GetName(), "start") == 0)
+    {
+    if (!MyPollers.TraceRecordStart())
+      {
+      writer->puts("Error: can't allocate the record buffer");
+      return;
+      }
+    }
+  else if (strcmp(cmd->GetName(), "stop") == 0)
+    MyPollers.TraceRecordStop();
+  else if (strcmp(cmd->GetName(), "clear") == 0)
+    MyPollers.TraceRecordClear();
+  //"status" falls through here.
+
+  MyPollers.TraceRecordStatus(writer);
+  }
+
+void OvmsPollers::poller_record_dump(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPollers.TraceRecordDump(argv[0], writer);
+  }
+
+void OvmsPollers::poller_record_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyPollers.TraceRecordList(writer, (argc > 0) ? atoi(argv[0]) : 50);
+  }
@@ -291,6 +291,9 @@ void OvmsPoller::PollerVWTPEnter(vwtp_channelstate_t state)
         if (m_poll_vwtp.txseqnr > 0)
           usleep(m_poll_vwtp.septime);
 
+        if (m_parent->IsRecording())
+          PollTrace(m_poll_tx_frame ? OvmsPollTraceEvent::RequestCF : OvmsPollTraceEvent::Request,
+                    txframe.MsgID, m_poll_tx_frame);
         m_poll_vwtp.txseqnr++;
         m_poll_tx_frame++;
         m_poll_vwtp.bus->Write(&txframe);
@@ -0,0 +1,240 @@
+#! /usr/bin/perl -w
+#
+# pollertrace.pl: analyze an OVMS poller trace recording
+#
+# Usage:
+#   pollertrace.pl [-l] [-h] <dumpfile>
+#     -l  list all records (text)
+#     -h  show latency histograms
+#
+# Create the dump file on the module by:
+#   poller record start
+#   … (let the vehicle poll for a while)
+#   poller record dump /sd/poller.ptr
+#
+# Download the file via the web UI file editor, SCP or the SD card.
+#
+
+use strict;
+use Getopt::Std;
+use List::Util qw(sum min max);
+
+our ($opt_l, $opt_h);
+getopts('lh') or die "Usage: $0 [-l] [-h] <dumpfile>\n";
+my $file = shift or die "Usage: $0 [-l] [-h] <dumpfile>\n";
+
+# Event codes (OvmsPollTraceEvent):
+my @EVNAME = qw(- request request-cf fc-tx timeout tx-fail fc-rx single first consec pending error done ignored);
+my %EV;
+@EV{@EVNAME} = (0..$#EVNAME);
+
+# Approximate frame sizes incl. stuff bits for 8 byte frames [bit]:
+my $BITS_STD = 130;
+my $BITS_EXT = 155;
+
+# NRC names (ISO 14229 Annex A.1):
+my %NRC = (
+  0x10 => 'generalReject', 0x11 => 'serviceNotSupported', 0x12 => 'subFunctionNotSupported',
+  0x13 => 'incorrectMessageLength', 0x14 => 'responseTooLong', 0x21 => 'busyRepeatRequest',
+  0x22 => 'conditionsNotCorrect', 0x24 => 'requestSequenceError', 0x31 => 'requestOutOfRange',
+  0x33 => 'securityAccessDenied', 0x78 => 'responsePending', 0x7e => 'subFunctionNotSupportedInActiveSession',
+  0x7f => 'serviceNotSupportedInActiveSession',
+);
+
+
+#
+# Read dump file
+#
+
+open(my $fh, '<:raw', $file) or die "$file: $!\n";
+my $buf;
+read($fh, $buf, 52) == 52 or die "$file: short header\n";
+my ($magic, $version, $recsize, $count, $lost, @rest) = unpack('Z8 v v V V V4 q< q<', $buf);
+my @bitrate = @rest[0..3];
+my ($dump_us, $dump_unix) = @rest[4..5];
+$magic eq 'OVMSPTR' or die "$file: not a poller trace dump\n";
+$version == 1 or die "$file: unsupported version $version\n";
+
+my @recs;
+while (read($fh, $buf, $recsize) == $recsize) {
+  my ($tlo, $thi, $ev, $bus, $canid, $pid, $type, $info) = unpack('V v C C V v C C', $buf);
+  push @recs, { time => $thi * 4294967296 + $tlo, ev => $ev, bus => $bus,
+    canid => $canid, pid => $pid, type => $type, info => $info };
+}
+close($fh);
+warn sprintf("Warning: %d records expected, %d read\n", $count, scalar(@recs)) if (@recs != $count);
+die "$file: no records\n" unless (@recs);
+
+my $t0 = $recs[0]{time};
+my $t1 = $recs[-1]{time};
+my $duration = ($t1 - $t0) / 1e6;
+
+printf "File:     %s\n", $file;
+printf "Records:  %d (%d lost before dump)\n", scalar(@recs), $lost;
+printf "Duration: %.3f s\n", $duration;
+printf "Recorded: %s\n", scalar(localtime($dump_unix - ($dump_us - $t0) / 1e6)) if ($dump_unix);
+print "\n";
+
+if ($opt_l) {
+  my $last = $t0;
+  foreach my $r (@recs) {
+    printf "%12.3f %8.3f %u %-10s %08x %02x %04x %u\n",
+      ($r->{time} - $t0) / 1000, ($r->{time} - $last) / 1000,
+      $r->{bus}, $EVNAME[$r->{ev}] // '?', $r->{canid}, $r->{type}, $r->{pid}, $r->{info};
+    $last = $r->{time};
+  }
+  print "\n";
+}
+
+
+#
+# Reconstruct requests
+#
+
+my %ecu;        # per TX ID: statistics
+my %open;       # per bus: current request
+my %lastend;    # per bus: key & outcome of the previous request
+my %busbits;    # per bus: poller frame bits
+my %busframes;  # per bus: poller frame count
+my %nrc;        # per NRC code: count
+
+sub ecu_stats {
+  my ($txid) = @_;
+  $ecu{$txid} //= { requests => 0, done => 0, timeouts => 0, txfails => 0, errors => 0,
+    pending => 0, retransmits => 0, ignored => 0, rxids => {}, first => [], total => [] };
+  return $ecu{$txid};
+}
+
+sub close_request {
+  my ($bus, $outcome) = @_;
+  my $req = delete $open{$bus} or return;
+  $lastend{$bus} = [ "$req->{txid}/$req->{type}/$req->{pid}", $outcome ];
+}
+
+foreach my $r (@recs) {
+  my $ev = $r->{ev};
+  my $bus = $r->{bus};
+
+  if ($ev != $EV{'timeout'} && $ev != $EV{'done'}) {
+    $busframes{$bus}++;
+    $busbits{$bus} += ($r->{canid} > 0x7ff) ? $BITS_EXT : $BITS_STD;
+  }
+
+  if ($ev == $EV{'request'}) {
+    # A request still open means the poller moved on without a response:
+    close_request($bus, 'abandoned');
+    my $s = ecu_stats($r->{canid});
+    $s->{requests}++;
+    # Immediate repetition of a failed request = retransmit:
+    my $prev = $lastend{$bus};
+    $s->{retransmits}++ if ($prev && $prev->[0] eq "$r->{canid}/$r->{type}/$r->{pid}" && $prev->[1] ne 'done');
+    $open{$bus} = { txid => $r->{canid}, type => $r->{type}, pid => $r->{pid},
+      time => $r->{time}, firstrx => undef };
+    next;
+  }
+
+  my $req = $open{$bus} or next;
+  my $s = ecu_stats($req->{txid});
+
+  if ($ev == $EV{'single'} || $ev == $EV{'first'} || $ev == $EV{'pending'} || $ev == $EV{'error'}) {
+    $s->{rxids}{$r->{canid}}++;
+    if (!defined $req->{firstrx}) {
+      $req->{firstrx} = $r->{time};
+      push @{$s->{first}}, ($r->{time} - $req->{time}) / 1000;
+    }
+  }
+  if ($ev == $EV{'pending'}) {
+    $s->{pending}++;
+    $nrc{$r->{info}}++;
+  }
+  elsif ($ev == $EV{'error'}) {
+    $s->{errors}++;
+    $nrc{$r->{info}}++;
+    $req->{error} = 1;
+  }
+  elsif ($ev == $EV{'ignored'}) {
+    $s->{ignored}++;
+  }
+  elsif ($ev == $EV{'done'}) {
+    if ($req->{error}) {
+      close_request($bus, 'error');
+    } else {
+      $s->{done}++;
+      push @{$s->{total}}, ($r->{time} - $req->{time}) / 1000;
+      close_request($bus, 'done');
+    }
+  }
+  elsif ($ev == $EV{'timeout'}) {
+    $s->{timeouts}++;
+    close_request($bus, 'timeout');
+  }
+  elsif ($ev == $EV{'tx-fail'}) {
+    $s->{txfails}++;
+    close_request($bus, 'txfail');
+  }
+}
+
+
+#
+# Output
+#
+
+sub percentile {
+  my ($sorted, $p) = @_;
+  return $sorted->[min($#$sorted, int($p / 100 * @$sorted))];
+}
+
+sub latency_line {
+  my ($label, $values) = @_;
+  return sprintf("  %-14s -\n", $label) unless (@$values);
+  my @v = sort { $a <=> $b } @$values;
+  return sprintf("  %-14s n=%-6d min=%7.1f avg=%7.1f p50=%7.1f p90=%7.1f p99=%7.1f max=%7.1f ms\n",
+    $label, scalar(@v), $v[0], sum(@v) / @v,
+    percentile(\@v, 50), percentile(\@v, 90), percentile(\@v, 99), $v[-1]);
+}
+
+sub histogram {
+  my ($values) = @_;
+  return unless (@$values);
+  my %bin;
+  foreach my $v (@$values) {
+    my $b = 1;
+    $b *= 2 while ($b < $v && $b < 8192);
+    $bin{$b}++;
+  }
+  my $peak = max(values %bin);
+  foreach my $b (sort { $a <=> $b } keys %bin) {
+    printf "    <=%5d ms %6d %s\n", $b, $bin{$b}, '#' x int(50 * $bin{$b} / $peak + 0.5);
+  }
+}
+
+print "Per ECU:\n";
+foreach my $txid (sort { $a <=> $b } keys %ecu) {
+  my $s = $ecu{$txid};
+  printf "\nECU %03x -> %s\n", $txid,
+    join(',', map { sprintf('%03x', $_) } sort { $a <=> $b } keys %{$s->{rxids}}) || '-';
+  printf "  requests=%d done=%d timeouts=%d txfails=%d errors=%d pending=%d retransmits=%d ignored=%d\n",
+    @{$s}{qw(requests done timeouts txfails errors pending retransmits ignored)};
+  print latency_line('first response', $s->{first});
+  histogram($s->{first}) if ($opt_h);
+  print latency_line('complete', $s->{total});
+  histogram($s->{total}) if ($opt_h);
+}
+
+if (%nrc) {
+  print "\nNegative responses:\n";
+  foreach my $code (sort { $a <=> $b } keys %nrc) {
+    printf "  %02x %-40s %d\n", $code, $NRC{$code} // '', $nrc{$code};
+  }
+}
+
+print "\nBus load by poller frames:\n";
+foreach my $bus (sort keys %busframes) {
+  my $rate = $bitrate[$bus - 1] || 0;
+  printf "  can%d: %d frames, %.1f fr/s", $bus, $busframes{$bus},
+    $duration > 0 ? $busframes{$bus} / $duration : 0;
+  if ($rate && $duration > 0) {
+    printf ", %.2f%% of %d kbit/s", 100 * $busbits{$bus} / ($rate * $duration), $rate / 1000;
+  }
+  print "\n";
+}
@@ -32,6 +32,10 @@
 #include "ovms_log.h"
 static const char *TAG = "re-pid";
 
+#include <algorithm>
+#include <string>
+#include "esp_timer.h"
+#include "ovms_config.h"
 #include "retools_pid.h"
 #include "vehicle.h"
 
@@ -86,6 +90,36 @@ canbus* GetCan(int bus)
     return can;
 }
 
+bool ReadEcuList(const char* value, std::vector<uint16_t>& ecus)
+{
+    std::string list(value);
+    size_t pos = 0;
+    while (pos <= list.size())
+    {
+        size_t sep = list.find(',', pos);
+        if (sep == std::string::npos)
+        {
+            sep = list.size();
+        }
+        unsigned long low, high;
+        if (!ReadHexRange(list.substr(pos, sep - pos).c_str(), low, high) ||
+            low <= 0 || high >= 0xfff || high < low)
+        {
+            return false;
+        }
+        for (unsigned long ecu = low; ecu <= high; ecu++)
+        {
+            if (ecus.size() == RE_PIDSCAN_MAX_ECUS)
+            {
+                return false;
+            }
+            ecus.push_back(ecu);
+        }
+        pos = sep + 1;
+    }
+    return !ecus.empty();
+}
+
 OvmsReToolsPidScanner* s_scanner = nullptr;
 
 void scanStart(int, OvmsWriter* writer, OvmsCommand*, int argc, const char* const* argv)
@@ -105,7 +139,9 @@ void scanStart(int, OvmsWriter* writer, OvmsCommand*, int argc, const char* cons
             return;
         }
     }
-    unsigned long bus = 0, ecu = 0, rxid_low = 0, rxid_high = 0, start = 0, end = 0;
+    unsigned long bus = 0, rxid_low = 0, rxid_high = 0, start = 0, end = 0;
+    std::vector<uint16_t> ecus;
+    std::string csvpath;
     int timeout = 3;
     unsigned long polltype = VEHICLE_POLL_TYPE_OBDIIEXTENDED;
     unsigned long step = 1;
@@ -117,6 +153,14 @@ void scanStart(int, OvmsWriter* writer, OvmsCommand*, int argc, const char* cons
         {
             switch (argv[i][1])
             {
+                case 'f':
+                    csvpath = argv[i]+2;
+                    if (csvpath.empty() || MyConfig.ProtectedPath(csvpath))
+                    {
+                        writer->printf("Error: Invalid or protected path %s\n", argv[i]+2);
+                        valid = false;
+                    }
+                    break;
                 case 'r':
                     if (!ReadHexRange(argv[i]+2, rxid_low, rxid_high) ||
                         rxid_low > 0x7ff || rxid_high > 0x7ff || rxid_high < rxid_low)
@@ -169,9 +213,10 @@ void scanStart(int, OvmsWriter* writer, OvmsCommand*, int argc, const char* cons
                     }
                     break;
                 case 2:
-                    if (!ReadHexString(argv[i], ecu) || ecu <= 0 || ecu >= 0xfff)
+                    if (!ReadEcuList(argv[i], ecus))
                     {
-                        writer->printf("Error: Invalid ECU Id to scan %s\n", argv[i]);
+                        writer->printf("Error: Invalid ECU Id list to scan %s (max %d ECUs)\n",
+                                       argv[i], RE_PIDSCAN_MAX_ECUS);
                         valid = false;
                     }
                     break;
@@ -212,52 +257,63 @@ void scanStart(int, OvmsWriter* writer, OvmsCommand*, int argc, const char* cons
         writer->printf("Error: Poll type %lx PID range is 00..ff\n", polltype);
         valid = false;
     }
-    if (!valid)
+    if (have_rxid && ecus.size() > 1)
     {
-        return;
+        writer->puts("Error: RX ID range can only be given for a single ECU");
+        valid = false;
     }
-    if (!have_rxid)
+    if (!valid)
     {
-        rxid_low = rxid_high = ecu + 8;
+        return;
     }
     canbus* can = GetCan(bus);
     if (can == nullptr)
     {
         writer->puts("CAN not started in active mode, please start and try again");
-        valid = false;
+        return;
     }
-    if (valid)
+    FILE* csv = nullptr;
+    if (!csvpath.empty())
     {
-        s_scanner = new OvmsReToolsPidScanner(can, ecu, rxid_low, rxid_high, polltype, start, end, step, timeout);
-        writer->printf("Scan started: bus %ld, ecu %lx, rxid %lx-%lx, polltype %lx, PID %lx-%lx (step %lx), timeout %d seconds\n",
-                       bus, ecu, rxid_low, rxid_high, polltype, start, end, step, timeout);
+        csv = fopen(csvpath.c_str(), "w");
+        if (csv == nullptr)
+        {
+            writer->printf("Error: Can't write to %s\n", csvpath.c_str());
+            return;
+        }
+        fputs("ecu,rxid,pid,result,data\n", csv);
     }
-}
-
-void scanStatus(int, OvmsWriter* writer, OvmsCommand*, int, const char* const*)
-{
-    if (s_scanner == nullptr)
+    s_scanner = new OvmsReToolsPidScanner(can, ecus, have_rxid, rxid_low, rxid_high, polltype, start, end, step, timeout, csv);
+    writer->printf("Scan started: bus %ld, ecu", bus);
+    for (auto ecu : ecus)
     {
-        writer->puts("No scan running");
+        writer->printf(" %x", ecu);
     }
-    else if (s_scanner->Complete())
+    if (have_rxid)
     {
-        writer->printf(
-            "Scan complete (%03x %04x-%04x)\n",
-            s_scanner->Ecu(), s_scanner->Start(), s_scanner->End()
-        );
+        writer->printf(", rxid %lx-%lx", rxid_low, rxid_high);
     }
-    else
+    writer->printf(", polltype %lx, PID %lx-%lx (step %lx), timeout max %d seconds\n",
+                   polltype, start, end, step, timeout);
+    if (csv)
     {
-        writer->printf(
-            "Scan running (%03x %04x-%04x): %04x\n",
-            s_scanner->Ecu(), s_scanner->Start(), s_scanner->End(), s_scanner->Current()
-        );
+        writer->printf("Writing results to %s\n", csvpath.c_str());
     }
-    if (s_scanner != nullptr)
+}
+
+void scanStatus(int, OvmsWriter* writer, OvmsCommand*, int, const char* const*)
+{
+    if (s_scanner == nullptr)
     {
-        s_scanner->Output(writer);
+        writer->puts("No scan running");
+        return;
     }
+    writer->printf(
+        "Scan %s (%04x-%04x)\n",
+        s_scanner->Complete() ? "complete" : "running", s_scanner->Start(), s_scanner->End()
+    );
+    s_scanner->Status(writer);
+    s_scanner->Output(writer);
 }
 
 void scanStop(int, OvmsWriter* writer, OvmsCommand*, int, const char* const*)
@@ -268,10 +324,9 @@ void scanStop(int, OvmsWriter* writer, OvmsCommand*, int, const char* const*)
         return;
     }
     writer->printf(
-        "Scan results (%03x %04x-%04x):\n",
-        s_scanner->Ecu(), s_scanner->Start(),
-        s_scanner->Complete() ? s_scanner->End() : s_scanner->Current()
+        "Scan results (%04x-%04x):\n", s_scanner->Start(), s_scanner->End()
     );
+    s_scanner->Status(writer);
     s_scanner->Output(writer);
     delete s_scanner;
     s_scanner = nullptr;
@@ -281,62 +336,116 @@ void scanStop(int, OvmsWriter* writer, OvmsCommand*, int, const char* const*)
 }  // anon namespace
 
 OvmsReToolsPidScanner::OvmsReToolsPidScanner(
-        canbus* bus, uint16_t ecu, uint16_t rxid_low, uint16_t rxid_high,
-        uint8_t polltype, int start, int end, int step, uint8_t timeout) :
+        canbus* bus, const std::vector<uint16_t>& ecus, bool have_rxid, uint16_t rxid_low, uint16_t rxid_high,
+        uint8_t polltype, int start, int end, int step, uint8_t timeout, FILE* csv) :
     m_frameCallback(std::bind(
         &OvmsReToolsPidScanner::FrameCallback, this,
         std::placeholders::_1, std::placeholders::_2
     )),
     m_bus(bus),
-    m_id(ecu),
-    m_rxid_low(rxid_low),
-    m_rxid_high(rxid_high),
+    m_jobs(),
     m_pollType(polltype),
     m_startPid(start),
     m_endPid(end),
     m_pidStep(step),
-    m_currentPid(end+1),
-    m_ticker(0u),
     m_timeout(timeout),
-    m_lastFrame(0u),
+    m_txError(false),
+    m_done(false),
     m_startTime(0u),
     m_lastResponseTime(0u),
-    m_mfRemain(0u),
     m_task(nullptr),
     m_rxqueue(nullptr),
     m_found(),
-    m_foundMutex()
+    m_foundMutex(),
+    m_csv(csv),
+    m_csvFlush(0)
 {
-    m_rxqueue = xQueueCreate(20,sizeof(CAN_frame_t));
+    int64_t now = esp_timer_get_time();
+    m_jobs.reserve(ecus.size());
+    for (auto ecu : ecus)
+    {
+        Job job = {};
+        job.ecu = ecu;
+        // Default RX ID: <ecu>+8
+        job.rxid_low = have_rxid ? rxid_low : ecu + 8;
+        job.rxid_high = have_rxid ? rxid_high : ecu + 8;
+        job.state = Job::Send;
+        job.current = m_startPid;
+        job.deadline = now;
+        job.startTime = now;
+        m_jobs.push_back(job);
+    }
+
+    // The queue receives all bus traffic, so leave room for multi-frame responses
+    // from several ECUs on a busy bus:
+    m_rxqueue = xQueueCreate(60, sizeof(CAN_frame_t));
+    MyCan.RegisterListener(m_rxqueue);
+    MyEvents.SignalEvent("retools.pidscan.start", NULL);
+    time(&m_startTime);
     xTaskCreatePinnedToCore(
         &OvmsReToolsPidScanner::Task, "OVMS RE PID", 4096, this, 5, &m_task, CORE(1)
     );
-    MyCan.RegisterListener(m_rxqueue, true);
-    m_currentPid = m_startPid - m_pidStep;
-    MyEvents.RegisterEvent(
-        TAG, "ticker.1",
-        std::bind(
-            &OvmsReToolsPidScanner::Ticker1, this,
-            std::placeholders::_1, std::placeholders::_2
-        )
-    );
-    MyEvents.SignalEvent("retools.pidscan.start", NULL);
-    time(&m_startTime);
-    SendNextFrame();
 }
 
 OvmsReToolsPidScanner::~OvmsReToolsPidScanner()
 {
     if (m_rxqueue)
     {
-        MyEvents.DeregisterEvent(TAG);
         MyCan.DeregisterListener(m_rxqueue);
+        {
+            // Don't interrupt the task while it holds the lock or writes the file:
+            OvmsMutexLock lock(&m_foundMutex);
+            vTaskDelete(m_task);
+        }
         vQueueDelete(m_rxqueue);
-        vTaskDelete(m_task);
+        if (m_csv)
+        {
+            fclose(m_csv);
+        }
         MyEvents.SignalEvent("retools.pidscan.stop", NULL);
     }
 }
 
+bool OvmsReToolsPidScanner::Complete() const
+{
+    for (auto& job : m_jobs)
+    {
+        if (job.state != Job::Done)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void OvmsReToolsPidScanner::Status(OvmsWriter* writer) const
+{
+    int64_t now = esp_timer_get_time();
+    int total = (m_endPid - m_startPid) / m_pidStep + 1;
+    for (auto& job : m_jobs)
+    {
+        int done = (std::min(job.current, m_endPid + 1) - m_startPid + m_pidStep - 1) / m_pidStep;
+        if (job.state == Job::Done)
+        {
+            done = total;
+        }
+        float secs = ((job.state == Job::Done ? job.endTime : now) - job.startTime) / 1e6;
+        float rate = (secs > 0) ? job.requests / secs : 0;
+        writer->printf(
+            "%03x: %s %04x %5.1f%%  %.1f req/s  rtt %.1f ms  rto %d ms  found %" PRIu32 "  timeouts %" PRIu32 "  busy %" PRIu32,
+            job.ecu, job.state == Job::Done ? "done" : "scan",
+            std::min(job.current, m_endPid), done * 100.0f / total, rate,
+            job.srtt / 1000.0f, (int)(ResponseTimeout(job) / 1000), job.found, job.timeouts, job.busy
+        );
+        if (job.state != Job::Done && rate > 0)
+        {
+            int eta = (total - done) * secs / std::max(done, 1);
+            writer->printf("  ETA %d:%02d:%02d", eta / 3600, (eta / 60) % 60, eta % 60);
+        }
+        writer->printf("\n");
+    }
+}
+
 void OvmsReToolsPidScanner::Output(OvmsWriter* writer) const
 {
     OvmsMutexLock lock(&m_foundMutex);
@@ -358,10 +467,10 @@ void OvmsReToolsPidScanner::Output(OvmsWriter* writer) const
         writer->printf("Last response: %s\n", tb);
         for (auto& found : m_found)
         {
-            uint16_t rxid, pid;
+            uint16_t ecu, rxid, pid;
             std::vector<uint8_t> data;
-            std::tie(rxid, pid, data) = found;
-            writer->printf("%03x[%03x]:%04x", m_id, rxid, pid);
+            std::tie(ecu, rxid, pid, data) = found;
+            writer->printf("%03x[%03x]:%04x", ecu, rxid, pid);
             for (auto& byte : data)
             {
                 writer->printf(" %02x", byte);
@@ -376,30 +485,90 @@ void OvmsReToolsPidScanner::Task(void *self)
     reinterpret_cast<OvmsReToolsPidScanner*>(self)->Task();
 }
 
+/**
+ * Task: the scanner runs all ECU state machines from here. Requests and timeouts
+ * are timed in µs, the queue wait ends at the next deadline of any ECU.
+ */
 void OvmsReToolsPidScanner::Task()
 {
     CAN_frame_t frame;
     while (1)
     {
-        if (xQueueReceive(
-                    m_rxqueue, &frame, static_cast<portTickType>(portMAX_DELAY)
-                ) == pdTRUE)
+        int64_t now = esp_timer_get_time();
+        int64_t next = now + 1000000;
+
+        if (m_txError)
         {
-            if (frame.origin == m_bus)
+            ESP_LOGE(TAG, "Error sending a frame, terminating scan");
+            m_txError = false;
+            for (auto& job : m_jobs)
             {
-                IncomingPollFrame(&frame);
+                if (job.state != Job::Done)
+                {
+                    Finish(job, now, "transmission error");
+                }
             }
         }
-    }
-}
 
-void OvmsReToolsPidScanner::Ticker1(std::string, void*)
-{
-    ++m_ticker;
-    if (m_currentPid <= m_endPid && m_ticker - m_lastFrame > m_timeout)
-    {
-        ESP_LOGE(TAG, "Frame response timeout for %x:%x", m_id, m_currentPid);
-        SendNextFrame();
+        for (auto& job : m_jobs)
+        {
+            if (job.state == Job::Done)
+            {
+                continue;
+            }
+            if (job.deadline <= now)
+            {
+                if (job.state == Job::Send)
+                {
+                    SendFrame(job, now);
+                }
+                else
+                {
+                    Timeout(job, now);
+                }
+            }
+            if (job.state != Job::Done && job.deadline < next)
+            {
+                next = job.deadline;
+            }
+        }
+
+        if (!m_done && Complete())
+        {
+            m_done = true;
+            ESP_LOGI(TAG, "Scan complete");
+            if (m_csv)
+            {
+                OvmsMutexLock lock(&m_foundMutex);
+                fflush(m_csv);
+            }
+            MyEvents.SignalEvent("retools.pidscan.done", NULL);
+        }
+        else if (m_csv && now - m_csvFlush > 5000000)
+        {
+            OvmsMutexLock lock(&m_foundMutex);
+            fflush(m_csv);
+            m_csvFlush = now;
+        }
+
+        TickType_t wait = (next > now) ? pdMS_TO_TICKS((next - now + 999) / 1000) : 0;
+        if (xQueueReceive(m_rxqueue, &frame, m_done ? portMAX_DELAY : std::max(wait, (TickType_t)1)) == pdTRUE)
+        {
+            if (frame.origin != m_bus)
+            {
+                continue;
+            }
+            now = esp_timer_get_time();
+            for (auto& job : m_jobs)
+            {
+                if (job.state == Job::Wait &&
+                    frame.MsgID >= job.rxid_low && frame.MsgID <= job.rxid_high)
+                {
+                    IncomingPollFrame(job, &frame, now);
+                    break;
+                }
+            }
+        }
     }
 }
 
@@ -407,28 +576,56 @@ void OvmsReToolsPidScanner::FrameCallback(const CAN_frame_t* frame, bool success
 {
     if (success == false)
     {
-        ESP_LOGE(TAG, "Error sending the frame, terminating scan");
-        m_currentPid = m_endPid + 1;
-        MyEvents.SignalEvent("retools.pidscan.done", NULL);
+        m_txError = true;
     }
 }
 
-void OvmsReToolsPidScanner::SendNextFrame()
+/**
+ * ResponseTimeout: adaptive response timeout from the observed latency of the ECU
+ * (srtt + 4 * rttvar), doubled per timeout of the current request, bounded by the
+ * user timeout.
+ */
+int64_t OvmsReToolsPidScanner::ResponseTimeout(const Job& job) const
 {
-    if (m_currentPid == m_endPid)
+    int64_t max = m_timeout * 1000000LL;
+    int64_t rto = (job.srtt == 0)
+        ? RE_PIDSCAN_RTO_INIT * 1000LL
+        : std::max<int64_t>(job.srtt + 4 * job.rttvar, RE_PIDSCAN_RTO_MIN * 1000LL);
+    rto <<= job.backoff;
+    return std::min(rto, max);
+}
+
+void OvmsReToolsPidScanner::UpdateRtt(Job& job, int64_t now)
+{
+    job.responses++;
+    job.backoff = 0;
+    if (job.pending)
     {
-        m_currentPid = m_endPid + 1;
-        ESP_LOGI(TAG, "Scan of %x complete", m_id);
-        MyEvents.SignalEvent("retools.pidscan.done", NULL);
+        // The response time after a ResponsePending doesn't tell the normal latency
         return;
     }
-    m_currentPid += m_pidStep;
+    int64_t sample = now - job.sent;
+    if (job.srtt == 0)
+    {
+        job.srtt = sample;
+        job.rttvar = sample / 2;
+    }
+    else
+    {
+        job.rttvar += (std::abs(job.srtt - sample) - job.rttvar) / 4;
+        job.srtt += (sample - job.srtt) / 8;
+    }
+    // Normal responses decay the busy backoff:
+    job.gap -= job.gap / 4;
+}
 
+void OvmsReToolsPidScanner::SendFrame(Job& job, int64_t now)
+{
     CAN_frame_t sendFrame = {
         m_bus,
         &m_frameCallback,
         { .B = { 8, 0, CAN_no_RTR, CAN_frame_std, 0 } },
-        m_id,
+        job.ecu,
         0
     };
 
@@ -436,65 +633,129 @@ void OvmsReToolsPidScanner::SendNextFrame()
     {
         sendFrame.data = { .u8 = {
             (ISOTP_FT_SINGLE << 4) + 3, m_pollType,
-            static_cast<uint8_t>(m_currentPid >> 8),
-            static_cast<uint8_t>(m_currentPid & 0xff)
+            static_cast<uint8_t>(job.current >> 8),
+            static_cast<uint8_t>(job.current & 0xff)
         } };
     }
     else
     {
         sendFrame.data = { .u8 = {
             (ISOTP_FT_SINGLE << 4) + 2, m_pollType,
-            static_cast<uint8_t>(m_currentPid & 0xff)
+            static_cast<uint8_t>(job.current & 0xff)
         } };
     }
 
-    m_mfRemain = 0u;
+    job.mfRemain = 0u;
+    job.pending = false;
     if (m_bus->Write(&sendFrame) == ESP_FAIL)
     {
-        ESP_LOGE(TAG, "Error sending test frame to PID %x:%x", m_id, m_currentPid);
-        m_currentPid = m_endPid + 1;
+        ESP_LOGE(TAG, "Error sending test frame to PID %x:%x", job.ecu, job.current);
+        Finish(job, now, "transmission error");
     }
     else
     {
-        ESP_LOGV(TAG, "Sending test frame to PID %x:%x", m_id, m_currentPid);
-        m_lastFrame = m_ticker;
+        ESP_LOGV(TAG, "Sending test frame to PID %x:%x", job.ecu, job.current);
+        job.requests++;
+        job.state = Job::Wait;
+        job.sent = now;
+        job.deadline = now + ResponseTimeout(job);
     }
 }
 
-void OvmsReToolsPidScanner::IncomingPollFrame(const CAN_frame_t* frame)
+void OvmsReToolsPidScanner::NextPid(Job& job, int64_t now)
 {
-    if (m_currentPid > m_endPid)
+    job.retries = 0;
+    job.mfRemain = 0u;
+    if (job.current + m_pidStep > m_endPid)
     {
+        job.current = m_endPid + 1;
+        Finish(job, now, "complete");
         return;
     }
+    job.current += m_pidStep;
+    job.state = Job::Send;
+    job.deadline = now + job.gap;
+}
 
-    uint8_t frameType = frame->data.u8[0] >> 4;
-    uint16_t frameLength = frame->data.u8[0] & 0x0f;
-    const uint8_t* data = &frame->data.u8[1];
-    uint16_t dataLength = frameLength;
+void OvmsReToolsPidScanner::Timeout(Job& job, int64_t now)
+{
+    job.timeouts++;
+    if (job.responses == 0 && job.timeouts >= RE_PIDSCAN_ABORT_TIMEOUTS)
+    {
+        Finish(job, now, "no response");
+        return;
+    }
+    ESP_LOGD(TAG, "Frame response timeout for %x:%x", job.ecu, job.current);
+    if (job.retries < RE_PIDSCAN_TIMEOUT_RETRIES && job.mfRemain == 0u)
+    {
+        job.retries++;
+        if (job.backoff < 8)
+        {
+            job.backoff++;
+        }
+        job.state = Job::Send;
+        job.deadline = now + job.gap;
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Frame response timeout for %x:%x", job.ecu, job.current);
+        WriteCsv(job, 0, job.current, "timeout", nullptr, 0);
+        NextPid(job, now);
+    }
+}
 
-    if (frame->MsgID < m_rxid_low || frame->MsgID > m_rxid_high)
+void OvmsReToolsPidScanner::Finish(Job& job, int64_t now, const char* reason)
+{
+    job.state = Job::Done;
+    job.endTime = now;
+    ESP_LOGI(TAG, "Scan of %x %s: %" PRIu32 " requests, %" PRIu32 " found, %" PRIu32 " timeouts, %" PRIu32 " busy",
+             job.ecu, reason, job.requests, job.found, job.timeouts, job.busy);
+}
+
+void OvmsReToolsPidScanner::WriteCsv(const Job& job, uint16_t rxid, uint16_t pid, const char* result,
+                                     const uint8_t* data, size_t length)
+{
+    if (m_csv == nullptr)
     {
-        // Frame not for us
         return;
     }
+    OvmsMutexLock lock(&m_foundMutex);
+    fprintf(m_csv, "%03x,%03x,%04x,%s,", job.ecu, rxid, pid, result);
+    for (size_t i = 0; i < length; i++)
+    {
+        fprintf(m_csv, "%02x", data[i]);
+    }
+    fputc('\n', m_csv);
+}
+
+void OvmsReToolsPidScanner::IncomingPollFrame(Job& job, const CAN_frame_t* frame, int64_t now)
+{
+    uint8_t frameType = frame->data.u8[0] >> 4;
+    uint16_t frameLength = frame->data.u8[0] & 0x0f;
+    const uint8_t* data = &frame->data.u8[1];
+    uint16_t dataLength = frameLength;
 
     if (frameType == ISOTP_FT_SINGLE)
     {
         // All good
-        m_mfRemain = 0;
+        job.mfRemain = 0;
     }
     else if (frameType == ISOTP_FT_FIRST)
     {
         frameLength = (frameLength << 8) | data[0];
         ++data;
         dataLength = (frameLength > 6 ? 6 : frameLength);
-        m_mfRemain = frameLength - dataLength;
+        job.mfRemain = frameLength - dataLength;
     }
     else if (frameType == ISOTP_FT_CONSECUTIVE)
     {
-        dataLength = (m_mfRemain > 7 ? 7 : m_mfRemain);
-        m_mfRemain -= dataLength;
+        if (job.mfRemain == 0u)
+        {
+            // Not expecting any
+            return;
+        }
+        dataLength = (job.mfRemain > 7 ? 7 : job.mfRemain);
+        job.mfRemain -= dataLength;
     }
     else
     {
@@ -507,31 +768,72 @@ void OvmsReToolsPidScanner::IncomingPollFrame(const CAN_frame_t* frame)
     {
         {
             OvmsMutexLock lock(&m_foundMutex);
-            std::copy(data, &data[dataLength], std::back_inserter(std::get<2>(m_found.back())));
+            std::copy(data, &data[dataLength], std::back_inserter(std::get<3>(m_found[job.mfIndex])));
         }
-        if (m_mfRemain == 0u)
+        if (job.mfRemain == 0u)
         {
-            SendNextFrame();
+            // m_found is only modified by this task, so reading needs no lock:
+            const auto& found = m_found[job.mfIndex];
+            const std::vector<uint8_t>& response = std::get<3>(found);
+            WriteCsv(job, std::get<1>(found), std::get<2>(found), "ok", response.data(), response.size());
+            NextPid(job, now);
         }
         else
         {
-            m_lastFrame = m_ticker;
+            job.deadline = now + RE_PIDSCAN_NCR_TIMEOUT * 1000LL;
         }
     }
     else if (dataLength == 3 && data[0] == UDS_RESP_TYPE_NRC && data[1] == m_pollType)
     {
         if (data[2] == UDS_RESP_NRC_RCRRP)
         {
-            // ResponsePending: ignore, keep waiting
+            // ResponsePending: keep waiting for up to P2*, back off on the following requests
             ESP_LOGD(TAG, "ResponsePending from %" PRIx16 "[%" PRIx32 "]:%x",
-              m_id, frame->MsgID, m_currentPid);
+              job.ecu, frame->MsgID, job.current);
+            job.busy++;
+            job.pending = true;
+            job.deadline = now + RE_PIDSCAN_P2EXT_TIMEOUT * 1000LL;
+            job.gap = std::min<int64_t>(std::max<int64_t>(job.gap * 2, 10000), RE_PIDSCAN_GAP_MAX * 1000LL);
+        }
+        else if (data[2] == UDS_RESP_NRC_BRR)
+        {
+            // BusyRepeatRequest: repeat after an increasing gap
+            ESP_LOGD(TAG, "BusyRepeatRequest from %" PRIx16 "[%" PRIx32 "]:%x",
+              job.ecu, frame->MsgID, job.current);
+            job.busy++;
+            job.gap = std::min<int64_t>(std::max<int64_t>(job.gap * 2, 10000), RE_PIDSCAN_GAP_MAX * 1000LL);
+            if (job.retries++ < RE_PIDSCAN_BUSY_RETRIES)
+            {
+                job.state = Job::Send;
+                job.deadline = now + job.gap;
+            }
+            else
+            {
+                WriteCsv(job, frame->MsgID, job.current, "busy", nullptr, 0);
+                NextPid(job, now);
+            }
         }
         else
         {
             // …other negative response code:
             ESP_LOGD(TAG, "Negative response from %" PRIx16 "[%" PRIx32 "]:%x code %02" PRIx8,
-              m_id, frame->MsgID, m_currentPid, data[2]);
-            SendNextFrame();
+              job.ecu, frame->MsgID, job.current, data[2]);
+            UpdateRtt(job, now);
+            if (data[2] == UDS_RESP_NRC_SNS)
+            {
+                Finish(job, now, "service not supported");
+            }
+            else
+            {
+                if (data[2] != UDS_RESP_NRC_ROOR)
+                {
+                    // The PID may exist but be locked or unavailable in this state:
+                    char result[8];
+                    snprintf(result, sizeof(result), "nrc-%02x", data[2]);
+                    WriteCsv(job, frame->MsgID, job.current, result, nullptr, 0);
+                }
+                NextPid(job, now);
+            }
         }
     }
     else if (dataLength > 3 && data[0] == m_pollType + 0x40)
@@ -552,14 +854,16 @@ void OvmsReToolsPidScanner::IncomingPollFrame(const CAN_frame_t* frame)
             payload = &data[2];
             payloadLength = dataLength - 2;
         }
-        if (responsePid == m_currentPid)
+        if (responsePid == job.current)
         {
             ESP_LOGD(
                 TAG,
                 "Success response from %" PRIx16 "[%" PRIx32 "]:%x length %" PRId16 " (0x%02" PRIx8 " 0x%02" PRIx8 " 0x%02" PRIx8 " 0x%02" PRIx8 "%s)",
-                m_id, frame->MsgID, m_currentPid, payloadLength, payload[0], payload[1], payload[2], payload[3],
+                job.ecu, frame->MsgID, job.current, payloadLength, payload[0], payload[1], payload[2], payload[3],
                 (frameType == 0 ? "" : " ...")
             );
+            UpdateRtt(job, now);
+            job.found++;
             time(&m_lastResponseTime);
             if (frameType == ISOTP_FT_FIRST)
             {
@@ -567,37 +871,38 @@ void OvmsReToolsPidScanner::IncomingPollFrame(const CAN_frame_t* frame)
                     m_bus,
                     &m_frameCallback,
                     { .B = { 8, 0, CAN_no_RTR, CAN_frame_std, 0 } },
-                    m_id,
-                    { .u8 = { 0x30, 0, 25, 0, 0, 0, 0, 0 } }
+                    job.ecu,
+                    { .u8 = { 0x30, 0, 5, 0, 0, 0, 0, 0 } }
                 };
                 if (m_bus->Write(&flowControl) == ESP_FAIL)
                 {
                     ESP_LOGE(
                         TAG, "Error sending flow control frame to PID %x:%x",
-                        m_id, m_currentPid
+                        job.ecu, job.current
                     );
-                    m_currentPid = m_endPid + 1;
+                    Finish(job, now, "transmission error");
                 }
                 else
                 {
-                    m_lastFrame = m_ticker;
+                    job.deadline = now + RE_PIDSCAN_NCR_TIMEOUT * 1000LL;
                 }
                 std::vector<uint8_t> response;
                 response.reserve(frameLength);
                 std::copy(payload, &payload[payloadLength], std::back_inserter(response));
                 OvmsMutexLock lock(&m_foundMutex);
-                m_found.push_back(std::make_tuple(frame->MsgID, responsePid, std::move(response)));
+                job.mfIndex = m_found.size();
+                m_found.push_back(std::make_tuple(job.ecu, frame->MsgID, responsePid, std::move(response)));
             }
             else
             {
-                OvmsMutexLock lock(&m_foundMutex);
-                m_found.push_back(std::make_tuple(frame->MsgID,
-                    responsePid, std::vector<uint8_t>(payload, &payload[payloadLength])
-                ));
-            }
-            if (m_mfRemain == 0u)
-            {
-                SendNextFrame();
+                {
+                    OvmsMutexLock lock(&m_foundMutex);
+                    m_found.push_back(std::make_tuple(job.ecu, frame->MsgID,
+                        responsePid, std::vector<uint8_t>(payload, &payload[payloadLength])
+                    ));
+                }
+                WriteCsv(job, frame->MsgID, responsePid, "ok", payload, payloadLength);
+                NextPid(job, now);
             }
         }
     }
@@ -619,14 +924,17 @@ OvmsReToolsPidScannerInit::OvmsReToolsPidScannerInit()
     }
     OvmsCommand* cmd_scan = cmd_reobdii->RegisterCommand("scan", "ECU PID scanning tool");
     cmd_scan->RegisterCommand(
-        "start", "Scan PIDs on an ECU in a given range", &scanStart,
-        "<bus> <ecu> <start_pid> <end_pid> [-s<pid_step>] [-r<rxid>[-<rxid>]] [-t<poll_type>] [-x<timeout>]\n"
+        "start", "Scan PIDs on one or more ECUs in a given range", &scanStart,
+        "<bus> <ecu>[-<ecu>][,<ecu>...] <start_pid> <end_pid> [-s<pid_step>] [-r<rxid>[-<rxid>]] [-t<poll_type>] [-x<timeout>] [-f<csvfile>]\n"
         "Give all values except bus and timeout hexadecimal. Options can be positioned anywhere.\n"
-        "Default <rxid> is <ecu>+8, try 0-7ff if you don't know the responding ID.\n"
+        "ECUs listed are scanned in parallel (max 16).\n"
+        "Default <rxid> is <ecu>+8, try 0-7ff if you don't know the responding ID (single ECU only).\n"
         "Default <poll_type> is 22 (ReadDataByIdentifier, 16 bit PID).\n"
         "Default <pid_step> is 1.\n"
-        "Default <timeout> is 3 seconds.",
-        4, 8
+        "<timeout> is the maximum response timeout, default 3 seconds. The timeout used adapts\n"
+        "to the response times of the ECU.\n"
+        "<csvfile> receives all results as they arrive (e.g. /sd/scan.csv).",
+        4, 9
     );
     cmd_scan->RegisterCommand("status", "The status of the PID scan", &scanStatus);
     cmd_scan->RegisterCommand("stop", "Stop the current scan", &scanStop);
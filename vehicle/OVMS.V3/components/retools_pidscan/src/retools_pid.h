@@ -40,31 +40,96 @@
 #include <functional>
 #include <vector>
 #include <tuple>
+#include <stdio.h>
 #include <time.h>
 
+/// Maximum number of ECUs scanned in parallel
+#define RE_PIDSCAN_MAX_ECUS         16
+/// Response timeout bounds & initial value [ms]
+#define RE_PIDSCAN_RTO_MIN          20
+#define RE_PIDSCAN_RTO_INIT         1000
+/// Consecutive frame timeout [ms]
+#define RE_PIDSCAN_NCR_TIMEOUT      250
+/// Response timeout after NRC 0x78 (ResponsePending, P2* server) [ms]
+#define RE_PIDSCAN_P2EXT_TIMEOUT    5000
+/// Request gap limit on busy responses [ms]
+#define RE_PIDSCAN_GAP_MAX          2000
+/// Repeats of a request after timeout / busy response
+#define RE_PIDSCAN_TIMEOUT_RETRIES  1
+#define RE_PIDSCAN_BUSY_RETRIES     8
+/// Timeouts without any response after which an ECU is given up
+#define RE_PIDSCAN_ABORT_TIMEOUTS   5
+
 class OvmsReToolsPidScanner
 {
   public:
-    OvmsReToolsPidScanner(canbus* bus, uint16_t ecu, uint16_t rxid_low, uint16_t rxid_high,
-                          uint8_t polltype, int start, int end, int step, uint8_t timeout);
+    /// Scan state of one ECU
+    struct Job
+    {
+        enum State { Send, Wait, Done };
+
+        uint16_t ecu;
+        uint16_t rxid_low;
+        uint16_t rxid_high;
+        State state;
+        /// The PID being scanned
+        int current;
+        /// Send time of the current request, deadline of the current state [µs]
+        int64_t sent;
+        int64_t deadline;
+        /// Response pending (NRC 0x78) received for the current request
+        bool pending;
+        /// Repeats of the current request
+        uint8_t retries;
+        /// Timeout backoff shift, reset on response
+        uint8_t backoff;
+        /// Smoothed response time & variance [µs], 0 = no sample yet
+        int64_t srtt;
+        int64_t rttvar;
+        /// Gap before the next request [µs], raised by busy responses
+        int64_t gap;
+        /// The number of bytes expected on a multi-frame response & its m_found index
+        uint16_t mfRemain;
+        size_t mfIndex;
+        /// Statistics
+        uint32_t requests;
+        uint32_t responses;
+        uint32_t found;
+        uint32_t timeouts;
+        uint32_t busy;
+        int64_t startTime;
+        int64_t endTime;
+    };
+
+  public:
+    OvmsReToolsPidScanner(canbus* bus, const std::vector<uint16_t>& ecus, bool have_rxid,
+                          uint16_t rxid_low, uint16_t rxid_high,
+                          uint8_t polltype, int start, int end, int step, uint8_t timeout,
+                          FILE* csv);
     ~OvmsReToolsPidScanner();
 
-    bool Complete() const { return m_currentPid > m_endPid; }
-    uint16_t Ecu() const { return m_id; }
+    bool Complete() const;
     int Start() const { return m_startPid; }
     int End() const { return m_endPid; }
-    int Current() const { return m_currentPid; }
+    const std::vector<Job>& Jobs() const { return m_jobs; }
+    bool CsvOpen() const { return m_csv != nullptr; }
 
     void Output(OvmsWriter* writer) const;
+    void Status(OvmsWriter* writer) const;
 
   private:
-    void Ticker1(std::string event, void* data);
-
     void FrameCallback(const CAN_frame_t* frame, bool success);
 
-    void IncomingPollFrame(const CAN_frame_t* frame);
+    void IncomingPollFrame(Job& job, const CAN_frame_t* frame, int64_t now);
 
-    void SendNextFrame();
+    void SendFrame(Job& job, int64_t now);
+    void NextPid(Job& job, int64_t now);
+    void Timeout(Job& job, int64_t now);
+    void Finish(Job& job, int64_t now, const char* reason);
+    int64_t ResponseTimeout(const Job& job) const;
+    void UpdateRtt(Job& job, int64_t now);
+    void WriteCsv(const Job& job, uint16_t rxid, uint16_t pid, const char* result,
+                  const uint8_t* data, size_t length);
 
     static void Task(void *self);
     void Task();
@@ -73,11 +138,8 @@ class OvmsReToolsPidScanner
     std::function<void(const CAN_frame_t*, bool)> m_frameCallback;
     /// The CAN bus that is being used
     canbus* m_bus;
-    /// The ID of the ECU to scan
-    uint16_t m_id;
-    /// The response ID range
-    uint16_t m_rxid_low;
-    uint16_t m_rxid_high;
+    /// The ECU scan states
+    std::vector<Job> m_jobs;
     /// The poll/service type
     uint8_t m_pollType;
     /// The PID to start scanning from
@@ -86,27 +148,26 @@ class OvmsReToolsPidScanner
     int m_endPid;
     /// The PID step size
     int m_pidStep;
-    /// The current PID being scanned
-    int m_currentPid;
-    /// The current ticker value
-    uint32_t m_ticker;
-    /// Response timeout in seconds
+    /// Maximum response timeout in seconds
     uint8_t m_timeout;
-    /// When the last frame was sent
-    uint32_t m_lastFrame;
+    /// Set by the frame callback on transmission errors
+    volatile bool m_txError;
+    /// Scan completion has been signalled
+    bool m_done;
     /// Scan start & last response time
     time_t m_startTime;
     time_t m_lastResponseTime;
-    /// The number of bytes expected on a multi-frame response
-    uint16_t m_mfRemain;
     /// The handle to the CAN task handler
     TaskHandle_t m_task;
     /// The handle to the CAN receive queue
     QueueHandle_t m_rxqueue;
-    /// The found PIDs and the current content
-    std::vector<std::tuple<uint16_t, uint16_t, std::vector<uint8_t>>> m_found;
-    /// A mutex over m_found
+    /// The found PIDs and the current content: ecu, rxid, pid, data
+    std::vector<std::tuple<uint16_t, uint16_t, uint16_t, std::vector<uint8_t>>> m_found;
+    /// A mutex over m_found & the CSV file
     mutable OvmsMutex m_foundMutex;
+    /// The CSV result stream & last flush time
+    FILE* m_csv;
+    int64_t m_csvFlush;
 };
 
 #endif  // __RE_TOOLS_PID_H__
@@ -33,6 +33,7 @@ static const char *TAG = "SIM7600";
 
 #include <string.h>
 #include "ovms_peripherals.h"
+#include "ovms_config.h"
 #include "simcom_7600.h"
 
 const char model[] = "SIM7600";
@@ -70,19 +71,39 @@ const char* simcom7600::GetName()
 void simcom7600::StartupNMEA()
   {
   // Switch on GPS, subscribe to NMEA sentences…
-  //   2 = $..RMC -- UTC time & date
-  //  64 = $..GNS -- Position & fix data
+  //   2 = $GPRMC -- UTC time & date
+  // 256 = $GNGNS -- Position & fix data
+  // …and with config modem gps.satinfo=yes:
+  //   4 = $GPGSV -- GPS satellites in view
+  //  64 = $GLGSV -- GLONASS satellites in view
+  // 128 = $GNGSA -- DOP & active satellites
+  int nmeamask = 258;
+  if (MyConfig.GetParamValueBool("modem", "gps.satinfo", false))
+    nmeamask |= 4 + 64 + 128;
+
+  // NMEA output rate: SIM7600 supports 1 Hz (0) and 10 Hz (1)
+  int gpsrate = MyConfig.GetParamValueInt("modem", "gps.rate", 1);
+  int nmearate = 0;
+  if (gpsrate == 10)
+    nmearate = 1;
+  else if (gpsrate != 1)
+    ESP_LOGW(TAG, "Unsupported gps.rate %d Hz (SIM7600: 1 or 10), using 1 Hz", gpsrate);
 
   // We need to do this a little differently from the standard, as SIM7600
   // may start GPS on power up, and doesn't like us using CGPS=1,1 when
   // it is already on. So workaround is to first CGPS=0.
   if (m_modem->m_mux != NULL)
     {
+    char buf[40];
     m_modem->muxtx(GetMuxChannelCMD(), "AT+CGPS=0\r\n");
     vTaskDelay(2000 / portTICK_PERIOD_MS);
     // send single commands, as each can fail:
-    m_modem->muxtx(GetMuxChannelCMD(), "AT+CGPSNMEA=258\r\n");
-    m_modem->muxtx(GetMuxChannelCMD(), "AT+CGPSINFOCFG=5,258\r\n");
+    snprintf(buf, sizeof(buf), "AT+CGPSNMEARATE=%d\r\n", nmearate);
+    m_modem->muxtx(GetMuxChannelCMD(), buf);
+    snprintf(buf, sizeof(buf), "AT+CGPSNMEA=%d\r\n", nmeamask);
+    m_modem->muxtx(GetMuxChannelCMD(), buf);
+    snprintf(buf, sizeof(buf), "AT+CGPSINFOCFG=5,%d\r\n", nmeamask);
+    m_modem->muxtx(GetMuxChannelCMD(), buf);
     m_modem->muxtx(GetMuxChannelCMD(), "AT+CGPS=1,1\r\n");
     }
   else
@@ -35,6 +35,7 @@ static const char *CHECK_SHUTDOWN_TAG = "vehicle-shutdown";
 
 #include <stdio.h>
 #include <algorithm>
+#include <esp_timer.h>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -414,8 +415,6 @@ OvmsVehicle::OvmsVehicle()
   m_brakelight_ignftbrk = false;
 
   m_tpms_lastcheck = 0;
-  m_inv_energyused = 0;
-  m_inv_energyrecd = 0;
 
 #ifdef CONFIG_OVMS_COMP_POLLER
   MyPollers.RegisterRunFinished(TAG, std::bind(&OvmsVehicle::PollRunFinishedNotify, this, _1, _2));
@@ -438,7 +437,7 @@ OvmsVehicle::OvmsVehicle()
   m_vqueue = xQueueCreate(CONFIG_OVMS_VEHICLE_CAN_RX_QUEUE_SIZE,sizeof(CAN_frame_t));
   xTaskCreatePinnedToCore(OvmsVehicleTask, "OVMS Vehicle Poll",
       CONFIG_OVMS_VEHICLE_RXTASK_STACK, (void*)this, 10, &m_vtask, CORE(1));
-  MyCan.RegisterListener(m_vqueue);
+  MyCan.RegisterListener(m_vqueue, false, true);
 #endif
   }
 
@@ -525,11 +524,13 @@ void OvmsVehicle::ShuttingDown()
   MyPollers.DeregisterRunFinished(TAG);
   MyPollers.DeregisterPollStateTicker(TAG);
   MyPollers.DeregisterFrameRx(TAG);
+  ClearCanInterest();
 
   if (m_pollsignal)
     delete m_pollsignal;
 #else
   MyCan.DeregisterListener(m_vqueue);
+  ClearCanInterest();
   CAN_frame_t entry;
   entry.origin = nullptr;
   entry.callback = nullptr;
@@ -667,6 +668,50 @@ void OvmsVehicle::RegisterCanBus(int bus, CAN_mode_t mode, CAN_speed_t speed, db
     }
   }
 
+/**
+ * RegisterCanInterest: declare the CAN IDs handled by IncomingFrameCan1..4()
+ *  Once IDs have been registered for a bus, other frames received on that bus
+ *  are dropped in the CAN RX task and not queued to the vehicle (poll responses
+ *  are still passed on). Without registrations, all frames are passed on.
+ *  Standard IDs (up to 0x7ff) are unlimited, extended IDs are limited to
+ *  CAN_INTEREST_MAXRANGES ranges per bus.
+ *
+ *  @param bus
+ *    The bus (m_can1..4) to register the IDs for
+ *  @param id_from, id_to
+ *    ID range (inclusive)
+ *  @param ids
+ *    List of single IDs
+ */
+void OvmsVehicle::RegisterCanInterest(canbus* bus, uint32_t id_from, uint32_t id_to)
+  {
+  if (!bus) return;
+  if (!bus->m_rxinterest.Add(id_from, id_to))
+    ESP_LOGE(TAG, "RegisterCanInterest: %s: failed to add %" PRIx32 "-%" PRIx32, bus->GetName(), id_from, id_to);
+  }
+
+void OvmsVehicle::RegisterCanInterest(canbus* bus, std::initializer_list<uint32_t> ids)
+  {
+  for (uint32_t id : ids)
+    RegisterCanInterest(bus, id, id);
+  }
+
+/**
+ * ClearCanInterest: pass all frames of a bus (or of all vehicle buses) on again
+ */
+void OvmsVehicle::ClearCanInterest(canbus* bus)
+  {
+  if (bus)
+    {
+    bus->m_rxinterest.Clear();
+    return;
+    }
+  if (m_can1) m_can1->m_rxinterest.Clear();
+  if (m_can2) m_can2->m_rxinterest.Clear();
+  if (m_can3) m_can3->m_rxinterest.Clear();
+  if (m_can4) m_can4->m_rxinterest.Clear();
+  }
+
 bool OvmsVehicle::PinCheck(const char* pin)
   {
   if (!MyConfig.IsDefined("password","pin")) return false;
@@ -1473,7 +1518,10 @@ OvmsVehicle::vehicle_command_t OvmsVehicle::CommandStatTrip(int verbosity, OvmsW
   const char* energyUnitLabel = OvmsMetricUnitLabel(energyUnit);
   const char* altitudeUnitLabel = OvmsMetricUnitLabel(altitudeUnit);
 
-  float trip_length = StdMetrics.ms_v_pos_trip->AsFloat(0);
+  // Fall back to the integrator results if the vehicle doesn't provide trip values:
+  float trip_length = StdMetrics.ms_v_pos_trip->IsDefined()
+    ? StdMetrics.ms_v_pos_trip->AsFloat(0)
+    : StdMetrics.ms_v_pos_integ_distance->AsFloat(0);
 
   float speed_avg = (m_drive_speedcnt > 0)
     ? UnitConvert(Kph, speedUnit, (float)(m_drive_speedsum / m_drive_speedcnt))
@@ -1484,10 +1532,17 @@ OvmsVehicle::vehicle_command_t OvmsVehicle::CommandStatTrip(int verbosity, OvmsW
   float decel_avg = (m_drive_decelcnt > 0)
     ? UnitConvert(MetersPSS, accelUnit, (float)(m_drive_decelsum / m_drive_decelcnt))
     : 0;
-  float energy_recup_perc = (m_inv_energyused > 0) ? m_inv_energyrecd / m_inv_energyused * 100 : 0;
-
-  float energy_used = StdMetrics.ms_v_bat_energy_used->AsFloat();
-  float energy_recd = StdMetrics.ms_v_bat_energy_recd->AsFloat();
+  float inv_energy_used = StdMetrics.ms_v_inv_integ_used->AsFloat();
+  float inv_energy_recd = StdMetrics.ms_v_inv_integ_recd->AsFloat();
+  float energy_recup_perc = (inv_energy_used > 0) ? inv_energy_recd / inv_energy_used * 100 : 0;
+
+  bool energy_defined = StdMetrics.ms_v_bat_energy_used->IsDefined();
+  float energy_used = energy_defined
+    ? StdMetrics.ms_v_bat_energy_used->AsFloat()
+    : StdMetrics.ms_v_bat_integ_used->AsFloat();
+  float energy_recd = energy_defined
+    ? StdMetrics.ms_v_bat_energy_recd->AsFloat()
+    : StdMetrics.ms_v_bat_integ_recd->AsFloat();
   float energy_recd_perc = (energy_used > 0) ? energy_recd / energy_used * 100 : 0;
   float wh_per_km = (trip_length > 0) ? (energy_used - energy_recd) * 1000 / trip_length : 0;
 
@@ -1542,14 +1597,14 @@ OvmsVehicle::vehicle_command_t OvmsVehicle::CommandStatTrip(int verbosity, OvmsW
       << decel_avg << accelUnitLabel
       ;
     }
-  if (m_inv_energyused > 0)
+  if (inv_energy_used > 0)
     {
     buf
       << "\nMotor +"
       << std::setprecision(3)
-      << m_inv_energyused
+      << inv_energy_used
       << " / -"
-      << m_inv_energyrecd << energyUnitLabel
+      << inv_energy_recd << energyUnitLabel
       << std::setprecision(0)
       << " (" << energy_recup_perc << "% recd)"
       ;
@@ -1611,10 +1666,6 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
       m_drive_accelsum = 0;
       m_drive_decelcnt = 0;
       m_drive_decelsum = 0;
-      m_inv_reftime = esp_log_timestamp();
-      m_inv_refpower = 0;
-      m_inv_energyused = 0;
-      m_inv_energyrecd = 0;
       MyEvents.SignalEvent("vehicle.on",NULL);
       if (m_autonotifications)
         {
@@ -1877,26 +1928,6 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
       m_drive_speedsum += speed;
       }
     }
-  else if (metric == StdMetrics.ms_v_inv_power)
-    // collect data for trip pos. and neg. (recuperated) motor energies
-    {
-    uint32_t now = esp_log_timestamp();
-    if (now > m_inv_reftime)
-      {
-      float invpower = StdMetrics.ms_v_inv_power->AsFloat();
-      float invenergy = (m_inv_refpower + invpower) * (now - m_inv_reftime) / (2*1000*3600); // average of last 2 values in kWh
-      if ( invenergy < 0 )
-        {
-        m_inv_energyrecd -= invenergy; // sum should be positive
-        }
-      else
-        {
-        m_inv_energyused += invenergy;
-        }
-      m_inv_refpower = invpower;
-      m_inv_reftime = now;
-      }
-    }
   else if (metric == StandardMetrics.ms_v_pos_acceleration)
     {
     if (m_brakelight_enable)
@@ -1950,11 +1981,11 @@ void OvmsVehicle::MetricModified(OvmsMetric* metric)
  */
 void OvmsVehicle::CalculateAcceleration()
   {
-  uint32_t now = esp_log_timestamp();
+  int64_t now = esp_timer_get_time();
   if (now > m_accel_reftime)
     {
     float speed = ABS(StdMetrics.ms_v_pos_speed->AsFloat(0, MetersPS));
-    float accel = (speed - m_accel_refspeed) / (now - m_accel_reftime) * 1000;
+    float accel = (speed - m_accel_refspeed) / (now - m_accel_reftime) * 1000000;
     // smooth out road bumps & gear box backlash:
     if (m_accel_smoothing > 0)
       accel = (accel + StdMetrics.ms_v_pos_acceleration->AsFloat() * m_accel_smoothing) / (m_accel_smoothing + 1);
@@ -229,7 +229,7 @@ class OvmsVehicle : public InternalRamAllocated
 
   protected:
     float m_accel_refspeed;                 // Acceleration calculation: last speed measured (m/s)
-    uint32_t m_accel_reftime;               // … timestamp for refspeed (ms)
+    int64_t m_accel_reftime;                // … timestamp for refspeed (µs)
     float m_accel_smoothing;                // … smoothing factor (samples, 0 = none, default 2.0)
     void CalculateAcceleration();           // Call after ms_v_pos_speed update to derive acceleration
 
@@ -266,10 +266,6 @@ class OvmsVehicle : public InternalRamAllocated
     double m_drive_accelsum;                // Driving acceleration average data
     uint32_t m_drive_decelcnt;              // Driving deceleration average data
     double m_drive_decelsum;                // Driving deceleration average data
-    double m_inv_energyused;                // Driving motor energy sum
-    double m_inv_energyrecd;                // Driving recupered energy sum
-    uint32_t m_inv_reftime;                 // last time inverter(motor) power was measured
-    float m_inv_refpower;                   // last inverter(motor) power
 
   protected:
 
@@ -370,6 +366,9 @@ class OvmsVehicle : public InternalRamAllocated
 
   protected:
     void RegisterCanBus(int bus, CAN_mode_t mode, CAN_speed_t speed, dbcfile* dbcfile = NULL);
+    void RegisterCanInterest(canbus* bus, uint32_t id_from, uint32_t id_to);
+    void RegisterCanInterest(canbus* bus, std::initializer_list<uint32_t> ids);
+    void ClearCanInterest(canbus* bus = NULL);
     bool PinCheck(const char* pin);
 
   public:
@@ -0,0 +1,416 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#include "ovms_log.h"
+static const char *TAG = "vehicle-integ";
+
+#include <math.h>
+#include <string.h>
+#include <functional>
+#include "esp_timer.h"
+#include "ovms_events.h"
+#include "metrics_standard.h"
+#include "vehicle_integrator.h"
+
+using namespace std::placeholders;
+
+OvmsVehicleIntegrator MyVehicleIntegrator __attribute__ ((init_priority (2010)));
+
+#define US_PER_HOUR               3600000000.0
+
+static inline void integ_add(double area, double& pos, double& neg)
+  {
+  if (area >= 0)
+    pos += area;
+  else
+    neg -= area;
+  }
+
+static void integ_trapezoid(double v0, double v1, double dt, double& pos, double& neg)
+  {
+  if ((v0 < 0) == (v1 < 0))
+    {
+    integ_add((v0 + v1) / 2 * dt, pos, neg);
+    }
+  else
+    {
+    // split at the zero crossing:
+    double tz = dt * v0 / (v0 - v1);
+    integ_add(v0 / 2 * tz, pos, neg);
+    integ_add(v1 / 2 * (dt - tz), pos, neg);
+    }
+  }
+
+
+/**
+ * OvmsIntegratorChannel: time integral of a single metric
+ *  - pos/neg get the positive/negative areas of the segment in [value × hours]
+ */
+
+OvmsIntegratorChannel::OvmsIntegratorChannel()
+  {
+  Reset();
+  }
+
+void OvmsIntegratorChannel::Reset()
+  {
+  m_samples = 0;
+  m_period = 0;
+  m_period_min = 0;
+  m_period_cnt = 0;
+  m_time = 0;
+  m_value = 0;
+  m_lastupdate = 0;
+  }
+
+void OvmsIntegratorChannel::Update(int64_t now, float value, double& pos, double& neg)
+  {
+  m_samples++;
+
+  // Track the update period: metrics only notify on changes, so use the
+  // shortest interval seen within the last INTEG_PERIOD_WINDOW updates:
+  if (m_lastupdate && now > m_lastupdate)
+    {
+    int64_t p = now - m_lastupdate;
+    if (p > INTEG_PERIOD_MAX) p = INTEG_PERIOD_MAX;
+    if (m_period_min == 0 || p < m_period_min)
+      m_period_min = p;
+    if (m_period == 0 || m_period_min < m_period)
+      m_period = m_period_min;
+    if (++m_period_cnt >= INTEG_PERIOD_WINDOW)
+      {
+      m_period = m_period_min;
+      m_period_min = 0;
+      m_period_cnt = 0;
+      }
+    }
+  m_lastupdate = now;
+
+  if (m_time && now > m_time)
+    {
+    // Hold the previous value until one period before now, then ramp:
+    double dt = now - m_time;
+    double ramp = (m_period > 0 && m_period < dt) ? m_period : dt;
+    double a0 = 0, a1 = 0;
+    integ_add((double)m_value * (dt - ramp), a0, a1);
+    integ_trapezoid(m_value, value, ramp, a0, a1);
+    pos += a0 / US_PER_HOUR;
+    neg += a1 / US_PER_HOUR;
+    }
+
+  if (now > m_time)
+    m_time = now;
+  m_value = value;
+  }
+
+void OvmsIntegratorChannel::Hold(int64_t now, bool stale, double& pos, double& neg)
+  {
+  if (m_time == 0)
+    return;
+  if (stale)
+    {
+    // no updates from the vehicle, drop the value:
+    m_time = 0;
+    m_lastupdate = 0;
+    m_period_min = 0;
+    m_period_cnt = 0;
+    return;
+    }
+  if (now > m_time)
+    {
+    double a0 = 0, a1 = 0;
+    integ_add((double)m_value * (now - m_time), a0, a1);
+    pos += a0 / US_PER_HOUR;
+    neg += a1 / US_PER_HOUR;
+    m_time = now;
+    }
+  }
+
+
+/**
+ * Shell commands
+ */
+
+static void integ_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  MyVehicleIntegrator.Status(writer);
+  }
+
+static void integ_reset(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (strcmp(cmd->GetName(), "trip") == 0)
+    MyVehicleIntegrator.ResetTrip();
+  else
+    MyVehicleIntegrator.ResetCharge();
+  writer->printf("Integrator %s values reset\n", cmd->GetName());
+  }
+
+
+/**
+ * OvmsVehicleIntegrator
+ */
+
+OvmsVehicleIntegrator::OvmsVehicleIntegrator()
+  {
+  ESP_LOGI(TAG, "Initialising vehicle integrator (2010)");
+
+  m_driving = false;
+  m_charging = false;
+  ClearTrip();
+  ClearCharge();
+
+  // Totals are taken over from the (persistent) metrics on the first publish,
+  // NAN never compares equal:
+  m_total_used = m_total_recd = m_total_charged = 0;
+  m_pub_used = m_pub_recd = m_pub_charged = NAN;
+
+  #undef bind  // Kludgy, but works
+  MyMetrics.RegisterListener(TAG, MS_V_BAT_POWER, std::bind(&OvmsVehicleIntegrator::MetricModified, this, _1));
+  MyMetrics.RegisterListener(TAG, MS_V_INV_POWER, std::bind(&OvmsVehicleIntegrator::MetricModified, this, _1));
+  MyMetrics.RegisterListener(TAG, MS_V_POS_SPEED, std::bind(&OvmsVehicleIntegrator::MetricModified, this, _1));
+  MyMetrics.RegisterListener(TAG, MS_V_POS_ODOMETER, std::bind(&OvmsVehicleIntegrator::MetricModified, this, _1));
+  MyMetrics.RegisterListener(TAG, MS_V_ENV_ON, std::bind(&OvmsVehicleIntegrator::MetricModified, this, _1));
+  MyMetrics.RegisterListener(TAG, MS_V_CHARGE_INPROGRESS, std::bind(&OvmsVehicleIntegrator::MetricModified, this, _1));
+  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&OvmsVehicleIntegrator::Ticker1, this, _1, _2));
+
+  OvmsCommand* cmd_vehicle = MyCommandApp.FindCommand("vehicle");
+  if (cmd_vehicle)
+    {
+    OvmsCommand* cmd_integ = cmd_vehicle->RegisterCommand("integrator", "Drive & energy integrator", integ_status);
+    cmd_integ->RegisterCommand("status", "Show integrator status", integ_status);
+    OvmsCommand* cmd_reset = cmd_integ->RegisterCommand("reset", "Reset integrator values");
+    cmd_reset->RegisterCommand("trip", "Reset trip values", integ_reset);
+    cmd_reset->RegisterCommand("charge", "Reset charge session values", integ_reset);
+    }
+  }
+
+OvmsVehicleIntegrator::~OvmsVehicleIntegrator()
+  {
+  MyEvents.DeregisterEvent(TAG);
+  MyMetrics.DeregisterListener(TAG);
+  }
+
+void OvmsVehicleIntegrator::ClearTrip()
+  {
+  m_trip_used = m_trip_recd = 0;
+  m_trip_inv_used = m_trip_inv_recd = 0;
+  m_trip_spd_dist = 0;
+  m_trip_odo_start = StdMetrics.ms_v_pos_odometer->AsFloat(0, Kilometers);
+  m_trip_odo_dist = 0;
+  }
+
+void OvmsVehicleIntegrator::ClearCharge()
+  {
+  m_charge_kwh = 0;
+  }
+
+void OvmsVehicleIntegrator::ResetTrip()
+  {
+  OvmsMutexLock lock(&m_mutex);
+  ClearTrip();
+  }
+
+void OvmsVehicleIntegrator::ResetCharge()
+  {
+  OvmsMutexLock lock(&m_mutex);
+  ClearCharge();
+  }
+
+void OvmsVehicleIntegrator::AddBattery(double pos, double neg)
+  {
+  if (m_charging)
+    {
+    m_charge_kwh += neg - pos;
+    m_total_charged += neg - pos;
+    }
+  else
+    {
+    m_total_used += pos;
+    m_total_recd += neg;
+    if (m_driving)
+      {
+      m_trip_used += pos;
+      m_trip_recd += neg;
+      }
+    }
+  }
+
+void OvmsVehicleIntegrator::AddMotor(double pos, double neg)
+  {
+  if (m_driving)
+    {
+    m_trip_inv_used += pos;
+    m_trip_inv_recd += neg;
+    }
+  }
+
+void OvmsVehicleIntegrator::AddSpeed(double pos, double neg)
+  {
+  if (m_driving)
+    m_trip_spd_dist += pos;
+  }
+
+/**
+ * Flush: integrate the held values up to now
+ *  (called with the mutex locked)
+ */
+void OvmsVehicleIntegrator::Flush(int64_t now)
+  {
+  double pos, neg;
+  pos = neg = 0;
+  m_bat.Hold(now, StdMetrics.ms_v_bat_power->Age() > INTEG_STALE_TIME, pos, neg);
+  AddBattery(pos, neg);
+  pos = neg = 0;
+  m_inv.Hold(now, StdMetrics.ms_v_inv_power->Age() > INTEG_STALE_TIME, pos, neg);
+  AddMotor(pos, neg);
+  pos = neg = 0;
+  m_spd.Hold(now, StdMetrics.ms_v_pos_speed->Age() > INTEG_STALE_TIME, pos, neg);
+  AddSpeed(pos, neg);
+  }
+
+void OvmsVehicleIntegrator::MetricModified(OvmsMetric* metric)
+  {
+  int64_t now = esp_timer_get_time();
+  double pos = 0, neg = 0;
+  OvmsMutexLock lock(&m_mutex);
+
+  if (metric == StdMetrics.ms_v_bat_power)
+    {
+    m_bat.Update(now, StdMetrics.ms_v_bat_power->AsFloat(0, kW), pos, neg);
+    AddBattery(pos, neg);
+    }
+  else if (metric == StdMetrics.ms_v_inv_power)
+    {
+    m_inv.Update(now, StdMetrics.ms_v_inv_power->AsFloat(0, kW), pos, neg);
+    AddMotor(pos, neg);
+    }
+  else if (metric == StdMetrics.ms_v_pos_speed)
+    {
+    m_spd.Update(now, fabsf(StdMetrics.ms_v_pos_speed->AsFloat(0, Kph)), pos, neg);
+    AddSpeed(pos, neg);
+    }
+  else if (metric == StdMetrics.ms_v_pos_odometer)
+    {
+    float odo = StdMetrics.ms_v_pos_odometer->AsFloat(0, Kilometers);
+    if (m_driving && odo > 0)
+      {
+      if (m_trip_odo_start <= 0 || odo < m_trip_odo_start)
+        m_trip_odo_start = odo;
+      else
+        m_trip_odo_dist = odo - m_trip_odo_start;
+      }
+    }
+  else if (metric == StdMetrics.ms_v_env_on)
+    {
+    bool on = StdMetrics.ms_v_env_on->AsBool();
+    if (on != m_driving)
+      {
+      // close the running segments in the old state:
+      Flush(now);
+      m_driving = on;
+      if (on)
+        ClearTrip();
+      }
+    }
+  else if (metric == StdMetrics.ms_v_charge_inprogress)
+    {
+    bool on = StdMetrics.ms_v_charge_inprogress->AsBool();
+    if (on != m_charging)
+      {
+      Flush(now);
+      m_charging = on;
+      if (on)
+        ClearCharge();
+      }
+    }
+  }
+
+void OvmsVehicleIntegrator::Ticker1(std::string event, void* data)
+  {
+  float trip_used, trip_recd, inv_used, inv_recd, dist, consumption, charge_kwh;
+  float total_used, total_recd, total_charged;
+
+  if (!m_mutex.Lock(pdMS_TO_TICKS(100)))
+    return;
+
+  Flush(esp_timer_get_time());
+
+  // Take over totals modified externally (restored from persistence or set by user):
+  float val;
+  if ((val = StdMetrics.ms_v_bat_integ_used_total->AsFloat()) != m_pub_used)
+    m_total_used = val;
+  if ((val = StdMetrics.ms_v_bat_integ_recd_total->AsFloat()) != m_pub_recd)
+    m_total_recd = val;
+  if ((val = StdMetrics.ms_v_charge_integ_kwh_total->AsFloat()) != m_pub_charged)
+    m_total_charged = val;
+
+  trip_used = m_trip_used;
+  trip_recd = m_trip_recd;
+  inv_used = m_trip_inv_used;
+  inv_recd = m_trip_inv_recd;
+  dist = (m_trip_odo_dist > 0) ? m_trip_odo_dist : m_trip_spd_dist;
+  consumption = (dist >= 0.1) ? (m_trip_used - m_trip_recd) * 1000 / dist : 0;
+  charge_kwh = m_charge_kwh;
+  total_used = m_pub_used = m_total_used;
+  total_recd = m_pub_recd = m_total_recd;
+  total_charged = m_pub_charged = m_total_charged;
+
+  m_mutex.Unlock();
+
+  // Publish outside the lock, listeners run synchronously.
+  // Snapshot readers shall see the set as one update (consumption = used / distance):
+  OvmsMetricSnapshotUpdate update;
+  StdMetrics.ms_v_bat_integ_used->SetValue(trip_used);
+  StdMetrics.ms_v_bat_integ_recd->SetValue(trip_recd);
+  StdMetrics.ms_v_bat_integ_consumption->SetValue(consumption);
+  StdMetrics.ms_v_inv_integ_used->SetValue(inv_used);
+  StdMetrics.ms_v_inv_integ_recd->SetValue(inv_recd);
+  StdMetrics.ms_v_pos_integ_distance->SetValue(dist);
+  StdMetrics.ms_v_charge_integ_kwh->SetValue(charge_kwh);
+  StdMetrics.ms_v_bat_integ_used_total->SetValue(total_used);
+  StdMetrics.ms_v_bat_integ_recd_total->SetValue(total_recd);
+  StdMetrics.ms_v_charge_integ_kwh_total->SetValue(total_charged);
+  }
+
+void OvmsVehicleIntegrator::Status(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_mutex);
+
+  writer->printf("State: %s%s\n",
+    m_driving ? "driving" : "parked",
+    m_charging ? ", charging" : "");
+  writer->printf("Updates:  %10s %10s %10s\n", "bat", "inv", "speed");
+  writer->printf("  count   %10" PRIu32 " %10" PRIu32 " %10" PRIu32 "\n",
+    m_bat.m_samples, m_inv.m_samples, m_spd.m_samples);
+  writer->printf("  period  %8.1fms %8.1fms %8.1fms\n",
+    (float)m_bat.m_period / 1000, (float)m_inv.m_period / 1000, (float)m_spd.m_period / 1000);
+  writer->printf("Trip:\n");
+  writer->printf("  battery   +%.3f / -%.3f kWh\n", m_trip_used, m_trip_recd);
+  writer->printf("  motor     +%.3f / -%.3f kWh\n", m_trip_inv_used, m_trip_inv_recd);
+  writer->printf("  distance  %.3f km (odometer), %.3f km (speed)\n", m_trip_odo_dist, m_trip_spd_dist);
+  writer->printf("Charge:\n");
+  writer->printf("  session   %.3f kWh\n", m_charge_kwh);
+  writer->printf("Total:\n");
+  writer->printf("  battery   +%.3f / -%.3f kWh\n", m_total_used, m_total_recd);
+  writer->printf("  charged   %.3f kWh\n", m_total_charged);
+  }
@@ -0,0 +1,126 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __VEHICLE_INTEGRATOR_H__
+#define __VEHICLE_INTEGRATOR_H__
+
+// Drive & energy integrator
+//
+// Integrates battery power, motor power and speed from the metric updates, i.e.
+// at the rate the vehicle module delivers them (often CAN frame rate), using
+// microsecond timestamps instead of sampling the metrics once per second.
+// Metrics only notify on value changes, so a gap longer than the observed update
+// period means the value was held: the gap is integrated as a constant up to
+// the last known period, followed by a trapezoid ramp to the new value. Segments
+// crossing zero are split exactly, so regen never cancels out consumption.
+//
+// Results are published once per second (ticker.1):
+//   - trip values, reset on vehicle on
+//   - charge session energy, reset on charge start
+//   - life time totals (persistent)
+
+#include <stdint.h>
+#include "ovms_metrics.h"
+#include "ovms_mutex.h"
+#include "ovms_command.h"
+
+#define INTEG_STALE_TIME          10          // Seconds without metric update after which a value is no longer held
+#define INTEG_PERIOD_MAX          2000000     // Max update period estimation [µs]
+#define INTEG_PERIOD_WINDOW       64          // Update period estimation window [updates]
+
+class OvmsIntegratorChannel
+  {
+  public:
+    OvmsIntegratorChannel();
+
+  public:
+    void Reset();
+    void Update(int64_t now, float value, double& pos, double& neg);
+    void Hold(int64_t now, bool stale, double& pos, double& neg);
+
+  public:
+    uint32_t  m_samples;                      // Number of updates
+    int64_t   m_period;                       // Estimated update period [µs]
+
+  protected:
+    int64_t   m_time;                         // Timestamp of last segment end [µs], 0 = no value
+    float     m_value;                        // Value at m_time
+    int64_t   m_lastupdate;                   // Timestamp of last update [µs]
+    int64_t   m_period_min;                   // Shortest interval in current window [µs]
+    int       m_period_cnt;                   // Updates in current window
+  };
+
+class OvmsVehicleIntegrator
+  {
+  public:
+    OvmsVehicleIntegrator();
+    ~OvmsVehicleIntegrator();
+
+  public:
+    void MetricModified(OvmsMetric* metric);
+    void Ticker1(std::string event, void* data);
+    void ResetTrip();
+    void ResetCharge();
+    void Status(OvmsWriter* writer);
+
+  protected:
+    void ClearTrip();
+    void ClearCharge();
+    void Flush(int64_t now);
+    void AddBattery(double pos, double neg);
+    void AddMotor(double pos, double neg);
+    void AddSpeed(double pos, double neg);
+    void Publish();
+
+  protected:
+    OvmsMutex             m_mutex;
+    OvmsIntegratorChannel m_bat;              // v.b.power [kW]
+    OvmsIntegratorChannel m_inv;              // v.i.power [kW]
+    OvmsIntegratorChannel m_spd;              // v.p.speed [kph]
+    bool                  m_driving;          // v.e.on
+    bool                  m_charging;         // v.c.inprogress
+
+    // Trip:
+    double                m_trip_used;        // [kWh]
+    double                m_trip_recd;        // [kWh]
+    double                m_trip_inv_used;    // [kWh]
+    double                m_trip_inv_recd;    // [kWh]
+    double                m_trip_spd_dist;    // [km] speed integral
+    float                 m_trip_odo_start;   // [km], 0 = unknown
+    float                 m_trip_odo_dist;    // [km] odometer delta
+
+    // Charge session:
+    double                m_charge_kwh;       // [kWh]
+
+    // Life time totals & last published values:
+    double                m_total_used;
+    double                m_total_recd;
+    double                m_total_charged;
+    float                 m_pub_used;
+    float                 m_pub_recd;
+    float                 m_pub_charged;
+  };
+
+extern OvmsVehicleIntegrator MyVehicleIntegrator;
+
+#endif //#ifndef __VEHICLE_INTEGRATOR_H__
@@ -0,0 +1,166 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#include "ovms_log.h"
+static const char *TAG = "vehicle";
+
+#include <string.h>
+#include "vehicle_pidtable.h"
+
+OvmsPidTable::OvmsPidTable(const char* tag, const pid_field_t* fields, size_t count)
+  {
+  m_tag = tag;
+  m_fields = fields;
+  m_count = count;
+
+  // Determine the max field count per pid, validate the sort order:
+  m_maxfields = 0;
+  int n = 0;
+  for (size_t i = 0; i < count; i++)
+    {
+    if (i > 0 && fields[i].pid < fields[i-1].pid)
+      ESP_LOGE(TAG, "OvmsPidTable(%s): table not sorted at index %d", tag, (int)i);
+    n = (i > 0 && fields[i].pid == fields[i-1].pid) ? n+1 : 1;
+    if (n > m_maxfields) m_maxfields = n;
+    }
+  m_values = new pid_value_t[m_maxfields > 0 ? m_maxfields : 1];
+  }
+
+OvmsPidTable::~OvmsPidTable()
+  {
+  delete [] m_values;
+  }
+
+const pid_field_t* OvmsPidTable::FindFirst(uint16_t pid)
+  {
+  size_t lo = 0, hi = m_count;
+  while (lo < hi)
+    {
+    size_t mid = (lo + hi) / 2;
+    if (m_fields[mid].pid < pid)
+      lo = mid + 1;
+    else
+      hi = mid;
+    }
+  return (lo < m_count && m_fields[lo].pid == pid) ? &m_fields[lo] : NULL;
+  }
+
+int OvmsPidTable::GetFieldCount(uint16_t pid)
+  {
+  const pid_field_t* f = FindFirst(pid);
+  const pid_field_t* end = m_fields + m_count;
+  int n = 0;
+  for (; f && f < end && f->pid == pid; f++)
+    n++;
+  return n;
+  }
+
+OvmsMetric* OvmsPidTable::GetMetric(const pid_field_t* field)
+  {
+  if (m_metrics.empty())
+    {
+    m_metrics.resize(m_count, NULL);
+    for (size_t i = 0; i < m_count; i++)
+      {
+      if (!m_fields[i].metric) continue;
+      m_metrics[i] = MyMetrics.Find(m_fields[i].metric);
+      if (!m_metrics[i])
+        ESP_LOGW(m_tag, "PID table: metric %s not found", m_fields[i].metric);
+      }
+    }
+  return m_metrics[field - m_fields];
+  }
+
+/**
+ * Decode: decode all fields of a reply
+ *  Returns the values in field order. Values are zero if the PID is unknown
+ *  or the reply is too short for the field. The result is valid until the next
+ *  call, i.e. Decode() is meant to be called from the poller task only.
+ */
+const pid_value_t* OvmsPidTable::Decode(uint16_t pid, const std::string& rxbuf)
+  {
+  memset(m_values, 0, m_maxfields * sizeof(pid_value_t));
+
+  const pid_field_t* first = FindFirst(pid);
+  if (!first)
+    return m_values;
+  const pid_field_t* end = m_fields + m_count;
+
+  static const uint8_t fieldsize[] = { 1, 1, 2, 2, 3, 4, 4 };
+  size_t datalen = rxbuf.size();
+  const uint8_t* d = (const uint8_t*) rxbuf.data();
+  pid_value_t* v = m_values;
+  for (const pid_field_t* f = first; f < end && f->pid == pid; f++, v++)
+    {
+    if (f->offset + fieldsize[f->type] > datalen)
+      {
+      ESP_LOGV(m_tag, "Received %d bytes for %s, expected %d",
+        (int)datalen, f->pidname, f->offset + fieldsize[f->type]);
+      continue;
+      }
+
+    const uint8_t* p = d + f->offset;
+    switch (f->type)
+      {
+      case PidField_UChar:  v->raw = p[0]; break;
+      case PidField_SChar:  v->raw = (int8_t) p[0]; break;
+      case PidField_UInt:   v->raw = (p[0] << 8) | p[1]; break;
+      case PidField_SInt:   v->raw = (int16_t) ((p[0] << 8) | p[1]); break;
+      case PidField_UInt24: v->raw = (p[0] << 16) | (p[1] << 8) | p[2]; break;
+      case PidField_UInt32:
+      case PidField_SInt32: v->raw = (int32_t) (((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]); break;
+      }
+
+    float raw = (f->type == PidField_UInt32) ? (float)(uint32_t)v->raw : (float)v->raw;
+    switch (f->scale)
+      {
+      case PidScale_Mul:  v->value = raw * f->factor + f->add; break;
+      case PidScale_Div:  v->value = raw / f->factor + f->add; break;
+      default:            v->value = raw + f->add; break;
+      }
+
+    if (f->scale == PidScale_None && f->add == 0)
+      {
+      if (f->type == PidField_UInt32)
+        ESP_LOGD(m_tag, "From ECU %s, pid %s: got %s=%" PRIu32 "%s\n", f->ecu, f->pidname, f->name, (uint32_t)v->raw, f->unit);
+      else
+        ESP_LOGD(m_tag, "From ECU %s, pid %s: got %s=%" PRId32 "%s\n", f->ecu, f->pidname, f->name, v->raw, f->unit);
+      }
+    else
+      {
+      ESP_LOGD(m_tag, "From ECU %s, pid %s: got %s=%.4f%s\n", f->ecu, f->pidname, f->name, v->value, f->unit);
+      }
+
+    if (f->metric)
+      {
+      OvmsMetric* m = GetMetric(f);
+      if (m)
+        {
+        dbcNumber num((double)UnitConvert(f->metric_unit, m->GetUnits(), v->value));
+        m->SetValue(num);
+        }
+      }
+    }
+
+  return m_values;
+  }
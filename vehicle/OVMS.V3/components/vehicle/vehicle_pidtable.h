@@ -0,0 +1,105 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __VEHICLE_PIDTABLE_H__
+#define __VEHICLE_PIDTABLE_H__
+
+// Table driven decoder for UDS ReadDataByIdentifier replies
+//
+// A pid table is a flash resident (const) array of field descriptors, sorted by
+// PID, describing the position, type and scaling of all values of interest in the
+// replies. OvmsPidTable::Decode() looks up the fields of a reply, logs them and
+// optionally sets a target metric, and returns the decoded values by field index,
+// so vehicle code only needs to implement the processing beyond that.
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "ovms_metrics.h"
+
+// Field types (big endian):
+typedef enum : uint8_t
+  {
+  PidField_UChar = 0,
+  PidField_SChar,
+  PidField_UInt,                        // 16 bit
+  PidField_SInt,
+  PidField_UInt24,
+  PidField_UInt32,
+  PidField_SInt32,
+  } pid_field_type_t;
+
+// Scaling: value = raw * factor + add, or value = raw / factor + add
+typedef enum : uint8_t
+  {
+  PidScale_None = 0,                    // value = raw + add
+  PidScale_Mul,
+  PidScale_Div,
+  } pid_field_scale_t;
+
+typedef struct
+  {
+  uint16_t pid;
+  uint16_t offset;                      // byte offset in reply payload
+  pid_field_type_t type;
+  pid_field_scale_t scale;
+  float factor;
+  float add;
+  const char* ecu;                      // ECU name (log)
+  const char* pidname;                  // PID name (log)
+  const char* name;                     // field name (log)
+  const char* unit;                     // unit text (log)
+  const char* metric;                   // target metric name or NULL
+  metric_unit_t metric_unit;            // unit of the decoded value for the target metric
+  } pid_field_t;
+
+typedef struct
+  {
+  int32_t raw;                          // unscaled value (uint32 fields: cast back to uint32_t)
+  float value;                          // scaled value
+  } pid_value_t;
+
+class OvmsPidTable
+  {
+  public:
+    OvmsPidTable(const char* tag, const pid_field_t* fields, size_t count);
+    ~OvmsPidTable();
+
+  public:
+    const pid_value_t* Decode(uint16_t pid, const std::string& rxbuf);
+    int GetFieldCount(uint16_t pid);
+
+  protected:
+    const pid_field_t* FindFirst(uint16_t pid);
+    OvmsMetric* GetMetric(const pid_field_t* field);
+
+  protected:
+    const char*           m_tag;
+    const pid_field_t*    m_fields;
+    size_t                m_count;
+    pid_value_t*          m_values;     // decoded values of the last Decode() call
+    int                   m_maxfields;  // max fields per pid
+    std::vector<OvmsMetric*> m_metrics; // target metrics by field index, resolved on first use
+  };
+
+#endif //#ifndef __VEHICLE_PIDTABLE_H__
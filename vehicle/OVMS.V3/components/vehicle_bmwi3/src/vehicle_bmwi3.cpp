@@ -68,6 +68,7 @@ static const char *TAG = "v-bmwi3";
 #include "../ecu_definitions/ecu_lim_defines.h"
 #include "../ecu_definitions/ecu_lim_extra_defines.h"
 #include "../ecu_definitions/ecu_ihx_defines.h"
+#include "vehicle_bmwi3_pids.h"
 
 
 
@@ -202,6 +203,7 @@ OvmsMetricString* MetricString(const char* name, uint16_t autostale=0, metric_un
 }
 
 OvmsVehicleBMWi3::OvmsVehicleBMWi3()
+  : m_pidtable(TAG, bmwi3_pid_fields, sizeof(bmwi3_pid_fields) / sizeof(bmwi3_pid_fields[0]))
 {
     ESP_LOGI(TAG, "BMW i3/i3s vehicle module");
 
@@ -423,9 +425,9 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", length, "I3_PID_SME_ALTERUNG_KAPAZITAET_TS", 4);
         break;
     }
-    unsigned long STAT_ALTERUNG_KAPAZITAET_WERT = (RXBUF_UINT32(0));
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    unsigned long STAT_ALTERUNG_KAPAZITAET_WERT = pidval[0].raw;
         // Remaining capacity of the memory / Restkapazitaet des Speichers
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lu%s\n", "SME", "ALTERUNG_KAPAZITAET_TS", "STAT_ALTERUNG_KAPAZITAET_WERT", STAT_ALTERUNG_KAPAZITAET_WERT, "\"%\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_bat_soh->SetValue(STAT_ALTERUNG_KAPAZITAET_WERT, Percentage);
@@ -444,10 +446,10 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", length, "I3_PID_SME_HV_SPANNUNG_BERECHNET", 2);
         break;
     }
-    float STAT_HV_SPANNUNG_BERECHNET_WERT = (RXBUF_UINT(0)/100.0f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_HV_SPANNUNG_BERECHNET_WERT = pidval[0].value;
         // Battery voltage behind the contactors, regardless of the contactor status / Batteriespannung hinter den
         // Schﾃｼtzen, unabhﾃ､ngig vom Schﾃｼtzzustand
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "HV_SPANNUNG_BERECHNET", "STAT_HV_SPANNUNG_BERECHNET_WERT", STAT_HV_SPANNUNG_BERECHNET_WERT, "\"V\"");
 
     // ==========  Add your processing here ==========
     hv_volts = STAT_HV_SPANNUNG_BERECHNET_WERT;
@@ -461,9 +463,9 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", length, "I3_PID_SME_HV_STROM", 4);
         break;
     }
-    float STAT_HV_STROM_WERT = (RXBUF_SINT32(0)/100.0f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_HV_STROM_WERT = pidval[0].value;
         // HV current in A / HV-Strom in A
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "HV_STROM", "STAT_HV_STROM_WERT", STAT_HV_STROM_WERT, "\"A\"");
 
     // ==========  Add your processing here ==========
     STAT_HV_STROM_WERT = -STAT_HV_STROM_WERT;
@@ -482,15 +484,13 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", length, "I3_PID_SME_ANZEIGE_SOC", 6);
         break;
     }
-    float STAT_ANZEIGE_SOC_WERT = (RXBUF_UINT(0)/10.0f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_ANZEIGE_SOC_WERT = pidval[0].value;
         // current advertisement Soc / aktueller Anzeige Soc
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ANZEIGE_SOC", "STAT_ANZEIGE_SOC_WERT", STAT_ANZEIGE_SOC_WERT, "\"%\"");
-    float STAT_MAXIMALE_ANZEIGE_SOC_WERT = (RXBUF_UINT(2)/10.0f);
+    float STAT_MAXIMALE_ANZEIGE_SOC_WERT = pidval[1].value;
         // upper limit of the display Soc / obere Grenze des Anzeige Soc
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ANZEIGE_SOC", "STAT_MAXIMALE_ANZEIGE_SOC_WERT", STAT_MAXIMALE_ANZEIGE_SOC_WERT, "\"%\"");
-    float STAT_MINIMALE_ANZEIGE_SOC_WERT = (RXBUF_UINT(4)/10.0f);
+    float STAT_MINIMALE_ANZEIGE_SOC_WERT = pidval[2].value;
         // lower limit of the display Soc / untere Grenze des Anzeige Soc
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ANZEIGE_SOC", "STAT_MINIMALE_ANZEIGE_SOC_WERT", STAT_MINIMALE_ANZEIGE_SOC_WERT, "\"%\"");
 
     // ==========  Add your processing here ==========
     if (STAT_ANZEIGE_SOC_WERT >= 0.0 && STAT_ANZEIGE_SOC_WERT <= 100.0) {
@@ -510,18 +510,16 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_SME_TEMPERATUREN", 6);
         break;
     }
-    float STAT_TCORE_MIN_WERT = (RXBUF_SINT(0)/100.0f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_TCORE_MIN_WERT = pidval[0].value;
         // Output of the calculated minimum cell core temperatures / Ausgabe der berechneten minimalen
         // Zellkerntemperaturen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "TEMPERATUREN", "STAT_TCORE_MIN_WERT", STAT_TCORE_MIN_WERT, "\"°C\"");
-    float STAT_TCORE_MAX_WERT = (RXBUF_SINT(2)/100.0f);
+    float STAT_TCORE_MAX_WERT = pidval[1].value;
         // Output of the calculated maximum cell core temperatures / Ausgabe der berechneten maximalen
         // Zellkerntemperaturen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "TEMPERATUREN", "STAT_TCORE_MAX_WERT", STAT_TCORE_MAX_WERT, "\"°C\"");
-    float STAT_TCORE_MEAN_WERT = (RXBUF_SINT(4)/100.0f);
+    float STAT_TCORE_MEAN_WERT = pidval[2].value;
         // Output of the calculated average cell core temperatures / Ausgabe der berechneten durchschnittlichen
         // Zellkerntemperaturen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "TEMPERATUREN", "STAT_TCORE_MEAN_WERT", STAT_TCORE_MEAN_WERT, "\"°C\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_bat_pack_tmin->SetValue(STAT_TCORE_MIN_WERT, Celcius);
@@ -538,6 +536,7 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_SME_ZUSTAND_SPEICHER", 38);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
 // 2020-12-19 12:54:28 SAST D (686338) v-bmwi3: From ECU SME, pid ZUSTAND_SPEICHER: got STAT_ZELLKAPAZITAET_MIN_WERT=120.4100"Ah"
 // 2020-12-19 12:54:28 SAST D (686338) v-bmwi3: From ECU SME, pid ZUSTAND_SPEICHER: got STAT_ZELLKAPAZITAET_MAX_WERT=122.1400"Ah"
@@ -559,102 +558,83 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
 // 2020-12-19 12:54:28 SAST D (686338) v-bmwi3: From ECU SME, pid ZUSTAND_SPEICHER: got STAT_ZELLOCV_MEAN_WERT=3.9235"V"
 // 2020-12-19 12:54:28 SAST D (686338) v-bmwi3: From ECU SME, pid ZUSTAND_SPEICHER: got STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT=1.0655
 
-    float STAT_ZELLKAPAZITAET_MIN_WERT = (RXBUF_UINT(0)/100.0f);
+    float STAT_ZELLKAPAZITAET_MIN_WERT = pidval[0].value;
         // Output of the current minimum measured cell capacity of all cells in Ah / Ausgabe der aktuellen minimalen
         // gemessenen Zellkapazität aller Zellen in Ah
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLKAPAZITAET_MIN_WERT", STAT_ZELLKAPAZITAET_MIN_WERT, "\"Ah\"");
 
-    float STAT_ZELLKAPAZITAET_MAX_WERT = (RXBUF_UINT(2)/100.0f);
+    float STAT_ZELLKAPAZITAET_MAX_WERT = pidval[1].value;
         // Output of the current maximum measured cell capacity of all cells in Ah / Ausgabe der aktuellen maximalen
         // gemessenen Zellkapazität aller Zellen in Ah
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLKAPAZITAET_MAX_WERT", STAT_ZELLKAPAZITAET_MAX_WERT, "\"Ah\"");
 
-    float STAT_ZELLKAPAZITAET_MEAN_WERT = (RXBUF_UINT(4)/100.0f);
+    float STAT_ZELLKAPAZITAET_MEAN_WERT = pidval[2].value;
         // Output of the current mean measured cell capacity averaged over all cells in Ah / Ausgabe der aktuellen
         // mittleren gemessenen Zellkapazität gemittelt über alle Zellen in Ah
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLKAPAZITAET_MEAN_WERT", STAT_ZELLKAPAZITAET_MEAN_WERT, "\"Ah\"");
 
-    float STAT_ZELLSPANNUNG_MIN_WERT = (RXBUF_UINT(6)/10000.0f);
+    float STAT_ZELLSPANNUNG_MIN_WERT = pidval[3].value;
         // Output of the current minimum measured cell voltage of all cells in V. / Ausgabe der aktuellen minimalen
         // gemessenen Zellspannung aller Zellen in V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSPANNUNG_MIN_WERT", STAT_ZELLSPANNUNG_MIN_WERT, "\"V\"");
 
-    float STAT_ZELLSPANNUNG_MAX_WERT = (RXBUF_UINT(8)/10000.0f);
+    float STAT_ZELLSPANNUNG_MAX_WERT = pidval[4].value;
         // Output of the current maximum measured cell voltage of all cells in V / Ausgabe der aktuellen maximalen
         // gemessenen Zellspannung aller Zellen in V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSPANNUNG_MAX_WERT", STAT_ZELLSPANNUNG_MAX_WERT, "\"V\"");
 
-    float STAT_ZELLSPANNUNG_MEAN_WERT = (RXBUF_UINT(10)/10000.0f);
+    float STAT_ZELLSPANNUNG_MEAN_WERT = pidval[5].value;
         // Output of the current mean measured cell voltage of all cells in V / Ausgabe der aktuellen mittleren
         // gemessenen Zellspannung aller Zellen in V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSPANNUNG_MEAN_WERT", STAT_ZELLSPANNUNG_MEAN_WERT, "\"V\"");
 
-    float STAT_ZELLTEMPERATUR_MIN_WERT = (RXBUF_SINT(12)/100.0f);
+    float STAT_ZELLTEMPERATUR_MIN_WERT = pidval[6].value;
         // Output of the current minimum measured cell temperature of all cells in <B0> C / Ausgabe der aktuellen minimalen
         // gemessenen Zelltemperatur aller Zellen in °C
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLTEMPERATUR_MIN_WERT", STAT_ZELLTEMPERATUR_MIN_WERT, "\"°C\"");
 
-    float STAT_ZELLTEMPERATUR_MAX_WERT = (RXBUF_SINT(14)/100.0f);
+    float STAT_ZELLTEMPERATUR_MAX_WERT = pidval[7].value;
         // Output of the current maximum measured cell temperature of all cells in <B0> C / Ausgabe der aktuellen maximalen
         // gemessenen Zelltemperatur aller Zellen in °C
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLTEMPERATUR_MAX_WERT", STAT_ZELLTEMPERATUR_MAX_WERT, "\"°C\"");
 
-    float STAT_ZELLTEMPERATUR_MEAN_WERT = (RXBUF_SINT(16)/100.0f);
+    float STAT_ZELLTEMPERATUR_MEAN_WERT = pidval[8].value;
         // Output of the current mean measured cell temperature of all cells in <B0> C / Ausgabe der aktuellen mittleren
         // gemessenen Zelltemperatur aller Zellen in °C
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLTEMPERATUR_MEAN_WERT", STAT_ZELLTEMPERATUR_MEAN_WERT, "\"°C\"");
 
-    float STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT = (RXBUF_UINT(18)/10000.0f);
+    float STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT = pidval[9].value;
         // Output of the current minimum measured resistance factor of all cells / Ausgabe des aktuellen minimalen
         // gemessenen Widerstandsfaktors aller Zellen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT", STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT, "");
 
-    float STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT = (RXBUF_UINT(20)/10000.0f);
+    float STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT = pidval[10].value;
         // Output of the current maximum measured resistance factor of all cells / Ausgabe des aktuellen maximalen
         // gemessenen Widerstandsfaktors aller Zellen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT", STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT, "");
 
-    float STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT = (RXBUF_UINT(22)/10000.0f);
+    float STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT = pidval[11].value;
         // Output of the current mean measured resistance factor of all cells / Ausgabe des aktuellen mittleren
         // gemessenen Widerstandsfaktors aller Zellen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT", STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT, "");
 
-    float STAT_ZELLSOC_MIN_WERT = (RXBUF_UINT(24)/100.0f);
+    float STAT_ZELLSOC_MIN_WERT = pidval[12].value;
         // Output of the current minimum measured SoC of all cells in% / Ausgabe des aktuellen minimalen gemessenen SoC
         // aller Zellen in %
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSOC_MIN_WERT", STAT_ZELLSOC_MIN_WERT, "\"%\"");
 
-    float STAT_ZELLSOC_MAX_WERT = (RXBUF_UINT(26)/100.0f);
+    float STAT_ZELLSOC_MAX_WERT = pidval[13].value;
         // Output of the current maximum measured SoC of all cells in% / Ausgabe des aktuellen maximalen gemessenen SoC
         // aller Zellen in %
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSOC_MAX_WERT", STAT_ZELLSOC_MAX_WERT, "\"%\"");
 
-    float STAT_ZELLSOC_MEAN_WERT = (RXBUF_UINT(28)/100.0f);
+    float STAT_ZELLSOC_MEAN_WERT = pidval[14].value;
         // Output of the current mean measured SoC of all cells in% / Ausgabe des aktuellen mittleren gemessenen SoC
         // aller Zellen in %
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSOC_MEAN_WERT", STAT_ZELLSOC_MEAN_WERT, "\"%\"");
 
-    float STAT_ZELLOCV_MIN_WERT = (RXBUF_UINT(30)/10000.0f);
+    float STAT_ZELLOCV_MIN_WERT = pidval[15].value;
         // Output of the current minimum OCV of all cells measured in the last resting state in V. / Ausgabe der
         // aktuellen minimalen im letzten Ruhezustand gemessenen OCV aller Zellen in V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLOCV_MIN_WERT", STAT_ZELLOCV_MIN_WERT, "\"V\"");
 
-    float STAT_ZELLOCV_MAX_WERT = (RXBUF_UINT(32)/10000.0f);
+    float STAT_ZELLOCV_MAX_WERT = pidval[16].value;
         // Output of the current maximum OCV of all cells measured in the last resting state in V. / Ausgabe der
         // aktuellen maximalen im letzten Ruhezustand gemessenen OCV aller Zellen in V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLOCV_MAX_WERT", STAT_ZELLOCV_MAX_WERT, "\"V\"");
 
-    float STAT_ZELLOCV_MEAN_WERT = (RXBUF_UINT(34)/10000.0f);
+    float STAT_ZELLOCV_MEAN_WERT = pidval[17].value;
         // Output of the current mean OCV of all cells measured in the last resting state in V / Ausgabe der aktuellen
         // mittleren im letzten Ruhezustand gemessenen OCV aller Zellen in V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_ZELLOCV_MEAN_WERT", STAT_ZELLOCV_MEAN_WERT, "\"V\"");
 
-    float STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT = (RXBUF_UINT(36)/10000.0f);
+    float STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT = pidval[18].value;
         // Current aging factor of the serial and parallel ohmic resistance as well as the parallel capacitance (1.5 =
         // increase of the current resistance by 50%) / Aktueller Alterungsfaktor des seriellen und parallelen ohmschen
         // Wider aktuellenstands sowie der parallelen Kapazität (1,5 = Eröhung des aktuellen Wider aktuellenstands um
         // 50%)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZUSTAND_SPEICHER", "STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT", STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT, "");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_bat_cac->SetValue(STAT_ZELLKAPAZITAET_MEAN_WERT, AmpHours);
@@ -678,6 +658,7 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_SME_PROJEKT_PARAMETER", 5);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
 // 2020-12-19 12:54:27 SAST D (685148) v-bmwi3: From ECU SME, pid PROJEKT_PARAMETER: got STAT_ANZAHL_ZELLEN_INSGESAMT_WERT=96
 // 2020-12-19 12:54:27 SAST D (685158) v-bmwi3: From ECU SME, pid PROJEKT_PARAMETER: got STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT=c
@@ -687,21 +668,17 @@ void OvmsVehicleBMWi3::IncomingPollReply(const OvmsPoller::poll_job_t &job, uint
 // Each module contains 4 temperature probes.
 // This stuff aint gonna change 
 
-    unsigned short STAT_ANZAHL_ZELLEN_INSGESAMT_WERT = (RXBUF_UINT(0));
+    unsigned short STAT_ANZAHL_ZELLEN_INSGESAMT_WERT = pidval[0].raw;
         // Number of cells in the HV storage system / Anzahl der Zellen des HV-Speichers
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_ZELLEN_INSGESAMT_WERT", STAT_ANZAHL_ZELLEN_INSGESAMT_WERT, "");
 
-    unsigned char STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT = (RXBUF_UCHAR(2));
+    unsigned char STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT = pidval[1].raw;
         // Number of cells per module / Anzahl der Zellen pro Modul
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT", STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT, "");
 
-    unsigned char STAT_ANZAHL_MODULE_WERT = (RXBUF_UCHAR(3));
+    unsigned char STAT_ANZAHL_MODULE_WERT = pidval[2].raw;
         // Number of modules in the HV storage system / Anzahl der Module des HV-Speichers
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_MODULE_WERT", STAT_ANZAHL_MODULE_WERT, "");
 
-    unsigned char STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT = (RXBUF_UCHAR(4));
+    unsigned char STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT = pidval[3].raw;
         // Number of temperature sensors per module / Anzahl der Temperatursensoren pro Modul
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT", STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT, "");
 
     // ==========  Add your processing here ==========
     hexdump(rxbuf, type, pid);
@@ -714,14 +691,13 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX", 4);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    float STAT_UCELL_MIN_WERT = (RXBUF_UINT(0)/1000.0f);
+    float STAT_UCELL_MIN_WERT = pidval[0].value;
         // minimum single cell voltage of all single cells / minimale Einzelzellspannung aller Einzelzellen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZELLSPANNUNGEN_MIN_MAX", "STAT_UCELL_MIN_WERT", STAT_UCELL_MIN_WERT, "\"V\"");
 
-    float STAT_UCELL_MAX_WERT = (RXBUF_UINT(2)/1000.0f);
+    float STAT_UCELL_MAX_WERT = pidval[1].value;
         // maximum single cell voltage of all single cells / maximale Einzelzellspannung aller Einzelzellen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "SME", "ZELLSPANNUNGEN_MIN_MAX", "STAT_UCELL_MAX_WERT", STAT_UCELL_MAX_WERT, "\"V\"");
 
     // ==========  Add your processing here ==========
     hexdump(rxbuf, type, pid);
@@ -737,32 +713,27 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV", 12);
         break;
     }
-    float STAT_ELECTRIC_RANGE_CURRENT_WERT = (RXBUF_UINT(0)/10.0f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_ELECTRIC_RANGE_CURRENT_WERT = pidval[0].value;
         // STAT_ELECTRIC_RANGE_CURRENT [0.1 km] / STAT_ELECTRIC_RANGE_CURRENT [0,1 km]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_ELECTRIC_RANGE_CURRENT_WERT", STAT_ELECTRIC_RANGE_CURRENT_WERT, "\"km\"");
-    float STAT_ELECTRIC_RANGE_MAXIMUM_WERT = (RXBUF_UINT(2)/10.0f);
+    float STAT_ELECTRIC_RANGE_MAXIMUM_WERT = pidval[1].value;
         // STAT_ELECTRIC_RANGE_MAXIMUM (actual maximum, depends on battery deterioration etc.) [0.1 km] /
         // STAT_ELECTRIC_RANGE_MAXIMUM (actual  maximum, depends on battery deterioration  etc.)  [0,1 km]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_ELECTRIC_RANGE_MAXIMUM_WERT", STAT_ELECTRIC_RANGE_MAXIMUM_WERT, "\"km\"");
-    float STAT_FUEL_RANGE_CURRENT_WERT = (RXBUF_UINT(4)/10.0f);
+    float STAT_FUEL_RANGE_CURRENT_WERT = pidval[2].value;
         // STAT_FUEL_RANGE_CURRENT [0.1 km] (0xFFFF if no REX is available) / STAT_FUEL_RANGE_CURRENT [0,1 km]  (0xFFFF
         // if no REX is available)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_FUEL_RANGE_CURRENT_WERT", STAT_FUEL_RANGE_CURRENT_WERT, "\"km\"");
-    float STAT_FUEL_RANGE_MAXIMUM_WERT = (RXBUF_UINT(6)/10.0f);
+    float STAT_FUEL_RANGE_MAXIMUM_WERT = pidval[3].value;
         // STAT_FUEL_RANGE_MAXIMUM (actual maximum, depends on average consumption etc.) [0.1 km] (0xFFFF if no REX is
         // available) / STAT_FUEL_RANGE_MAXIMUM (actual  maximum, depends on average consumption etc.)  [0,1 km] (0xFFFF
         // if no REX is available)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_FUEL_RANGE_MAXIMUM_WERT", STAT_FUEL_RANGE_MAXIMUM_WERT, "\"km\"");
-    float STAT_RANGE_CONSUMPTION_ELECTRIC_WERT = (RXBUF_UINT(8)/1000.0f);
+    float STAT_RANGE_CONSUMPTION_ELECTRIC_WERT = pidval[4].value;
         // STAT_RANGE_CONSUMPTION_ELECTRIC [kWh / 100km], (only for vehicles without STARTWETESPEICHER, 0xFFFF if not
         // used) / STAT_RANGE_CONSUMPTION_ELECTRIC [kWh/100km], (only for vehicles without STARTWETESPEICHER, 0xFFFF if
         // not used)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_RANGE_CONSUMPTION_ELECTRIC_WERT", STAT_RANGE_CONSUMPTION_ELECTRIC_WERT, "\"kWh/100km\"");
-    float STAT_NEBENVERBRAUCHERLEISTUNG_WERT = (RXBUF_UINT(10)/100.0f);
+    float STAT_NEBENVERBRAUCHERLEISTUNG_WERT = pidval[5].value;
         // STAT_NEBENVERBENVERBRAUCHERLEISTUNG_WERT [0.01 kW], (only for vehicles without STARTWERTESPEICHER, 0xFFFF if
         // not used) / STAT_NEBENVERBRAUCHERLEISTUNG_WERT  [0,01 kW], (only for vehicles without STARTWERTESPEICHER,
         // 0xFFFF if not used)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_NEBENVERBRAUCHERLEISTUNG_WERT", STAT_NEBENVERBRAUCHERLEISTUNG_WERT, "\"kW\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_bat_range_est->SetValue(STAT_ELECTRIC_RANGE_CURRENT_WERT, Kilometers);
@@ -780,12 +751,9 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_TACHO_WERT", 2);
         break;
     }
-    float STAT_GESCHWINDIGKEIT_WERT = (RXBUF_UINT(0)/10.0f);
-        // Returns the display speed. / Rückgabe der Anzeigegeschwindigkeit.
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "TACHO_WERT", "STAT_GESCHWINDIGKEIT_WERT", STAT_GESCHWINDIGKEIT_WERT, "\"km/h\"");
+    m_pidtable.Decode(job.pid, rxbuf);
 
     // ==========  Add your processing here ==========
-    StdMetrics.ms_v_pos_speed->SetValue(STAT_GESCHWINDIGKEIT_WERT, Kph);
 
     break;
   }
@@ -795,14 +763,13 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_GWSZ_ABSOLUT_WERT", 8);
         break;
     }
-    long STAT_ABSOLUT_GWSZ_RAM_WERT = (RXBUF_SINT32(0));
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    long STAT_ABSOLUT_GWSZ_RAM_WERT = pidval[0].raw;
         // Returns the absolute total odometer from the RAM. / Liefert den absoluten Gesamtwegstreckenzähler aus dem
         // RAM.
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%ld%s\n", "KOM", "GWSZ_ABSOLUT_WERT", "STAT_ABSOLUT_GWSZ_RAM_WERT", STAT_ABSOLUT_GWSZ_RAM_WERT, "\"km\"");
-    long STAT_ABSOLUT_GWSZ_EEP_WERT = (RXBUF_SINT32(4));
+    long STAT_ABSOLUT_GWSZ_EEP_WERT = pidval[1].raw;
         // Supplies the absolute total odometer from the EEPROM. / Liefert den absoluten Gesamtwegstreckenzähler aus dem
         // EEPROM.
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%ld%s\n", "KOM", "GWSZ_ABSOLUT_WERT", "STAT_ABSOLUT_GWSZ_EEP_WERT", STAT_ABSOLUT_GWSZ_EEP_WERT, "\"km\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_pos_odometer->SetValue(STAT_ABSOLUT_GWSZ_RAM_WERT, Kilometers);
@@ -815,15 +782,11 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_A_TEMP_WERT", 2);
         break;
     }
-    float STAT_A_TEMP_ANZEIGE_WERT = (RXBUF_UCHAR(0)/2.0f-40.0);
-        // Display value outside temperature / Anzeigewert Außentemperatur
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "A_TEMP_WERT", "STAT_A_TEMP_ANZEIGE_WERT", STAT_A_TEMP_ANZEIGE_WERT, "\"°C\"");
-    float STAT_A_TEMP_ROHWERT_WERT = (RXBUF_UCHAR(1)/2.0f-40.0);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_A_TEMP_ROHWERT_WERT = pidval[1].value;
         // Raw value outside temperature / Rohwert Außentemperatur
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "A_TEMP_WERT", "STAT_A_TEMP_ROHWERT_WERT", STAT_A_TEMP_ROHWERT_WERT, "\"°C\"");
 
     // ==========  Add your processing here ==========
-    StdMetrics.ms_v_env_temp->SetValue(STAT_A_TEMP_ANZEIGE_WERT, Celcius);
 
     break;
   }
@@ -833,21 +796,18 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_KOMBI_BC_BCW_KWH_KM", 8);
         break;
     }
-    float STAT_BC_DSV_KWH_KM_WERT = (RXBUF_UINT(0)/10.0f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_BC_DSV_KWH_KM_WERT = pidval[0].value;
         // On-board computer average consumption in 0.1 [KWh / 100km] / Bordcomputer Durchschnittsverbrauch in 0,1
         // [KWh/100km]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_DSV_KWH_KM_WERT", STAT_BC_DSV_KWH_KM_WERT, "\"kWh/100km\"");
-    float STAT_BC_DSG_KWH_KM_WERT = (RXBUF_UINT(2)/100.0f);
+    float STAT_BC_DSG_KWH_KM_WERT = pidval[1].value;
         // On-board computer average speed in 0.01 [km / h] / Bordcomputer Durchschnittsgeschwindigkeit in 0,01 [km/h]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_DSG_KWH_KM_WERT", STAT_BC_DSG_KWH_KM_WERT, "\"km/h\"");
-    float STAT_BC_MVERB_KWH_KM_WERT = (RXBUF_SINT(4)/10.0f);
+    float STAT_BC_MVERB_KWH_KM_WERT = pidval[2].value;
     //int16_t STAT_BC_MVERB_WH_KM_WERT = RXBUF_SINT(4); // Raw figure is in Wh/km which is what the metric wants (and its signed, actually)
         // On-board computer current consumption in 0.1 [KWh / h] = [KW] / Bordcomputer Momentanverbrauch in 0,1
         // [KWh/h]=[KW]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_MVERB_KWH_KM_WERT", STAT_BC_MVERB_KWH_KM_WERT, "\"kW\"");
-    float STAT_BC_RW_KWH_KM_WERT = (RXBUF_UINT(6)/10.0f);
+    float STAT_BC_RW_KWH_KM_WERT = pidval[3].value;
         // On-board computer range in 0.1 [km] / Bordcomputer Reichweite in 0,1 [km]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_RW_KWH_KM_WERT", STAT_BC_RW_KWH_KM_WERT, "\"km\"");
 
     // ==========  Add your processing here ==========
     // Leave to the calc in vehicle.cpp:  StdMetrics.ms_v_bat_consumption->SetValue(STAT_BC_MVERB_WH_KM_WERT, WattHoursPK);
@@ -860,20 +820,19 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_KOMBI_BC_RBC_KWH_KM", 10);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
     float STAT_RBC_DSV_KWH_KM_WERT = (RXBUF_UINT(0)/10.0f);
     uint16_t STAT_RBC_DSV_WH_KM_WERT = RXBUF_SINT(0); // Wh/km - seems to be signed?
         // On-board computer average consumption in 0.1 [KWh / 100km] / Reisebordcomputer Durchschnittsverbrauch in 0,1
         // [KWh/100km]
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_BC_RBC_KWH_KM", "STAT_RBC_DSV_KWH_KM_WERT", STAT_RBC_DSV_KWH_KM_WERT, "\"kWh/100km\"");
-    float STAT_RBC_DSG_KWH_KM_WERT = (RXBUF_UINT(2)/100.0f);
+    float STAT_RBC_DSG_KWH_KM_WERT = pidval[0].value;
         // On-board computer average speed in 0.01 [km / h] / Reisebordcomputer Durchschnittsgeschwindigkeit in 0,01
         // [km/h]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "KOMBI_BC_RBC_KWH_KM", "STAT_RBC_DSG_KWH_KM_WERT", STAT_RBC_DSG_KWH_KM_WERT, "\"km/h\"");
     // Can't process STAT_RBC_ABFAHRT_KWH_KM_WERT - don't know type string[2] (offset 4)
     // Can't process STAT_RBC_DAUER_KWH_KM_WERT - don't know type string[2] (offset 6)
-    unsigned short STAT_RBC_STRECKE_KWH_KM_WERT = (RXBUF_UINT(8));
+    unsigned short STAT_RBC_STRECKE_KWH_KM_WERT = pidval[1].raw;
         // On-board computer route in 1 [km] / Reisebordcomputer Strecke in 1 [km]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "KOM", "KOMBI_BC_RBC_KWH_KM", "STAT_RBC_STRECKE_KWH_KM_WERT", STAT_RBC_STRECKE_KWH_KM_WERT, "\"km\"");
 
     // ==========  Add your processing here ==========
     ESP_LOGD(TAG, "BC departure time %d:%d, travel time %d:%d", RXBUF_UCHAR(4), RXBUF_UCHAR(5), RXBUF_UCHAR(6), RXBUF_UCHAR(6));
@@ -907,24 +866,21 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_REICHWEITE_MCV", 8);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned short STAT_ECO_MODE_REICHWEITE_WERT = (RXBUF_UINT(0));
+    unsigned short STAT_ECO_MODE_REICHWEITE_WERT = pidval[0].raw;
         // Eco-mode range / Eco-Mode-reichweite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "KOM", "REICHWEITE_MCV", "STAT_ECO_MODE_REICHWEITE_WERT", STAT_ECO_MODE_REICHWEITE_WERT, "\"km\"");
 
-    unsigned short STAT_COMFORT_MODE_REICHWEITE_WERT = (RXBUF_UINT(2));
+    unsigned short STAT_COMFORT_MODE_REICHWEITE_WERT = pidval[1].raw;
         // Comfort mode range (CRW) / Comfort-Mode Reichweite (CRW)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "KOM", "REICHWEITE_MCV", "STAT_COMFORT_MODE_REICHWEITE_WERT", STAT_COMFORT_MODE_REICHWEITE_WERT, "\"km\"");
 
     // Definition seems to be wrong: float STAT_BC_REICHWEITE_WERT = (RXBUF_UINT(4)/10.0f);
-    unsigned int STAT_BC_REICHWEITE_WERT = (RXBUF_UINT(4));
+    unsigned int STAT_BC_REICHWEITE_WERT = pidval[2].raw;
         // BC range / BC-Reichweite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "KOM", "REICHWEITE_MCV", "STAT_BC_REICHWEITE_WERT", STAT_BC_REICHWEITE_WERT, "\"km\"");
 
     // Definition seems to be wrong: float STAT_ECO_PRO_PLUS_REICHWEITE_WERT = (RXBUF_UINT(6)/10.0f);
-    unsigned int STAT_ECO_PRO_PLUS_REICHWEITE_WERT = (RXBUF_UINT(6));
+    unsigned int STAT_ECO_PRO_PLUS_REICHWEITE_WERT = pidval[3].raw;
         // ECO Pro + range / ECO Pro+ Reichweite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "KOM", "REICHWEITE_MCV", "STAT_ECO_PRO_PLUS_REICHWEITE_WERT", STAT_ECO_PRO_PLUS_REICHWEITE_WERT, "\"km\"");
 
     // ==========  Add your processing here ==========
     mt_i3_range_bc->SetValue(STAT_BC_REICHWEITE_WERT, Kilometers);
@@ -941,54 +897,43 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KOM_SEGMENTDATEN_SPEICHER", 210);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_BLOCK_01_SEGMENT_ID_WERT = (RXBUF_UCHAR(0));
+    unsigned char STAT_BLOCK_01_SEGMENT_ID_WERT = pidval[0].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_SEGMENT_ID_WERT", STAT_BLOCK_01_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_01_TAG_WERT = (RXBUF_UCHAR(1));
+    unsigned char STAT_BLOCK_01_TAG_WERT = pidval[1].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_TAG_WERT", STAT_BLOCK_01_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_01_MONAT_WERT = (RXBUF_UCHAR(2));
+    unsigned char STAT_BLOCK_01_MONAT_WERT = pidval[2].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_MONAT_WERT", STAT_BLOCK_01_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_01_JAHR_WERT = (RXBUF_UCHAR(3)+2000.0);
+    unsigned char STAT_BLOCK_01_JAHR_WERT = pidval[3].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_JAHR_WERT", STAT_BLOCK_01_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_01_STUNDE_WERT = (RXBUF_UCHAR(4));
+    unsigned char STAT_BLOCK_01_STUNDE_WERT = pidval[4].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_STUNDE_WERT", STAT_BLOCK_01_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_01_MINUTE_WERT = (RXBUF_UCHAR(5));
+    unsigned char STAT_BLOCK_01_MINUTE_WERT = pidval[5].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_MINUTE_WERT", STAT_BLOCK_01_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_01_A_TEMP_WERT = (RXBUF_UCHAR(9)*0.5f-40.0);
+    float STAT_BLOCK_01_A_TEMP_WERT = pidval[6].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_A_TEMP_WERT", STAT_BLOCK_01_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_01_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(10)/2.0f);
+    float STAT_BLOCK_01_AKT_DAUER_ECO_WERT = pidval[7].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_AKT_DAUER_ECO_WERT", STAT_BLOCK_01_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(11)/2.0f);
+    float STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[8].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_01_SOC_WERT = (RXBUF_UCHAR(12)/2.0f);
+    float STAT_BLOCK_01_SOC_WERT = pidval[9].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_SOC_WERT", STAT_BLOCK_01_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_01_REKUPERATION_WERT = (RXBUF_UCHAR(16));
+    unsigned char STAT_BLOCK_01_REKUPERATION_WERT = pidval[10].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_REKUPERATION_WERT", STAT_BLOCK_01_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(17)/2.0f);
+    float STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT = pidval[11].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_01_STERNE = (RXBUF_UCHAR(20));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -998,53 +943,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_01_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_01_STERNE", (unsigned long)BF_BLOCK_01_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_02_SEGMENT_ID_WERT = (RXBUF_UCHAR(21));
+    unsigned char STAT_BLOCK_02_SEGMENT_ID_WERT = pidval[12].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_SEGMENT_ID_WERT", STAT_BLOCK_02_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_02_TAG_WERT = (RXBUF_UCHAR(22));
+    unsigned char STAT_BLOCK_02_TAG_WERT = pidval[13].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_TAG_WERT", STAT_BLOCK_02_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_02_MONAT_WERT = (RXBUF_UCHAR(23));
+    unsigned char STAT_BLOCK_02_MONAT_WERT = pidval[14].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_MONAT_WERT", STAT_BLOCK_02_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_02_JAHR_WERT = (RXBUF_UCHAR(24)+2000.0);
+    unsigned char STAT_BLOCK_02_JAHR_WERT = pidval[15].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_JAHR_WERT", STAT_BLOCK_02_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_02_STUNDE_WERT = (RXBUF_UCHAR(25));
+    unsigned char STAT_BLOCK_02_STUNDE_WERT = pidval[16].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_STUNDE_WERT", STAT_BLOCK_02_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_02_MINUTE_WERT = (RXBUF_UCHAR(26));
+    unsigned char STAT_BLOCK_02_MINUTE_WERT = pidval[17].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_MINUTE_WERT", STAT_BLOCK_02_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_02_A_TEMP_WERT = (RXBUF_UCHAR(30)*0.5f-40.0);
+    float STAT_BLOCK_02_A_TEMP_WERT = pidval[18].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_A_TEMP_WERT", STAT_BLOCK_02_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_02_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(31)/2.0f);
+    float STAT_BLOCK_02_AKT_DAUER_ECO_WERT = pidval[19].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_AKT_DAUER_ECO_WERT", STAT_BLOCK_02_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(32)/2.0f);
+    float STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[20].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_02_SOC_WERT = (RXBUF_UCHAR(33)/2.0f);
+    float STAT_BLOCK_02_SOC_WERT = pidval[21].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_SOC_WERT", STAT_BLOCK_02_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_02_REKUPERATION_WERT = (RXBUF_UCHAR(37));
+    unsigned char STAT_BLOCK_02_REKUPERATION_WERT = pidval[22].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_REKUPERATION_WERT", STAT_BLOCK_02_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(38)/2.0f);
+    float STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT = pidval[23].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_02_STERNE = (RXBUF_UCHAR(41));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1054,53 +987,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_02_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_02_STERNE", (unsigned long)BF_BLOCK_02_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_03_SEGMENT_ID_WERT = (RXBUF_UCHAR(42));
+    unsigned char STAT_BLOCK_03_SEGMENT_ID_WERT = pidval[24].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_SEGMENT_ID_WERT", STAT_BLOCK_03_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_03_TAG_WERT = (RXBUF_UCHAR(43));
+    unsigned char STAT_BLOCK_03_TAG_WERT = pidval[25].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_TAG_WERT", STAT_BLOCK_03_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_03_MONAT_WERT = (RXBUF_UCHAR(44));
+    unsigned char STAT_BLOCK_03_MONAT_WERT = pidval[26].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_MONAT_WERT", STAT_BLOCK_03_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_03_JAHR_WERT = (RXBUF_UCHAR(45)+2000.0);
+    unsigned char STAT_BLOCK_03_JAHR_WERT = pidval[27].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_JAHR_WERT", STAT_BLOCK_03_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_03_STUNDE_WERT = (RXBUF_UCHAR(46));
+    unsigned char STAT_BLOCK_03_STUNDE_WERT = pidval[28].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_STUNDE_WERT", STAT_BLOCK_03_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_03_MINUTE_WERT = (RXBUF_UCHAR(47));
+    unsigned char STAT_BLOCK_03_MINUTE_WERT = pidval[29].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_MINUTE_WERT", STAT_BLOCK_03_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_03_A_TEMP_WERT = (RXBUF_UCHAR(51)*0.5f-40.0);
+    float STAT_BLOCK_03_A_TEMP_WERT = pidval[30].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_A_TEMP_WERT", STAT_BLOCK_03_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_03_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(52)/2.0f);
+    float STAT_BLOCK_03_AKT_DAUER_ECO_WERT = pidval[31].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_AKT_DAUER_ECO_WERT", STAT_BLOCK_03_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(53)/2.0f);
+    float STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[32].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_03_SOC_WERT = (RXBUF_UCHAR(54)/2.0f);
+    float STAT_BLOCK_03_SOC_WERT = pidval[33].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_SOC_WERT", STAT_BLOCK_03_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_03_REKUPERATION_WERT = (RXBUF_UCHAR(58));
+    unsigned char STAT_BLOCK_03_REKUPERATION_WERT = pidval[34].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_REKUPERATION_WERT", STAT_BLOCK_03_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(59)/2.0f);
+    float STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT = pidval[35].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_03_STERNE = (RXBUF_UCHAR(62));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1110,53 +1031,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_03_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_03_STERNE", (unsigned long)BF_BLOCK_03_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_04_SEGMENT_ID_WERT = (RXBUF_UCHAR(63));
+    unsigned char STAT_BLOCK_04_SEGMENT_ID_WERT = pidval[36].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_SEGMENT_ID_WERT", STAT_BLOCK_04_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_04_TAG_WERT = (RXBUF_UCHAR(64));
+    unsigned char STAT_BLOCK_04_TAG_WERT = pidval[37].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_TAG_WERT", STAT_BLOCK_04_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_04_MONAT_WERT = (RXBUF_UCHAR(65));
+    unsigned char STAT_BLOCK_04_MONAT_WERT = pidval[38].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_MONAT_WERT", STAT_BLOCK_04_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_04_JAHR_WERT = (RXBUF_UCHAR(66)+2000.0);
+    unsigned char STAT_BLOCK_04_JAHR_WERT = pidval[39].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_JAHR_WERT", STAT_BLOCK_04_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_04_STUNDE_WERT = (RXBUF_UCHAR(67));
+    unsigned char STAT_BLOCK_04_STUNDE_WERT = pidval[40].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_STUNDE_WERT", STAT_BLOCK_04_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_04_MINUTE_WERT = (RXBUF_UCHAR(68));
+    unsigned char STAT_BLOCK_04_MINUTE_WERT = pidval[41].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_MINUTE_WERT", STAT_BLOCK_04_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_04_A_TEMP_WERT = (RXBUF_UCHAR(72)*0.5f-40.0);
+    float STAT_BLOCK_04_A_TEMP_WERT = pidval[42].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_A_TEMP_WERT", STAT_BLOCK_04_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_04_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(73)/2.0f);
+    float STAT_BLOCK_04_AKT_DAUER_ECO_WERT = pidval[43].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_AKT_DAUER_ECO_WERT", STAT_BLOCK_04_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(74)/2.0f);
+    float STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[44].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_04_SOC_WERT = (RXBUF_UCHAR(75)/2.0f);
+    float STAT_BLOCK_04_SOC_WERT = pidval[45].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_SOC_WERT", STAT_BLOCK_04_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_04_REKUPERATION_WERT = (RXBUF_UCHAR(79));
+    unsigned char STAT_BLOCK_04_REKUPERATION_WERT = pidval[46].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_REKUPERATION_WERT", STAT_BLOCK_04_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(80)/2.0f);
+    float STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT = pidval[47].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_04_STERNE = (RXBUF_UCHAR(83));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1166,53 +1075,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_04_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_04_STERNE", (unsigned long)BF_BLOCK_04_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_05_SEGMENT_ID_WERT = (RXBUF_UCHAR(84));
+    unsigned char STAT_BLOCK_05_SEGMENT_ID_WERT = pidval[48].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_SEGMENT_ID_WERT", STAT_BLOCK_05_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_05_TAG_WERT = (RXBUF_UCHAR(85));
+    unsigned char STAT_BLOCK_05_TAG_WERT = pidval[49].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_TAG_WERT", STAT_BLOCK_05_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_05_MONAT_WERT = (RXBUF_UCHAR(86));
+    unsigned char STAT_BLOCK_05_MONAT_WERT = pidval[50].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_MONAT_WERT", STAT_BLOCK_05_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_05_JAHR_WERT = (RXBUF_UCHAR(87)+2000.0);
+    unsigned char STAT_BLOCK_05_JAHR_WERT = pidval[51].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_JAHR_WERT", STAT_BLOCK_05_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_05_STUNDE_WERT = (RXBUF_UCHAR(88));
+    unsigned char STAT_BLOCK_05_STUNDE_WERT = pidval[52].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_STUNDE_WERT", STAT_BLOCK_05_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_05_MINUTE_WERT = (RXBUF_UCHAR(89));
+    unsigned char STAT_BLOCK_05_MINUTE_WERT = pidval[53].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_MINUTE_WERT", STAT_BLOCK_05_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_05_A_TEMP_WERT = (RXBUF_UCHAR(93)*0.5f-40.0);
+    float STAT_BLOCK_05_A_TEMP_WERT = pidval[54].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_A_TEMP_WERT", STAT_BLOCK_05_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_05_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(94)/2.0f);
+    float STAT_BLOCK_05_AKT_DAUER_ECO_WERT = pidval[55].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_AKT_DAUER_ECO_WERT", STAT_BLOCK_05_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(95)/2.0f);
+    float STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[56].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_05_SOC_WERT = (RXBUF_UCHAR(96)/2.0f);
+    float STAT_BLOCK_05_SOC_WERT = pidval[57].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_SOC_WERT", STAT_BLOCK_05_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_05_REKUPERATION_WERT = (RXBUF_UCHAR(100));
+    unsigned char STAT_BLOCK_05_REKUPERATION_WERT = pidval[58].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_REKUPERATION_WERT", STAT_BLOCK_05_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(101)/2.0f);
+    float STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT = pidval[59].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_05_STERNE = (RXBUF_UCHAR(104));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1222,53 +1119,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_05_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_05_STERNE", (unsigned long)BF_BLOCK_05_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_06_SEGMENT_ID_WERT = (RXBUF_UCHAR(105));
+    unsigned char STAT_BLOCK_06_SEGMENT_ID_WERT = pidval[60].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_SEGMENT_ID_WERT", STAT_BLOCK_06_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_06_TAG_WERT = (RXBUF_UCHAR(106));
+    unsigned char STAT_BLOCK_06_TAG_WERT = pidval[61].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_TAG_WERT", STAT_BLOCK_06_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_06_MONAT_WERT = (RXBUF_UCHAR(107));
+    unsigned char STAT_BLOCK_06_MONAT_WERT = pidval[62].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_MONAT_WERT", STAT_BLOCK_06_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_06_JAHR_WERT = (RXBUF_UCHAR(108)+2000.0);
+    unsigned char STAT_BLOCK_06_JAHR_WERT = pidval[63].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_JAHR_WERT", STAT_BLOCK_06_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_06_STUNDE_WERT = (RXBUF_UCHAR(109));
+    unsigned char STAT_BLOCK_06_STUNDE_WERT = pidval[64].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_STUNDE_WERT", STAT_BLOCK_06_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_06_MINUTE_WERT = (RXBUF_UCHAR(110));
+    unsigned char STAT_BLOCK_06_MINUTE_WERT = pidval[65].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_MINUTE_WERT", STAT_BLOCK_06_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_06_A_TEMP_WERT = (RXBUF_UCHAR(114)*0.5f-40.0);
+    float STAT_BLOCK_06_A_TEMP_WERT = pidval[66].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_A_TEMP_WERT", STAT_BLOCK_06_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_06_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(115)/2.0f);
+    float STAT_BLOCK_06_AKT_DAUER_ECO_WERT = pidval[67].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_AKT_DAUER_ECO_WERT", STAT_BLOCK_06_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(116)/2.0f);
+    float STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[68].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_06_SOC_WERT = (RXBUF_UCHAR(117)/2.0f);
+    float STAT_BLOCK_06_SOC_WERT = pidval[69].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_SOC_WERT", STAT_BLOCK_06_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_06_REKUPERATION_WERT = (RXBUF_UCHAR(121));
+    unsigned char STAT_BLOCK_06_REKUPERATION_WERT = pidval[70].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_REKUPERATION_WERT", STAT_BLOCK_06_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(122)/2.0f);
+    float STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT = pidval[71].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_06_STERNE = (RXBUF_UCHAR(125));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1278,53 +1163,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_06_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_06_STERNE", (unsigned long)BF_BLOCK_06_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_07_SEGMENT_ID_WERT = (RXBUF_UCHAR(126));
+    unsigned char STAT_BLOCK_07_SEGMENT_ID_WERT = pidval[72].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_SEGMENT_ID_WERT", STAT_BLOCK_07_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_07_TAG_WERT = (RXBUF_UCHAR(127));
+    unsigned char STAT_BLOCK_07_TAG_WERT = pidval[73].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_TAG_WERT", STAT_BLOCK_07_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_07_MONAT_WERT = (RXBUF_UCHAR(128));
+    unsigned char STAT_BLOCK_07_MONAT_WERT = pidval[74].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_MONAT_WERT", STAT_BLOCK_07_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_07_JAHR_WERT = (RXBUF_UCHAR(129)+2000.0);
+    unsigned char STAT_BLOCK_07_JAHR_WERT = pidval[75].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_JAHR_WERT", STAT_BLOCK_07_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_07_STUNDE_WERT = (RXBUF_UCHAR(130));
+    unsigned char STAT_BLOCK_07_STUNDE_WERT = pidval[76].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_STUNDE_WERT", STAT_BLOCK_07_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_07_MINUTE_WERT = (RXBUF_UCHAR(131));
+    unsigned char STAT_BLOCK_07_MINUTE_WERT = pidval[77].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_MINUTE_WERT", STAT_BLOCK_07_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_07_A_TEMP_WERT = (RXBUF_UCHAR(135)*0.5f-40.0);
+    float STAT_BLOCK_07_A_TEMP_WERT = pidval[78].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_A_TEMP_WERT", STAT_BLOCK_07_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_07_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(136)/2.0f);
+    float STAT_BLOCK_07_AKT_DAUER_ECO_WERT = pidval[79].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_AKT_DAUER_ECO_WERT", STAT_BLOCK_07_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(137)/2.0f);
+    float STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[80].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_07_SOC_WERT = (RXBUF_UCHAR(138)/2.0f);
+    float STAT_BLOCK_07_SOC_WERT = pidval[81].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_SOC_WERT", STAT_BLOCK_07_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_07_REKUPERATION_WERT = (RXBUF_UCHAR(142));
+    unsigned char STAT_BLOCK_07_REKUPERATION_WERT = pidval[82].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_REKUPERATION_WERT", STAT_BLOCK_07_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(143)/2.0f);
+    float STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT = pidval[83].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_07_STERNE = (RXBUF_UCHAR(146));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1334,53 +1207,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_07_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_07_STERNE", (unsigned long)BF_BLOCK_07_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_08_SEGMENT_ID_WERT = (RXBUF_UCHAR(147));
+    unsigned char STAT_BLOCK_08_SEGMENT_ID_WERT = pidval[84].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_SEGMENT_ID_WERT", STAT_BLOCK_08_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_08_TAG_WERT = (RXBUF_UCHAR(148));
+    unsigned char STAT_BLOCK_08_TAG_WERT = pidval[85].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_TAG_WERT", STAT_BLOCK_08_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_08_MONAT_WERT = (RXBUF_UCHAR(149));
+    unsigned char STAT_BLOCK_08_MONAT_WERT = pidval[86].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_MONAT_WERT", STAT_BLOCK_08_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_08_JAHR_WERT = (RXBUF_UCHAR(150)+2000.0);
+    unsigned char STAT_BLOCK_08_JAHR_WERT = pidval[87].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_JAHR_WERT", STAT_BLOCK_08_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_08_STUNDE_WERT = (RXBUF_UCHAR(151));
+    unsigned char STAT_BLOCK_08_STUNDE_WERT = pidval[88].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_STUNDE_WERT", STAT_BLOCK_08_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_08_MINUTE_WERT = (RXBUF_UCHAR(152));
+    unsigned char STAT_BLOCK_08_MINUTE_WERT = pidval[89].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_MINUTE_WERT", STAT_BLOCK_08_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_08_A_TEMP_WERT = (RXBUF_UCHAR(156)*0.5f-40.0);
+    float STAT_BLOCK_08_A_TEMP_WERT = pidval[90].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_A_TEMP_WERT", STAT_BLOCK_08_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_08_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(157)/2.0f);
+    float STAT_BLOCK_08_AKT_DAUER_ECO_WERT = pidval[91].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_AKT_DAUER_ECO_WERT", STAT_BLOCK_08_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(158)/2.0f);
+    float STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[92].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_08_SOC_WERT = (RXBUF_UCHAR(159)/2.0f);
+    float STAT_BLOCK_08_SOC_WERT = pidval[93].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_SOC_WERT", STAT_BLOCK_08_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_08_REKUPERATION_WERT = (RXBUF_UCHAR(163));
+    unsigned char STAT_BLOCK_08_REKUPERATION_WERT = pidval[94].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_REKUPERATION_WERT", STAT_BLOCK_08_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(164)/2.0f);
+    float STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT = pidval[95].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_08_STERNE = (RXBUF_UCHAR(167));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1390,53 +1251,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_08_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_08_STERNE", (unsigned long)BF_BLOCK_08_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_09_SEGMENT_ID_WERT = (RXBUF_UCHAR(168));
+    unsigned char STAT_BLOCK_09_SEGMENT_ID_WERT = pidval[96].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_SEGMENT_ID_WERT", STAT_BLOCK_09_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_09_TAG_WERT = (RXBUF_UCHAR(169));
+    unsigned char STAT_BLOCK_09_TAG_WERT = pidval[97].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_TAG_WERT", STAT_BLOCK_09_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_09_MONAT_WERT = (RXBUF_UCHAR(170));
+    unsigned char STAT_BLOCK_09_MONAT_WERT = pidval[98].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_MONAT_WERT", STAT_BLOCK_09_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_09_JAHR_WERT = (RXBUF_UCHAR(171)+2000.0);
+    unsigned char STAT_BLOCK_09_JAHR_WERT = pidval[99].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_JAHR_WERT", STAT_BLOCK_09_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_09_STUNDE_WERT = (RXBUF_UCHAR(172));
+    unsigned char STAT_BLOCK_09_STUNDE_WERT = pidval[100].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_STUNDE_WERT", STAT_BLOCK_09_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_09_MINUTE_WERT = (RXBUF_UCHAR(173));
+    unsigned char STAT_BLOCK_09_MINUTE_WERT = pidval[101].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_MINUTE_WERT", STAT_BLOCK_09_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_09_A_TEMP_WERT = (RXBUF_UCHAR(177)*0.5f-40.0);
+    float STAT_BLOCK_09_A_TEMP_WERT = pidval[102].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_A_TEMP_WERT", STAT_BLOCK_09_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_09_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(178)/2.0f);
+    float STAT_BLOCK_09_AKT_DAUER_ECO_WERT = pidval[103].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_AKT_DAUER_ECO_WERT", STAT_BLOCK_09_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(179)/2.0f);
+    float STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[104].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_09_SOC_WERT = (RXBUF_UCHAR(180)/2.0f);
+    float STAT_BLOCK_09_SOC_WERT = pidval[105].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_SOC_WERT", STAT_BLOCK_09_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_09_REKUPERATION_WERT = (RXBUF_UCHAR(184));
+    unsigned char STAT_BLOCK_09_REKUPERATION_WERT = pidval[106].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_REKUPERATION_WERT", STAT_BLOCK_09_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(185)/2.0f);
+    float STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT = pidval[107].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_09_STERNE = (RXBUF_UCHAR(188));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1446,53 +1295,41 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_BLOCK_09_STERNE_BREMSEN: Mask: 0x38 - Stars for brakes
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "BF_BLOCK_09_STERNE", (unsigned long)BF_BLOCK_09_STERNE, "\"Bit\"");
 
-    unsigned char STAT_BLOCK_10_SEGMENT_ID_WERT = (RXBUF_UCHAR(189));
+    unsigned char STAT_BLOCK_10_SEGMENT_ID_WERT = pidval[108].raw;
         // Segment ID / Segment ID
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_SEGMENT_ID_WERT", STAT_BLOCK_10_SEGMENT_ID_WERT, "");
 
-    unsigned char STAT_BLOCK_10_TAG_WERT = (RXBUF_UCHAR(190));
+    unsigned char STAT_BLOCK_10_TAG_WERT = pidval[109].raw;
         // Day / Tag
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_TAG_WERT", STAT_BLOCK_10_TAG_WERT, "");
 
-    unsigned char STAT_BLOCK_10_MONAT_WERT = (RXBUF_UCHAR(191));
+    unsigned char STAT_BLOCK_10_MONAT_WERT = pidval[110].raw;
         // month / Monat
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_MONAT_WERT", STAT_BLOCK_10_MONAT_WERT, "");
 
-    unsigned char STAT_BLOCK_10_JAHR_WERT = (RXBUF_UCHAR(192)+2000.0);
+    unsigned char STAT_BLOCK_10_JAHR_WERT = pidval[111].value;
         // year / Jahr
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_JAHR_WERT", STAT_BLOCK_10_JAHR_WERT, "");
 
-    unsigned char STAT_BLOCK_10_STUNDE_WERT = (RXBUF_UCHAR(193));
+    unsigned char STAT_BLOCK_10_STUNDE_WERT = pidval[112].raw;
         // hour / Stunde
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_STUNDE_WERT", STAT_BLOCK_10_STUNDE_WERT, "\"h\"");
 
-    unsigned char STAT_BLOCK_10_MINUTE_WERT = (RXBUF_UCHAR(194));
+    unsigned char STAT_BLOCK_10_MINUTE_WERT = pidval[113].raw;
         // minute / Minute
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_MINUTE_WERT", STAT_BLOCK_10_MINUTE_WERT, "\"min\"");
 
-    float STAT_BLOCK_10_A_TEMP_WERT = (RXBUF_UCHAR(198)*0.5f-40.0);
+    float STAT_BLOCK_10_A_TEMP_WERT = pidval[114].value;
         // Outside temperature [-40 to + 50 � C] / Außentemperatur [-40 bis +50°C]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_A_TEMP_WERT", STAT_BLOCK_10_A_TEMP_WERT, "\"°C\"");
 
-    float STAT_BLOCK_10_AKT_DAUER_ECO_WERT = (RXBUF_UCHAR(199)/2.0f);
+    float STAT_BLOCK_10_AKT_DAUER_ECO_WERT = pidval[115].value;
         // Act. Duration ECO [0-100%] / Akt.-Dauer ECO [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_AKT_DAUER_ECO_WERT", STAT_BLOCK_10_AKT_DAUER_ECO_WERT, "\"%\"");
 
-    float STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT = (RXBUF_UCHAR(200)/2.0f);
+    float STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT = pidval[116].value;
         // Act. Duration ECO + or sport [0-100%] / Akt.-Dauer ECO+  oder Sport [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT", STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT, "\"%\"");
 
-    float STAT_BLOCK_10_SOC_WERT = (RXBUF_UCHAR(201)/2.0f);
+    float STAT_BLOCK_10_SOC_WERT = pidval[117].value;
         // SOC [0-100%] in 0.5% steps / SOC [0-100%] in 0,5 % Schritten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_SOC_WERT", STAT_BLOCK_10_SOC_WERT, "\"%\"");
 
-    unsigned char STAT_BLOCK_10_REKUPERATION_WERT = (RXBUF_UCHAR(205));
+    unsigned char STAT_BLOCK_10_REKUPERATION_WERT = pidval[118].raw;
         // Recuperation [0-255 kWh] / Rekuperation [0-255 kWh]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_REKUPERATION_WERT", STAT_BLOCK_10_REKUPERATION_WERT, "\"kWh\"");
 
-    float STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT = (RXBUF_UCHAR(206)/2.0f);
+    float STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT = pidval[119].value;
         // Share of e-driving vs. Incinerator [0-100%] / Anteil E-Fahren vs. Verbrenner [0-100%]
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT", STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT, "\"%\"");
 
     unsigned char BF_BLOCK_10_STERNE = (RXBUF_UCHAR(209));
         // Bitfield 1: stars for acceleration, stars for braking / Bitfield 1: Sterne für Beschleunigung, Sterne für
@@ -1515,71 +1352,56 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG", 25);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    float STAT_SOC_HVB_WERT = (RXBUF_UINT(0)*0.1f);
+    float STAT_SOC_HVB_WERT = pidval[0].value;
         // HV battery charge level / Ladezustand HV Batterie
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_SOC_HVB_WERT", STAT_SOC_HVB_WERT, "\"%\"");
 
-    float STAT_SOC_HVB_MIN_WERT = (RXBUF_UCHAR(2)*0.5f);
+    float STAT_SOC_HVB_MIN_WERT = pidval[1].value;
         // Startability limit, state of charge HV battery / Startfähigkeitsgrenze Ladezustand HV Batterie
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_SOC_HVB_MIN_WERT", STAT_SOC_HVB_MIN_WERT, "\"%\"");
 
-    unsigned char STAT_LADEGERAET = (RXBUF_UCHAR(3));
+    unsigned char STAT_LADEGERAET = pidval[2].raw;
         // Charger recognized (1 = recognized / 0 = not recognized) / Ladegerät erkannt (1 = erkannt / 0 = nicht
         // erkannt)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_LADEGERAET", STAT_LADEGERAET, "\"0/1\"");
 
-    unsigned char STAT_FREMDLADUNG = (RXBUF_UCHAR(4));
+    unsigned char STAT_FREMDLADUNG = pidval[3].raw;
         // External charge (1 = recognized / 0 = not recognized) / Fremdladung (1 = erkannt / 0 = nicht erkannt)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_FREMDLADUNG", STAT_FREMDLADUNG, "\"0/1\"");
 
-    unsigned char STAT_FAHRB = (RXBUF_UCHAR(5));
+    unsigned char STAT_FAHRB = pidval[4].raw;
         // Ready to drive (1 = active / 0 = not active) / Fahrbereitschaft (1 = aktiv / 0 = nicht aktiv)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_FAHRB", STAT_FAHRB, "\"0/1\"");
 
-    unsigned char STAT_BA_DCDC_KOMM_NR = (RXBUF_UCHAR(6));
+    unsigned char STAT_BA_DCDC_KOMM_NR = pidval[5].raw;
         // Commanded DC / DC converter operating mode / Kommandierte Betriebsart DC/DC Wandler
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_BA_DCDC_KOMM_NR", STAT_BA_DCDC_KOMM_NR, "\"0-n\"");
 
-    float STAT_I_DCDC_HV_OUT_WERT = (RXBUF_SINT(7)*0.1f);
+    float STAT_I_DCDC_HV_OUT_WERT = pidval[6].value;
         // Current limit HV side / Stromgrenze HV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_HV_OUT_WERT", STAT_I_DCDC_HV_OUT_WERT, "\"A\"");
 
-    float STAT_U_DCDC_HV_OUT_WERT = (RXBUF_UINT(9)*0.1f);
+    float STAT_U_DCDC_HV_OUT_WERT = pidval[7].value;
         // Voltage limit HV side / Spannungsgrenze HV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_HV_OUT_WERT", STAT_U_DCDC_HV_OUT_WERT, "\"V\"");
 
-    float STAT_I_DCDC_LV_OUT_WERT = (RXBUF_SINT(11)*0.1f);
+    float STAT_I_DCDC_LV_OUT_WERT = pidval[8].value;
         // Current limit NV side / Stromgrenze NV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_LV_OUT_WERT", STAT_I_DCDC_LV_OUT_WERT, "\"A\"");
 
-    float STAT_U_DCDC_LV_OUT_WERT = (RXBUF_UINT(13)*0.01f);
+    float STAT_U_DCDC_LV_OUT_WERT = pidval[9].value;
         // Voltage limit NV side / Spannungsgrenze NV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_LV_OUT_WERT", STAT_U_DCDC_LV_OUT_WERT, "\"V\"");
 
-    unsigned char STAT_BA_DCDC_IST_NR = (RXBUF_UCHAR(15));
+    unsigned char STAT_BA_DCDC_IST_NR = pidval[10].raw;
         // ACTUAL operating mode DCDC converter / IST-Betriebsart DCDC-Wandler
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_BA_DCDC_IST_NR", STAT_BA_DCDC_IST_NR, "\"0-n\"");
 
-    float STAT_ALS_DCDC_WERT = (RXBUF_UCHAR(16)*0.5f);
+    float STAT_ALS_DCDC_WERT = pidval[11].value;
         // DC / DC converter utilization / Auslastung DC/DC-Wandler
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_ALS_DCDC_WERT", STAT_ALS_DCDC_WERT, "\"%\"");
 
-    float STAT_I_DCDC_HV_WERT = (RXBUF_SINT(17)*0.1f);
+    float STAT_I_DCDC_HV_WERT = pidval[12].value;
         // Current HV side / Strom HV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_HV_WERT", STAT_I_DCDC_HV_WERT, "\"A\"");
 
-    float STAT_U_DCDC_HV_WERT = (RXBUF_UINT(19)*0.1f);
+    float STAT_U_DCDC_HV_WERT = pidval[13].value;
         // Voltage HV side / Spannung HV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_HV_WERT", STAT_U_DCDC_HV_WERT, "\"V\"");
 
-    float STAT_I_DCDC_LV_WERT = (RXBUF_SINT(21)*0.1f);
+    float STAT_I_DCDC_LV_WERT = pidval[14].value;
         // Electricity NV side / Strom NV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_LV_WERT", STAT_I_DCDC_LV_WERT, "\"A\"");
 
-    float STAT_U_DCDC_LV_WERT = (RXBUF_UINT(23)*0.01f);
+    float STAT_U_DCDC_LV_WERT = pidval[15].value;
         // Voltage NV side / Spannung NV-Seite
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_LV_WERT", STAT_U_DCDC_LV_WERT, "\"V\"");
 
     // ==========  Add your processing here ==========
     mt_i3_charge_actual->SetValue(STAT_SOC_HVB_WERT, Percentage);
@@ -1593,26 +1415,22 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_EME_AE_STROM_EMASCHINE", 10);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    float STAT_STROM_AC_EFF_W_WERT = (RXBUF_SINT(0)*0.0625f);
+    float STAT_STROM_AC_EFF_W_WERT = pidval[0].value;
         // Effective supply current phase W / Effektiver Zuleitungsstrom Phase W
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_STROM_EMASCHINE", "STAT_STROM_AC_EFF_W_WERT", STAT_STROM_AC_EFF_W_WERT, "\"A\"");
 
-    float STAT_STROM_AC_EFF_V_WERT = (RXBUF_SINT(2)*0.0625f);
+    float STAT_STROM_AC_EFF_V_WERT = pidval[1].value;
         // Effective supply current phase V / Effektiver Zuleitungsstrom Phase V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_STROM_EMASCHINE", "STAT_STROM_AC_EFF_V_WERT", STAT_STROM_AC_EFF_V_WERT, "\"A\"");
 
-    float STAT_STROM_AC_EFF_U_WERT = (RXBUF_SINT(4)*0.0625f);
+    float STAT_STROM_AC_EFF_U_WERT = pidval[2].value;
         // Effective supply current phase U / Effektiver Zuleitungsstrom Phase U
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_STROM_EMASCHINE", "STAT_STROM_AC_EFF_U_WERT", STAT_STROM_AC_EFF_U_WERT, "\"A\"");
 
-    float STAT_ERREGERSTROM_WERT = (RXBUF_SINT(6)*0.0625f);
+    float STAT_ERREGERSTROM_WERT = pidval[3].value;
         // Current excitation current / Aktueller Erregerstrom
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_STROM_EMASCHINE", "STAT_ERREGERSTROM_WERT", STAT_ERREGERSTROM_WERT, "\"A\"");
 
-    float STAT_STROM_DC_HV_UMRICHTER_EM_WERT = (RXBUF_SINT(8)*0.1f);
+    float STAT_STROM_DC_HV_UMRICHTER_EM_WERT = pidval[4].value;
         // HV-DC current of the converter for the EM stator / HV-DC Strom des Umrichters für den EM-Stator
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_STROM_EMASCHINE", "STAT_STROM_DC_HV_UMRICHTER_EM_WERT", STAT_STROM_DC_HV_UMRICHTER_EM_WERT, "\"A\"");
 
     // ==========  Add your processing here ==========
     hexdump(rxbuf, job.type, job.pid);
@@ -1625,52 +1443,38 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_EME_AE_TEMP_LE", 30);
         break;
     }
-    float STAT_TEMP_UMRICHTER_PHASE_U_WERT = (RXBUF_SINT(0)*0.0156f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_TEMP_UMRICHTER_PHASE_U_WERT = pidval[0].value;
         // Temperature converter phase U / Temperatur Umrichter Phase U
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_PHASE_U_WERT", STAT_TEMP_UMRICHTER_PHASE_U_WERT, "\"°C\"");
-    float STAT_TEMP_UMRICHTER_PHASE_V_WERT = (RXBUF_SINT(2)*0.0156f);
+    float STAT_TEMP_UMRICHTER_PHASE_V_WERT = pidval[1].value;
         // Temperature converter phase V / Temperatur Umrichter Phase V
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_PHASE_V_WERT", STAT_TEMP_UMRICHTER_PHASE_V_WERT, "\"°C\"");
-    float STAT_TEMP_UMRICHTER_PHASE_W_WERT = (RXBUF_SINT(4)*0.0156f);
+    float STAT_TEMP_UMRICHTER_PHASE_W_WERT = pidval[2].value;
         // Temperature converter phase W / Temperatur Umrichter Phase W
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_PHASE_W_WERT", STAT_TEMP_UMRICHTER_PHASE_W_WERT, "\"°C\"");
-    float STAT_TEMP_UMRICHTER_GT_WERT = (RXBUF_SINT(6)*0.0156f);
+    float STAT_TEMP_UMRICHTER_GT_WERT = pidval[3].value;
         // Temperature inverter gate driver / Temperatur Inverter Gatedriver
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_GT_WERT", STAT_TEMP_UMRICHTER_GT_WERT, "\"°C\"");
-    float STAT_TEMP_DCDC_BO_WERT = (RXBUF_SINT(8)*0.0156f);
+    float STAT_TEMP_DCDC_BO_WERT = pidval[4].value;
         // Temperature of the DCDC board / Temperatur des DCDC Boards
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_BO_WERT", STAT_TEMP_DCDC_BO_WERT, "\"°C\"");
-    float STAT_TEMP_DCDC_GTW_WERT = (RXBUF_SINT(10)*0.0156f);
+    float STAT_TEMP_DCDC_GTW_WERT = pidval[5].value;
         // Temperature DC / DC push-pull converter / Temperatur DC/DC-Gegentaktwandler
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_GTW_WERT", STAT_TEMP_DCDC_GTW_WERT, "\"°C\"");
-    float STAT_TEMP_DCDC_TS_WERT = (RXBUF_SINT(12)*0.0156f);
+    float STAT_TEMP_DCDC_TS_WERT = pidval[6].value;
         // Temperature DC / DC buck converter / Temperatur DC/DC-Tiefsetzer
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_TS_WERT", STAT_TEMP_DCDC_TS_WERT, "\"°C\"");
-    float STAT_TEMP_DCDC_GR_WERT = (RXBUF_SINT(14)*0.0156f);
+    float STAT_TEMP_DCDC_GR_WERT = pidval[7].value;
         // Temperature of the DCDC board / Temperatur des DCDC Boards
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_GR_WERT", STAT_TEMP_DCDC_GR_WERT, "\"°C\"");
-    float STAT_TEMP_SLE_PFC_WERT = (RXBUF_SINT(16)*0.0156f);
+    float STAT_TEMP_SLE_PFC_WERT = pidval[8].value;
         // Temperature SLE-PowerFactorCorrection / Temperatur SLE-PowerFactorCorrection
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_PFC_WERT", STAT_TEMP_SLE_PFC_WERT, "\"°C\"");
-    float STAT_TEMP_SLE_GR_WERT = (RXBUF_SINT(18)*0.0156f);
+    float STAT_TEMP_SLE_GR_WERT = pidval[9].value;
         // Temperature SLE rectifier / Temperatur SLE-Gleichrichter
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_GR_WERT", STAT_TEMP_SLE_GR_WERT, "\"°C\"");
-    float STAT_TEMP_SLE_GTW_WERT = (RXBUF_SINT(20)*0.0156f);
+    float STAT_TEMP_SLE_GTW_WERT = pidval[10].value;
         // Temperature SLE push-pull converter / Temperatur SLE-Gegentaktwandler
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_GTW_WERT", STAT_TEMP_SLE_GTW_WERT, "\"°C\"");
-    float STAT_TEMP_SLE_BO_WERT = (RXBUF_SINT(22)*0.0156f);
+    float STAT_TEMP_SLE_BO_WERT = pidval[11].value;
         // Temperature of the SLE board / Temperatur des SLE Boards
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_BO_WERT", STAT_TEMP_SLE_BO_WERT, "\"°C\"");
-    float STAT_TEMP_ELUP_LE_WERT = (RXBUF_SINT(24)*0.0156f);
+    float STAT_TEMP_ELUP_LE_WERT = pidval[12].value;
         // Temperature on the power board - measuring point ELUP power output stage / Temperatur auf dem Powerbord -
         // Messstelle ELUP Leistungsendstufe
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_ELUP_LE_WERT", STAT_TEMP_ELUP_LE_WERT, "\"°C\"");
-    float STAT_TEMP_PROZESSOR_MC0_WERT = (RXBUF_SINT(26)*0.0156f);
+    float STAT_TEMP_PROZESSOR_MC0_WERT = pidval[13].value;
         // Temperature processor MC0 / Temperatur Prozessor MC0
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_PROZESSOR_MC0_WERT", STAT_TEMP_PROZESSOR_MC0_WERT, "\"°C\"");
-    float STAT_TEMP_PROZESSOR_MC2_WERT = (RXBUF_SINT(28)*0.0156f);
+    float STAT_TEMP_PROZESSOR_MC2_WERT = pidval[14].value;
         // Temperature processor MC2 / Temperatur Prozessor MC2
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_LE", "STAT_TEMP_PROZESSOR_MC2_WERT", STAT_TEMP_PROZESSOR_MC2_WERT, "\"°C\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_inv_temp->SetValue(
@@ -1693,12 +1497,11 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_EME_AE_TEMP_EMASCHINE", 4);
         break;
     }
-    float STAT_TEMP1_E_MOTOR_WERT = (RXBUF_SINT(0)*0.0156f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_TEMP1_E_MOTOR_WERT = pidval[0].value;
         // E-motor temperature 1 / E-Motor Temperatur 1
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_EMASCHINE", "STAT_TEMP1_E_MOTOR_WERT", STAT_TEMP1_E_MOTOR_WERT, "\"°C\"");
-    float STAT_TEMP2_E_MOTOR_WERT = (RXBUF_SINT(2)*0.0156f);
+    float STAT_TEMP2_E_MOTOR_WERT = pidval[1].value;
         // E-motor temperature 2 / E-Motor Temperatur 2
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_TEMP_EMASCHINE", "STAT_TEMP2_E_MOTOR_WERT", STAT_TEMP2_E_MOTOR_WERT, "\"°C\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_mot_temp->SetValue(max(STAT_TEMP1_E_MOTOR_WERT, STAT_TEMP2_E_MOTOR_WERT), Celcius);
@@ -1711,21 +1514,15 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_EME_AE_ELEKTRISCHE_MASCHINE", 7);
         break;
     }
-    float STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT = (RXBUF_UINT(0)*0.5f-5000.0);
-        // Speed of the electric machine / Drehzahl der E-Maschine
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT", STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT, "\"1/min\"");
-    float STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT = (RXBUF_SINT(2)*0.5f);
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
+    float STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT = pidval[1].value;
         // IS the moment of the e-machine / IST Moment der E-Maschine (moment?  torque?)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT", STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT, "\"Nm\"");
-    float STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT = (RXBUF_SINT(4)*0.5f);
+    float STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT = pidval[2].value;
         // SHOULD moment of the electric machine / SOLL Moment der E-Maschine
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT", STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT, "\"Nm\"");
-    unsigned char STAT_ELEKTRISCHE_BETRIEBSART_NR = (RXBUF_UCHAR(6));
+    unsigned char STAT_ELEKTRISCHE_BETRIEBSART_NR = pidval[3].raw;
         // current operating mode of the e-machine / aktuelle Betriebsart der E-Maschine
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_BETRIEBSART_NR", STAT_ELEKTRISCHE_BETRIEBSART_NR, "\"0-n\"");
 
     // ==========  Add your processing here ==========
-    StdMetrics.ms_v_mot_rpm->SetValue(STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT, Other);
 
     break;
   }
@@ -1737,35 +1534,29 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_NBT_STATUS_SPEED", 14);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    short STAT_WHEEL1_SENSOR_SPEED_WERT = (RXBUF_SINT(0));
+    short STAT_WHEEL1_SENSOR_SPEED_WERT = pidval[0].raw;
         // Speed on bike 1 / Geschwindigkeit am Rad 1
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "NBT", "STATUS_SPEED", "STAT_WHEEL1_SENSOR_SPEED_WERT", STAT_WHEEL1_SENSOR_SPEED_WERT, "\"km/h\"");
 
-    short STAT_WHEEL2_SENSOR_SPEED_WERT = (RXBUF_SINT(2));
+    short STAT_WHEEL2_SENSOR_SPEED_WERT = pidval[1].raw;
         // Speed on bike 2 / Geschwindigkeit am Rad 2
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "NBT", "STATUS_SPEED", "STAT_WHEEL2_SENSOR_SPEED_WERT", STAT_WHEEL2_SENSOR_SPEED_WERT, "\"km/h\"");
 
-    short STAT_WHEEL3_SENSOR_SPEED_WERT = (RXBUF_SINT(4));
+    short STAT_WHEEL3_SENSOR_SPEED_WERT = pidval[2].raw;
         // Speed on the bike 3 / Geschwindigkeit am Rad 3
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "NBT", "STATUS_SPEED", "STAT_WHEEL3_SENSOR_SPEED_WERT", STAT_WHEEL3_SENSOR_SPEED_WERT, "\"km/h\"");
 
-    short STAT_WHEEL4_SENSOR_SPEED_WERT = (RXBUF_SINT(6));
+    short STAT_WHEEL4_SENSOR_SPEED_WERT = pidval[3].raw;
         // Speed on the bike 4 / Geschwindigkeit am Rad 4
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "NBT", "STATUS_SPEED", "STAT_WHEEL4_SENSOR_SPEED_WERT", STAT_WHEEL4_SENSOR_SPEED_WERT, "\"km/h\"");
 
-    short STAT_COMBINED_SENSOR_SPEED_WERT = (RXBUF_SINT(8));
+    short STAT_COMBINED_SENSOR_SPEED_WERT = pidval[4].raw;
         // Combined speed of the wheel sensors / Kombinierte Geschwindigkeit der Radsensoren
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "NBT", "STATUS_SPEED", "STAT_COMBINED_SENSOR_SPEED_WERT", STAT_COMBINED_SENSOR_SPEED_WERT, "\"km/h\"");
 
-    short STAT_GPS_SPEED_WERT = (RXBUF_SINT(10));
+    short STAT_GPS_SPEED_WERT = pidval[5].raw;
         // Speed based on the GPS signal. / Geschwindigkeit basierend auf das GPS-Signal.
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "NBT", "STATUS_SPEED", "STAT_GPS_SPEED_WERT", STAT_GPS_SPEED_WERT, "\"km/h\"");
 
-    unsigned short STAT_SPEED_DIFFERENCE_PERCENT_WERT = (RXBUF_UINT(12));
+    unsigned short STAT_SPEED_DIFFERENCE_PERCENT_WERT = pidval[6].raw;
         // Difference in percent between the speeds that were recorded with the wheel sensors or GPS / Abweichung in
         // Prozent zwischen den Geschwindigkeiten, die mit den Radsensoren bzw. mittels GPS erfasst wurden
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "NBT", "STATUS_SPEED", "STAT_SPEED_DIFFERENCE_PERCENT_WERT", STAT_SPEED_DIFFERENCE_PERCENT_WERT, "\"%\"");
 
     // ==========  Add your processing here ==========
     // TODO: Which wheel is which?
@@ -1784,14 +1575,13 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_NBT_STATUS_DIRECTION", 2);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_DIRECTION = (RXBUF_SCHAR(0));
+    unsigned char STAT_DIRECTION = pidval[0].raw;
         // Current gear position see TGearType / aktuelle Gangstellung siehe TGearType
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "NBT", "STATUS_DIRECTION", "STAT_DIRECTION", STAT_DIRECTION, "\"0-n\"");
 
-    unsigned char STAT_DIRECTION_SOURCE = (RXBUF_UCHAR(1));
+    unsigned char STAT_DIRECTION_SOURCE = pidval[1].raw;
         // see table TDirectionSource / siehe Tabelle TDirectionSource
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "NBT", "STATUS_DIRECTION", "STAT_DIRECTION_SOURCE", STAT_DIRECTION_SOURCE, "\"0-n\"");
 
     // ==========  Add your processing here ==========
     // 0: reverse, 1: drive, 2: neutral/park (find park status elsewhere)
@@ -1807,42 +1597,34 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_FZD_DWA_KLAPPENKONTAKTE", 12);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_KONTAKT_FAHRERTUER_NR = (RXBUF_UCHAR(0));
+    unsigned char STAT_KONTAKT_FAHRERTUER_NR = pidval[0].raw;
         // Contact driver's door / Kontakt Fahrertür
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_FAHRERTUER_NR", STAT_KONTAKT_FAHRERTUER_NR, "\"0-n\"");
 
-    unsigned char STAT_KONTAKT_BEIFAHRERTUER_NR = (RXBUF_UCHAR(1));
+    unsigned char STAT_KONTAKT_BEIFAHRERTUER_NR = pidval[1].raw;
         // Contact passenger door / Kontakt Beifahrertür
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_BEIFAHRERTUER_NR", STAT_KONTAKT_BEIFAHRERTUER_NR, "\"0-n\"");
 
-    unsigned char STAT_KONTAKT_FAHRERTUER_HINTEN_NR = (RXBUF_UCHAR(2));
+    unsigned char STAT_KONTAKT_FAHRERTUER_HINTEN_NR = pidval[2].raw;
         // Contact at the rear of the driver's door / Kontakt Fahrertür hinten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_FAHRERTUER_HINTEN_NR", STAT_KONTAKT_FAHRERTUER_HINTEN_NR, "\"0-n\"");
 
-    unsigned char STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR = (RXBUF_UCHAR(3));
+    unsigned char STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR = pidval[3].raw;
         // Contact rear passenger door / Kontakt Beifahrertür hinten
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR", STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR, "\"0-n\"");
 
-    unsigned char STAT_KONTAKT_MOTORHAUBE_NR = (RXBUF_UCHAR(4));
+    unsigned char STAT_KONTAKT_MOTORHAUBE_NR = pidval[4].raw;
         // Contact bonnet / Kontakt Motorhaube
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_MOTORHAUBE_NR", STAT_KONTAKT_MOTORHAUBE_NR, "\"0-n\"");
 
-    unsigned char STAT_KONTAKT_HECKKLAPPE_NR = (RXBUF_UCHAR(5));
+    unsigned char STAT_KONTAKT_HECKKLAPPE_NR = pidval[5].raw;
         // Contact tailgate / Kontakt Heckklappe
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_HECKKLAPPE_NR", STAT_KONTAKT_HECKKLAPPE_NR, "\"0-n\"");
 
-    unsigned char STAT_KONTAKT_HECKSCHEIBE_NR = (RXBUF_UCHAR(6));
+    unsigned char STAT_KONTAKT_HECKSCHEIBE_NR = pidval[6].raw;
         // Contact rear window / Kontakt Heckscheibe
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_HECKSCHEIBE_NR", STAT_KONTAKT_HECKSCHEIBE_NR, "\"0-n\"");
 
-    unsigned char STAT_ZV_NR = (RXBUF_UCHAR(7));
+    unsigned char STAT_ZV_NR = pidval[7].raw;
         // Central locking status / Status Zentralverriegelung
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_ZV_NR", STAT_ZV_NR, "\"0-n\"");
 
-    unsigned long STAT_RESERVE_WERT = (RXBUF_UINT32(8));
+    unsigned long STAT_RESERVE_WERT = pidval[8].raw;
         // Reserve (not yet occupied) / Reserve (noch nicht belegt)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lu%s\n", "FZD", "DWA_KLAPPENKONTAKTE", "STAT_RESERVE_WERT", STAT_RESERVE_WERT, "\"HEX\"");
 
     // ==========  Add your processing here ==========
     //FIXME: which is the driver's side?  My car is RHD and so the front right is the drivers door
@@ -1865,10 +1647,10 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET", 16);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    float STAT_NETZFREQUENZ_PHASE_1_WERT = (RXBUF_UCHAR(0)/4.0f);
+    float STAT_NETZFREQUENZ_PHASE_1_WERT = pidval[0].value;
         // Current grid frequency phase 1 / Aktuelle Netzfrequenz Phase 1
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_NETZFREQUENZ_PHASE_1_WERT", STAT_NETZFREQUENZ_PHASE_1_WERT, "\"Hz\"");
 
     unsigned char BF_LADEGERAET_DERATING = (RXBUF_UCHAR(1));
         // Reason for derating / Grund für Derating
@@ -1882,13 +1664,11 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_DERATING_BIT6: Mask: 0x40 - Reserved
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "BF_LADEGERAET_DERATING", (unsigned long)BF_LADEGERAET_DERATING, "\"Bit\"");
 
-    float STAT_LEISTUNG_DERATING_WERT = (RXBUF_UINT(2)*10.0f);
+    float STAT_LEISTUNG_DERATING_WERT = pidval[1].value;
         // Derating performance / Derating Leistung
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_LEISTUNG_DERATING_WERT", STAT_LEISTUNG_DERATING_WERT, "\"W\"");
 
-    unsigned char STAT_DERATING_WERT = (RXBUF_UCHAR(4));
+    unsigned char STAT_DERATING_WERT = pidval[2].raw;
         // Derating / Derating
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_DERATING_WERT", STAT_DERATING_WERT, "\"%\"");
 
     unsigned char BF_LADEGERAET_FEHLERZUSTAND_UCXII = (RXBUF_UCHAR(5));
         // Charger fault conditions / Ladegerät Fehlerzustände
@@ -1923,17 +1703,14 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
             // STAT_URSACHE_LADEUNTERBRECHUNG_BIT2: Mask: 0x04 - Connector not locked: 0 = not active; 1 = active
     ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%lx%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG", (unsigned long)BF_LADEGERAET_URSACHE_LADEUNTERBRECHUNG, "\"Bit\"");
 
-    unsigned char STAT_BETRIEBSART_NR = (RXBUF_UCHAR(9));
+    unsigned char STAT_BETRIEBSART_NR = pidval[3].raw;
         // Operating mode / Betriebsart
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_BETRIEBSART_NR", STAT_BETRIEBSART_NR, "\"0-n\"");
 
-    float STAT_NETZFREQUENZ_PHASE_2_WERT = (RXBUF_UCHAR(10)/4.0f);
+    float STAT_NETZFREQUENZ_PHASE_2_WERT = pidval[4].value;
         // Current grid frequency phase 2 / Aktuelle Netzfrequenz Phase 2
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_NETZFREQUENZ_PHASE_2_WERT", STAT_NETZFREQUENZ_PHASE_2_WERT, "\"Hz\"");
 
-    float STAT_NETZFREQUENZ_PHASE_3_WERT = (RXBUF_UCHAR(11)/4.0f);
+    float STAT_NETZFREQUENZ_PHASE_3_WERT = pidval[5].value;
         // Current grid frequency phase 3 / Aktuelle Netzfrequenz Phase 3
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_NETZFREQUENZ_PHASE_3_WERT", STAT_NETZFREQUENZ_PHASE_3_WERT, "\"Hz\"");
 
     unsigned long BF_MOD_ERR = (RXBUF_UINT32(12));
         // Error states load module / Fehlerzustände Lademodul
@@ -2027,18 +1804,16 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KLE_LADEGERAET_LEISTUNG", 4);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT = (RXBUF_UCHAR(0));
+    unsigned char STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT = pidval[0].raw;
         // Charge cycle efficiency / Wirkungsgrad Ladezyklus
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KLE", "LADEGERAET_LEISTUNG", "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT", STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT, "\"%\"");
 
-    unsigned char STAT_WIRKUNGSGRAD_DC_WERT = (RXBUF_UCHAR(1));
+    unsigned char STAT_WIRKUNGSGRAD_DC_WERT = pidval[1].raw;
         // Efficiency DC / Wirkungsgrad DC
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "KLE", "LADEGERAET_LEISTUNG", "STAT_WIRKUNGSGRAD_DC_WERT", STAT_WIRKUNGSGRAD_DC_WERT, "\"%\"");
 
-    unsigned short STAT_LADEGERAET_DC_HV_LEISTUNG_WERT = (RXBUF_UINT(2));
+    unsigned short STAT_LADEGERAET_DC_HV_LEISTUNG_WERT = pidval[2].raw;
         // Instantaneous power output in the intermediate circuit / Abgegebende Momentanleistung in den Zwischenkreis
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "KLE", "LADEGERAET_LEISTUNG", "STAT_LADEGERAET_DC_HV_LEISTUNG_WERT", STAT_LADEGERAET_DC_HV_LEISTUNG_WERT, "\"W\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_charge_efficiency->SetValue(STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT, Percentage); // Seemed very low in my sample though
@@ -2051,34 +1826,28 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KLE_LADEGERAET_SPANNUNG", 12);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned short STAT_SPANNUNG_RMS_AC_PHASE_1_WERT = (RXBUF_UINT(0));
+    unsigned short STAT_SPANNUNG_RMS_AC_PHASE_1_WERT = pidval[0].raw;
         // RMS values of the AC conductor voltages (phase 1) / Effektivwerte der AC Leiterspannungen (Phase1)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT", STAT_SPANNUNG_RMS_AC_PHASE_1_WERT, "\"V\"");
 
-    float STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT = (RXBUF_UINT(2)/10.0f);
+    float STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT = pidval[1].value;
         // HV DC voltage upper limit / HV DC Spannungsobergrenze
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT", STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT, "\"V\"");
 
-    float STAT_SPANNUNG_DC_HV_WERT = (RXBUF_UINT(4)/10.0f);
+    float STAT_SPANNUNG_DC_HV_WERT = pidval[2].value;
         // HV DC voltage / HV DC Spannung
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_DC_HV_WERT", STAT_SPANNUNG_DC_HV_WERT, "\"V\"");
 
-    float STAT_SPANNUNG_KL30_WERT = (RXBUF_UCHAR(6)/10.0f);
+    float STAT_SPANNUNG_KL30_WERT = pidval[3].value;
         // KL30 voltage / KL30 Spannung
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_KL30_WERT", STAT_SPANNUNG_KL30_WERT, "\"V\"");
 
-    float STAT_SPANNUNG_KL30C_WERT = (RXBUF_UCHAR(7)/10.0f);
+    float STAT_SPANNUNG_KL30C_WERT = pidval[4].value;
         // KL30C voltage / KL30C Spannung
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_KL30C_WERT", STAT_SPANNUNG_KL30C_WERT, "\"V\"");
 
-    unsigned short STAT_SPANNUNG_RMS_AC_PHASE_2_WERT = (RXBUF_UINT(8));
+    unsigned short STAT_SPANNUNG_RMS_AC_PHASE_2_WERT = pidval[5].raw;
         // RMS values of the AC conductor voltages (phase 2) / Effektivwerte der AC Leiterspannungen (Phase 2)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_RMS_AC_PHASE_2_WERT", STAT_SPANNUNG_RMS_AC_PHASE_2_WERT, "\"V\"");
 
-    unsigned short STAT_SPANNUNG_RMS_AC_PHASE_3_WERT = (RXBUF_UINT(10));
+    unsigned short STAT_SPANNUNG_RMS_AC_PHASE_3_WERT = pidval[6].raw;
         // RMS values of the AC conductor voltages (phase 3) / Effektivwerte der AC Leiterspannungen (Phase 3)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_RMS_AC_PHASE_3_WERT", STAT_SPANNUNG_RMS_AC_PHASE_3_WERT, "\"V\"");
 
     // ==========  Add your processing here ==========
     if (STAT_SPANNUNG_RMS_AC_PHASE_2_WERT > STAT_SPANNUNG_RMS_AC_PHASE_1_WERT-25) {
@@ -2107,34 +1876,28 @@ case I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_KLE_LADEGERAET_STROM", 14);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    float STAT_STROM_AC_PHASE_1_WERT = (RXBUF_UINT(0)/10.0f);
+    float STAT_STROM_AC_PHASE_1_WERT = pidval[0].value;
         // AC current phase 1 / AC Strom Phase 1
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_PHASE_1_WERT", STAT_STROM_AC_PHASE_1_WERT, "\"A\"");
 
-    float STAT_STROM_AC_MAX_GESPEICHERT_WERT = (RXBUF_UINT(2)/10.0f);
+    float STAT_STROM_AC_MAX_GESPEICHERT_WERT = pidval[1].value;
         // Maximum stored AC current / Maximal gespeicherter AC Strom
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_MAX_GESPEICHERT_WERT", STAT_STROM_AC_MAX_GESPEICHERT_WERT, "\"A\"");
 
-    float STAT_STROM_HV_DC_WERT = (RXBUF_UINT(4)/10.0f-204.7);
+    float STAT_STROM_HV_DC_WERT = pidval[2].value;
         // HV DC electricity / HV DC Strom
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_STROM", "STAT_STROM_HV_DC_WERT", STAT_STROM_HV_DC_WERT, "\"A\"");
 
-    float STAT_STROM_HV_DC_MAX_LIMIT_WERT = (RXBUF_UINT(6)/10.0f);
+    float STAT_STROM_HV_DC_MAX_LIMIT_WERT = pidval[3].value;
         // Maximum permitted HV DC current / Maximal erlaubter HV DC Strom
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_STROM", "STAT_STROM_HV_DC_MAX_LIMIT_WERT", STAT_STROM_HV_DC_MAX_LIMIT_WERT, "\"A\"");
 
-    float STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT = (RXBUF_UINT(8)/10.0f-204.7);
+    float STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT = pidval[4].value;
         // Maximum stored DC current / Maximal gespeicherter DC Strom
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_STROM", "STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT", STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT, "\"A\"");
 
-    float STAT_STROM_AC_PHASE_2_WERT = (RXBUF_UINT(10)/10.0f);
+    float STAT_STROM_AC_PHASE_2_WERT = pidval[5].value;
         // AC current phase 2 / AC Strom Phase 2
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_PHASE_2_WERT", STAT_STROM_AC_PHASE_2_WERT, "\"A\"");
 
-    float STAT_STROM_AC_PHASE_3_WERT = (RXBUF_UINT(12)/10.0f);
+    float STAT_STROM_AC_PHASE_3_WERT = pidval[6].value;
         // AC current phase 3 / AC Strom Phase 3
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_PHASE_3_WERT", STAT_STROM_AC_PHASE_3_WERT, "\"A\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_charge_current->SetValue(STAT_STROM_AC_PHASE_1_WERT+STAT_STROM_AC_PHASE_2_WERT+STAT_STROM_AC_PHASE_3_WERT, Amps);
@@ -2183,18 +1946,16 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_EDM_PEDALWERTGEBER", 6);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    float STAT_SPANNUNG_PEDALWERT1_WERT = (RXBUF_UINT(0)*0.0049f);
+    float STAT_SPANNUNG_PEDALWERT1_WERT = pidval[0].value;
         // Voltage measured at pedal encoder 1 / Spannung gemessen am Pedalwertgeber 1
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EDM", "PEDALWERTGEBER", "STAT_SPANNUNG_PEDALWERT1_WERT", STAT_SPANNUNG_PEDALWERT1_WERT, "\"V\"");
 
-    float STAT_SPANNUNG_PEDALWERT2_WERT = (RXBUF_UINT(2)*0.0049f);
+    float STAT_SPANNUNG_PEDALWERT2_WERT = pidval[1].value;
         // Voltage measured at the pedal encoder 2 / Spannung gemessen am Pedalwertgeber 2
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EDM", "PEDALWERTGEBER", "STAT_SPANNUNG_PEDALWERT2_WERT", STAT_SPANNUNG_PEDALWERT2_WERT, "\"V\"");
 
-    float STAT_PEDALWERT_WERT = (RXBUF_UINT(4)*0.0625f);
+    float STAT_PEDALWERT_WERT = pidval[2].value;
         // Pedal value determined from pedal value sensors 1 and 2 / Aus Pedalwertgeber 1 und 2 ermittelter Pedalwert
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EDM", "PEDALWERTGEBER", "STAT_PEDALWERT_WERT", STAT_PEDALWERT_WERT, "\"%\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_env_throttle->SetValue(STAT_PEDALWERT_WERT);
@@ -2250,11 +2011,11 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_LIM_LADEBEREITSCHAFT_LIM", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_LADEBEREITSCHAFT_LIM = (RXBUF_UCHAR(0));
+    unsigned char STAT_LADEBEREITSCHAFT_LIM = pidval[0].raw;
         // Ready to charge (HW line), (1 = yes, 0 = no) sent from LIM to SLE / Ladebereitschaft (HW-Leitung), (1 = ja, 0
         // = nein) vom LIM an SLE gesendet
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "LADEBEREITSCHAFT_LIM", "STAT_LADEBEREITSCHAFT_LIM", STAT_LADEBEREITSCHAFT_LIM, "\"0/1\"");
 
     // ==========  Add your processing here ==========
     mt_i3_v_charge_readytocharge->SetValue(STAT_LADEBEREITSCHAFT_LIM);
@@ -2267,31 +2028,26 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_LIM_PILOTSIGNAL", 7);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_PILOT_AKTIV = (RXBUF_UCHAR(0));
+    unsigned char STAT_PILOT_AKTIV = pidval[0].raw;
         // State of the pilot signal (0 = not active, 1 = active) / Zustand des Pilotsignals (0 = nicht aktiv, 1 = aktiv)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "PILOTSIGNAL", "STAT_PILOT_AKTIV", STAT_PILOT_AKTIV, "\"0/1\"");
 
-    unsigned char STAT_PILOT_PWM_DUTYCYCLE_WERT = (RXBUF_UCHAR(1));
+    unsigned char STAT_PILOT_PWM_DUTYCYCLE_WERT = pidval[1].raw;
         // Pulse duty factor PWM pilot signal / Tastverhältnis PWM Pilotsignal
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "PILOTSIGNAL", "STAT_PILOT_PWM_DUTYCYCLE_WERT", STAT_PILOT_PWM_DUTYCYCLE_WERT, "\"%\"");
 
-    unsigned char STAT_PILOT_CURRENT_WERT = (RXBUF_UCHAR(2));
+    unsigned char STAT_PILOT_CURRENT_WERT = pidval[2].raw;
         // Current value calculated from the pilot signal / Errechneter Stromwert aus Pilotsignal
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "PILOTSIGNAL", "STAT_PILOT_CURRENT_WERT", STAT_PILOT_CURRENT_WERT, "\"A\"");
 
-    unsigned char STAT_PILOT_LADEBEREIT = (RXBUF_UCHAR(3));
+    unsigned char STAT_PILOT_LADEBEREIT = pidval[3].raw;
         // Vehicle ready to charge state (0 = not ready to charge, 1 = ready to charge) / Zustand Ladebereitschaft
         // Fahrzeug (0 = nicht ladebereit, 1 = ladebereit)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "PILOTSIGNAL", "STAT_PILOT_LADEBEREIT", STAT_PILOT_LADEBEREIT, "\"0/1\"");
 
-    unsigned short STAT_PILOT_FREQUENZ_WERT = (RXBUF_UINT(4));
+    unsigned short STAT_PILOT_FREQUENZ_WERT = pidval[4].raw;
         // Frequency of the pilot signal / Frequenz des Pilotsignals
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%u%s\n", "LIM", "PILOTSIGNAL", "STAT_PILOT_FREQUENZ_WERT", STAT_PILOT_FREQUENZ_WERT, "\"Hz\"");
 
-    float STAT_PILOT_PEGEL_WERT = (RXBUF_UCHAR(6)/10.0f);
+    float STAT_PILOT_PEGEL_WERT = pidval[5].value;
         // Pilot signal level / Pegel des Pilotsignals
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "LIM", "PILOTSIGNAL", "STAT_PILOT_PEGEL_WERT", STAT_PILOT_PEGEL_WERT, "\"V\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_charge_pilot->SetValue(STAT_PILOT_AKTIV);
@@ -2305,14 +2061,13 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_LIM_PROXIMITY", 2);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_STECKER_NR = (RXBUF_UCHAR(0));
+    unsigned char STAT_STECKER_NR = pidval[0].raw;
         // Condition of the plug / Zustand des Steckers
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "PROXIMITY", "STAT_STECKER_NR", STAT_STECKER_NR, "\"0-n\"");
 
-    unsigned char STAT_STROMTRAGFAEHIGKEIT_WERT = (RXBUF_UCHAR(1));
+    unsigned char STAT_STROMTRAGFAEHIGKEIT_WERT = pidval[1].raw;
         // Current carrying capacity of the connected cable / Stromtragfähigkeit des angeschlossenen Kabels
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "PROXIMITY", "STAT_STROMTRAGFAEHIGKEIT_WERT", STAT_STROMTRAGFAEHIGKEIT_WERT, "\"A\"");
 
     // ==========  Add your processing here ==========
     mt_i3_v_charge_plugstatus->SetValue(
@@ -2331,26 +2086,23 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO", 4);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_CHARGE_CONTROL_1 = (RXBUF_UCHAR(0));
+    unsigned char STAT_CHARGE_CONTROL_1 = pidval[0].raw;
         // Charge control status 1 line (0 = not active, 1 = active) / Zustand Charge control 1 Leitung (0 = nicht aktiv,
         // 1 = aktiv)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_CHARGE_CONTROL_1", STAT_CHARGE_CONTROL_1, "\"0/1\"");
 
-    unsigned char STAT_CHARGE_CONTROL_2 = (RXBUF_UCHAR(1));
+    unsigned char STAT_CHARGE_CONTROL_2 = pidval[1].raw;
         // Charge control status 2 line (0 = not active, 1 = active) / Zustand Charge control 2 Leitung (0 = nicht aktiv,
         // 1 = aktiv)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_CHARGE_CONTROL_2", STAT_CHARGE_CONTROL_2, "\"0/1\"");
 
-    unsigned char STAT_CHARGE_PERMISSION = (RXBUF_UCHAR(2));
+    unsigned char STAT_CHARGE_PERMISSION = pidval[2].raw;
         // Charge permission line status (0 = not active, 1 = active) / Zustand Charge Permission Leitung (0 = nicht
         // aktiv, 1 = aktiv)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_CHARGE_PERMISSION", STAT_CHARGE_PERMISSION, "\"0/1\"");
 
-    unsigned char STAT_LADESTECKER = (RXBUF_UCHAR(3));
+    unsigned char STAT_LADESTECKER = pidval[3].raw;
         // State of charging plug (0 = not plugged in, 1 = plugged in) / Zustand Ladestecker (0 = nicht gesteckt, 1 =
         // gesteckt)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_LADESTECKER", STAT_LADESTECKER, "\"0/1\"");
 
     // ==========  Add your processing here ==========
     // FIXME: these don't work?
@@ -2365,10 +2117,10 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_LIM_DC_SCHUETZ_SCHALTER", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_DC_SCHUETZ_SCHALTER = (RXBUF_UCHAR(0));
+    unsigned char STAT_DC_SCHUETZ_SCHALTER = pidval[0].raw;
         // Contactor switch status (DC charging) / Status Schützschalter (DC-Laden)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "DC_SCHUETZ_SCHALTER", "STAT_DC_SCHUETZ_SCHALTER", STAT_DC_SCHUETZ_SCHALTER, "\"0-n\"");
 
     // ==========  Add your processing here ==========
     mt_i3_v_charge_dc_contactorstatus->SetValue(
@@ -2404,11 +2156,11 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_LIM_DC_PINABDECKUNG_COMBO", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_DC_PINABDECKUNG = (RXBUF_UCHAR(0));
+    unsigned char STAT_DC_PINABDECKUNG = pidval[0].raw;
         // State of the DC pin cover for combo socket (0 = closed, 1 = open) / Zustand der DC Pinabdeckung bei
         // Combo-Steckdose (0 = geschlossen, 1 = geöffnet)
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "LIM", "DC_PINABDECKUNG_COMBO", "STAT_DC_PINABDECKUNG", STAT_DC_PINABDECKUNG, "\"0/1\"");
 
     // ==========  Add your processing here ==========
     // FIXME: doesn't seem to work
@@ -2428,10 +2180,10 @@ case I3_PID_EDM_PEDALWERTGEBER: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_BDC_HANDBREMSE_KONTAKT", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_HANDBREMSE_KONTAKT_EIN = (RXBUF_UCHAR(0));
+    unsigned char STAT_HANDBREMSE_KONTAKT_EIN = pidval[0].raw;
         // 0: handbrake released; 1: handbrake applied / 0: Handbremse gelöst; 1: Handbremse angezogen
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "BDC", "HANDBREMSE_KONTAKT", "STAT_HANDBREMSE_KONTAKT_EIN", STAT_HANDBREMSE_KONTAKT_EIN, "\"0/1\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_env_handbrake->SetValue(STAT_HANDBREMSE_KONTAKT_EIN);
@@ -2455,10 +2207,10 @@ case I3_PID_IHX_TEMP_INNEN_UNBELUEFTET: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_IHX_TEMP_INNEN_UNBELUEFTET", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    char STAT_TEMP_INNEN_WERT = (RXBUF_SCHAR(0));
+    char STAT_TEMP_INNEN_WERT = pidval[0].raw;
         // Calculated internal temperature / Errechnete Innentemperatur
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%d%s\n", "IHX", "TEMP_INNEN_UNBELUEFTET", "STAT_TEMP_INNEN_WERT", STAT_TEMP_INNEN_WERT, "\"°C\"");
 
     // ==========  Add your processing here ==========
     if (STAT_TEMP_INNEN_WERT <= 60) {
@@ -2490,20 +2242,19 @@ case I3_PID_IHX_TEMP_INNEN_UNBELUEFTET: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE", 2);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR = (RXBUF_UCHAR(0));
+    unsigned char STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR = pidval[0].raw;
         // 1 = DOWN; 2 = CENTER; 3 = CENTER_BOTTOM; 4 = UP; 5 = TOP_UNTEN (driver only); 6 = TOP_MITTE; 7 =
         // TOP_MITTE_BOTTOM; 8 = AUTO; 32 = INDIVIDUAL; 40 = SPECIAL PROGRAM; 255 = INVALID (BASE); / 1=UNTEN; 2=MITTE;
         // 3=MITTE_UNTEN; 4=OBEN; 5=OBEN_UNTEN (Nur Fahrer); 6=OBEN_MITTE; 7=OBEN_MITTE_UNTEN; 8=AUTO; 32=INDIVIDUAL;
         // 40=SONDERPROGRAMM; 255=UNGUELTIG (BASIS);
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "IHX", "KLIMA_VORN_LUFTVERTEILUNG_LI_RE", "STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR", STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR, "\"0-n\"");
 
-    unsigned char STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR = (RXBUF_UCHAR(1));
+    unsigned char STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR = pidval[1].raw;
         // 1 = DOWN; 2 = CENTER; 3 = CENTER_BOTTOM; 4 = UP; 5 = TOP_UNTEN (driver only); 6 = TOP_MITTE; 7 =
         // TOP_MITTE_BOTTOM; 8 = AUTO; 32 = INDIVIDUAL; 40 = SPECIAL PROGRAM; 255 = INVALID (BASE); / 1=UNTEN; 2=MITTE;
         // 3=MITTE_UNTEN; 4=OBEN; 5=OBEN_UNTEN (Nur Fahrer); 6=OBEN_MITTE; 7=OBEN_MITTE_UNTEN; 8=AUTO; 32=INDIVIDUAL;
         // 40=SONDERPROGRAMM; 255=UNGUELTIG (BASIS);
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "IHX", "KLIMA_VORN_LUFTVERTEILUNG_LI_RE", "STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR", STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR, "\"0-n\"");
 
     // ==========  Add your processing here ==========
     // v.e.cabinvent                            feet,face                Cabin vent type (comma-separated list of feet, face, screen, etc)
@@ -2530,12 +2281,12 @@ case I3_PID_IHX_TEMP_INNEN_UNBELUEFTET: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_IHX_KLIMA_VORN_OFF_EIN", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_KLIMA_VORN_OFF_EIN = (RXBUF_UCHAR(0));
+    unsigned char STAT_KLIMA_VORN_OFF_EIN = pidval[0].raw;
         // Function status air conditioning OFF: 0 = OFF = air conditioning is switched on, LED is off 1 = ON = air
         // conditioning is switched off, LED is on / Funktionsstatus Klima OFF: 0 = AUS = Klima ist eingeschaltet, LED
         // ist aus 1 = EIN = Klima ist ausgeschaltet, LED ist an
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "IHX", "KLIMA_VORN_OFF_EIN", "STAT_KLIMA_VORN_OFF_EIN", STAT_KLIMA_VORN_OFF_EIN, "\"0/1\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_env_hvac->SetValue( (STAT_KLIMA_VORN_OFF_EIN == 0) );
@@ -2548,10 +2299,10 @@ case I3_PID_IHX_TEMP_INNEN_UNBELUEFTET: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_IHX_KLIMA_VORN_PRG_AUC_EIN", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_KLIMA_VORN_PRG_AUC_EIN = (RXBUF_UCHAR(0));
+    unsigned char STAT_KLIMA_VORN_PRG_AUC_EIN = pidval[0].raw;
         // Automatic air circulation control: 0 = OFF, 1 = ON / Automatische Umluft Control: 0 = AUS, 1 = EIN
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "IHX", "KLIMA_VORN_PRG_AUC_EIN", "STAT_KLIMA_VORN_PRG_AUC_EIN", STAT_KLIMA_VORN_PRG_AUC_EIN, "\"0/1\"");
 
     // ==========  Add your processing here ==========
     mt_i3_v_env_autorecirc->SetValue(STAT_KLIMA_VORN_PRG_AUC_EIN);
@@ -2564,10 +2315,10 @@ case I3_PID_IHX_TEMP_INNEN_UNBELUEFTET: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_IHX_KLIMA_VORN_PRG_UMLUFT_EIN", 1);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    unsigned char STAT_KLIMA_VORN_PRG_UMLUFT_EIN = (RXBUF_UCHAR(0));
+    unsigned char STAT_KLIMA_VORN_PRG_UMLUFT_EIN = pidval[0].raw;
         // Recirculation program: 0 = OFF, 1 = ON / Programm Umluft: 0 = AUS, 1 = EIN
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "IHX", "KLIMA_VORN_PRG_UMLUFT_EIN", "STAT_KLIMA_VORN_PRG_UMLUFT_EIN", STAT_KLIMA_VORN_PRG_UMLUFT_EIN, "\"0/1\"");
 
     // ==========  Add your processing here ==========
     StdMetrics.ms_v_env_cabinintake->SetValue( STAT_KLIMA_VORN_PRG_UMLUFT_EIN ? "recirc" : "fresh" );
@@ -2584,14 +2335,13 @@ case I3_PID_IHX_TEMP_INNEN_UNBELUEFTET: {
         ESP_LOGV(TAG, "Received %d bytes for %s, expected %d", datalen, "I3_PID_EPS_EPS_MOMENTENSENSOR", 3);
         break;
     }
+    const pid_value_t* pidval = m_pidtable.Decode(job.pid, rxbuf);
 
-    float STAT_MOMENT_WERT = (RXBUF_SINT(0)/128.0f);
+    float STAT_MOMENT_WERT = pidval[0].value;
         // Current moment / Aktuelles Moment
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%.4f%s\n", "EPS", "EPS_MOMENTENSENSOR", "STAT_MOMENT_WERT", STAT_MOMENT_WERT, "\"Nm\"");
 
-    char STAT_SENSOR_ZUSTAND_NR_0XDB99 = (RXBUF_SCHAR(2));
+    char STAT_SENSOR_ZUSTAND_NR_0XDB99 = pidval[1].raw;
         // State of the steering torque sensor / Zustand Sensor Lenkmoment
-    ESP_LOGD(TAG, "From ECU %s, pid %s: got %s=%x%s\n", "EPS", "EPS_MOMENTENSENSOR", "STAT_SENSOR_ZUSTAND_NR_0XDB99", STAT_SENSOR_ZUSTAND_NR_0XDB99, "\"0-n\"");
 
     // ==========  Add your processing here ==========
     // So we are only polling this because the EPS (power steering) is only powered when the car is READY
@@ -39,6 +39,7 @@
 #define __VEHICLE_BMWI3_H__
 
 #include "vehicle.h"
+#include "vehicle_pidtable.h"
 
 using namespace std;
 
@@ -75,6 +76,7 @@ class OvmsVehicleBMWi3 : public OvmsVehicle
 
   protected:
     string bmwi3_obd_rxbuf;                               // CAN messages unpacked into here
+    OvmsPidTable m_pidtable;                              // Table driven PID field decoder
     float hv_volts;                                       // Traction battery voltage - used to calculate power from current
     float soc = 0.0f;                                     // Remember SOC for derivative calcs
     int framecount = 0, tickercount = 0, replycount = 0;  // Keep track of when the car is talking or schtum.
@@ -0,0 +1,364 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          19th October 2026
+
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+#ifndef __VEHICLE_BMWI3_PIDS_H__
+#define __VEHICLE_BMWI3_PIDS_H__
+
+// ECU PID field table, sorted by PID, see vehicle_pidtable.h.
+// Shared by the BMW i3 and Mini SE modules: field order per PID must match the pidval[]
+// indexes used in both IncomingPollReply() implementations. Metrics the two modules
+// handle differently are set in the reply handlers, not via the table.
+
+static const pid_field_t bmwi3_pid_fields[] =
+  {
+  // pid, offset, type, scale, factor, add, ecu, pid name, field name, unit, target metric, metric unit
+  // I3_PID_KOM_REICHWEITE_MCV (0x420C)
+  { I3_PID_KOM_REICHWEITE_MCV, 0, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KOM", "REICHWEITE_MCV", "STAT_ECO_MODE_REICHWEITE_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_REICHWEITE_MCV, 2, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KOM", "REICHWEITE_MCV", "STAT_COMFORT_MODE_REICHWEITE_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_REICHWEITE_MCV, 4, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KOM", "REICHWEITE_MCV", "STAT_BC_REICHWEITE_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_REICHWEITE_MCV, 6, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KOM", "REICHWEITE_MCV", "STAT_ECO_PRO_PLUS_REICHWEITE_WERT", "\"km\"", NULL, Other },
+  // I3_PID_SME_ALTERUNG_KAPAZITAET_TS (0x6335)
+  { I3_PID_SME_ALTERUNG_KAPAZITAET_TS, 0, PidField_UInt32, PidScale_None, 1.0f, 0.0f, "SME", "ALTERUNG_KAPAZITAET_TS", "STAT_ALTERUNG_KAPAZITAET_WERT", "\"%\"", NULL, Other },
+  // I3_PID_NBT_STATUS_SPEED (0xD030)
+  { I3_PID_NBT_STATUS_SPEED, 0, PidField_SInt, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_SPEED", "STAT_WHEEL1_SENSOR_SPEED_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_NBT_STATUS_SPEED, 2, PidField_SInt, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_SPEED", "STAT_WHEEL2_SENSOR_SPEED_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_NBT_STATUS_SPEED, 4, PidField_SInt, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_SPEED", "STAT_WHEEL3_SENSOR_SPEED_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_NBT_STATUS_SPEED, 6, PidField_SInt, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_SPEED", "STAT_WHEEL4_SENSOR_SPEED_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_NBT_STATUS_SPEED, 8, PidField_SInt, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_SPEED", "STAT_COMBINED_SENSOR_SPEED_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_NBT_STATUS_SPEED, 10, PidField_SInt, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_SPEED", "STAT_GPS_SPEED_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_NBT_STATUS_SPEED, 12, PidField_UInt, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_SPEED", "STAT_SPEED_DIFFERENCE_PERCENT_WERT", "\"%\"", NULL, Other },
+  // I3_PID_NBT_STATUS_DIRECTION (0xD031)
+  { I3_PID_NBT_STATUS_DIRECTION, 0, PidField_SChar, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_DIRECTION", "STAT_DIRECTION", "\"0-n\"", NULL, Other },
+  { I3_PID_NBT_STATUS_DIRECTION, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "NBT", "STATUS_DIRECTION", "STAT_DIRECTION_SOURCE", "\"0-n\"", NULL, Other },
+  // I3_PID_KOM_TACHO_WERT (0xD107)
+  { I3_PID_KOM_TACHO_WERT, 0, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KOM", "TACHO_WERT", "STAT_GESCHWINDIGKEIT_WERT", "\"km/h\"", MS_V_POS_SPEED, Kph },
+  // I3_PID_KOM_GWSZ_ABSOLUT_WERT (0xD10D)
+  { I3_PID_KOM_GWSZ_ABSOLUT_WERT, 0, PidField_SInt32, PidScale_None, 1.0f, 0.0f, "KOM", "GWSZ_ABSOLUT_WERT", "STAT_ABSOLUT_GWSZ_RAM_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_GWSZ_ABSOLUT_WERT, 4, PidField_SInt32, PidScale_None, 1.0f, 0.0f, "KOM", "GWSZ_ABSOLUT_WERT", "STAT_ABSOLUT_GWSZ_EEP_WERT", "\"km\"", NULL, Other },
+  // I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV (0xD111)
+  { I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 0, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_ELECTRIC_RANGE_CURRENT_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 2, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_ELECTRIC_RANGE_MAXIMUM_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 4, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_FUEL_RANGE_CURRENT_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 6, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_FUEL_RANGE_MAXIMUM_WERT", "\"km\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 8, PidField_UInt, PidScale_Div, 1000.0f, 0.0f, "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_RANGE_CONSUMPTION_ELECTRIC_WERT", "\"kWh/100km\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_REICHWEITE_BEV_PHEV, 10, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "KOM", "KOMBI_REICHWEITE_BEV_PHEV", "STAT_NEBENVERBRAUCHERLEISTUNG_WERT", "\"kW\"", NULL, Other },
+  // I3_PID_KOM_A_TEMP_WERT (0xD112)
+  { I3_PID_KOM_A_TEMP_WERT, 0, PidField_UChar, PidScale_Div, 2.0f, -40.0f, "KOM", "A_TEMP_WERT", "STAT_A_TEMP_ANZEIGE_WERT", "\"°C\"", MS_V_ENV_TEMP, Celcius },
+  { I3_PID_KOM_A_TEMP_WERT, 1, PidField_UChar, PidScale_Div, 2.0f, -40.0f, "KOM", "A_TEMP_WERT", "STAT_A_TEMP_ROHWERT_WERT", "\"°C\"", NULL, Other },
+  // I3_PID_KOM_KOMBI_BC_BCW_KWH_KM (0xD129)
+  { I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 0, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_DSV_KWH_KM_WERT", "\"kWh/100km\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 2, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_DSG_KWH_KM_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 4, PidField_SInt, PidScale_Div, 10.0f, 0.0f, "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_MVERB_KWH_KM_WERT", "\"kW\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_BC_BCW_KWH_KM, 6, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KOM", "KOMBI_BC_BCW_KWH_KM", "STAT_BC_RW_KWH_KM_WERT", "\"km\"", NULL, Other },
+  // I3_PID_KOM_KOMBI_BC_RBC_KWH_KM (0xD12A)
+  { I3_PID_KOM_KOMBI_BC_RBC_KWH_KM, 2, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "KOM", "KOMBI_BC_RBC_KWH_KM", "STAT_RBC_DSG_KWH_KM_WERT", "\"km/h\"", NULL, Other },
+  { I3_PID_KOM_KOMBI_BC_RBC_KWH_KM, 8, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KOM", "KOMBI_BC_RBC_KWH_KM", "STAT_RBC_STRECKE_KWH_KM_WERT", "\"km\"", NULL, Other },
+  // I3_PID_KOM_SEGMENTDATEN_SPEICHER (0xD12F)
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 2, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 3, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 4, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 5, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 9, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 10, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 11, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 12, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 16, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 17, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_01_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 21, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 22, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 23, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 24, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 25, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 26, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 30, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 31, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 32, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 33, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 37, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 38, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_02_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 42, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 43, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 44, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 45, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 46, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 47, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 51, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 52, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 53, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 54, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 58, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 59, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_03_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 63, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 64, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 65, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 66, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 67, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 68, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 72, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 73, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 74, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 75, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 79, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 80, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_04_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 84, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 85, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 86, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 87, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 88, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 89, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 93, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 94, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 95, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 96, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 100, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 101, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_05_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 105, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 106, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 107, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 108, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 109, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 110, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 114, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 115, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 116, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 117, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 121, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 122, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_06_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 126, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 127, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 128, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 129, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 130, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 131, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 135, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 136, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 137, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 138, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 142, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 143, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_07_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 147, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 148, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 149, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 150, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 151, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 152, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 156, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 157, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 158, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 159, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 163, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 164, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_08_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 168, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 169, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 170, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 171, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 172, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 173, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 177, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 178, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 179, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 180, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 184, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 185, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_09_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 189, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_SEGMENT_ID_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 190, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_TAG_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 191, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_MONAT_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 192, PidField_UChar, PidScale_None, 1.0f, 2000.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_JAHR_WERT", "", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 193, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_STUNDE_WERT", "\"h\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 194, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_MINUTE_WERT", "\"min\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 198, PidField_UChar, PidScale_Mul, 0.5f, -40.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_A_TEMP_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 199, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_AKT_DAUER_ECO_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 200, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_AKT_DAUER_ECOPLUS_SPORT_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 201, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 205, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_REKUPERATION_WERT", "\"kWh\"", NULL, Other },
+  { I3_PID_KOM_SEGMENTDATEN_SPEICHER, 206, PidField_UChar, PidScale_Div, 2.0f, 0.0f, "KOM", "SEGMENTDATEN_SPEICHER", "STAT_BLOCK_10_EFAHREN_VS_VERBRENNER_WERT", "\"%\"", NULL, Other },
+  // I3_PID_BDC_HANDBREMSE_KONTAKT (0xD130)
+  { I3_PID_BDC_HANDBREMSE_KONTAKT, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "BDC", "HANDBREMSE_KONTAKT", "STAT_HANDBREMSE_KONTAKT_EIN", "\"0/1\"", NULL, Other },
+  // I3_PID_IHX_TEMP_INNEN_UNBELUEFTET (0xD85C)
+  { I3_PID_IHX_TEMP_INNEN_UNBELUEFTET, 0, PidField_SChar, PidScale_None, 1.0f, 0.0f, "IHX", "TEMP_INNEN_UNBELUEFTET", "STAT_TEMP_INNEN_WERT", "\"°C\"", NULL, Other },
+  // I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE (0xD91A)
+  { I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "IHX", "KLIMA_VORN_LUFTVERTEILUNG_LI_RE", "STAT_KLIMA_VORN_LUFTVERTEILUNG_LINKS_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_IHX_KLIMA_VORN_LUFTVERTEILUNG_LI_RE, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "IHX", "KLIMA_VORN_LUFTVERTEILUNG_LI_RE", "STAT_KLIMA_VORN_LUFTVERTEILUNG_RECHTS_NR", "\"0-n\"", NULL, Other },
+  // I3_PID_IHX_KLIMA_VORN_OFF_EIN (0xD92C)
+  { I3_PID_IHX_KLIMA_VORN_OFF_EIN, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "IHX", "KLIMA_VORN_OFF_EIN", "STAT_KLIMA_VORN_OFF_EIN", "\"0/1\"", NULL, Other },
+  // I3_PID_IHX_KLIMA_VORN_PRG_AUC_EIN (0xD930)
+  { I3_PID_IHX_KLIMA_VORN_PRG_AUC_EIN, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "IHX", "KLIMA_VORN_PRG_AUC_EIN", "STAT_KLIMA_VORN_PRG_AUC_EIN", "\"0/1\"", NULL, Other },
+  // I3_PID_IHX_KLIMA_VORN_PRG_UMLUFT_EIN (0xD931)
+  { I3_PID_IHX_KLIMA_VORN_PRG_UMLUFT_EIN, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "IHX", "KLIMA_VORN_PRG_UMLUFT_EIN", "STAT_KLIMA_VORN_PRG_UMLUFT_EIN", "\"0/1\"", NULL, Other },
+  // I3_PID_EPS_EPS_MOMENTENSENSOR (0xDB99)
+  { I3_PID_EPS_EPS_MOMENTENSENSOR, 0, PidField_SInt, PidScale_Div, 128.0f, 0.0f, "EPS", "EPS_MOMENTENSENSOR", "STAT_MOMENT_WERT", "\"Nm\"", NULL, Other },
+  { I3_PID_EPS_EPS_MOMENTENSENSOR, 2, PidField_SChar, PidScale_None, 1.0f, 0.0f, "EPS", "EPS_MOMENTENSENSOR", "STAT_SENSOR_ZUSTAND_NR_0XDB99", "\"0-n\"", NULL, Other },
+  // I3_PID_FZD_DWA_KLAPPENKONTAKTE (0xDCDD)
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_FAHRERTUER_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_BEIFAHRERTUER_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 2, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_FAHRERTUER_HINTEN_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 3, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_BEIFAHRERTUER_HINTEN_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 4, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_MOTORHAUBE_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 5, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_HECKKLAPPE_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 6, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_KONTAKT_HECKSCHEIBE_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 7, PidField_UChar, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_ZV_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_FZD_DWA_KLAPPENKONTAKTE, 8, PidField_UInt32, PidScale_None, 1.0f, 0.0f, "FZD", "DWA_KLAPPENKONTAKTE", "STAT_RESERVE_WERT", "\"HEX\"", NULL, Other },
+  // I3_PID_SME_HV_SPANNUNG_BERECHNET (0xDD68)
+  { I3_PID_SME_HV_SPANNUNG_BERECHNET, 0, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "SME", "HV_SPANNUNG_BERECHNET", "STAT_HV_SPANNUNG_BERECHNET_WERT", "\"V\"", NULL, Other },
+  // I3_PID_SME_HV_STROM (0xDD69)
+  { I3_PID_SME_HV_STROM, 0, PidField_SInt32, PidScale_Div, 100.0f, 0.0f, "SME", "HV_STROM", "STAT_HV_STROM_WERT", "\"A\"", NULL, Other },
+  // I3_PID_SME_ANZEIGE_SOC (0xDDBC)
+  { I3_PID_SME_ANZEIGE_SOC, 0, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "SME", "ANZEIGE_SOC", "STAT_ANZEIGE_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_SME_ANZEIGE_SOC, 2, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "SME", "ANZEIGE_SOC", "STAT_MAXIMALE_ANZEIGE_SOC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_SME_ANZEIGE_SOC, 4, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "SME", "ANZEIGE_SOC", "STAT_MINIMALE_ANZEIGE_SOC_WERT", "\"%\"", NULL, Other },
+  // I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX (0xDDBF)
+  { I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX, 0, PidField_UInt, PidScale_Div, 1000.0f, 0.0f, "SME", "ZELLSPANNUNGEN_MIN_MAX", "STAT_UCELL_MIN_WERT", "\"V\"", NULL, Other },
+  { I3_PID_SME_ZELLSPANNUNGEN_MIN_MAX, 2, PidField_UInt, PidScale_Div, 1000.0f, 0.0f, "SME", "ZELLSPANNUNGEN_MIN_MAX", "STAT_UCELL_MAX_WERT", "\"V\"", NULL, Other },
+  // I3_PID_SME_TEMPERATUREN (0xDDC0)
+  { I3_PID_SME_TEMPERATUREN, 0, PidField_SInt, PidScale_Div, 100.0f, 0.0f, "SME", "TEMPERATUREN", "STAT_TCORE_MIN_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_SME_TEMPERATUREN, 2, PidField_SInt, PidScale_Div, 100.0f, 0.0f, "SME", "TEMPERATUREN", "STAT_TCORE_MAX_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_SME_TEMPERATUREN, 4, PidField_SInt, PidScale_Div, 100.0f, 0.0f, "SME", "TEMPERATUREN", "STAT_TCORE_MEAN_WERT", "\"°C\"", NULL, Other },
+  // I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG (0xDE00)
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 0, PidField_UInt, PidScale_Mul, 0.1f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_SOC_HVB_WERT", "\"%\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 2, PidField_UChar, PidScale_Mul, 0.5f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_SOC_HVB_MIN_WERT", "\"%\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 3, PidField_UChar, PidScale_None, 1.0f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_LADEGERAET", "\"0/1\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 4, PidField_UChar, PidScale_None, 1.0f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_FREMDLADUNG", "\"0/1\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 5, PidField_UChar, PidScale_None, 1.0f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_FAHRB", "\"0/1\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 6, PidField_UChar, PidScale_None, 1.0f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_BA_DCDC_KOMM_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 7, PidField_SInt, PidScale_Mul, 0.1f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_HV_OUT_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 9, PidField_UInt, PidScale_Mul, 0.1f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_HV_OUT_WERT", "\"V\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 11, PidField_SInt, PidScale_Mul, 0.1f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_LV_OUT_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 13, PidField_UInt, PidScale_Mul, 0.01f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_LV_OUT_WERT", "\"V\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 15, PidField_UChar, PidScale_None, 1.0f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_BA_DCDC_IST_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 16, PidField_UChar, PidScale_Mul, 0.5f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_ALS_DCDC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 17, PidField_SInt, PidScale_Mul, 0.1f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_HV_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 19, PidField_UInt, PidScale_Mul, 0.1f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_HV_WERT", "\"V\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 21, PidField_SInt, PidScale_Mul, 0.1f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_I_DCDC_LV_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_EME_HVPM_DCDC_ANSTEUERUNG, 23, PidField_UInt, PidScale_Mul, 0.01f, 0.0f, "EME", "EME_HVPM_DCDC_ANSTEUERUNG", "STAT_U_DCDC_LV_WERT", "\"V\"", NULL, Other },
+  // I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET (0xDE84)
+  { I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 0, PidField_UChar, PidScale_Div, 4.0f, 0.0f, "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_NETZFREQUENZ_PHASE_1_WERT", "\"Hz\"", NULL, Other },
+  { I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 2, PidField_UInt, PidScale_Mul, 10.0f, 0.0f, "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_LEISTUNG_DERATING_WERT", "\"W\"", NULL, Other },
+  { I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 4, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_DERATING_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 9, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_BETRIEBSART_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 10, PidField_UChar, PidScale_Div, 4.0f, 0.0f, "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_NETZFREQUENZ_PHASE_2_WERT", "\"Hz\"", NULL, Other },
+  { I3_PID_KLE_BETRIEBSZUSTAND_LADEGERAET, 11, PidField_UChar, PidScale_Div, 4.0f, 0.0f, "KLE", "BETRIEBSZUSTAND_LADEGERAET", "STAT_NETZFREQUENZ_PHASE_3_WERT", "\"Hz\"", NULL, Other },
+  // I3_PID_KLE_LADEGERAET_LEISTUNG (0xDE85)
+  { I3_PID_KLE_LADEGERAET_LEISTUNG, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KLE", "LADEGERAET_LEISTUNG", "STAT_WIRKUNGSGRAD_LADEZYKLUS_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_LEISTUNG, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "KLE", "LADEGERAET_LEISTUNG", "STAT_WIRKUNGSGRAD_DC_WERT", "\"%\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_LEISTUNG, 2, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KLE", "LADEGERAET_LEISTUNG", "STAT_LADEGERAET_DC_HV_LEISTUNG_WERT", "\"W\"", NULL, Other },
+  // I3_PID_KLE_LADEGERAET_SPANNUNG (0xDE86)
+  { I3_PID_KLE_LADEGERAET_SPANNUNG, 0, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_RMS_AC_PHASE_1_WERT", "\"V\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_SPANNUNG, 2, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_DC_HV_OBERGRENZE_WERT", "\"V\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_SPANNUNG, 4, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_DC_HV_WERT", "\"V\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_SPANNUNG, 6, PidField_UChar, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_KL30_WERT", "\"V\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_SPANNUNG, 7, PidField_UChar, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_KL30C_WERT", "\"V\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_SPANNUNG, 8, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_RMS_AC_PHASE_2_WERT", "\"V\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_SPANNUNG, 10, PidField_UInt, PidScale_None, 1.0f, 0.0f, "KLE", "LADEGERAET_SPANNUNG", "STAT_SPANNUNG_RMS_AC_PHASE_3_WERT", "\"V\"", NULL, Other },
+  // I3_PID_KLE_LADEGERAET_STROM (0xDE87)
+  { I3_PID_KLE_LADEGERAET_STROM, 0, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_PHASE_1_WERT", "\"A\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_STROM, 2, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_MAX_GESPEICHERT_WERT", "\"A\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_STROM, 4, PidField_UInt, PidScale_Div, 10.0f, -204.7f, "KLE", "LADEGERAET_STROM", "STAT_STROM_HV_DC_WERT", "\"A\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_STROM, 6, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_STROM", "STAT_STROM_HV_DC_MAX_LIMIT_WERT", "\"A\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_STROM, 8, PidField_UInt, PidScale_Div, 10.0f, -204.7f, "KLE", "LADEGERAET_STROM", "STAT_STROM_HV_DC_MAX_GESPEICHERT_WERT", "\"A\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_STROM, 10, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_PHASE_2_WERT", "\"A\"", NULL, Other },
+  { I3_PID_KLE_LADEGERAET_STROM, 12, PidField_UInt, PidScale_Div, 10.0f, 0.0f, "KLE", "LADEGERAET_STROM", "STAT_STROM_AC_PHASE_3_WERT", "\"A\"", NULL, Other },
+  // I3_PID_EME_AE_STROM_EMASCHINE (0xDE8A)
+  { I3_PID_EME_AE_STROM_EMASCHINE, 0, PidField_SInt, PidScale_Mul, 0.0625f, 0.0f, "EME", "AE_STROM_EMASCHINE", "STAT_STROM_AC_EFF_W_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_AE_STROM_EMASCHINE, 2, PidField_SInt, PidScale_Mul, 0.0625f, 0.0f, "EME", "AE_STROM_EMASCHINE", "STAT_STROM_AC_EFF_V_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_AE_STROM_EMASCHINE, 4, PidField_SInt, PidScale_Mul, 0.0625f, 0.0f, "EME", "AE_STROM_EMASCHINE", "STAT_STROM_AC_EFF_U_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_AE_STROM_EMASCHINE, 6, PidField_SInt, PidScale_Mul, 0.0625f, 0.0f, "EME", "AE_STROM_EMASCHINE", "STAT_ERREGERSTROM_WERT", "\"A\"", NULL, Other },
+  { I3_PID_EME_AE_STROM_EMASCHINE, 8, PidField_SInt, PidScale_Mul, 0.1f, 0.0f, "EME", "AE_STROM_EMASCHINE", "STAT_STROM_DC_HV_UMRICHTER_EM_WERT", "\"A\"", NULL, Other },
+  // I3_PID_EME_AE_TEMP_LE (0xDE8C)
+  { I3_PID_EME_AE_TEMP_LE, 0, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_PHASE_U_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 2, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_PHASE_V_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 4, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_PHASE_W_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 6, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_UMRICHTER_GT_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 8, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_BO_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 10, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_GTW_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 12, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_TS_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 14, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_DCDC_GR_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 16, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_PFC_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 18, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_GR_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 20, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_GTW_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 22, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_SLE_BO_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 24, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_ELUP_LE_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 26, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_PROZESSOR_MC0_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_LE, 28, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_LE", "STAT_TEMP_PROZESSOR_MC2_WERT", "\"°C\"", NULL, Other },
+  // I3_PID_EDM_PEDALWERTGEBER (0xDE9C)
+  { I3_PID_EDM_PEDALWERTGEBER, 0, PidField_UInt, PidScale_Mul, 0.0049f, 0.0f, "EDM", "PEDALWERTGEBER", "STAT_SPANNUNG_PEDALWERT1_WERT", "\"V\"", NULL, Other },
+  { I3_PID_EDM_PEDALWERTGEBER, 2, PidField_UInt, PidScale_Mul, 0.0049f, 0.0f, "EDM", "PEDALWERTGEBER", "STAT_SPANNUNG_PEDALWERT2_WERT", "\"V\"", NULL, Other },
+  { I3_PID_EDM_PEDALWERTGEBER, 4, PidField_UInt, PidScale_Mul, 0.0625f, 0.0f, "EDM", "PEDALWERTGEBER", "STAT_PEDALWERT_WERT", "\"%\"", NULL, Other },
+  // I3_PID_EME_AE_TEMP_EMASCHINE (0xDEA6)
+  { I3_PID_EME_AE_TEMP_EMASCHINE, 0, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_EMASCHINE", "STAT_TEMP1_E_MOTOR_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_EME_AE_TEMP_EMASCHINE, 2, PidField_SInt, PidScale_Mul, 0.0156f, 0.0f, "EME", "AE_TEMP_EMASCHINE", "STAT_TEMP2_E_MOTOR_WERT", "\"°C\"", NULL, Other },
+  // I3_PID_EME_AE_ELEKTRISCHE_MASCHINE (0xDEA7)
+  { I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 0, PidField_UInt, PidScale_Mul, 0.5f, -5000.0f, "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_MASCHINE_DREHZAHL_WERT", "\"1/min\"", MS_V_MOT_RPM, Other },
+  { I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 2, PidField_SInt, PidScale_Mul, 0.5f, 0.0f, "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_MASCHINE_IST_MOMENT_WERT", "\"Nm\"", NULL, Other },
+  { I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 4, PidField_SInt, PidScale_Mul, 0.5f, 0.0f, "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_MASCHINE_SOLL_MOMENT_WERT", "\"Nm\"", NULL, Other },
+  { I3_PID_EME_AE_ELEKTRISCHE_MASCHINE, 6, PidField_UChar, PidScale_None, 1.0f, 0.0f, "EME", "AE_ELEKTRISCHE_MASCHINE", "STAT_ELEKTRISCHE_BETRIEBSART_NR", "\"0-n\"", NULL, Other },
+  // I3_PID_LIM_LADEBEREITSCHAFT_LIM (0xDEF2)
+  { I3_PID_LIM_LADEBEREITSCHAFT_LIM, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "LADEBEREITSCHAFT_LIM", "STAT_LADEBEREITSCHAFT_LIM", "\"0/1\"", NULL, Other },
+  // I3_PID_LIM_PROXIMITY (0xDEF5)
+  { I3_PID_LIM_PROXIMITY, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "PROXIMITY", "STAT_STECKER_NR", "\"0-n\"", NULL, Other },
+  { I3_PID_LIM_PROXIMITY, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "PROXIMITY", "STAT_STROMTRAGFAEHIGKEIT_WERT", "\"A\"", NULL, Other },
+  // I3_PID_LIM_PILOTSIGNAL (0xDEF6)
+  { I3_PID_LIM_PILOTSIGNAL, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "PILOTSIGNAL", "STAT_PILOT_AKTIV", "\"0/1\"", NULL, Other },
+  { I3_PID_LIM_PILOTSIGNAL, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "PILOTSIGNAL", "STAT_PILOT_PWM_DUTYCYCLE_WERT", "\"%\"", NULL, Other },
+  { I3_PID_LIM_PILOTSIGNAL, 2, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "PILOTSIGNAL", "STAT_PILOT_CURRENT_WERT", "\"A\"", NULL, Other },
+  { I3_PID_LIM_PILOTSIGNAL, 3, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "PILOTSIGNAL", "STAT_PILOT_LADEBEREIT", "\"0/1\"", NULL, Other },
+  { I3_PID_LIM_PILOTSIGNAL, 4, PidField_UInt, PidScale_None, 1.0f, 0.0f, "LIM", "PILOTSIGNAL", "STAT_PILOT_FREQUENZ_WERT", "\"Hz\"", NULL, Other },
+  { I3_PID_LIM_PILOTSIGNAL, 6, PidField_UChar, PidScale_Div, 10.0f, 0.0f, "LIM", "PILOTSIGNAL", "STAT_PILOT_PEGEL_WERT", "\"V\"", NULL, Other },
+  // I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO (0xDEF7)
+  { I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_CHARGE_CONTROL_1", "\"0/1\"", NULL, Other },
+  { I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 1, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_CHARGE_CONTROL_2", "\"0/1\"", NULL, Other },
+  { I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 2, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_CHARGE_PERMISSION", "\"0/1\"", NULL, Other },
+  { I3_PID_LIM_LADESCHNITTSTELLE_DC_TEPCO, 3, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "LADESCHNITTSTELLE_DC_TEPCO", "STAT_LADESTECKER", "\"0/1\"", NULL, Other },
+  // I3_PID_LIM_DC_SCHUETZ_SCHALTER (0xDEF8)
+  { I3_PID_LIM_DC_SCHUETZ_SCHALTER, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "DC_SCHUETZ_SCHALTER", "STAT_DC_SCHUETZ_SCHALTER", "\"0-n\"", NULL, Other },
+  // I3_PID_LIM_DC_PINABDECKUNG_COMBO (0xDEFA)
+  { I3_PID_LIM_DC_PINABDECKUNG_COMBO, 0, PidField_UChar, PidScale_None, 1.0f, 0.0f, "LIM", "DC_PINABDECKUNG_COMBO", "STAT_DC_PINABDECKUNG", "\"0/1\"", NULL, Other },
+  // I3_PID_SME_PROJEKT_PARAMETER (0xDF71)
+  { I3_PID_SME_PROJEKT_PARAMETER, 0, PidField_UInt, PidScale_None, 1.0f, 0.0f, "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_ZELLEN_INSGESAMT_WERT", "", NULL, Other },
+  { I3_PID_SME_PROJEKT_PARAMETER, 2, PidField_UChar, PidScale_None, 1.0f, 0.0f, "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_ZELLEN_PRO_MODUL_WERT", "", NULL, Other },
+  { I3_PID_SME_PROJEKT_PARAMETER, 3, PidField_UChar, PidScale_None, 1.0f, 0.0f, "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_MODULE_WERT", "", NULL, Other },
+  { I3_PID_SME_PROJEKT_PARAMETER, 4, PidField_UChar, PidScale_None, 1.0f, 0.0f, "SME", "PROJEKT_PARAMETER", "STAT_ANZAHL_TEMPERATURSENSOREN_PRO_MODUL_WERT", "", NULL, Other },
+  // I3_PID_SME_ZUSTAND_SPEICHER (0xDFA0)
+  { I3_PID_SME_ZUSTAND_SPEICHER, 0, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLKAPAZITAET_MIN_WERT", "\"Ah\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 2, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLKAPAZITAET_MAX_WERT", "\"Ah\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 4, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLKAPAZITAET_MEAN_WERT", "\"Ah\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 6, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSPANNUNG_MIN_WERT", "\"V\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 8, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSPANNUNG_MAX_WERT", "\"V\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 10, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSPANNUNG_MEAN_WERT", "\"V\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 12, PidField_SInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLTEMPERATUR_MIN_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 14, PidField_SInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLTEMPERATUR_MAX_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 16, PidField_SInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLTEMPERATUR_MEAN_WERT", "\"°C\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 18, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLWIDERSTANDSFAKTOR_MIN_WERT", "", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 20, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLWIDERSTANDSFAKTOR_MAX_WERT", "", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 22, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLWIDERSTANDSFAKTOR_MEAN_WERT", "", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 24, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSOC_MIN_WERT", "\"%\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 26, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSOC_MAX_WERT", "\"%\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 28, PidField_UInt, PidScale_Div, 100.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLSOC_MEAN_WERT", "\"%\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 30, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLOCV_MIN_WERT", "\"V\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 32, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLOCV_MAX_WERT", "\"V\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 34, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_ZELLOCV_MEAN_WERT", "\"V\"", NULL, Other },
+  { I3_PID_SME_ZUSTAND_SPEICHER, 36, PidField_UInt, PidScale_Div, 10000.0f, 0.0f, "SME", "ZUSTAND_SPEICHER", "STAT_IMPEDANCE_ESTIMATION_ALPHA_WERT", "", NULL, Other },
+  };
+
+#endif //#ifndef __VEHICLE_BMWI3_PIDS_H__
@@ -27,6 +27,7 @@
 #define __VEHICLE_MINISE_H__
 
 #include "vehicle.h"
+#include "vehicle_pidtable.h"
 
 #ifdef CONFIG_OVMS_COMP_WEBSERVER
 #include "ovms_webserver.h"
@@ -64,6 +65,7 @@ class OvmsVehicleMiniSE : public OvmsVehicle {
 
   protected:
   string obd_rxbuf;                                     // CAN messages unpacked into here
+  OvmsPidTable m_pidtable;                              // Table driven PID field decoder
   float hv_volts{};                                     // Traction battery voltage - used to calculate power from current
   float soc = 0.0f;                                     // Remember SOC for derivative calcs
   int framecount = 0, tickercount = 0, replycount = 0;  // Keep track of when the car is talking or schtum.
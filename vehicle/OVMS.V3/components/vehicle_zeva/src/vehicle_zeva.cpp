@@ -39,6 +39,7 @@ OvmsVehicleZeva::OvmsVehicleZeva()
 
   // Change CANbus speed to either 125 or 250KBPS 
   RegisterCanBus(1,CAN_MODE_ACTIVE,CAN_SPEED_250KBPS);
+  RegisterCanInterest(m_can1, { 0x0A });
 
   StandardMetrics.ms_v_type->SetValue("ZEVA");
   StandardMetrics.ms_v_vin->SetValue("ZEVAZEVAZEVAZEVA");
@@ -143,42 +143,6 @@ ssize_t BufferedShell::write(const void *buf, size_t nbyte)
   return done;
   }
 
-void BufferedShell::Log(LogBuffers* message)
-  {
-  if (!m_output)
-    {
-    message->release();
-    return;
-    }
-  if (message->last())
-    {
-    if (m_output->empty())
-      {
-      m_output->release();
-      m_output = message;
-      return;
-      }
-    LogBuffers::iterator before = m_output->begin(), after;
-    while (true)
-      {
-      after = before;
-      ++after;
-      if (after == m_output->end())
-        break;
-      before = after;
-      }
-    m_output->splice_after(before, *message);
-    m_left = 0;
-    }
-  else
-    {
-    for (LogBuffers::iterator i = message->begin(); i != message->end(); ++i)
-      write(*i, strlen(*i));
-    }
-  message->release();
-  return;
-  }
-
 // Deliver the buffered output to an OvmsWriter (typically a Console),
 // This releases the LogBuffers object so it is freed.
 void BufferedShell::Output(OvmsWriter* writer)
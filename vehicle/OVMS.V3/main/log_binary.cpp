@@ -0,0 +1,772 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "logbinary";
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stddef.h>
+#include <time.h>
+#include "soc/soc.h"
+#include "log_binary.h"
+#include "ovms_command.h"
+#include "ovms_utils.h"
+
+typedef enum
+  {
+  LBA_None,                     // "%%"
+  LBA_Int,
+  LBA_Long,
+  LBA_LLong,
+  LBA_Intmax,
+  LBA_Size,
+  LBA_Ptrdiff,
+  LBA_Double,
+  LBA_String,
+  LBA_Pointer,
+  LBA_Unsupported,
+  } logbin_argtype_t;
+
+typedef struct
+  {
+  const char* start;            // '%'
+  size_t len;                   // length including the conversion character
+  bool widthstar;               // width given by argument
+  bool precstar;                // precision given by argument
+  int precision;                // -1 = none
+  logbin_argtype_t type;
+  } logbin_spec_t;
+
+/**
+ * NextSpec: find & parse the next conversion specification
+ *  - returns false at the end of the format string
+ *  - p is set to the next character after the specification
+ */
+static bool NextSpec(const char*& p, logbin_spec_t& spec)
+  {
+  while (*p && *p != '%')
+    p++;
+  if (!*p)
+    return false;
+
+  const char* s = p + 1;
+  spec.start = p;
+  spec.widthstar = spec.precstar = false;
+  spec.precision = -1;
+  while (*s && strchr("-+ #0'", *s))
+    s++;
+  if (*s == '*')
+    {
+    spec.widthstar = true;
+    s++;
+    }
+  else
+    {
+    while (isdigit((unsigned char)*s))
+      s++;
+    }
+  if (*s == '.')
+    {
+    s++;
+    if (*s == '*')
+      {
+      spec.precstar = true;
+      s++;
+      }
+    else
+      {
+      spec.precision = 0;
+      while (isdigit((unsigned char)*s))
+        spec.precision = spec.precision * 10 + (*s++ - '0');
+      }
+    }
+
+  // length modifier:
+  char len = 0;
+  if (*s == 'h')
+    {
+    len = 'h';
+    if (*++s == 'h') s++;
+    }
+  else if (*s == 'l')
+    {
+    len = 'l';
+    if (*++s == 'l')
+      {
+      len = 'q';
+      s++;
+      }
+    }
+  else if (*s && strchr("Ljzqt", *s))
+    {
+    len = *s++;
+    }
+
+  // conversion:
+  char conv = *s;
+  if (conv)
+    s++;
+  if (conv == '%')
+    spec.type = (s - p == 2) ? LBA_None : LBA_Unsupported;
+  else if (conv && strchr("diouxX", conv))
+    {
+    switch (len)
+      {
+      case 0:
+      case 'h': spec.type = LBA_Int; break;
+      case 'l': spec.type = LBA_Long; break;
+      case 'q': spec.type = LBA_LLong; break;
+      case 'j': spec.type = LBA_Intmax; break;
+      case 'z': spec.type = LBA_Size; break;
+      case 't': spec.type = LBA_Ptrdiff; break;
+      default:  spec.type = LBA_Unsupported; break;
+      }
+    }
+  else if (conv == 'c')
+    spec.type = (len == 0) ? LBA_Int : LBA_Unsupported;
+  else if (conv && strchr("fFeEgGaA", conv))
+    spec.type = (len == 'L') ? LBA_Unsupported : LBA_Double;
+  else if (conv == 's')
+    spec.type = (len == 0) ? LBA_String : LBA_Unsupported;
+  else if (conv == 'p')
+    spec.type = LBA_Pointer;
+  else
+    spec.type = LBA_Unsupported;
+
+  spec.len = s - p;
+  p = s;
+  return true;
+  }
+
+static size_t ArgSize(logbin_argtype_t type)
+  {
+  switch (type)
+    {
+    case LBA_Int:     return sizeof(int32_t);
+    case LBA_Long:    return sizeof(long);
+    case LBA_LLong:   return sizeof(long long);
+    case LBA_Intmax:  return sizeof(intmax_t);
+    case LBA_Size:    return sizeof(size_t);
+    case LBA_Ptrdiff: return sizeof(ptrdiff_t);
+    case LBA_Double:  return sizeof(double);
+    case LBA_Pointer: return sizeof(void*);
+    default:          return 0;
+    }
+  }
+
+/**
+ * LogBinaryConstant: check if ptr points into the flash rodata segment
+ *  (i.e. to a constant that will be valid and unchanged until the next firmware update)
+ */
+bool LogBinaryConstant(const void* ptr)
+  {
+#if defined(SOC_DROM_LOW) && defined(SOC_DROM_HIGH)
+  return ((intptr_t)ptr >= SOC_DROM_LOW && (intptr_t)ptr < SOC_DROM_HIGH);
+#else
+  return false;
+#endif
+  }
+
+/**
+ * LogBinaryEncode: encode the arguments of a log message
+ *  - string arguments are copied unless constant, honoring the precision
+ *  - pass buffer=NULL to get the encoded size
+ *  - returns the encoded size or -1 if the format cannot be encoded
+ */
+int LogBinaryEncode(uint8_t* buffer, size_t size, const char* fmt, va_list args)
+  {
+  va_list ap;
+  va_copy(ap, args);
+  size_t pos = 0;
+  bool ok = true;
+  const char* p = fmt;
+  logbin_spec_t spec;
+
+  auto put = [&](const void* data, size_t len)
+    {
+    if (buffer && pos + len <= size)
+      memcpy(buffer + pos, data, len);
+    pos += len;
+    };
+
+  while (ok && NextSpec(p, spec))
+    {
+    int32_t star;
+    int precision = spec.precision;
+    if (spec.widthstar)
+      {
+      star = va_arg(ap, int);
+      put(&star, sizeof(star));
+      }
+    if (spec.precstar)
+      {
+      star = va_arg(ap, int);
+      put(&star, sizeof(star));
+      precision = star;
+      }
+    switch (spec.type)
+      {
+      case LBA_None:
+        break;
+      case LBA_Int:
+        {
+        int32_t v = va_arg(ap, int);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_Long:
+        {
+        long v = va_arg(ap, long);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_LLong:
+        {
+        long long v = va_arg(ap, long long);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_Intmax:
+        {
+        intmax_t v = va_arg(ap, intmax_t);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_Size:
+        {
+        size_t v = va_arg(ap, size_t);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_Ptrdiff:
+        {
+        ptrdiff_t v = va_arg(ap, ptrdiff_t);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_Double:
+        {
+        double v = va_arg(ap, double);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_Pointer:
+        {
+        void* v = va_arg(ap, void*);
+        put(&v, sizeof(v));
+        break;
+        }
+      case LBA_String:
+        {
+        const char* s = va_arg(ap, const char*);
+        uint8_t kind;
+        if (s && LogBinaryConstant(s))
+          {
+          uint32_t id = (uint32_t)(uintptr_t)s;
+          kind = 1;
+          put(&kind, sizeof(kind));
+          put(&id, sizeof(id));
+          }
+        else
+          {
+          if (!s)
+            s = "(null)";
+          size_t len = (precision >= 0) ? strnlen(s, precision) : strlen(s);
+          uint16_t len16 = (len < 0xffff) ? len : 0xffff;
+          kind = 0;
+          put(&kind, sizeof(kind));
+          put(&len16, sizeof(len16));
+          put(s, len16);
+          }
+        break;
+        }
+      default:
+        ok = false;
+        break;
+      }
+    }
+
+  va_end(ap);
+  return ok ? pos : -1;
+  }
+
+/**
+ * LogBinaryFormat: render an encoded log message
+ *  - resolve: lookup of constant strings by id
+ *  - returns the text length (excluding the NUL) that would have been written
+ *    if the buffer was large enough (as snprintf), or -1 on invalid data
+ */
+int LogBinaryFormat(char* buffer, size_t size, const char* fmt,
+  const uint8_t* args, size_t argsize, LogBinaryResolver resolve)
+  {
+  size_t out = 0, pos = 0;
+  const char* p = fmt;
+  logbin_spec_t spec;
+  char sf[32];
+  std::string str;
+
+  auto get = [&](void* data, size_t len) -> bool
+    {
+    if (pos + len > argsize)
+      return false;
+    memcpy(data, args + pos, len);
+    pos += len;
+    return true;
+    };
+  auto append = [&](const char* text, size_t len)
+    {
+    if (buffer && out < size)
+      memcpy(buffer + out, text, (out + len < size) ? len : size - out);
+    out += len;
+    };
+
+  for (;;)
+    {
+    // copy literal text:
+    const char* lit = p;
+    bool more = NextSpec(p, spec);
+    append(lit, (more ? spec.start : p) - lit);
+    if (!more)
+      break;
+    if (spec.type == LBA_None)
+      {
+      append("%", 1);
+      continue;
+      }
+
+    // build conversion specification with '*' values resolved:
+    size_t sflen = 0;
+    int32_t star;
+    for (const char* s = spec.start; s < spec.start + spec.len; s++)
+      {
+      if (*s == '*')
+        {
+        if (!get(&star, sizeof(star)))
+          return -1;
+        sflen += snprintf(sf + sflen, (sflen < sizeof(sf)) ? sizeof(sf) - sflen : 0, "%d", (int)star);
+        }
+      else if (sflen < sizeof(sf))
+        {
+        sf[sflen++] = *s;
+        }
+      }
+    if (sflen >= sizeof(sf))
+      return -1;
+    sf[sflen] = 0;
+
+    // render argument:
+    char* dst = (buffer && out < size) ? buffer + out : NULL;
+    size_t rem = (buffer && out < size) ? size - out : 0;
+    int n;
+    switch (spec.type)
+      {
+      case LBA_Int:
+        {
+        int32_t v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, (int)v);
+        break;
+        }
+      case LBA_Long:
+        {
+        long v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, v);
+        break;
+        }
+      case LBA_LLong:
+        {
+        long long v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, v);
+        break;
+        }
+      case LBA_Intmax:
+        {
+        intmax_t v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, v);
+        break;
+        }
+      case LBA_Size:
+        {
+        size_t v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, v);
+        break;
+        }
+      case LBA_Ptrdiff:
+        {
+        ptrdiff_t v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, v);
+        break;
+        }
+      case LBA_Double:
+        {
+        double v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, v);
+        break;
+        }
+      case LBA_Pointer:
+        {
+        void* v;
+        if (!get(&v, sizeof(v))) return -1;
+        n = snprintf(dst, rem, sf, v);
+        break;
+        }
+      case LBA_String:
+        {
+        uint8_t kind;
+        const char* s;
+        if (!get(&kind, sizeof(kind))) return -1;
+        if (kind == 1)
+          {
+          uint32_t id;
+          if (!get(&id, sizeof(id))) return -1;
+          s = resolve ? resolve(id) : NULL;
+          if (!s) s = "(?)";
+          }
+        else
+          {
+          uint16_t len;
+          if (!get(&len, sizeof(len)) || pos + len > argsize) return -1;
+          str.assign((const char*)args + pos, len);
+          pos += len;
+          s = str.c_str();
+          }
+        n = snprintf(dst, rem, sf, s);
+        break;
+        }
+      default:
+        return -1;
+      }
+    if (n < 0)
+      return -1;
+    out += n;
+    }
+
+  if (buffer && size)
+    buffer[(out < size) ? out : size-1] = 0;
+  return out;
+  }
+
+/**
+ * LogBinaryStringRefs: call back for all constant string ids used by a message
+ *  - returns false on invalid data
+ */
+bool LogBinaryStringRefs(const char* fmt, const uint8_t* args, size_t argsize,
+  std::function<void(uint32_t id)> callback)
+  {
+  size_t pos = 0;
+  const char* p = fmt;
+  logbin_spec_t spec;
+  while (NextSpec(p, spec))
+    {
+    if (spec.widthstar) pos += sizeof(int32_t);
+    if (spec.precstar) pos += sizeof(int32_t);
+    if (spec.type == LBA_String)
+      {
+      if (pos >= argsize)
+        return false;
+      if (args[pos++] == 1)
+        {
+        uint32_t id;
+        if (pos + sizeof(id) > argsize)
+          return false;
+        memcpy(&id, args + pos, sizeof(id));
+        pos += sizeof(id);
+        callback(id);
+        }
+      else
+        {
+        uint16_t len;
+        if (pos + sizeof(len) > argsize)
+          return false;
+        memcpy(&len, args + pos, sizeof(len));
+        pos += sizeof(len) + len;
+        }
+      }
+    else if (spec.type == LBA_Unsupported)
+      return false;
+    else
+      pos += ArgSize(spec.type);
+    }
+  return (pos <= argsize);
+  }
+
+/**
+ * LogBinaryTimestamp: get the system timestamp [ms] of an ESP log message
+ *  (format: [color escape] "X (%u) %s: …", IDF 5: "X (%lu) %s: …")
+ */
+bool LogBinaryTimestamp(const char* fmt, const uint8_t* args, size_t argsize, uint32_t* ms)
+  {
+  const char* p = fmt;
+  while (p[0] == '\033' && p[1] == '[')
+    {
+    for (p += 2; *p && *p++ != 'm'; ) ;
+    }
+  if (!p[0] || p[1] != ' ' || p[2] != '(' || p[3] != '%')
+    return false;
+  p += 3;
+  logbin_spec_t spec;
+  if (!NextSpec(p, spec) || spec.widthstar || spec.precstar)
+    return false;
+  if (spec.type == LBA_Int && argsize >= sizeof(uint32_t))
+    {
+    memcpy(ms, args, sizeof(uint32_t));
+    return true;
+    }
+  else if (spec.type == LBA_Long && argsize >= sizeof(long))
+    {
+    long v;
+    memcpy(&v, args, sizeof(v));
+    *ms = (uint32_t) v;
+    return true;
+    }
+  return false;
+  }
+
+/**
+ * LogFormatTimestamp: render a log file timestamp ("YYYY-MM-DD HH:MM:SS.mmm TZ ")
+ */
+size_t LogFormatTimestamp(char* buffer, size_t size, const struct timeval* stamp)
+  {
+  struct tm tmu;
+  localtime_r(&stamp->tv_sec, &tmu);
+  size_t len = strftime(buffer, size, "%Y-%m-%d %H:%M:%S", &tmu);
+  len += snprintf(buffer+len, size-len, ".%03lu ", (unsigned long)stamp->tv_usec / 1000);
+  if (len < size)
+    len += strftime(buffer+len, size-len, "%Z ", &tmu);
+  return len;
+  }
+
+
+/**
+ * LogBinaryFile: binary log file writer & decoder
+ */
+
+LogBinaryFile::LogBinaryFile()
+  {
+  }
+
+size_t LogBinaryFile::WriteRecord(FILE* file, char type, const void* data1, size_t len1, const void* data2, size_t len2)
+  {
+  size_t len = len1 + len2;
+  if (len > 0xffff)
+    return 0;
+  uint8_t hdr[3] = { (uint8_t)type, (uint8_t)(len & 0xff), (uint8_t)(len >> 8) };
+  size_t written = fwrite(hdr, 1, sizeof(hdr), file);
+  if (len1)
+    written += fwrite(data1, 1, len1, file);
+  if (len2)
+    written += fwrite(data2, 1, len2, file);
+  return written;
+  }
+
+size_t LogBinaryFile::Define(FILE* file, char type, uint32_t id)
+  {
+  if (m_defined.count(id))
+    return 0;
+  m_defined.insert(id);
+  const char* str = (const char*)(uintptr_t)id;
+  if (!LogBinaryConstant(str))
+    str = "(?)";
+  return WriteRecord(file, type, &id, sizeof(id), str, strlen(str));
+  }
+
+/**
+ * WriteHeader: start a new log session in the file (resets the id dictionary)
+ */
+size_t LogBinaryFile::WriteHeader(FILE* file, const char* info)
+  {
+  m_defined.clear();
+  std::string hdr = LOGBIN_MAGIC;
+  hdr.append(" ");
+  hdr.append(info);
+  return WriteRecord(file, LBR_Header, hdr.data(), hdr.size(), NULL, 0);
+  }
+
+size_t LogBinaryFile::WriteLog(FILE* file, const struct timeval* stamp, uint32_t fmtid, const uint8_t* args, size_t argsize)
+  {
+  const char* fmt = (const char*)(uintptr_t)fmtid;
+  if (!LogBinaryConstant(fmt))
+    return 0;
+  size_t written = Define(file, LBR_Format, fmtid);
+  LogBinaryStringRefs(fmt, args, argsize, [&](uint32_t id)
+    {
+    written += Define(file, LBR_String, id);
+    });
+  uint8_t hdr[10];
+  uint32_t sec = stamp->tv_sec;
+  uint16_t msec = stamp->tv_usec / 1000;
+  memcpy(hdr, &sec, 4);
+  memcpy(hdr+4, &msec, 2);
+  memcpy(hdr+6, &fmtid, 4);
+  return written + WriteRecord(file, LBR_Log, hdr, sizeof(hdr), args, argsize);
+  }
+
+size_t LogBinaryFile::WriteText(FILE* file, const struct timeval* stamp, const char* text, size_t len)
+  {
+  uint8_t hdr[6];
+  uint32_t sec = stamp->tv_sec;
+  uint16_t msec = stamp->tv_usec / 1000;
+  memcpy(hdr, &sec, 4);
+  memcpy(hdr+4, &msec, 2);
+  return WriteRecord(file, LBR_Text, hdr, sizeof(hdr), text, len);
+  }
+
+/**
+ * Check: test if the file is a binary log file
+ */
+bool LogBinaryFile::Check(const char* path)
+  {
+  FILE* file = fopen(path, "r");
+  if (!file)
+    return false;
+  char hdr[3+sizeof(LOGBIN_MAGIC)-1];
+  bool binary = (fread(hdr, 1, sizeof(hdr), file) == sizeof(hdr) &&
+    hdr[0] == LBR_Header && memcmp(hdr+3, LOGBIN_MAGIC, sizeof(LOGBIN_MAGIC)-1) == 0);
+  fclose(file);
+  return binary;
+  }
+
+/**
+ * Decode: render a binary log file as text
+ *  - output goes to the writer or to the file out
+ *  - lines: number of log lines decoded
+ *  - returns false if the file is not a binary log file
+ */
+bool LogBinaryFile::Decode(FILE* in, OvmsWriter* writer, FILE* out, int* lines)
+  {
+  std::map<uint32_t, std::string> dict;
+  std::string payload, text;
+  uint8_t hdr[3];
+  char tb[64];
+  bool valid = false;
+  *lines = 0;
+
+  auto resolve = [&](uint32_t id) -> const char*
+    {
+    auto it = dict.find(id);
+    return (it != dict.end()) ? it->second.c_str() : NULL;
+    };
+  auto output = [&](const std::string& line)
+    {
+    if (out)
+      fwrite(line.data(), 1, line.size(), out);
+    else
+      writer->write(line.data(), line.size());
+    };
+
+  while (fread(hdr, 1, sizeof(hdr), in) == sizeof(hdr))
+    {
+    size_t len = hdr[1] | (hdr[2] << 8);
+    payload.resize(len);
+    if (len && fread(&payload[0], 1, len, in) != len)
+      {
+      ESP_LOGW(TAG, "Decode: truncated record at end of file");
+      break;
+      }
+    const uint8_t* data = (const uint8_t*)payload.data();
+
+    if (hdr[0] == LBR_Header && startsWith(payload, LOGBIN_MAGIC))
+      {
+      dict.clear();
+      valid = true;
+      continue;
+      }
+    else if (!valid)
+      {
+      return false;
+      }
+
+    switch (hdr[0])
+      {
+      case LBR_Format:
+      case LBR_String:
+        {
+        if (len < 4) break;
+        uint32_t id;
+        memcpy(&id, data, 4);
+        dict[id] = payload.substr(4);
+        break;
+        }
+      case LBR_Log:
+      case LBR_Text:
+        {
+        size_t hlen = (hdr[0] == LBR_Log) ? 10 : 6;
+        if (len < hlen) break;
+        uint32_t sec;
+        uint16_t msec;
+        memcpy(&sec, data, 4);
+        memcpy(&msec, data+4, 2);
+        if (hdr[0] == LBR_Text)
+          {
+          text.assign(payload, hlen, std::string::npos);
+          }
+        else
+          {
+          uint32_t fmtid;
+          memcpy(&fmtid, data+6, 4);
+          const char* fmt = resolve(fmtid);
+          int tlen = fmt ? LogBinaryFormat(NULL, 0, fmt, data+hlen, len-hlen, resolve) : -1;
+          if (tlen < 0)
+            {
+            text = "[undecodable log record]\n";
+            }
+          else
+            {
+            text.resize(tlen+1);
+            LogBinaryFormat(&text[0], tlen+1, fmt, data+hlen, len-hlen, resolve);
+            text.resize(tlen);
+            }
+          }
+        std::string line;
+        if (sec)
+          {
+          struct timeval stamp = { (time_t)sec, (suseconds_t)msec * 1000 };
+          line.assign(tb, LogFormatTimestamp(tb, sizeof(tb), &stamp));
+          }
+        line.append(stripesc(text.c_str()));
+        output(line);
+        (*lines)++;
+        break;
+        }
+      default:
+        break;
+      }
+    }
+
+  return valid;
+  }
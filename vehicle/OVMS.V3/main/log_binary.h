@@ -0,0 +1,104 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __LOG_BINARY_H__
+#define __LOG_BINARY_H__
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <string>
+#include <set>
+#include <map>
+#include <functional>
+#include <sys/time.h>
+
+class OvmsWriter;
+
+// Binary log format: deferred formatting of log messages
+//
+// A binary log message consists of the format string id (its address in the
+// flash rodata segment) and the raw arguments. Strings are stored inline,
+// unless they are constants in flash, which are stored by id as well.
+// Messages using non-constant format strings or unsupported conversions
+// (%n, long double, wide chars) need to be logged as text.
+//
+// Binary log files consist of records of [type:1][length:2][payload], with
+// the header record resetting the id dictionary (file appended to after a
+// firmware change) and format/string records defining the ids before use.
+// The raw argument encoding depends on the CPU architecture, so the files
+// are decoded on the module ("log decode").
+
+#define LOGBIN_MAGIC            "OVMSLOG1"
+
+typedef enum
+  {
+  LBR_Header    = 'H',          // payload: magic, firmware version
+  LBR_Format    = 'F',          // payload: id:4, format string
+  LBR_String    = 'S',          // payload: id:4, string
+  LBR_Log       = 'L',          // payload: sec:4, msec:2, format id:4, arguments
+  LBR_Text      = 'X',          // payload: sec:4, msec:2, text
+  } logbin_record_t;
+
+typedef std::function<const char*(uint32_t id)> LogBinaryResolver;
+
+extern bool LogBinaryConstant(const void* ptr);
+extern int LogBinaryEncode(uint8_t* buffer, size_t size, const char* fmt, va_list args)
+  __attribute__ ((format (printf, 3, 0)));
+extern int LogBinaryFormat(char* buffer, size_t size, const char* fmt,
+  const uint8_t* args, size_t argsize, LogBinaryResolver resolve);
+extern bool LogBinaryStringRefs(const char* fmt, const uint8_t* args, size_t argsize,
+  std::function<void(uint32_t id)> callback);
+extern bool LogBinaryTimestamp(const char* fmt, const uint8_t* args, size_t argsize, uint32_t* ms);
+extern size_t LogFormatTimestamp(char* buffer, size_t size, const struct timeval* stamp);
+
+class LogBinaryFile
+  {
+  public:
+    LogBinaryFile();
+
+  public:
+    size_t WriteHeader(FILE* file, const char* info);
+    size_t WriteLog(FILE* file, const struct timeval* stamp, uint32_t fmtid, const uint8_t* args, size_t argsize);
+    size_t WriteText(FILE* file, const struct timeval* stamp, const char* text, size_t len);
+
+  public:
+    static bool Check(const char* path);
+    static bool Decode(FILE* in, OvmsWriter* writer, FILE* out, int* lines);
+
+  protected:
+    size_t WriteRecord(FILE* file, char type, const void* data1, size_t len1, const void* data2, size_t len2);
+    size_t Define(FILE* file, char type, uint32_t id);
+
+  protected:
+    std::set<uint32_t> m_defined;
+  };
+
+#endif //#ifndef __LOG_BINARY_H__
@@ -0,0 +1,606 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "logring";
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "log_ring.h"
+#include "log_binary.h"
+#include "ovms_command.h"
+#include "ovms_malloc.h"
+
+#define LOGRING_PAD             0xffff  // Record length marking a padding record
+#define LOGRING_BINARY          0x8000  // Record length flag marking a deferred record
+
+static_assert(sizeof(std::atomic<uint32_t>) == 4, "LogRing record header needs 32 bit atomics");
+
+LogRing::LogRing()
+  {
+  m_buffer = NULL;
+  m_size = m_mask = m_maxrecord = 0;
+  m_head = 0;
+  m_records = 0;
+  m_truncated = 0;
+  m_deferrals = 0;
+  m_deferred = false;
+  for (int i = 0; i < LOGRING_MAXREADERS; i++)
+    {
+    reader_t& r = m_readers[i];
+    r.active = false;
+    r.busy = 0;
+    r.signalled = false;
+    r.cursor = 0;
+    r.lost = 0;
+    r.overruns = 0;
+    r.lostread = r.peekpos = r.peeksize = r.records = 0;
+    r.render = NULL;
+    r.name = NULL;
+    r.notify = NULL;
+    r.ctx = NULL;
+    }
+  }
+
+LogRing::~LogRing()
+  {
+  if (m_buffer)
+    free(m_buffer);
+  for (int i = 0; i < LOGRING_MAXREADERS; i++)
+    {
+    if (m_readers[i].render)
+      free(m_readers[i].render);
+    }
+  }
+
+/**
+ * Init: allocate the ring buffer
+ *  - size will be rounded down to a power of two
+ *  - single records are limited to 1/4 of the ring size (max 32K)
+ */
+bool LogRing::Init(size_t size)
+  {
+  if (m_buffer)
+    return true;
+  uint32_t pow2 = 1024;
+  while (pow2 < 0x100000 && (pow2 << 1) <= size)
+    pow2 <<= 1;
+  m_buffer = (uint8_t*) ExternalRamCalloc(pow2, 1);
+  if (!m_buffer)
+    {
+    ESP_LOGE(TAG, "Init: unable to allocate %" PRIu32 " bytes", pow2);
+    return false;
+    }
+  m_size = pow2;
+  m_mask = pow2 - 1;
+  m_maxrecord = (pow2 / 4 < LOGRING_BINARY) ? pow2 / 4 : LOGRING_BINARY - LOGRING_ALIGN;
+  // Invalidate the (zero) record positions in the new buffer:
+  for (uint32_t pos = 0; pos < m_size; pos += LOGRING_ALIGN)
+    Record(pos)->pos = pos + 1;
+  return true;
+  }
+
+/**
+ * FixLineEnds: replace CR/LF except the last one by "|" (see LogBuffer()),
+ *  but don't leave '|' at the end.
+ *  An ESC sequence to change color may be appended after the log text.
+ *  - returns the new text length
+ */
+static size_t FixLineEnds(char* buffer)
+  {
+  char* s;
+  for (s=buffer; *s; s++)
+    {
+    if (*s=='\r' || *s=='\n')
+      {
+      char *t = s;
+      if (*(s+1) == '\033')
+        ++s;
+      else if (*(s+1) != '\0')
+        {
+        *s = '|';
+        continue;
+        }
+      while (t > buffer && *(t-1) == '|')
+        --t;
+      while ((*t++ = *s++)) ;
+      s = t - 1;
+      break;
+      }
+    }
+  while (*s) s++;
+  return s - buffer;
+  }
+
+/**
+ * Write: format a log message into the ring
+ *  - prefix: optional text to prepend (partial log output)
+ *  - in deferred mode, messages with constant formats are stored in binary form
+ *  - returns the formatted (or encoded) length of fmt/args or -1 on error
+ */
+int LogRing::Write(const char* prefix, const char* fmt, va_list args)
+  {
+  if (!m_buffer)
+    return -1;
+
+  // Try binary encoding:
+  if (m_deferred && !prefix && LogBinaryConstant(fmt))
+    {
+    int ret = LogBinaryEncode(NULL, 0, fmt, args);
+    uint32_t need = (sizeof(record_t) + sizeof(uint32_t) + ret + LOGRING_ALIGN-1) & ~(LOGRING_ALIGN-1);
+    if (ret >= 0 && need <= m_maxrecord)
+      {
+      uint32_t pos = Reserve(need);
+      uint8_t* buffer = (uint8_t*)(Record(pos) + 1);
+      uint32_t fmtid = (uint32_t)(uintptr_t)fmt;
+      memcpy(buffer, &fmtid, sizeof(fmtid));
+      LogBinaryEncode(buffer + sizeof(fmtid), ret, fmt, args);
+      m_deferrals++;
+      Commit(pos, need, (sizeof(fmtid) + ret) | LOGRING_BINARY);
+      return ret;
+      }
+    }
+
+  // Get the record size:
+  va_list args2;
+  va_copy(args2, args);
+  int ret = vsnprintf(NULL, 0, fmt, args2);
+  va_end(args2);
+  if (ret < 0)
+    return ret;
+  size_t plen = prefix ? strlen(prefix) : 0;
+  uint32_t need = (sizeof(record_t) + plen + ret + 1 + LOGRING_ALIGN-1) & ~(LOGRING_ALIGN-1);
+  if (need > m_maxrecord)
+    {
+    need = m_maxrecord;
+    m_truncated++;
+    }
+
+  // Reserve & fill:
+  uint32_t pos = Reserve(need);
+  char* buffer = (char*)(Record(pos) + 1);
+  size_t cap = need - sizeof(record_t);
+  size_t len = 0;
+  if (plen)
+    {
+    len = (plen < cap) ? plen : cap - 1;
+    memcpy(buffer, prefix, len);
+    }
+  vsnprintf(buffer + len, cap - len, fmt, args);
+  if (len + ret >= cap)
+    buffer[cap-2] = '\n';    // keep the line end on truncated records
+
+  Commit(pos, need, FixLineEnds(buffer));
+  return ret;
+  }
+
+/**
+ * Reserve: reserve space for a record of the given size
+ *  - skips the rest of the buffer if the record does not fit
+ *  - returns the record position
+ */
+uint32_t LogRing::Reserve(uint32_t need)
+  {
+  uint32_t head = m_head.load(std::memory_order_relaxed);
+  uint32_t pad, pos;
+  do
+    {
+    uint32_t room = m_size - (head & m_mask);
+    pad = (room < need) ? room : 0;
+    pos = head + pad;
+    } while (!m_head.compare_exchange_weak(head, pos + need));
+
+  // Readers with unread data in our reservation need to be pushed forward:
+  Overrun(pos + need - m_size, head);
+
+  if (pad)
+    {
+    record_t* rec = Record(head);
+    rec->size = pad;
+    rec->len = LOGRING_PAD;
+    rec->pos.store(head, std::memory_order_release);
+    }
+  return pos;
+  }
+
+/**
+ * Commit: publish a filled record to the readers
+ */
+void LogRing::Commit(uint32_t pos, uint32_t need, uint32_t len)
+  {
+  record_t* rec = Record(pos);
+  rec->size = need;
+  rec->len = len;
+
+  // Don't commit if other producers have lapped us while formatting:
+  if ((int32_t)(m_head.load() - (pos + m_size)) > 0)
+    return;
+  rec->pos.store(pos, std::memory_order_release);
+  m_records++;
+
+  Notify();
+  }
+
+/**
+ * Overrun: move readers having unread data before limit forward
+ *  - readers are moved to the first record boundary at or after limit,
+ *    i.e. the oldest record surviving the reservation
+ *  - if the record chain cannot be followed up to limit (records being
+ *    overwritten by concurrent producers), the reader is moved to head
+ */
+void LogRing::Overrun(uint32_t limit, uint32_t head)
+  {
+  for (int i = 0; i < LOGRING_MAXREADERS; i++)
+    {
+    reader_t& r = m_readers[i];
+    if (!r.active)
+      continue;
+    uint32_t cursor = r.cursor.load();
+    while ((int32_t)(limit - cursor) > 0)
+      {
+      // Count the records to be skipped & find the first surviving record:
+      uint32_t cnt = 0;
+      uint32_t pos = cursor;
+      while ((int32_t)(limit - pos) > 0)
+        {
+        record_t* rec = Record(pos);
+        if (rec->pos.load(std::memory_order_acquire) != pos || rec->size < LOGRING_ALIGN
+            || cnt >= m_size / LOGRING_ALIGN)
+          {
+          cnt++;
+          pos = head;
+          break;
+          }
+        if (rec->len != LOGRING_PAD)
+          cnt++;
+        pos += rec->size;
+        }
+      if ((int32_t)(pos - head) > 0)
+        pos = head;
+      if (r.cursor.compare_exchange_weak(cursor, pos))
+        {
+        r.lost += cnt;
+        r.overruns++;
+        break;
+        }
+      }
+    }
+  }
+
+/**
+ * Notify: signal new records to readers not yet signalled
+ */
+void LogRing::Notify()
+  {
+  for (int i = 0; i < LOGRING_MAXREADERS; i++)
+    {
+    reader_t& r = m_readers[i];
+    if (!r.active)
+      continue;
+    r.busy++;
+    if (r.active && r.notify && !r.signalled.exchange(true))
+      {
+      if (!r.notify(r.ctx))
+        r.signalled = false;
+      }
+    r.busy--;
+    }
+  }
+
+/**
+ * AddReader: register a reader, starting at the current head
+ *  - notify: called from the logging task context on new records, must not block
+ *  - returns the reader id or -1 if all reader slots are in use
+ */
+int LogRing::AddReader(const char* name, LogRingNotify notify, void* ctx)
+  {
+  OvmsMutexLock lock(&m_readers_mutex);
+  for (int i = 0; i < LOGRING_MAXREADERS; i++)
+    {
+    reader_t& r = m_readers[i];
+    if (r.active || r.busy)
+      continue;
+    r.name = name;
+    r.notify = notify;
+    r.ctx = ctx;
+    r.signalled = false;
+    r.lost = 0;
+    r.overruns = 0;
+    r.lostread = r.peekpos = r.peeksize = r.records = 0;
+    r.cursor = m_head.load();
+    r.active = true;
+    return i;
+    }
+  return -1;
+  }
+
+/**
+ * RemoveReader: unregister a reader
+ *  - waits for running notifications to finish, so the ctx can be freed after return
+ */
+void LogRing::RemoveReader(int reader)
+  {
+  if (reader < 0 || reader >= LOGRING_MAXREADERS)
+    return;
+  OvmsMutexLock lock(&m_readers_mutex);
+  reader_t& r = m_readers[reader];
+  r.active = false;
+  while (r.busy)
+    vTaskDelay(1);
+  if (r.render)
+    {
+    free(r.render);
+    r.render = NULL;
+    }
+  }
+
+/**
+ * Acknowledge: reenable notifications, call before reading the available records
+ */
+void LogRing::Acknowledge(int reader)
+  {
+  if (reader < 0 || reader >= LOGRING_MAXREADERS)
+    return;
+  m_readers[reader].signalled = false;
+  }
+
+/**
+ * Next: get the next committed record at or after the cursor, skipping padding
+ *  - returns NULL if no record is available
+ */
+LogRing::record_t* LogRing::Next(reader_t& r, uint32_t& cursor)
+  {
+  for (;;)
+    {
+    record_t* rec = Record(cursor);
+    if (rec->pos.load(std::memory_order_acquire) != cursor)
+      return NULL;
+    uint32_t size = rec->size;
+    if (size < LOGRING_ALIGN || size > m_size - (cursor & m_mask))
+      {
+      // Record has been overwritten, the cursor should have been moved:
+      uint32_t moved = r.cursor.load();
+      if (moved == cursor)
+        return NULL;
+      cursor = moved;
+      continue;
+      }
+    if (rec->len == LOGRING_PAD)
+      {
+      if (r.cursor.compare_exchange_strong(cursor, cursor + size))
+        cursor += size;
+      continue;
+      }
+    return rec;
+    }
+  }
+
+/**
+ * Peek: get the next record for the reader
+ *  - the text is not necessarily NUL terminated if the reader has been overrun,
+ *    so always use the length returned
+ *  - deferred records are rendered into the reader's buffer, valid until
+ *    the next call
+ *  - returns false if no record is available
+ */
+bool LogRing::Peek(int reader, const char** text, size_t* len)
+  {
+  if (!m_buffer || reader < 0 || reader >= LOGRING_MAXREADERS)
+    return false;
+  reader_t& r = m_readers[reader];
+  uint32_t cursor = r.cursor.load(std::memory_order_acquire);
+  for (;;)
+    {
+    record_t* rec = Next(r, cursor);
+    if (!rec)
+      return false;
+    uint32_t size = rec->size;
+    uint32_t reclen = rec->len;
+    if (reclen & LOGRING_BINARY)
+      {
+      reclen &= ~LOGRING_BINARY;
+      if (reclen > size - sizeof(record_t))
+        reclen = size - sizeof(record_t);
+      *len = Render(r, cursor, rec, reclen, text);
+      if (*len == 0)
+        {
+        // Overrun while copying the record:
+        cursor = r.cursor.load();
+        continue;
+        }
+      }
+    else
+      {
+      if (reclen > size - sizeof(record_t) - 1)
+        reclen = size - sizeof(record_t) - 1;
+      *text = (const char*)(rec + 1);
+      *len = reclen;
+      }
+    r.peekpos = cursor;
+    r.peeksize = size;
+    return true;
+    }
+  }
+
+/**
+ * Render: format a deferred record into the reader's render buffer
+ *  - the record is copied first to be safe from overruns while formatting
+ *  - returns the text length or 0 if the reader has been overrun
+ */
+size_t LogRing::Render(reader_t& r, uint32_t cursor, const record_t* rec, uint32_t len, const char** text)
+  {
+  static const char nomem[] = "[log record not rendered: out of memory]\n";
+  static const char invalid[] = "[log record not rendered: invalid data]\n";
+  if (!r.render)
+    r.render = (char*) ExternalRamMalloc(2 * m_maxrecord);
+  if (!r.render)
+    {
+    if (r.cursor.load() != cursor)
+      return 0;
+    *text = nomem;
+    return sizeof(nomem) - 1;
+    }
+
+  uint8_t* data = (uint8_t*)r.render + m_maxrecord;
+  memcpy(data, rec + 1, len);
+  if (r.cursor.load() != cursor)
+    return 0;
+
+  uint32_t fmtid;
+  const char* fmt;
+  int tlen = -1;
+  if (len >= sizeof(fmtid))
+    {
+    memcpy(&fmtid, data, sizeof(fmtid));
+    fmt = (const char*)(uintptr_t)fmtid;
+    if (LogBinaryConstant(fmt))
+      {
+      tlen = LogBinaryFormat(r.render, m_maxrecord, fmt, data + sizeof(fmtid), len - sizeof(fmtid),
+        [](uint32_t id) -> const char*
+          {
+          const char* str = (const char*)(uintptr_t)id;
+          return LogBinaryConstant(str) ? str : NULL;
+          });
+      }
+    }
+  if (tlen < 0)
+    {
+    *text = invalid;
+    return sizeof(invalid) - 1;
+    }
+  *text = r.render;
+  if ((uint32_t)tlen >= m_maxrecord)
+    r.render[m_maxrecord-2] = '\n';    // keep the line end on truncated records
+  return FixLineEnds(r.render);
+  }
+
+/**
+ * Advance: mark the record returned by Peek() as read
+ *  - returns false if the reader has been overrun while processing the record,
+ *    i.e. the record may have been overwritten
+ */
+bool LogRing::Advance(int reader)
+  {
+  if (reader < 0 || reader >= LOGRING_MAXREADERS)
+    return false;
+  reader_t& r = m_readers[reader];
+  uint32_t pos = r.peekpos;
+  r.records++;
+  return r.cursor.compare_exchange_strong(pos, pos + r.peeksize);
+  }
+
+/**
+ * Read: copy the next record & mark it as read
+ *  - binary: set for deferred records (format id + arguments, see log_binary.h)
+ *  - text records are copied without the NUL, truncated to the buffer size
+ *  - returns false if no record is available
+ */
+bool LogRing::Read(int reader, uint8_t* buffer, size_t size, size_t* len, bool* binary)
+  {
+  if (!m_buffer || reader < 0 || reader >= LOGRING_MAXREADERS)
+    return false;
+  reader_t& r = m_readers[reader];
+  uint32_t cursor = r.cursor.load(std::memory_order_acquire);
+  for (;;)
+    {
+    record_t* rec = Next(r, cursor);
+    if (!rec)
+      return false;
+    uint32_t recsize = rec->size;
+    uint32_t reclen = rec->len;
+    bool bin = (reclen & LOGRING_BINARY);
+    reclen &= ~LOGRING_BINARY;
+    if (reclen > recsize - sizeof(record_t))
+      reclen = recsize - sizeof(record_t);
+    if (reclen > size)
+      reclen = size;
+    memcpy(buffer, rec + 1, reclen);
+    if (!r.cursor.compare_exchange_strong(cursor, cursor + recsize))
+      continue;   // overrun, cursor has been reloaded
+    r.records++;
+    *len = reclen;
+    *binary = bin;
+    return true;
+    }
+  }
+
+/**
+ * GetLost: get number of records lost since the last call
+ */
+uint32_t LogRing::GetLost(int reader)
+  {
+  if (reader < 0 || reader >= LOGRING_MAXREADERS)
+    return 0;
+  reader_t& r = m_readers[reader];
+  uint32_t lost = r.lost;
+  uint32_t cnt = lost - r.lostread;
+  r.lostread = lost;
+  return cnt;
+  }
+
+int LogRing::GetReaderCount()
+  {
+  int cnt = 0;
+  for (int i = 0; i < LOGRING_MAXREADERS; i++)
+    {
+    if (m_readers[i].active)
+      cnt++;
+    }
+  return cnt;
+  }
+
+void LogRing::ShowStatus(OvmsWriter* writer)
+  {
+  uint32_t head = m_head;
+  writer->printf(
+    "Log ring status    : %s\n"
+    "  Ring size        : %" PRIu32 " bytes\n"
+    "  Messages written : %" PRIu32 "\n"
+    "  Messages cut     : %" PRIu32 "\n"
+    "  Messages deferred: %" PRIu32 "%s\n"
+    , m_buffer ? "active" : "inactive"
+    , m_size
+    , m_records.load()
+    , m_truncated.load()
+    , m_deferrals.load()
+    , m_deferred ? " (deferred mode)" : "");
+  for (int i = 0; i < LOGRING_MAXREADERS; i++)
+    {
+    reader_t& r = m_readers[i];
+    if (!r.active)
+      continue;
+    writer->printf("  Reader #%-2d %-10s: %" PRIu32 " read, %" PRIu32 " lost in %" PRIu32 " overruns, backlog %" PRIu32 " bytes\n"
+      , i, r.name ? r.name : "-"
+      , r.records, r.lost.load(), r.overruns.load()
+      , head - r.cursor.load());
+    }
+  }
@@ -0,0 +1,145 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __LOG_RING_H__
+#define __LOG_RING_H__
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <atomic>
+#include "ovms_mutex.h"
+
+class OvmsWriter;
+
+#define LOGRING_MAXREADERS      16      // Max number of concurrent readers
+#define LOGRING_ALIGN           8       // Record alignment = header size
+
+// LogRing: lock free multi producer log message ring
+//
+// Log messages are formatted directly into a fixed size ring buffer (allocated
+// in PSRAM if available). Producers reserve space by an atomic compare & swap
+// on the head position, so any task can log without taking a lock or doing a
+// heap allocation. A reservation is committed by writing the record position
+// into the record header last, so readers see complete records only.
+//
+// Each reader (console, file logger, websocket client) owns a cursor into the
+// ring and reads the records in place, i.e. without copying. Readers are
+// notified on new records via their callback, at most once until they call
+// Acknowledge().
+//
+// Readers never block producers: if a reader falls more than a ring size
+// behind, producers move the reader's cursor forward and count the skipped
+// records as lost for that reader. A record being read while the reader is
+// overrun may get overwritten, Advance() returns false in that case.
+//
+// In deferred mode, log messages with constant format strings are stored in
+// binary form (see log_binary.h) instead of being formatted by the producer.
+// Peek() renders these into a per reader buffer, Read() passes them on as is.
+
+typedef bool (*LogRingNotify)(void* ctx);
+
+class LogRing
+  {
+  public:
+    LogRing();
+    ~LogRing();
+
+  public:
+    bool Init(size_t size);
+    bool IsReady() { return m_buffer != NULL; }
+
+  public:
+    int Write(const char* prefix, const char* fmt, va_list args) __attribute__ ((format (printf, 3, 0)));
+    void SetDeferred(bool deferred) { m_deferred = deferred; }
+    bool GetDeferred() { return m_deferred; }
+    uint32_t GetMaxRecord() { return m_maxrecord; }
+
+  public:
+    int AddReader(const char* name, LogRingNotify notify, void* ctx);
+    void RemoveReader(int reader);
+    void Acknowledge(int reader);
+    bool Peek(int reader, const char** text, size_t* len);
+    bool Advance(int reader);
+    bool Read(int reader, uint8_t* buffer, size_t size, size_t* len, bool* binary);
+    uint32_t GetLost(int reader);
+    int GetReaderCount();
+    void ShowStatus(OvmsWriter* writer);
+
+  protected:
+    typedef struct
+      {
+      std::atomic<uint32_t> pos;        // Ring position of the record, written last (commit)
+      uint16_t size;                    // Record size including header & alignment
+      uint16_t len;                     // Text length excluding NUL, LOGRING_PAD = padding,
+                                        //  LOGRING_BINARY flag = deferred record
+      } record_t;
+
+    typedef struct
+      {
+      std::atomic<bool> active;
+      std::atomic<int> busy;            // Producers currently notifying this reader
+      std::atomic<bool> signalled;      // Notification pending
+      std::atomic<uint32_t> cursor;     // Ring position of next record to read
+      std::atomic<uint32_t> lost;       // Records skipped due to overrun
+      std::atomic<uint32_t> overruns;   // Number of overruns
+      uint32_t lostread;                // Lost records already reported to reader
+      uint32_t peekpos;                 // Position & size of record returned by Peek()
+      uint32_t peeksize;
+      uint32_t records;                 // Records read
+      char* render;                     // Buffer for rendering deferred records
+      const char* name;
+      LogRingNotify notify;
+      void* ctx;
+      } reader_t;
+
+  protected:
+    record_t* Record(uint32_t pos) { return (record_t*)(m_buffer + (pos & m_mask)); }
+    uint32_t Reserve(uint32_t need);
+    void Commit(uint32_t pos, uint32_t need, uint32_t len);
+    void Overrun(uint32_t limit, uint32_t head);
+    record_t* Next(reader_t& r, uint32_t& cursor);
+    size_t Render(reader_t& r, uint32_t cursor, const record_t* rec, uint32_t len, const char** text);
+    void Notify();
+
+  protected:
+    uint8_t* m_buffer;
+    uint32_t m_size;
+    uint32_t m_mask;
+    uint32_t m_maxrecord;
+    std::atomic<uint32_t> m_head;       // Next free ring position
+    std::atomic<uint32_t> m_records;    // Records written
+    std::atomic<uint32_t> m_truncated;  // Records truncated to m_maxrecord
+    std::atomic<uint32_t> m_deferrals;  // Records written in binary form
+    volatile bool m_deferred;
+    reader_t m_readers[LOGRING_MAXREADERS];
+    OvmsMutex m_readers_mutex;
+  };
+
+#endif //#ifndef __LOG_RING_H__
@@ -0,0 +1,545 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#include "ovms_log.h"
+static const char *TAG = "metrics-history";
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "metrics_history.h"
+#include "ovms_command.h"
+#include "ovms_config.h"
+#include "ovms_events.h"
+#include "ovms_malloc.h"
+#include "ovms_utils.h"
+
+OvmsMetricsHistory MyMetricsHistory __attribute__ ((init_priority (1815)));
+
+static const struct
+  {
+  const char* name;
+  uint32_t period;
+  uint16_t size;
+  uint16_t width;
+  } history_tiers[MHT_Count] =
+  {
+  { "1s",   1,    METRICS_HISTORY_SIZE_1S,  1 },
+  { "1m",   60,   METRICS_HISTORY_SIZE_1M,  3 },
+  { "15m",  900,  METRICS_HISTORY_SIZE_15M, 3 },
+  };
+
+////////////////////////////////////////////////////////////////////////
+// OvmsMetricHistory
+
+OvmsMetricHistory::OvmsMetricHistory(const std::string& name, float resolution)
+  {
+  m_name = name;
+  m_metric = NULL;
+  m_resolution = (resolution > 0) ? resolution : METRICS_HISTORY_RESOLUTION;
+  m_units = Other;
+
+  // Allocate all rings in one PSRAM block:
+  size_t values = 0;
+  for (int i = 0; i < MHT_Count; i++)
+    values += history_tiers[i].size * history_tiers[i].width;
+  m_memsize = values * sizeof(int32_t);
+  m_mem = (int32_t*) ExternalRamMalloc(m_memsize);
+  if (!m_mem)
+    {
+    ESP_LOGE(TAG, "%s: out of memory", m_name.c_str());
+    m_memsize = 0;
+    }
+
+  int32_t* data = m_mem;
+  for (int i = 0; i < MHT_Count; i++)
+    {
+    tier_t& t = m_tier[i];
+    memset(&t, 0, sizeof(t));
+    t.data = data;
+    t.size = data ? history_tiers[i].size : 0;
+    t.width = history_tiers[i].width;
+    t.period = history_tiers[i].period;
+    if (data) data += t.size * t.width;
+    }
+  }
+
+OvmsMetricHistory::~OvmsMetricHistory()
+  {
+  if (m_mem) free(m_mem);
+  }
+
+const char* OvmsMetricHistory::TierName(metric_history_tier_t tier)
+  {
+  return (tier >= 0 && tier < MHT_Count) ? history_tiers[tier].name : "";
+  }
+
+metric_history_tier_t OvmsMetricHistory::TierFromName(const char* name)
+  {
+  for (int i = 0; i < MHT_Count; i++)
+    {
+    if (strcmp(name, history_tiers[i].name) == 0)
+      return (metric_history_tier_t) i;
+    }
+  return MHT_Count;
+  }
+
+uint32_t OvmsMetricHistory::TierPeriod(metric_history_tier_t tier)
+  {
+  return (tier >= 0 && tier < MHT_Count) ? history_tiers[tier].period : 0;
+  }
+
+int OvmsMetricHistory::GetPrecision()
+  {
+  if (m_resolution >= 1) return 0;
+  int prec = (int) ceilf(-log10f(m_resolution) - 0.001f);
+  return (prec > 6) ? 6 : prec;
+  }
+
+/**
+ * Sample: take the current metric value, called once per second
+ */
+void OvmsMetricHistory::Sample(uint32_t now)
+  {
+  if (!m_mem) return;
+
+  int32_t value = METRICS_HISTORY_NODATA;
+  if (m_metric && m_metric->IsDefined())
+    {
+    float v = roundf(m_metric->AsFloat() / m_resolution);
+    if (isnan(v))
+      value = METRICS_HISTORY_NODATA;
+    else if (v >= 2147483520.0f)
+      value = INT32_MAX;
+    else if (v <= -2147483520.0f)
+      value = INT32_MIN + 1;
+    else
+      value = (int32_t) v;
+    }
+
+  Push(m_tier[MHT_1s], now, &value);
+  Aggregate(m_tier[MHT_1m], now, value);
+  Aggregate(m_tier[MHT_15m], now, value);
+  }
+
+/**
+ * Push: add a slot to a ring, fill gaps since the previous slot
+ */
+void OvmsMetricHistory::Push(tier_t& t, uint32_t slot, const int32_t* values)
+  {
+  if (t.fill)
+    {
+    if (slot <= t.slot)
+      return; // not monotonic
+    uint32_t gap = slot - t.slot - 1;
+    if (gap > t.size) gap = t.size;
+    while (gap--)
+      {
+      int32_t* d = &t.data[t.head * t.width];
+      for (int i = 0; i < t.width; i++)
+        d[i] = METRICS_HISTORY_NODATA;
+      t.head = (t.head + 1) % t.size;
+      if (t.fill < t.size) t.fill++;
+      }
+    }
+  memcpy(&t.data[t.head * t.width], values, t.width * sizeof(int32_t));
+  t.head = (t.head + 1) % t.size;
+  if (t.fill < t.size) t.fill++;
+  t.slot = slot;
+  }
+
+/**
+ * Aggregate: add a sample to the current aggregation slot, push completed slots
+ */
+void OvmsMetricHistory::Aggregate(tier_t& t, uint32_t now, int32_t value)
+  {
+  uint32_t slot = now / t.period;
+  if (t.acc_active && slot != t.acc_slot)
+    Flush(t);
+  if (!t.acc_active)
+    {
+    t.acc_active = true;
+    t.acc_slot = slot;
+    t.acc_cnt = 0;
+    t.acc_sum = 0;
+    t.acc_min = INT32_MAX;
+    t.acc_max = INT32_MIN;
+    }
+  if (value != METRICS_HISTORY_NODATA)
+    {
+    t.acc_cnt++;
+    t.acc_sum += value;
+    if (value < t.acc_min) t.acc_min = value;
+    if (value > t.acc_max) t.acc_max = value;
+    }
+  }
+
+void OvmsMetricHistory::Flush(tier_t& t)
+  {
+  int32_t values[3] = { METRICS_HISTORY_NODATA, METRICS_HISTORY_NODATA, METRICS_HISTORY_NODATA };
+  if (t.acc_cnt)
+    {
+    int64_t half = (t.acc_sum >= 0) ? t.acc_cnt / 2 : -(t.acc_cnt / 2);
+    values[0] = t.acc_min;
+    values[1] = t.acc_max;
+    values[2] = (int32_t) ((t.acc_sum + half) / t.acc_cnt);
+    }
+  Push(t, t.acc_slot, values);
+  t.acc_active = false;
+  }
+
+/**
+ * Foreach: iterate over the completed slots of a tier, oldest first
+ *  span: max age in seconds, 0 = all
+ *  Returns the number of slots passed to the callback
+ */
+int OvmsMetricHistory::Foreach(metric_history_tier_t tier, uint32_t span, MetricHistoryCallback callback)
+  {
+  if (tier < 0 || tier >= MHT_Count) return 0;
+  tier_t& t = m_tier[tier];
+  uint32_t cnt = t.fill;
+  if (span)
+    {
+    uint32_t n = (span + t.period - 1) / t.period;
+    if (n < cnt) cnt = n;
+    }
+  if (cnt == 0) return 0;
+
+  time_t utc = time(NULL);
+  uint32_t mono = monotonictime;
+  uint32_t slot = t.slot - cnt + 1;
+  int index = (t.head + t.size - cnt) % t.size;
+
+  metric_history_point_t p;
+  for (uint32_t i = 0; i < cnt; i++, slot++)
+    {
+    const int32_t* v = &t.data[index * t.width];
+    p.time = utc - (time_t) (mono - slot * t.period);
+    p.defined = (v[0] != METRICS_HISTORY_NODATA);
+    if (!p.defined)
+      p.min = p.max = p.avg = NAN;
+    else if (t.width == 1)
+      p.min = p.max = p.avg = v[0] * m_resolution;
+    else
+      {
+      p.min = v[0] * m_resolution;
+      p.max = v[1] * m_resolution;
+      p.avg = v[2] * m_resolution;
+      }
+    callback(p);
+    index = (index + 1) % t.size;
+    }
+  return cnt;
+  }
+
+////////////////////////////////////////////////////////////////////////
+// Commands
+
+static void metrics_history_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  OvmsMutexLock lock(&MyMetricsHistory.m_mutex);
+  if (MyMetricsHistory.m_map.empty())
+    {
+    writer->puts("No metric history configured.");
+    return;
+    }
+  size_t total = 0;
+  writer->printf("%-40s %10s %6s %6s %6s\n", "Metric", "Resolution", "1s", "1m", "15m");
+  for (auto& kv : MyMetricsHistory.m_map)
+    {
+    OvmsMetricHistory* h = kv.second;
+    writer->printf("%-40s %10g %6d %6d %6d%s\n", h->m_name.c_str(), h->m_resolution,
+      h->GetCount(MHT_1s), h->GetCount(MHT_1m), h->GetCount(MHT_15m),
+      h->m_metric ? "" : " (not registered)");
+    total += h->GetMemory();
+    }
+  writer->printf("Memory used: %u bytes\n", total);
+  }
+
+static void metrics_history_show(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  metric_history_tier_t tier = MHT_1m;
+  uint32_t span = 0;
+  if (argc > 1)
+    {
+    tier = OvmsMetricHistory::TierFromName(argv[1]);
+    if (tier == MHT_Count)
+      {
+      writer->printf("Error: unknown tier '%s' (use 1s, 1m or 15m)\n", argv[1]);
+      return;
+      }
+    }
+  if (argc > 2)
+    span = atol(argv[2]);
+
+  OvmsMutexLock lock(&MyMetricsHistory.m_mutex);
+  OvmsMetricHistory* h = MyMetricsHistory.Find(argv[0]);
+  if (!h)
+    {
+    writer->printf("Error: no history for metric '%s'\n", argv[0]);
+    return;
+    }
+
+  int prec = h->GetPrecision();
+  const char* unit = OvmsMetricUnitLabel(h->m_units);
+  writer->printf("%s [%s] %s:\n", h->m_name.c_str(), unit, OvmsMetricHistory::TierName(tier));
+  int cnt = h->Foreach(tier, span, [writer, tier, prec](const metric_history_point_t& p)
+    {
+    char ts[20];
+    struct tm tmu;
+    localtime_r(&p.time, &tmu);
+    strftime(ts, sizeof(ts), "%Y-%m-%d %H:%M:%S", &tmu);
+    if (!p.defined)
+      writer->printf("%s  -\n", ts);
+    else if (tier == MHT_1s)
+      writer->printf("%s  %.*f\n", ts, prec, p.avg);
+    else
+      writer->printf("%s  min %.*f  max %.*f  avg %.*f\n", ts, prec, p.min, prec, p.max, prec, p.avg);
+    });
+  writer->printf("%d entries\n", cnt);
+  }
+
+static void metrics_history_add(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (!MyMetrics.Find(argv[0]))
+    writer->printf("Warning: metric '%s' is not registered (yet)\n", argv[0]);
+  float resolution = (argc > 1) ? atof(argv[1]) : 0;
+  if (argc > 1 && resolution <= 0)
+    {
+    writer->puts("Error: resolution must be > 0");
+    return;
+    }
+  MyConfig.SetParamValue(METRICS_HISTORY_PARAM, argv[0], (argc > 1) ? argv[1] : "");
+  writer->printf("History for '%s' enabled\n", argv[0]);
+  }
+
+static void metrics_history_remove(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (!MyConfig.IsDefined(METRICS_HISTORY_PARAM, argv[0]))
+    {
+    writer->printf("Error: no history for metric '%s'\n", argv[0]);
+    return;
+    }
+  MyConfig.DeleteInstance(METRICS_HISTORY_PARAM, argv[0]);
+  writer->printf("History for '%s' removed\n", argv[0]);
+  }
+
+#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+
+/**
+ * OvmsMetrics.GetHistory(metric [, tier [, span]])
+ *  Returns object { metric, units, tier, period, resolution, time, data } or undefined
+ *  time: start of the first slot (UTC seconds), data: values (1s) or [min,max,avg]
+ *  arrays, null for slots without data
+ */
+duk_ret_t DukOvmsMetricHistory(duk_context *ctx)
+  {
+  const char *mn = duk_to_string(ctx, 0);
+  const char *tn = duk_opt_string(ctx, 1, "1m");
+  uint32_t span = duk_opt_uint(ctx, 2, 0);
+  metric_history_tier_t tier = OvmsMetricHistory::TierFromName(tn);
+  if (tier == MHT_Count)
+    return 0;
+
+  OvmsMutexLock lock(&MyMetricsHistory.m_mutex);
+  OvmsMetricHistory* h = MyMetricsHistory.Find(mn);
+  if (!h)
+    return 0;
+
+  DukContext dc(ctx);
+  duk_idx_t obj_idx = dc.PushObject();
+  dc.Push(h->m_name);
+  dc.PutProp(obj_idx, "metric");
+  dc.Push(OvmsMetricUnitName(h->m_units));
+  dc.PutProp(obj_idx, "units");
+  dc.Push(OvmsMetricHistory::TierName(tier));
+  dc.PutProp(obj_idx, "tier");
+  dc.Push(OvmsMetricHistory::TierPeriod(tier));
+  dc.PutProp(obj_idx, "period");
+  dc.Push(h->m_resolution);
+  dc.PutProp(obj_idx, "resolution");
+
+  duk_idx_t arr_idx = dc.PushArray();
+  duk_uarridx_t cnt = 0;
+  time_t start = 0;
+  h->Foreach(tier, span, [&dc, &cnt, &start, arr_idx, tier, ctx](const metric_history_point_t& p)
+    {
+    if (cnt == 0) start = p.time;
+    if (!p.defined)
+      duk_push_null(ctx);
+    else if (tier == MHT_1s)
+      dc.Push(p.avg);
+    else
+      {
+      duk_idx_t val_idx = dc.PushArray();
+      dc.Push(p.min);
+      dc.PutProp(val_idx, 0u);
+      dc.Push(p.max);
+      dc.PutProp(val_idx, 1u);
+      dc.Push(p.avg);
+      dc.PutProp(val_idx, 2u);
+      }
+    dc.PutProp(arr_idx, cnt++);
+    });
+  dc.PutProp(obj_idx, "data");
+  dc.Push((double) start);
+  dc.PutProp(obj_idx, "time");
+  return 1;
+  }
+
+#endif //#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+
+////////////////////////////////////////////////////////////////////////
+// OvmsMetricsHistory
+
+OvmsMetricsHistory::OvmsMetricsHistory()
+  {
+  ESP_LOGI(TAG, "Initialising METRICS HISTORY (1815)");
+
+  MyConfig.RegisterParam(METRICS_HISTORY_PARAM, "Metrics history", true, true);
+
+  OvmsCommand* cmd_metric = MyCommandApp.FindCommand("metrics");
+  if (cmd_metric)
+    {
+    OvmsCommand* cmd_history = cmd_metric->RegisterCommand("history","METRIC history framework", metrics_history_status);
+    cmd_history->RegisterCommand("status","Show recorded metric histories", metrics_history_status);
+    cmd_history->RegisterCommand("show","Show history of a metric", metrics_history_show,
+      "<metric> [<tier> [<span>]]\n"
+      "<tier> = 1s / 1m (default) / 15m\n"
+      "<span> = max age in seconds, default all", 1, 3);
+    cmd_history->RegisterCommand("add","Enable history recording for a metric", metrics_history_add,
+      "<metric> [<resolution>]\n"
+      "<resolution> = quantization step in native units, default 0.01", 1, 2);
+    cmd_history->RegisterCommand("remove","Disable history recording for a metric", metrics_history_remove,
+      "<metric>", 1, 1);
+    }
+
+#ifdef bind
+  #undef bind  // Kludgy, but works
+#endif
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEvent(TAG, "ticker.1", std::bind(&OvmsMetricsHistory::Ticker1, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "config.mounted", std::bind(&OvmsMetricsHistory::EventHandler, this, _1, _2));
+  MyEvents.RegisterEvent(TAG, "config.changed", std::bind(&OvmsMetricsHistory::EventHandler, this, _1, _2));
+  }
+
+OvmsMetricsHistory::~OvmsMetricsHistory()
+  {
+  for (auto& kv : m_map)
+    delete kv.second;
+  m_map.clear();
+  }
+
+OvmsMetricHistory* OvmsMetricsHistory::Find(const std::string& name)
+  {
+  auto it = m_map.find(name);
+  return (it != m_map.end()) ? it->second : NULL;
+  }
+
+/**
+ * LoadConfig: sync history map with config
+ *  Config: param "metrics.history", instance = metric name, value = resolution
+ *  Existing histories are kept unless removed or the resolution changed.
+ */
+void OvmsMetricsHistory::LoadConfig()
+  {
+  ConfigParamMap cfg = MyConfig.GetParamMap(METRICS_HISTORY_PARAM);
+  OvmsMutexLock lock(&m_mutex);
+
+  for (auto it = m_map.begin(); it != m_map.end();)
+    {
+    auto ci = cfg.find(it->first);
+    float resolution = (ci != cfg.end()) ? atof(ci->second.c_str()) : -1;
+    if (resolution == 0) resolution = METRICS_HISTORY_RESOLUTION;
+    if (resolution != it->second->m_resolution)
+      {
+      delete it->second;
+      it = m_map.erase(it);
+      }
+    else
+      ++it;
+    }
+
+  for (auto& kv : cfg)
+    {
+    if (m_map.find(kv.first) != m_map.end())
+      continue;
+    float resolution = atof(kv.second.c_str());
+    OvmsMetricHistory* h = new OvmsMetricHistory(kv.first, resolution);
+    m_map[kv.first] = h;
+    ESP_LOGI(TAG, "Recording history for %s (resolution %g)", h->m_name.c_str(), h->m_resolution);
+    }
+  }
+
+/**
+ * MetricRemoved: called by OvmsMetrics on metric deregistration
+ */
+void OvmsMetricsHistory::MetricRemoved(OvmsMetric* metric)
+  {
+  OvmsMutexLock lock(&m_mutex);
+  for (auto& kv : m_map)
+    {
+    if (kv.second->m_metric == metric)
+      kv.second->m_metric = NULL;
+    }
+  }
+
+void OvmsMetricsHistory::Ticker1(std::string event, void* data)
+  {
+  if (m_map.empty()) return;
+  OvmsMutexLock lock(&m_mutex);
+  uint32_t now = monotonictime;
+  for (auto& kv : m_map)
+    {
+    OvmsMetricHistory* h = kv.second;
+    if (!h->m_metric)
+      {
+      h->m_metric = MyMetrics.Find(h->m_name.c_str());
+      if (h->m_metric) h->m_units = h->m_metric->GetUnits();
+      }
+    h->Sample(now);
+    }
+  }
+
+void OvmsMetricsHistory::EventHandler(std::string event, void* data)
+  {
+  if (event == "config.changed")
+    {
+    OvmsConfigParam* param = (OvmsConfigParam*) data;
+    if (param && param->GetName() == METRICS_HISTORY_PARAM)
+      LoadConfig();
+    }
+  else if (event == "config.mounted")
+    {
+    LoadConfig();
+    }
+  }
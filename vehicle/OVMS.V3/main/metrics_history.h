@@ -0,0 +1,159 @@
+/*
+;    Project:       Open Vehicle Monitor System
+;    Date:          14th March 2017
+;
+;    Changes:
+;    1.0  Initial release
+;
+;    (C) 2011       Michael Stegen / Stegen Electronics
+;    (C) 2011-2017  Mark Webb-Johnson
+;    (C) 2011        Sonny Chen @ EPRO/DX
+;
+; Permission is hereby granted, free of charge, to any person obtaining a copy
+; of this software and associated documentation files (the "Software"), to deal
+; in the Software without restriction, including without limitation the rights
+; to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+; copies of the Software, and to permit persons to whom the Software is
+; furnished to do so, subject to the following conditions:
+;
+; The above copyright notice and this permission notice shall be included in
+; all copies or substantial portions of the Software.
+;
+; THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+; IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+; FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+; AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+; LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+; OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+; THE SOFTWARE.
+*/
+
+#ifndef __METRICS_HISTORY_H__
+#define __METRICS_HISTORY_H__
+
+#include <functional>
+#include <map>
+#include <string>
+#include <stdint.h>
+#include "ovms.h"
+#include "ovms_mutex.h"
+#include "ovms_metrics.h"
+
+#define METRICS_HISTORY_PARAM         "metrics.history"
+#define METRICS_HISTORY_RESOLUTION    0.01f       // Default quantization step
+#define METRICS_HISTORY_NODATA        INT32_MIN   // Slot value for "no data"
+#define METRICS_HISTORY_SIZE_1S       900         // 15 minutes of 1 second samples
+#define METRICS_HISTORY_SIZE_1M       360         // 6 hours of 1 minute aggregates
+#define METRICS_HISTORY_SIZE_15M      384         // 4 days of 15 minute aggregates
+
+typedef enum
+  {
+  MHT_1s = 0,
+  MHT_1m,
+  MHT_15m,
+  MHT_Count
+  } metric_history_tier_t;
+
+typedef struct
+  {
+  time_t time;                        // Slot start (UTC)
+  bool defined;                       // false = no data in slot
+  float min;
+  float max;
+  float avg;                          // 1 s tier: min = max = avg = sample
+  } metric_history_point_t;
+
+typedef std::function<void(const metric_history_point_t&)> MetricHistoryCallback;
+
+// OvmsMetricHistory: sample history of a single metric
+//
+// Samples are taken once per second and quantized to int32 steps of the
+// configured resolution. The 1 s ring holds the raw samples, the 1 min and
+// 15 min rings hold min/max/avg aggregates built from these. All rings have
+// fixed slot periods aligned to the monotonic time, so timestamps are implicit:
+// each ring only records the slot number of its newest entry. Gaps (undefined
+// metric, missed ticks) are filled with METRICS_HISTORY_NODATA.
+
+class OvmsMetricHistory
+  {
+  public:
+    OvmsMetricHistory(const std::string& name, float resolution);
+    ~OvmsMetricHistory();
+
+  public:
+    void Sample(uint32_t now);
+    int Foreach(metric_history_tier_t tier, uint32_t span, MetricHistoryCallback callback);
+    int GetCount(metric_history_tier_t tier) { return m_tier[tier].fill; }
+    size_t GetMemory() { return m_memsize; }
+    int GetPrecision();
+
+  public:
+    static const char* TierName(metric_history_tier_t tier);
+    static metric_history_tier_t TierFromName(const char* name);
+    static uint32_t TierPeriod(metric_history_tier_t tier);
+
+  protected:
+    typedef struct
+      {
+      int32_t* data;                  // Ring storage, width values per slot
+      uint16_t size;                  // Slots
+      uint16_t width;                 // Values per slot: 1 = sample, 3 = min/max/avg
+      uint32_t period;                // Seconds per slot
+      uint16_t head;                  // Next slot to write
+      uint16_t fill;                  // Slots in use
+      uint32_t slot;                  // Slot number (monotonic / period) of newest entry
+      // Aggregation of the current (incomplete) slot:
+      uint32_t acc_slot;
+      bool acc_active;
+      uint16_t acc_cnt;
+      int32_t acc_min;
+      int32_t acc_max;
+      int64_t acc_sum;
+      } tier_t;
+
+    void Push(tier_t& t, uint32_t slot, const int32_t* values);
+    void Aggregate(tier_t& t, uint32_t now, int32_t value);
+    void Flush(tier_t& t);
+
+  public:
+    std::string m_name;
+    OvmsMetric* m_metric;             // NULL = not (yet) registered
+    float m_resolution;
+    metric_unit_t m_units;
+
+  protected:
+    tier_t m_tier[MHT_Count];
+    int32_t* m_mem;
+    size_t m_memsize;
+  };
+
+typedef std::map<std::string, OvmsMetricHistory*> MetricHistoryMap;
+
+class OvmsMetricsHistory
+  {
+  public:
+    OvmsMetricsHistory();
+    ~OvmsMetricsHistory();
+
+  public:
+    void LoadConfig();
+    void MetricRemoved(OvmsMetric* metric);
+    OvmsMetricHistory* Find(const std::string& name);   // caller must hold m_mutex
+
+  public:
+    void Ticker1(std::string event, void* data);
+    void EventHandler(std::string event, void* data);
+
+  public:
+    OvmsMutex m_mutex;
+    MetricHistoryMap m_map;
+  };
+
+extern OvmsMetricsHistory MyMetricsHistory;
+
+#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+#include "ovms_script.h"
+extern duk_ret_t DukOvmsMetricHistory(duk_context *ctx);
+#endif //#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+
+#endif //#ifndef __METRICS_HISTORY_H__
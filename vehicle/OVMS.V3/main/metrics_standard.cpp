@@ -66,6 +66,28 @@ MetricsStandard::MetricsStandard()
   ms_m_egpio_monitor = new OvmsMetricBitset<10,0>(MS_M_EGPIO_MONITOR, SM_STALE_MAX);
 #endif //CONFIG_OVMS_COMP_MAX7317
   ms_m_obd2ecu_on = new OvmsMetricBool(MS_M_OBD2ECU_ON, SM_STALE_MID);
+  ms_m_event_coalesced = new OvmsMetricInt(MS_M_EVENT_COALESCED, SM_STALE_MID);
+  ms_m_event_critical_depth = new OvmsMetricInt(MS_M_EVENT_CRITICAL_DEPTH, SM_STALE_MID);
+  ms_m_event_critical_latency = new OvmsMetricFloat(MS_M_EVENT_CRITICAL_LATENCY, SM_STALE_MID, Seconds);
+  ms_m_event_normal_depth = new OvmsMetricInt(MS_M_EVENT_NORMAL_DEPTH, SM_STALE_MID);
+  ms_m_event_normal_latency = new OvmsMetricFloat(MS_M_EVENT_NORMAL_LATENCY, SM_STALE_MID, Seconds);
+  ms_m_event_bulk_depth = new OvmsMetricInt(MS_M_EVENT_BULK_DEPTH, SM_STALE_MID);
+  ms_m_event_bulk_latency = new OvmsMetricFloat(MS_M_EVENT_BULK_LATENCY, SM_STALE_MID, Seconds);
+
+#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+  ms_m_js_heap_used = new OvmsMetricInt(MS_M_JS_HEAP_USED, SM_STALE_MID);
+  ms_m_js_heap_free = new OvmsMetricInt(MS_M_JS_HEAP_FREE, SM_STALE_MID);
+  ms_m_js_heap_frag = new OvmsMetricFloat(MS_M_JS_HEAP_FRAG, SM_STALE_MID, Percentage);
+  ms_m_js_gc_count = new OvmsMetricInt(MS_M_JS_GC_COUNT, SM_STALE_MID);
+  ms_m_js_gc_pause = new OvmsMetricFloat(MS_M_JS_GC_PAUSE, SM_STALE_MID, Seconds);
+  ms_m_js_job_max = new OvmsMetricFloat(MS_M_JS_JOB_MAX, SM_STALE_MID, Seconds);
+#endif //CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+
+#ifdef CONFIG_OVMS_COMP_WEBSERVER
+  ms_m_web_req_count = new OvmsMetricInt(MS_M_WEB_REQ_COUNT, SM_STALE_MID);
+  ms_m_web_req_max = new OvmsMetricFloat(MS_M_WEB_REQ_MAX, SM_STALE_MID, Seconds);
+  ms_m_web_req_slowest = new OvmsMetricString(MS_M_WEB_REQ_SLOWEST, SM_STALE_MID);
+#endif //CONFIG_OVMS_COMP_WEBSERVER
 
   ms_s_v2_connected = new OvmsMetricBool(MS_S_V2_CONNECTED);
   ms_s_v2_peers = new OvmsMetricInt(MS_S_V2_PEERS);
@@ -95,6 +117,11 @@ MetricsStandard::MetricsStandard()
   ms_v_bat_energy_used_total = new OvmsMetricFloat(MS_V_BAT_ENERGY_USED_TOTAL, SM_STALE_MID, kWh, true);
   ms_v_bat_energy_recd = new OvmsMetricFloat(MS_V_BAT_ENERGY_RECD, SM_STALE_MID, kWh, true);
   ms_v_bat_energy_recd_total = new OvmsMetricFloat(MS_V_BAT_ENERGY_RECD_TOTAL, SM_STALE_MID, kWh, true);
+  ms_v_bat_integ_used = new OvmsMetricFloat(MS_V_BAT_INTEG_USED, SM_STALE_MID, kWh);
+  ms_v_bat_integ_used_total = new OvmsMetricFloat(MS_V_BAT_INTEG_USED_TOTAL, SM_STALE_MID, kWh, true);
+  ms_v_bat_integ_recd = new OvmsMetricFloat(MS_V_BAT_INTEG_RECD, SM_STALE_MID, kWh);
+  ms_v_bat_integ_recd_total = new OvmsMetricFloat(MS_V_BAT_INTEG_RECD_TOTAL, SM_STALE_MID, kWh, true);
+  ms_v_bat_integ_consumption = new OvmsMetricFloat(MS_V_BAT_INTEG_CONSUMPTION, SM_STALE_MID, WattHoursPK);
   ms_v_bat_range_full = new OvmsMetricFloat(MS_V_BAT_RANGE_FULL, SM_STALE_HIGH, Kilometers);
   ms_v_bat_range_ideal = new OvmsMetricFloat(MS_V_BAT_RANGE_IDEAL, SM_STALE_HIGH, Kilometers, true);
   ms_v_bat_range_est = new OvmsMetricFloat(MS_V_BAT_RANGE_EST, SM_STALE_HIGH, Kilometers, true);
@@ -148,6 +175,8 @@ MetricsStandard::MetricsStandard()
   ms_v_charge_kwh = new OvmsMetricFloat(MS_V_CHARGE_KWH, SM_STALE_MID, kWh, true);
   ms_v_charge_kwh_grid = new OvmsMetricFloat(MS_V_CHARGE_KWH_GRID, SM_STALE_MID, kWh, true);
   ms_v_charge_kwh_grid_total = new OvmsMetricFloat(MS_V_CHARGE_KWH_GRID_TOTAL, SM_STALE_MID, kWh, true);
+  ms_v_charge_integ_kwh = new OvmsMetricFloat(MS_V_CHARGE_INTEG_KWH, SM_STALE_MID, kWh);
+  ms_v_charge_integ_kwh_total = new OvmsMetricFloat(MS_V_CHARGE_INTEG_KWH_TOTAL, SM_STALE_MID, kWh, true);
   ms_v_charge_mode = new OvmsMetricString(MS_V_CHARGE_MODE, SM_STALE_MID);
   ms_v_charge_timermode = new OvmsMetricBool(MS_V_CHARGE_TIMERMODE, SM_STALE_MID, Other, true);
   ms_v_charge_timerstart = new OvmsMetricInt(MS_V_CHARGE_TIMERSTART, SM_STALE_MID, TimeUTC, true);
@@ -200,6 +229,8 @@ MetricsStandard::MetricsStandard()
   //
   ms_v_inv_temp = new OvmsMetricFloat(MS_V_INV_TEMP, SM_STALE_MID, Celcius, true);
   ms_v_inv_power = new OvmsMetricFloat(MS_V_INV_POWER, SM_STALE_MID, kW);
+  ms_v_inv_integ_used = new OvmsMetricFloat(MS_V_INV_INTEG_USED, SM_STALE_MID, kWh);
+  ms_v_inv_integ_recd = new OvmsMetricFloat(MS_V_INV_INTEG_RECD, SM_STALE_MID, kWh);
   ms_v_inv_efficiency = new OvmsMetricFloat(MS_V_INV_EFFICIENCY, SM_STALE_MID, Percentage);
 
   //
@@ -260,7 +291,11 @@ MetricsStandard::MetricsStandard()
   ms_v_pos_gpslock = new OvmsMetricBool(MS_V_POS_GPSLOCK, SM_STALE_MIN);
   ms_v_pos_gpsmode = new OvmsMetricString(MS_V_POS_GPSMODE, SM_STALE_MIN);
   ms_v_pos_gpshdop = new OvmsMetricFloat(MS_V_POS_GPSHDOP, SM_STALE_MIN);
+  ms_v_pos_gpspdop = new OvmsMetricFloat(MS_V_POS_GPSPDOP, SM_STALE_MIN);
+  ms_v_pos_gpsvdop = new OvmsMetricFloat(MS_V_POS_GPSVDOP, SM_STALE_MIN);
   ms_v_pos_satcount= new OvmsMetricInt(MS_V_POS_SATCOUNT, SM_STALE_MIN);
+  ms_v_pos_satinview = new OvmsMetricInt(MS_V_POS_SATINVIEW, SM_STALE_MIN);
+  ms_v_pos_gpssnr = new OvmsMetricFloat(MS_V_POS_GPSSNR, SM_STALE_MIN);
   ms_v_pos_gpssq = new OvmsMetricInt(MS_V_POS_GPSSQ, SM_STALE_MIN, Percentage);
   ms_v_pos_gpstime = new OvmsMetricInt64(MS_V_POS_GPSTIME, SM_STALE_MIN, DateLocal);
   ms_v_pos_latitude = new OvmsMetricFloat(MS_V_POS_LATITUDE, SM_STALE_MIN, Other, true);
@@ -273,6 +308,7 @@ MetricsStandard::MetricsStandard()
   ms_v_pos_gpsspeed = new OvmsMetricFloat(MS_V_POS_GPSSPEED, SM_STALE_MIN, Kph);
   ms_v_pos_odometer = new OvmsMetricFloat(MS_V_POS_ODOMETER, SM_STALE_MID, Kilometers, true);
   ms_v_pos_trip = new OvmsMetricFloat(MS_V_POS_TRIP, SM_STALE_MID, Kilometers, true);
+  ms_v_pos_integ_distance = new OvmsMetricFloat(MS_V_POS_INTEG_DISTANCE, SM_STALE_MID, Kilometers);
   ms_v_pos_valet_latitude = new OvmsMetricFloat(MS_V_POS_VALET_LATITUDE, SM_STALE_NONE, Other, true);
   ms_v_pos_valet_longitude = new OvmsMetricFloat(MS_V_POS_VALET_LONGITUDE, SM_STALE_NONE, Other, true);
   ms_v_pos_valet_distance = new OvmsMetricFloat(MS_V_POS_VALET_DISTANCE, SM_STALE_HIGH, Meters, true);
@@ -69,6 +69,28 @@
 #define MS_M_EGPIO_OUTPUT           "m.egpio.output"
 #endif //CONFIG_OVMS_COMP_MAX7317
 #define MS_M_OBD2ECU_ON             "m.obdc2ecu.on"
+#define MS_M_EVENT_COALESCED        "m.event.coalesced"
+#define MS_M_EVENT_CRITICAL_DEPTH   "m.event.critical.depth"
+#define MS_M_EVENT_CRITICAL_LATENCY "m.event.critical.latency"
+#define MS_M_EVENT_NORMAL_DEPTH     "m.event.normal.depth"
+#define MS_M_EVENT_NORMAL_LATENCY   "m.event.normal.latency"
+#define MS_M_EVENT_BULK_DEPTH       "m.event.bulk.depth"
+#define MS_M_EVENT_BULK_LATENCY     "m.event.bulk.latency"
+
+#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+#define MS_M_JS_HEAP_USED           "m.js.heap.used"
+#define MS_M_JS_HEAP_FREE           "m.js.heap.free"
+#define MS_M_JS_HEAP_FRAG           "m.js.heap.frag"
+#define MS_M_JS_GC_COUNT            "m.js.gc.count"
+#define MS_M_JS_GC_PAUSE            "m.js.gc.pause"
+#define MS_M_JS_JOB_MAX             "m.js.job.max"
+#endif //CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+
+#ifdef CONFIG_OVMS_COMP_WEBSERVER
+#define MS_M_WEB_REQ_COUNT          "m.web.req.count"
+#define MS_M_WEB_REQ_MAX            "m.web.req.max"
+#define MS_M_WEB_REQ_SLOWEST        "m.web.req.slowest"
+#endif //CONFIG_OVMS_COMP_WEBSERVER
 
 #define MS_S_V2_CONNECTED           "s.v2.connected"
 #define MS_S_V2_PEERS               "s.v2.peers"
@@ -95,6 +117,11 @@
 #define MS_V_BAT_ENERGY_USED_TOTAL  "v.b.energy.used.total"
 #define MS_V_BAT_ENERGY_RECD        "v.b.energy.recd"
 #define MS_V_BAT_ENERGY_RECD_TOTAL  "v.b.energy.recd.total"
+#define MS_V_BAT_INTEG_USED         "v.b.integ.used"
+#define MS_V_BAT_INTEG_USED_TOTAL   "v.b.integ.used.total"
+#define MS_V_BAT_INTEG_RECD         "v.b.integ.recd"
+#define MS_V_BAT_INTEG_RECD_TOTAL   "v.b.integ.recd.total"
+#define MS_V_BAT_INTEG_CONSUMPTION  "v.b.integ.consumption"
 #define MS_V_BAT_RANGE_FULL         "v.b.range.full"
 #define MS_V_BAT_RANGE_IDEAL        "v.b.range.ideal"
 #define MS_V_BAT_RANGE_EST          "v.b.range.est"
@@ -140,6 +167,8 @@
 #define MS_V_CHARGE_KWH             "v.c.kwh"
 #define MS_V_CHARGE_KWH_GRID        "v.c.kwh.grid"
 #define MS_V_CHARGE_KWH_GRID_TOTAL  "v.c.kwh.grid.total"
+#define MS_V_CHARGE_INTEG_KWH       "v.c.integ.kwh"
+#define MS_V_CHARGE_INTEG_KWH_TOTAL "v.c.integ.kwh.total"
 #define MS_V_CHARGE_MODE            "v.c.mode"
 #define MS_V_CHARGE_TIMERMODE       "v.c.timermode"
 #define MS_V_CHARGE_TIMERSTART      "v.c.timerstart"
@@ -186,6 +215,8 @@
 
 #define MS_V_INV_TEMP               "v.i.temp"
 #define MS_V_INV_POWER              "v.i.power"
+#define MS_V_INV_INTEG_USED         "v.i.integ.used"
+#define MS_V_INV_INTEG_RECD         "v.i.integ.recd"
 #define MS_V_INV_EFFICIENCY         "v.i.efficiency"
 
 #define MS_V_MOT_RPM                "v.m.rpm"
@@ -233,7 +264,11 @@
 #define MS_V_POS_GPSSTALE           "v.p.gpsstale"
 #define MS_V_POS_GPSMODE            "v.p.gpsmode"
 #define MS_V_POS_GPSHDOP            "v.p.gpshdop"
+#define MS_V_POS_GPSPDOP            "v.p.gpspdop"
+#define MS_V_POS_GPSVDOP            "v.p.gpsvdop"
 #define MS_V_POS_SATCOUNT           "v.p.satcount"
+#define MS_V_POS_SATINVIEW          "v.p.satinview"
+#define MS_V_POS_GPSSNR             "v.p.gpssnr"
 #define MS_V_POS_GPSSQ              "v.p.gpssq"
 #define MS_V_POS_GPSTIME            "v.p.gpstime"
 #define MS_V_POS_LATITUDE           "v.p.latitude"
@@ -246,6 +281,7 @@
 #define MS_V_POS_GPSSPEED           "v.p.gpsspeed"
 #define MS_V_POS_ODOMETER           "v.p.odometer"
 #define MS_V_POS_TRIP               "v.p.trip"
+#define MS_V_POS_INTEG_DISTANCE     "v.p.integ.distance"
 #define MS_V_POS_VALET_LATITUDE     "v.p.valet.latitude"
 #define MS_V_POS_VALET_LONGITUDE    "v.p.valet.longitude"
 #define MS_V_POS_VALET_DISTANCE     "v.p.valet.distance"
@@ -310,6 +346,28 @@ class MetricsStandard
     OvmsMetricBitset<10,0>* ms_m_egpio_monitor;           // EGPIO (MAX7317) input monitoring state
 #endif //CONFIG_OVMS_COMP_MAX7317
     OvmsMetricBool* ms_m_obd2ecu_on;                      // OBD2ECU process is on.
+    OvmsMetricInt*    ms_m_event_coalesced;               // Event signals merged by coalescing since boot
+    OvmsMetricInt*    ms_m_event_critical_depth;          // Event queue critical lane max depth in last minute
+    OvmsMetricFloat*  ms_m_event_critical_latency;        // Event queue critical lane max latency in last minute [s]
+    OvmsMetricInt*    ms_m_event_normal_depth;            // Event queue normal lane max depth in last minute
+    OvmsMetricFloat*  ms_m_event_normal_latency;          // Event queue normal lane max latency in last minute [s]
+    OvmsMetricInt*    ms_m_event_bulk_depth;              // Event queue bulk lane max depth in last minute
+    OvmsMetricFloat*  ms_m_event_bulk_latency;            // Event queue bulk lane max latency in last minute [s]
+
+#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+    OvmsMetricInt*    ms_m_js_heap_used;                  // Javascript heap in use [bytes]
+    OvmsMetricInt*    ms_m_js_heap_free;                  // Javascript heap free [bytes]
+    OvmsMetricFloat*  ms_m_js_heap_frag;                  // Javascript heap fragmentation [%]
+    OvmsMetricInt*    ms_m_js_gc_count;                   // Javascript scheduled GC runs
+    OvmsMetricFloat*  ms_m_js_gc_pause;                   // Javascript max GC pause in last minute [s]
+    OvmsMetricFloat*  ms_m_js_job_max;                    // Javascript max job duration in last minute [s]
+#endif //CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
+
+#ifdef CONFIG_OVMS_COMP_WEBSERVER
+    OvmsMetricInt*    ms_m_web_req_count;                 // Web page requests served since boot
+    OvmsMetricFloat*  ms_m_web_req_max;                   // Web max page handler time in last minute [s]
+    OvmsMetricString* ms_m_web_req_slowest;               // Web page URI with the max handler time in last minute
+#endif //CONFIG_OVMS_COMP_WEBSERVER
 
     OvmsMetricBool*   ms_s_v2_connected;                  // True = V2 server connected [1]
     OvmsMetricInt*    ms_s_v2_peers;                      // V2 clients connected [1]
@@ -339,6 +397,11 @@ class MetricsStandard
     OvmsMetricFloat*  ms_v_bat_energy_used_total;         // Main battery energy used total (life time) [kWh]
     OvmsMetricFloat*  ms_v_bat_energy_recd;               // Main battery energy recovered on trip [kWh]
     OvmsMetricFloat*  ms_v_bat_energy_recd_total;         // Main battery energy recovered total (life time) [kWh]
+    OvmsMetricFloat*  ms_v_bat_integ_used;                // Battery energy used on trip, integrated from v.b.power [kWh]
+    OvmsMetricFloat*  ms_v_bat_integ_used_total;          // Battery energy used total (life time), integrated [kWh]
+    OvmsMetricFloat*  ms_v_bat_integ_recd;                // Battery energy recovered on trip, integrated [kWh]
+    OvmsMetricFloat*  ms_v_bat_integ_recd_total;          // Battery energy recovered total (life time), integrated [kWh]
+    OvmsMetricFloat*  ms_v_bat_integ_consumption;         // Trip average consumption, integrated energy / distance [Wh/km]
     OvmsMetricFloat*  ms_v_bat_range_full;                // Ideal range at 100% SOC & current conditions [km]
     OvmsMetricFloat*  ms_v_bat_range_ideal;               // Ideal range [km]
     OvmsMetricFloat*  ms_v_bat_range_est;                 // Estimated range [km]
@@ -393,6 +456,8 @@ class MetricsStandard
     OvmsMetricFloat*  ms_v_charge_kwh;                    // Energy sum for running charge [kWh]
     OvmsMetricFloat*  ms_v_charge_kwh_grid;               // Energy drawn from grid during running session [kWh]
     OvmsMetricFloat*  ms_v_charge_kwh_grid_total;         // Energy drawn from grid total (life time) [kWh]
+    OvmsMetricFloat*  ms_v_charge_integ_kwh;              // Energy charged into the battery in running session, integrated [kWh]
+    OvmsMetricFloat*  ms_v_charge_integ_kwh_total;        // Energy charged into the battery total (life time), integrated [kWh]
     OvmsMetricString* ms_v_charge_mode;                   // standard, range, performance, storage
     OvmsMetricBool*   ms_v_charge_timermode;              // True if timer enabled
     OvmsMetricInt*    ms_v_charge_timerstart;             // Time timer is due to start
@@ -445,6 +510,8 @@ class MetricsStandard
     //
     OvmsMetricFloat*  ms_v_inv_temp;                      // Inverter temperature [°C]
     OvmsMetricFloat*  ms_v_inv_power;                     // Momentary inverter motor power [kW] (output=positive)
+    OvmsMetricFloat*  ms_v_inv_integ_used;                // Motor energy used on trip, integrated from v.i.power [kWh]
+    OvmsMetricFloat*  ms_v_inv_integ_recd;                // Motor energy recovered on trip, integrated [kWh]
     OvmsMetricFloat*  ms_v_inv_efficiency;                // Momentary inverter efficiency [%]
 
     //
@@ -503,7 +570,11 @@ class MetricsStandard
     OvmsMetricBool*   ms_v_pos_gpslock;
     OvmsMetricString* ms_v_pos_gpsmode;                   // <GPS><GLONASS>; N/A/D/E (None/Autonomous/Differential/Estimated)
     OvmsMetricFloat*  ms_v_pos_gpshdop;                   // Horizontal dilution of precision (smaller=better)
+    OvmsMetricFloat*  ms_v_pos_gpspdop;                   // Position (3D) dilution of precision (GSA, smaller=better)
+    OvmsMetricFloat*  ms_v_pos_gpsvdop;                   // Vertical dilution of precision (GSA, smaller=better)
     OvmsMetricInt*    ms_v_pos_satcount;
+    OvmsMetricInt*    ms_v_pos_satinview;                 // Satellites in view (GSV, all constellations)
+    OvmsMetricFloat*  ms_v_pos_gpssnr;                    // Mean SNR of the up to four strongest tracked satellites [dB-Hz]
     OvmsMetricInt*    ms_v_pos_gpssq;                     // GPS signal quality [%] (<30 unusable, >50 good, >80 excellent)
     OvmsMetricInt64*  ms_v_pos_gpstime;                   // Time (UTC) of GPS coordinates [Seconds]
     OvmsMetricFloat*  ms_v_pos_latitude;
@@ -516,6 +587,7 @@ class MetricsStandard
     OvmsMetricFloat*  ms_v_pos_gpsspeed;                  // GPS speed over ground [kph]
     OvmsMetricFloat*  ms_v_pos_odometer;
     OvmsMetricFloat*  ms_v_pos_trip;
+    OvmsMetricFloat*  ms_v_pos_integ_distance;            // Trip distance, odometer or integrated speed [km]
     OvmsMetricFloat*  ms_v_pos_valet_latitude;
     OvmsMetricFloat*  ms_v_pos_valet_longitude;
     OvmsMetricFloat*  ms_v_pos_valet_distance;
@@ -50,9 +50,9 @@ static const char *TAG = "command";
 #include "ovms_utils.h"
 #include "ovms_script.h"
 #include "buffered_shell.h"
-#include "log_buffers.h"
 #include "ovms_semaphore.h"
 #include "ovms_vfs.h"
+#include "ovms_version.h"
 
 OvmsCommandApp MyCommandApp __attribute__ ((init_priority (1010)));
 
@@ -656,6 +656,41 @@ void log_expire(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, c
   MyCommandApp.ExpireLogFiles(verbosity, writer, keepdays);
   }
 
+void log_decode(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (MyConfig.ProtectedPath(argv[0]) || (argc > 1 && MyConfig.ProtectedPath(argv[1])))
+    {
+    writer->puts("Error: protected path");
+    return;
+    }
+  FILE* in = fopen(argv[0], "r");
+  if (!in)
+    {
+    writer->printf("Error: cannot open '%s'\n", argv[0]);
+    return;
+    }
+  FILE* out = NULL;
+  if (argc > 1)
+    {
+    out = fopen(argv[1], "w");
+    if (!out)
+      {
+      writer->printf("Error: cannot open '%s' for writing\n", argv[1]);
+      fclose(in);
+      return;
+      }
+    }
+  int lines;
+  bool ok = LogBinaryFile::Decode(in, writer, out, &lines);
+  fclose(in);
+  if (out)
+    fclose(out);
+  if (!ok)
+    writer->printf("Error: '%s' is not a binary log file\n", argv[0]);
+  else if (out)
+    writer->printf("%d log lines written to '%s'\n", lines, argv[1]);
+  }
+
 static OvmsCommand* monitor;
 static OvmsCommand* monitor_yes;
 
@@ -828,9 +863,15 @@ OvmsCommandApp::OvmsCommandApp()
   m_logfile_path = "";
   m_logfile_size = 0;
   m_logfile_maxsize = 0;
+  m_logfile_binary = false;
   m_logtask = NULL;
-  m_logtask_queue = NULL;
+  m_logtask_reader = -1;
+  m_logtask_record = NULL;
+  m_logtask_exit = false;
+  m_logtask_exitack = NULL;
   m_logtask_dropcnt = 0;
+  m_partials_count = 0;
+  m_logring.Init(CONFIG_OVMS_LOGRING_SIZE);
   m_logfile_cyclecnt = 0;
   m_expiretask = 0;
 
@@ -842,6 +883,8 @@ OvmsCommandApp::OvmsCommandApp()
   cmd_log->RegisterCommand("close", "Stop file logging", log_close);
   cmd_log->RegisterCommand("status", "Show logging status", log_status);
   cmd_log->RegisterCommand("expire", "Expire old log files", log_expire, "[<keepdays>]", 0, 1);
+  cmd_log->RegisterCommand("decode", "Decode binary log file to text", log_decode,
+    "<binpath> [<textpath>]\nWithout <textpath>, the log is shown on the console", 1, 2, true, vfs_file_validate);
   OvmsCommand* level_cmd = cmd_log->RegisterCommand("level", "Set logging level", NULL, "$C [<tag>]", 0, 0, false);
   level_cmd->RegisterCommand("verbose", "Log at the VERBOSE level (5)", log_level , "[<tag>]", 0, 1);
   level_cmd->RegisterCommand("debug", "Log at the DEBUG level (4)", log_level , "[<tag>]", 0, 1);
@@ -959,16 +1002,6 @@ OvmsCommand* OvmsCommandApp::FindCommandFullName(const char* name, bool allow_cr
   return found;
   }
 
-void OvmsCommandApp::RegisterConsole(OvmsWriter* writer)
-  {
-  m_consoles.insert(writer);
-  }
-
-void OvmsCommandApp::DeregisterConsole(OvmsWriter* writer)
-  {
-  m_consoles.erase(writer);
-  }
-
 int OvmsCommandApp::Log(const char* fmt, ...)
   {
   va_list args;
@@ -980,75 +1013,40 @@ int OvmsCommandApp::Log(const char* fmt, ...)
 
 int OvmsCommandApp::Log(const char* fmt, va_list args)
   {
-  LogBuffers* lb;
+  if (!m_logring.IsReady())
+    return vprintf(fmt, args);
+  if (m_partials_count == 0)
+    return m_logring.Write(NULL, fmt, args);
+
+  // Prepend partial output of this task:
+  std::string prefix;
   TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  m_partials_mutex.Lock();
   PartialLogs::iterator it = m_partials.find(task);
-  if (it == m_partials.end())
-    lb = new LogBuffers();
-  else
-    {
-    lb = it->second;
-    m_partials.erase(task);
-    }
-  int ret = LogBuffer(lb, fmt, args);
-  lb->set(m_consoles.size());
-  for (ConsoleSet::iterator it = m_consoles.begin(); it != m_consoles.end(); ++it)
+  if (it != m_partials.end())
     {
-    (*it)->Log(lb);
+    prefix = std::move(it->second);
+    m_partials.erase(it);
+    m_partials_count = m_partials.size();
     }
-  return ret;
+  m_partials_mutex.Unlock();
+  return m_logring.Write(prefix.empty() ? NULL : prefix.c_str(), fmt, args);
   }
 
 int OvmsCommandApp::LogPartial(const char* fmt, ...)
   {
-  LogBuffers* lb;
-  TaskHandle_t task = xTaskGetCurrentTaskHandle();
-  PartialLogs::iterator it = m_partials.find(task);
-  if (it == m_partials.end())
-    {
-    lb = new LogBuffers();
-    m_partials[task] = lb;
-    }
-  else
-    {
-    lb = it->second;
-    }
+  char *buffer;
   va_list args;
   va_start(args, fmt);
-  int ret = LogBuffer(lb, fmt, args);
-  va_end(args);
-  return ret;
-  }
-
-int OvmsCommandApp::LogBuffer(LogBuffers* lb, const char* fmt, va_list args)
-  {
-  char *buffer;
   int ret = vasprintf(&buffer, fmt, args);
+  va_end(args);
   if (ret < 0) return ret;
 
-  // Replace CR/LF except last by "|", but don't leave '|' at the end.
-  // An ESC sequence to change color may be appended after the log text.
-  char* s;
-  for (s=buffer; *s; s++)
-    {
-    if (*s=='\r' || *s=='\n')
-      {
-      char *t = s;
-      if (*(s+1) == '\033')
-        ++s;
-      else if (*(s+1) != '\0')
-        {
-        *s = '|';
-        continue;
-        }
-      while (t > buffer && *(t-1) == '|')
-        --t;
-      while ((*t++ = *s++)) ;
-      break;
-      }
-    }
-
-  lb->append(buffer);
+  TaskHandle_t task = xTaskGetCurrentTaskHandle();
+  OvmsMutexLock lock(&m_partials_mutex);
+  m_partials[task].append(buffer, ret);
+  m_partials_count = m_partials.size();
+  free(buffer);
   return ret;
   }
 
@@ -1092,29 +1090,84 @@ void OvmsCommandApp::Execute(int verbosity, OvmsWriter* writer, int argc, const
  * LogTask: file logging task
  */
 
-struct LogTaskCmd
+static void LogTaskEntry(void* me)
+  {
+  ((OvmsCommandApp*)me)->LogTask();
+  }
+
+bool OvmsCommandApp::LogTaskNotify(void* ctx)
   {
-  enum
+  OvmsCommandApp* me = (OvmsCommandApp*) ctx;
+  TaskHandle_t task = me->m_logtask;
+  if (!task)
+    return false;
+  xTaskNotifyGive(task);
+  return true;
+  }
+
+// Write log text to file, skipping terminal escape sequences (see stripesc())
+static size_t LogTaskWrite(const char* text, size_t len, FILE* file)
+  {
+  size_t written = 0;
+  const char* end = text + len;
+  while (text < end)
+    {
+    const char* esc = text;
+    while (esc < end && !(esc[0] == '\033' && esc+1 < end && esc[1] == '['))
+      esc++;
+    if (esc > text)
+      written += fwrite(text, 1, esc - text, file);
+    for (text = esc; text < end && *text++ != 'm'; ) ;
+    }
+  return written;
+  }
+
+// Get the system timestamp [ms] of an ESP log line (format: [escapes] "X (<ms>) …")
+static bool LogTextTimestamp(const char* text, size_t len, uint32_t* ms)
+  {
+  const char* le = text;
+  const char* end = text + len;
+  while (le+1 < end && le[0] == '\033' && le[1] == '[')
     {
-    LTC_Log,          // write data.logbuffers to file
-    LTC_Exit,         // close file, give data.cmdack, exit
-    } type;
-  union
+    for (le += 2; le < end && *le++ != 'm'; ) ;
+    }
+  if (end - le > 3 && *(le + 1) == ' ' && *(le + 2) == '(')
     {
-    LogBuffers*       logbuffers;
-    OvmsSemaphore*    cmdack;
-    } data;
-  };
+    *ms = atoi(le + 3);
+    return true;
+    }
+  return false;
+  }
 
-static void LogTaskEntry(void* me)
+// Convert a system timestamp to real time
+void OvmsCommandApp::LogTaskStamp(uint32_t ms, struct timeval* stamp)
   {
-  ((OvmsCommandApp*)me)->LogTask();
+  stamp->tv_sec = ms / 1000;
+  stamp->tv_usec = (ms % 1000) * 1000;
+  // If 10 seconds have elapsed since the previous log message or if a
+  // real base time hasn't been set yet, recalculate the correspondence
+  // of real time to system time.
+  if (stamp->tv_sec - m_logtask_laststamp > 10 || m_logtask_basetime.tv_sec < 1609459200)
+    {
+    struct timeval daytime, uptime;
+    gettimeofday(&daytime, NULL);
+    uptime.tv_sec = xTaskGetTickCount();
+    uptime.tv_usec = (uptime.tv_sec % 100) * 10000;
+    uptime.tv_sec /= 100;
+    daytime.tv_usec -= daytime.tv_usec % 10000;       // Always show 0 for ms units
+    timersub(&daytime, &uptime, &m_logtask_basetime);
+    }
+  m_logtask_laststamp = stamp->tv_sec;
+  timeradd(&m_logtask_basetime, stamp, stamp);
   }
 
 void OvmsCommandApp::LogTask()
   {
-  LogTaskCmd cmd;
   char tb[64];
+  const char* text;
+  size_t len;
+  bool binary;
+  uint32_t ms;
 
   m_logtask_linecnt = 0;
   m_logtask_fsynctime = 0;
@@ -1129,82 +1182,82 @@ void OvmsCommandApp::LogTask()
 
   for (;;)
     {
-    if (xQueueReceive(m_logtask_queue, (void*)&cmd, timeout) == pdTRUE)
+    if (ulTaskNotifyTake(pdTRUE, timeout) > 0)
       {
-      // cmd received:
-      if (cmd.type == LogTaskCmd::LTC_Log)
+      if (m_logtask_exit)
+        break;
+
+      // write new log ring messages:
+      m_logring.Acknowledge(m_logtask_reader);
+      if (m_logtask_record)
         {
-        // write logbuffers messages:
-        for (auto it = cmd.data.logbuffers->begin(); it != cmd.data.logbuffers->end(); it++)
+        // binary format: pass deferred records on as is
+        uint8_t* rec = m_logtask_record;
+        while (m_logring.Read(m_logtask_reader, rec, m_logring.GetMaxRecord(), &len, &binary))
           {
-          std::string le = stripesc(*it);
-          if (*(le.data() + 1) == ' ' && *(le.data() + 2) == '(')
+          struct timeval stamp = { 0, 0 };
+          if (binary && len >= sizeof(uint32_t))
             {
-            struct timeval stamp;
-            stamp.tv_sec = atoi(le.data() + 3);
-            stamp.tv_usec = (stamp.tv_sec % 1000) * 1000;
-            stamp.tv_sec /= 1000;
-            // If 10 seconds have elapsed since the previous log message or if a
-            // real base time hasn't been set yet, recalculate the correspondence
-            // of real time to system time.
-            if (stamp.tv_sec - m_logtask_laststamp > 10 || m_logtask_basetime.tv_sec < 1609459200)
-              {
-              struct timeval daytime, uptime;
-              gettimeofday(&daytime, NULL);
-              uptime.tv_sec = xTaskGetTickCount();
-              uptime.tv_usec = (uptime.tv_sec % 100) * 10000;
-              uptime.tv_sec /= 100;
-              daytime.tv_usec -= daytime.tv_usec % 10000;       // Always show 0 for ms units
-              timersub(&daytime, &uptime, &m_logtask_basetime);
-              }
-            m_logtask_laststamp = stamp.tv_sec;
-            // write timestamp:
-            timeradd(&m_logtask_basetime, &stamp, &stamp);
-            struct tm tmu;
-            localtime_r(&stamp.tv_sec, &tmu);
-            strftime(tb, sizeof(tb), "%Y-%m-%d %H:%M:%S", &tmu);
-            m_logfile_size += fwrite(tb, 1, strlen(tb), m_logfile);
-            snprintf(tb, sizeof(tb), ".%03lu ", stamp.tv_usec / 1000);
-            int len = strlen(tb);
-            strftime(tb+len, sizeof(tb)-len, "%Z ", &tmu);
-            m_logfile_size += fwrite(tb, 1, strlen(tb), m_logfile);
+            uint32_t fmtid;
+            memcpy(&fmtid, rec, sizeof(fmtid));
+            const char* fmt = (const char*)(uintptr_t)fmtid;
+            if (LogBinaryConstant(fmt) && LogBinaryTimestamp(fmt, rec+4, len-4, &ms))
+              LogTaskStamp(ms, &stamp);
+            m_logfile_size += m_logbinfile.WriteLog(m_logfile, &stamp, fmtid, rec+4, len-4);
+            }
+          else if (!binary)
+            {
+            if (LogTextTimestamp((const char*)rec, len, &ms))
+              LogTaskStamp(ms, &stamp);
+            m_logfile_size += m_logbinfile.WriteText(m_logfile, &stamp, (const char*)rec, len);
             }
-          // write log entry:
-          m_logfile_size += fwrite(le.data(), 1, le.size(), m_logfile);
           m_logtask_linecnt++;
           }
-        cmd.data.logbuffers->release();
-
-        // check file size:
-        if (m_logfile_maxsize && m_logfile_size > (m_logfile_maxsize*1024))
-          {
-          if (!CycleLogfile())
-            break;
-          }
-        else if (syncperiod < 0 && m_logtask_linecnt >= linecnt_synced - syncperiod)
+        }
+      else
+        {
+        while (m_logring.Peek(m_logtask_reader, &text, &len))
           {
-          linecnt_synced = m_logtask_linecnt;
-          uint32_t t0 = esp_timer_get_time();
-          fflush(m_logfile);
-          fsync(fileno(m_logfile));
-          m_logtask_fsynctime += esp_timer_get_time() - t0;
+          if (LogTextTimestamp(text, len, &ms))
+            {
+            // write timestamp:
+            struct timeval stamp;
+            LogTaskStamp(ms, &stamp);
+            m_logfile_size += fwrite(tb, 1, LogFormatTimestamp(tb, sizeof(tb), &stamp), m_logfile);
+            }
+          // write log entry:
+          m_logfile_size += LogTaskWrite(text, len, m_logfile);
+          m_logring.Advance(m_logtask_reader);
+          m_logtask_linecnt++;
           }
+        }
+      m_logtask_dropcnt += m_logring.GetLost(m_logtask_reader);
 
-        // check file status:
-        if (ferror(m_logfile))
-          {
-          ESP_LOGE(TAG, "LogTask: writing to file failed, terminating");
+      // check file size:
+      if (m_logfile_maxsize && m_logfile_size > (m_logfile_maxsize*1024))
+        {
+        if (!CycleLogfile())
           break;
-          }
         }
-      else if (cmd.type == LogTaskCmd::LTC_Exit)
+      else if (syncperiod < 0 && m_logtask_linecnt >= linecnt_synced - syncperiod)
+        {
+        linecnt_synced = m_logtask_linecnt;
+        uint32_t t0 = esp_timer_get_time();
+        fflush(m_logfile);
+        fsync(fileno(m_logfile));
+        m_logtask_fsynctime += esp_timer_get_time() - t0;
+        }
+
+      // check file status:
+      if (ferror(m_logfile))
         {
+        ESP_LOGE(TAG, "LogTask: writing to file failed, terminating");
         break;
         }
       }
     else
       {
-      // cmd timeout: anything to sync?
+      // timeout: anything to sync?
       if (m_logtask_linecnt != linecnt_synced)
         {
         linecnt_synced = m_logtask_linecnt;
@@ -1217,27 +1270,18 @@ void OvmsCommandApp::LogTask()
     }
 
   // cleanup & terminate:
+  m_logring.SetDeferred(false);
+  m_logring.RemoveReader(m_logtask_reader);
+  m_logtask_reader = -1;
+  if (m_logtask_record)
+    free(m_logtask_record);
+  m_logtask_record = NULL;
   if (m_logfile)
     fclose(m_logfile);
-  LogTaskCmd drop;
-  while (xQueueReceive(m_logtask_queue, (void*)&drop, 0) == pdTRUE)
-    {
-    if (drop.type == LogTaskCmd::LTC_Log)
-      {
-      drop.data.logbuffers->release();
-      }
-    else if (drop.type == LogTaskCmd::LTC_Exit)
-      {
-      if (drop.data.cmdack)
-        drop.data.cmdack->Give();
-      }
-    }
-  vQueueDelete(m_logtask_queue);
   m_logfile = NULL;
-  m_logtask_queue = NULL;
   m_logtask = NULL;
-  if (cmd.type == LogTaskCmd::LTC_Exit && cmd.data.cmdack)
-    cmd.data.cmdack->Give();
+  if (m_logtask_exit && m_logtask_exitack)
+    m_logtask_exitack->Give();
   vTaskDelete(NULL);
   }
 
@@ -1247,50 +1291,55 @@ bool OvmsCommandApp::StartLogTask(FILE* file)
   m_logfile = file;
   if (m_logtask)
     return true;
-  // create queue:
+  // register as log ring reader:
   m_logtask_dropcnt = 0;
-  m_logtask_queue = xQueueCreate(CONFIG_OVMS_LOGFILE_QUEUE_SIZE, sizeof(LogTaskCmd));
-  if (!m_logtask_queue)
+  m_logtask_exit = false;
+  m_logtask_exitack = NULL;
+  m_logtask_reader = m_logring.AddReader("File", LogTaskNotify, this);
+  if (m_logtask_reader < 0)
     {
-    ESP_LOGE(TAG, "StartLogTask: unable to create queue (out of memory)");
+    ESP_LOGE(TAG, "StartLogTask: no log ring reader slot available");
     return false;
     }
+  // binary format: defer message formatting to the readers
+  if (m_logfile_binary)
+    {
+    m_logtask_record = (uint8_t*) ExternalRamMalloc(m_logring.GetMaxRecord());
+    if (!m_logtask_record)
+      ESP_LOGW(TAG, "StartLogTask: out of memory, falling back to text format");
+    }
   // create task:
   BaseType_t res = xTaskCreatePinnedToCore(LogTaskEntry, "OVMS FileLog", 3*1024, (void*)this,
     CONFIG_OVMS_LOGFILE_TASK_PRIORITY, &m_logtask, CORE(1));
   if (res != pdPASS)
     {
     ESP_LOGE(TAG, "StartLogTask: unable to create task, error code=%d", res);
-    vQueueDelete(m_logtask_queue);
-    m_logtask_queue = NULL;
+    m_logring.RemoveReader(m_logtask_reader);
+    m_logtask_reader = -1;
+    if (m_logtask_record)
+      free(m_logtask_record);
+    m_logtask_record = NULL;
     return false;
     }
-  // register as logging console:
-  SetMonitoring(true);
-  MyCommandApp.RegisterConsole(this);
+  if (m_logtask_record)
+    m_logring.SetDeferred(true);
   return true;
   }
 
 bool OvmsCommandApp::StopLogTask()
   {
   OvmsMutexLock lock(&m_logtask_mutex);
-  if (!m_logtask)
+  TaskHandle_t task = m_logtask;
+  if (!task)
     return true;
-  // detach from logging:
-  SetMonitoring(false);
-  MyCommandApp.DeregisterConsole(this);
-  // send exit command to task:
+  // signal exit to task…
   OvmsSemaphore ack;
-  LogTaskCmd cmd;
-  cmd.type = LogTaskCmd::LTC_Exit;
-  cmd.data.cmdack = &ack;
-  if (xQueueSend(m_logtask_queue, &cmd, (portTickType)portMAX_DELAY) != pdTRUE)
-    {
-    ESP_LOGE(TAG, "StopLogTask: unable to send command to task");
-    return false;
-    }
+  m_logtask_exitack = &ack;
+  m_logtask_exit = true;
+  xTaskNotifyGive(task);
   // …and wait for it to finish:
   ack.Take();
+  m_logtask_exitack = NULL;
   return true;
   }
 
@@ -1327,6 +1376,13 @@ bool OvmsCommandApp::OpenLogfile()
   else
     m_logfile_size = 0;
 
+  // don't mix text & binary logs, archive the file on a format change:
+  if (m_logfile_size > 0 && LogBinaryFile::Check(m_logfile_path.c_str()) != m_logfile_binary)
+    {
+    if (ArchiveLogfile())
+      m_logfile_size = 0;
+    }
+
   // open file, start task:
   FILE* file = fopen(m_logfile_path.c_str(), "a+");
   if (file == NULL)
@@ -1334,6 +1390,8 @@ bool OvmsCommandApp::OpenLogfile()
     ESP_LOGE(TAG, "OpenLogfile: cannot open '%s'", m_logfile_path.c_str());
     return false;
     }
+  if (m_logfile_binary)
+    m_logfile_size += m_logbinfile.WriteHeader(file, GetOVMSVersion().c_str());
   if (!StartLogTask(file))
     {
     ESP_LOGE(TAG, "OpenLogfile: cannot start log task on '%s'", m_logfile_path.c_str());
@@ -1378,7 +1436,12 @@ bool OvmsCommandApp::CycleLogfile()
     return false;
   fclose(m_logfile);
   m_logfile = NULL;
+  ArchiveLogfile();
+  return OpenLogfile();
+  }
 
+bool OvmsCommandApp::ArchiveLogfile()
+  {
   char ts[20];
   time_t tm = time(NULL);
   struct tm timeinfo;
@@ -1387,32 +1450,14 @@ bool OvmsCommandApp::CycleLogfile()
   archpath.append(ts);
   if (rename(m_logfile_path.c_str(), archpath.c_str()) == 0)
     {
-    ESP_LOGI(TAG, "CycleLogfile: log file '%s' archived as '%s'", m_logfile_path.c_str(), archpath.c_str());
+    ESP_LOGI(TAG, "ArchiveLogfile: log file '%s' archived as '%s'", m_logfile_path.c_str(), archpath.c_str());
     m_logfile_cyclecnt++;
+    return true;
     }
   else
     {
-    ESP_LOGE(TAG, "CycleLogfile: rename log file '%s' to '%s' failed", m_logfile_path.c_str(), archpath.c_str());
-    }
-
-  return OpenLogfile();
-  }
-
-void OvmsCommandApp::Log(LogBuffers* msg)
-  {
-  if (!m_logtask || !m_logtask_queue)
-    {
-    msg->release();
-    return;
-    }
-  // send to LogTask:
-  LogTaskCmd cmd;
-  cmd.type = LogTaskCmd::LTC_Log;
-  cmd.data.logbuffers = msg;
-  if (xQueueSend(m_logtask_queue, &cmd, 0) != pdTRUE)
-    {
-    m_logtask_dropcnt++;
-    msg->release();
+    ESP_LOGE(TAG, "ArchiveLogfile: rename log file '%s' to '%s' failed", m_logfile_path.c_str(), archpath.c_str());
+    return false;
     }
   }
 
@@ -1533,24 +1578,27 @@ void OvmsCommandApp::ExpireTask(void* data)
 void OvmsCommandApp::ShowLogStatus(int verbosity, OvmsWriter* writer)
   {
   writer->printf(
-    "Log listeners      : %u\n"
+    "Log listeners      : %d\n"
     "File logging status: %s\n"
     "  Log file path    : %s\n"
+    "  Log file format  : %s\n"
     "  Current size     : %.1f kB\n"
     "  Cycle size       : %u kB\n"
     "  Cycle count      : %" PRIu32 "\n"
     "  Dropped messages : %" PRIu32 "\n"
     "  Messages logged  : %" PRIu32 "\n"
     "  Total fsync time : %.1f s\n"
-    , m_consoles.size()
+    , m_logring.GetReaderCount()
     , m_logfile ? "active" : "inactive"
     , m_logfile_path.empty() ? "-" : m_logfile_path.c_str()
+    , m_logfile_binary ? "binary" : "text"
     , (float) m_logfile_size / 1024.0f
     , m_logfile_maxsize
     , m_logfile_cyclecnt
     , m_logtask_dropcnt
     , m_logtask_linecnt
     , m_logtask_fsynctime / 1e6);
+  m_logring.ShowStatus(writer);
   }
 
 void OvmsCommandApp::EventHandler(std::string event, void* data)
@@ -1598,7 +1646,18 @@ void OvmsCommandApp::ReadConfig()
 
   // configure log file:
   m_logfile_maxsize = MyConfig.GetParamValueInt("log", "file.maxsize", 1024);
-  if (MyConfig.GetParamValueBool("log", "file.enable", false) == true)
+  bool enable = MyConfig.GetParamValueBool("log", "file.enable", false);
+  bool binary = (MyConfig.GetParamValue("log", "file.format", "text") == "binary");
+  if (binary != m_logfile_binary && m_logfile)
+    {
+    // format change: restart file logging
+    CloseLogfile();
+    m_logfile_binary = binary;
+    if (!enable)
+      OpenLogfile();
+    }
+  m_logfile_binary = binary;
+  if (enable)
     SetLogfile(MyConfig.GetParamValue("log", "file.path"));
   }
 
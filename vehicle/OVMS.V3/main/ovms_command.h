@@ -37,10 +37,13 @@
 #include <set>
 #include <list>
 #include <functional>
+#include <atomic>
 #include <limits.h>
 #include "ovms.h"
 #include "ovms_utils.h"
 #include "ovms_mutex.h"
+#include "log_ring.h"
+#include "log_binary.h"
 #include "task_base.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -54,8 +57,8 @@
 class OvmsWriter;
 class OvmsCommand;
 class OvmsCommandMap;
-class LogBuffers;
-typedef std::map<TaskHandle_t, LogBuffers*> PartialLogs;
+class OvmsSemaphore;
+typedef std::map<TaskHandle_t, std::string> PartialLogs;
 typedef bool (*InsertCallback)(OvmsWriter* writer, void* userData, char);
 
 class OvmsWriter
@@ -72,7 +75,6 @@ class OvmsWriter
     virtual char** GetCompletions(int &common_len, bool &finished ) { return NULL; }
     virtual void SetArgv(const char* const* argv) { return; }
     virtual const char* const* GetArgv() { return NULL; }
-    virtual void Log(LogBuffers* message) {};
     virtual void Exit();
     virtual bool IsInteractive() { return true; }
     void RegisterInsertCallback(InsertCallback cb, void* ctx);
@@ -349,8 +351,7 @@ class OvmsCommandApp : public OvmsWriter
     OvmsCommand* FindCommand(const char* name);
     OvmsCommand* FindCommandFullName(const char* name, bool allow_create_user= false);
     OvmsCommand* CheckCreateUsr(const char* name, OvmsCommand *command);
-    void RegisterConsole(OvmsWriter* writer);
-    void DeregisterConsole(OvmsWriter* writer);
+    LogRing* GetLogRing() { return &m_logring; }
     int Log(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
     int Log(const char* fmt, va_list args) __attribute__ ((format (printf, 2, 0)));
     int LogPartial(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
@@ -378,27 +379,32 @@ class OvmsCommandApp : public OvmsWriter
 
   private:
     bool CycleLogfile();
+    bool ArchiveLogfile();
     void ReadConfig();
 
     OvmsCommand* CheckCreateUsr(OvmsCommand *, bool allow_create_user);
   private:
-    int LogBuffer(LogBuffers* lb, const char* fmt, va_list args) __attribute__ ((format (printf, 3, 0)));
-
-  public:
-    void Log(LogBuffers* message);
+    static bool LogTaskNotify(void* ctx);
+    void LogTaskStamp(uint32_t ms, struct timeval* stamp);
 
   private:
     OvmsCommand m_root;
-    typedef std::set<OvmsWriter*> ConsoleSet;
-    ConsoleSet m_consoles;
+    LogRing m_logring;
     PartialLogs m_partials;
+    OvmsMutex m_partials_mutex;
+    std::atomic<int> m_partials_count;
     FILE* m_logfile;
     std::string m_logfile_path;
     size_t m_logfile_size;
     size_t m_logfile_maxsize;
+    bool m_logfile_binary;
+    LogBinaryFile m_logbinfile;
     TaskHandle_t m_logtask;
     OvmsMutex m_logtask_mutex;
-    QueueHandle_t m_logtask_queue;
+    int m_logtask_reader;
+    uint8_t* m_logtask_record;
+    volatile bool m_logtask_exit;
+    OvmsSemaphore* m_logtask_exitack;
     uint32_t m_logtask_dropcnt;
     uint32_t m_logfile_cyclecnt;
     uint32_t m_logtask_linecnt;
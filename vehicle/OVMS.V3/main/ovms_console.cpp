@@ -34,7 +34,6 @@
 #include "ovms_log.h"
 #include "ovms_console.h"
 #include "ovms_version.h"
-#include "log_buffers.h"
 
 //static const char *TAG = "Console";
 static char CRbuf[4] = { '\r', '\033', '[', 'K' };
@@ -57,12 +56,14 @@ OvmsConsole::OvmsConsole()
   m_discarded = 0;
   m_state = AT_PROMPT;
   m_lost = m_acked = 0;
+  m_logreader = -1;
+  m_logpending = false;
   }
 
 OvmsConsole::~OvmsConsole()
   {
   m_ready = false;
-  MyCommandApp.DeregisterConsole(this);
+  MyCommandApp.GetLogRing()->RemoveReader(m_logreader);
   }
 
 void OvmsConsole::Initialize(const char* console)
@@ -74,7 +75,7 @@ void OvmsConsole::Initialize(const char* console)
     printf("\nWelcome to the Open Vehicle Monitoring System (OVMS) - %s Console\n", console);
     printf("Firmware: %s\nHardware: %s\n",GetOVMSVersion().c_str(),GetOVMSHardware().c_str());
     ProcessChar('\n');
-    MyCommandApp.RegisterConsole(this);
+    m_logreader = MyCommandApp.GetLogRing()->AddReader(console, LogRingNotify, this);
     }
   m_ready = true;
   }
@@ -126,21 +127,56 @@ char** OvmsConsole::GetCompletions(int &common_len, bool &finished )
   return m_completions;
   }
 
-void OvmsConsole::Log(LogBuffers* message)
+bool OvmsConsole::LogRingNotify(void* ctx)
   {
-  if (!m_ready)
+  OvmsConsole* me = (OvmsConsole*) ctx;
+  if (!me->m_ready)
+    return false;
+  Event event;
+  event.type = ALERT_RING;
+  event.buffer = NULL;
+  return (xQueueSendToBack(me->m_queue, (void * )&event, 0) == pdPASS);
+  }
+
+void OvmsConsole::ReadLogRing()
+  {
+  LogRing* ring = MyCommandApp.GetLogRing();
+  const char* text;
+  size_t len;
+  m_logpending = false;
+  ring->Acknowledge(m_logreader);
+  while (ring->Peek(m_logreader, &text, &len))
     {
-    message->release();
-    return;
+    if (m_monitoring && len > 0)
+      DisplayLog(text, len);
+    ring->Advance(m_logreader);
     }
-  Event event;
-  event.type = ALERT_MULTI;
-  event.multi = message;
-  BaseType_t ret = xQueueSendToBack(m_queue, (void * )&event, 0);
-  if (ret != pdPASS)
+  m_lost += ring->GetLost(m_logreader);
+  }
+
+// We remove the newline from the end of a log message so that we can later
+// output a newline as part of restoring the command prompt and its line
+// without leaving a blank line above it.  So before we display a new log
+// message we need to output a newline if the last action was displaying a
+// log message, or output a carriage return to back over the prompt.
+void OvmsConsole::DisplayLog(const char* buffer, size_t len)
+  {
+  if (m_state == AWAITING_NL)
+    write(NLbuf, 2);
+  else if (m_state == AT_PROMPT)
+    write(CRbuf, 4);
+  if (buffer[len-1] == '\n')
     {
-    message->release();
-    ++m_lost;
+    --len;
+    if (len && buffer[len-1] == '\r')  // Omit CR, too, in case of \r\n
+      --len;
+    m_state = AWAITING_NL;
+    write(buffer, len);
+    }
+  else
+    {
+    m_state = NO_NL;
+    write(buffer, len);
     }
   }
 
@@ -173,6 +209,17 @@ void OvmsConsole::Poll(portTickType ticks, QueueHandle_t queue)
         HandleDeviceEvent(&event);
         continue;
         }
+      // Log ring messages are read in place, while a command that takes input
+      // is executing they stay in the ring until the command has finished.
+      if (event.type == ALERT_RING)
+        {
+        if (m_insert)
+          m_logpending = true;
+        else
+          ReadLogRing();
+        ticks = 200 / portTICK_PERIOD_MS;
+        continue;
+        }
       // While a command that takes input is executing, put alert events into a
       // separate "deferred" queue.  If that queue fills, keep only the last N
       // events and count those discarded.
@@ -185,71 +232,22 @@ void OvmsConsole::Poll(portTickType ticks, QueueHandle_t queue)
           Event discard;
           xQueueReceive(m_deferred, (void*)&discard, 0);
           xQueueSendToBack(m_deferred, (void *)&event, 0);
-          if (discard.type == ALERT_MULTI)
-            discard.multi->release();
-          else
-            free(discard.buffer);
+          free(discard.buffer);
           ++m_discarded;
           }
         continue;
         }
-      // We remove the newline from the end of a log message so that we can later
-      // output a newline as part of restoring the command prompt and its line
-      // without leaving a blank line above it.  So before we display a new log
-      // message we need to output a newline if the last action was displaying a
-      // log message, or output a carriage return to back over the prompt.
-      if (m_monitoring &&
-        (event.type != ALERT_MULTI || event.multi->begin() != event.multi->end()))
-        {
-        if (m_state == AWAITING_NL)
-          write(NLbuf, 2);
-        else if (m_state == AT_PROMPT)
-          write(CRbuf, 4);
-        char* buffer;
-        size_t len;
-        if (event.type == ALERT_MULTI)
-          {
-          LogBuffers::iterator before = event.multi->begin(), after;
-          while (true)
-            {
-            buffer = *before;
-            len = strlen(buffer);
-            after = before;
-            ++after;
-            if (after == event.multi->end())
-              break;
-            write(buffer, len);
-            before = after;
-            }
-          }
-        else
-          {
-          buffer = event.buffer;
-          len = strlen(buffer);
-          }
-        if (buffer[len-1] == '\n')
-          {
-          --len;
-          if (buffer[len-1] == '\r')  // Omit CR, too, in case of \r\n
-            --len;
-          m_state = AWAITING_NL;
-          write(buffer, len);
-          }
-        else
-          {
-          m_state = NO_NL;
-          write(buffer, len);
-          }
-        }
-      if (event.type == ALERT_MULTI)
-        event.multi->release();
-      else
-        free(event.buffer);
+      if (m_monitoring && event.buffer[0])
+        DisplayLog(event.buffer, strlen(event.buffer));
+      free(event.buffer);
       ticks = 200 / portTICK_PERIOD_MS;
       }
     else
       {
-      // Timeout indicates the queue is empty
+      // Timeout indicates the queue is empty, check for log ring messages
+      // not signalled due to a full queue:
+      if (!m_insert && m_logreader >= 0)
+        ReadLogRing();
       unsigned int lost = m_lost - m_acked;     // Modulo 2^32 arithmetic
       if (lost > 0)
         {
@@ -272,6 +270,8 @@ void OvmsConsole::Poll(portTickType ticks, QueueHandle_t queue)
 
 void OvmsConsole::finalise()
   {
+  if (m_logpending)
+    ReadLogRing();
   if (m_deferred)
     {
     if (m_discarded)
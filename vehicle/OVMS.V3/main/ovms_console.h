@@ -39,7 +39,6 @@
 
 class OvmsCommandMap;
 class Parent;
-class LogBuffers;
 struct mbuf;
 
 class OvmsConsole : public OvmsShell
@@ -57,7 +56,7 @@ class OvmsConsole : public OvmsShell
       {
       RECV = 0x10000,
       ALERT,
-      ALERT_MULTI
+      ALERT_RING
       } event_type_t;
 
     typedef struct
@@ -66,7 +65,6 @@ class OvmsConsole : public OvmsShell
       union
         {
         char* buffer;       // Pointer to ALERT buffer
-        LogBuffers* multi;  // Pointer to ALERT_MULTI message
         ssize_t size;       // Buffer size for RECV
         struct mbuf* mbuf;  // Buffer pointer for RECV with Mongoose
         };
@@ -83,12 +81,14 @@ class OvmsConsole : public OvmsShell
     void Initialize(const char* console);
     char** SetCompletion(int index, const char* token, bool isfinal) override;
     char** GetCompletions(int &common_len, bool &finished ) override;
-    void Log(LogBuffers* message);
     void Poll(portTickType ticks, QueueHandle_t queue = NULL);
 
   protected:
     void Service();
     void finalise();
+    void DisplayLog(const char* buffer, size_t len);
+    void ReadLogRing();
+    static bool LogRingNotify(void* ctx);
 
   protected:
     virtual void HandleDeviceEvent(void* event) = 0;
@@ -105,6 +105,8 @@ class OvmsConsole : public OvmsShell
     DisplayState m_state;
     unsigned int m_lost;        // Log messages lost due to full queue
     unsigned int m_acked;       // Log messages acknowledged as lost
+    int m_logreader;            // Log ring reader id
+    bool m_logpending;          // Log ring read deferred
   };
 
 #endif //#ifndef __CONSOLE_H__
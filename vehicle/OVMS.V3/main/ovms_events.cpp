@@ -34,11 +34,13 @@ static const char *TAG = "events";
 #include <string.h>
 #include <stdio.h>
 #include <esp_task_wdt.h>
+#include <esp_timer.h>
 #include "ovms_module.h"
 #include "ovms_events.h"
 #include "ovms_command.h"
 #include "ovms_script.h"
 #include "ovms_boot.h"
+#include "metrics_standard.h"
 #if ESP_IDF_VERSION_MAJOR >= 4
 #include <esp_netif_types.h>
 #include <esp_eth_com.h>
@@ -99,12 +101,18 @@ void event_trace(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
   writer->printf("Event tracing is now %s\n",cmd->GetName());
   }
 
+static const char* const event_lane_names[EVENT_LANE_COUNT] = { "critical", "normal", "bulk" };
+
 void event_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
-  writer->printf("Event map has %d listeners, and queue has %d/%d entries\n",
+  writer->printf("Event map has %d listeners, and queue has %d/%d %d/%d %d/%d entries (critical normal bulk)\n",
     MyEvents.Map().size(),
-    uxQueueMessagesWaiting(MyEvents.m_taskqueue),
-    CONFIG_OVMS_HW_EVENT_QUEUE_SIZE);
+    uxQueueMessagesWaiting(MyEvents.m_lanes[EVENT_LANE_CRITICAL].m_queue),
+    MyEvents.m_lanes[EVENT_LANE_CRITICAL].m_size,
+    uxQueueMessagesWaiting(MyEvents.m_lanes[EVENT_LANE_NORMAL].m_queue),
+    MyEvents.m_lanes[EVENT_LANE_NORMAL].m_size,
+    uxQueueMessagesWaiting(MyEvents.m_lanes[EVENT_LANE_BULK].m_queue),
+    MyEvents.m_lanes[EVENT_LANE_BULK].m_size);
 
   EventCallbackEntry* cbe = MyEvents.m_current_callback;
   if (cbe != NULL)
@@ -114,6 +122,12 @@ void event_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
     writer->printf("  To:    %s\n",cbe->m_caller.c_str());
     writer->printf("  For:   %" PRIu32 " second(s)\n",monotonictime-MyEvents.m_current_started);
     }
+
+  if (MyEvents.m_coalesce_size)
+    {
+    writer->printf("Coalescing %d event(s), %" PRIu32 " signal(s) coalesced\n",
+      MyEvents.m_coalesce_size, MyEvents.m_coalesced);
+    }
   }
 
 void event_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
@@ -180,6 +194,59 @@ void event_raise(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
     }
   }
 
+void event_coalesce(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (argc == 2)
+    {
+    uint32_t window_ms = atol(argv[1]);
+    MyEvents.SetCoalescing(argv[0], window_ms);
+    if (window_ms)
+      writer->printf("Event '%s' coalesced to max one signal per %" PRIu32 " ms\n", argv[0], window_ms);
+    else
+      writer->printf("Event '%s' coalescing disabled\n", argv[0]);
+    }
+  else if (argc == 1)
+    {
+    uint32_t window_ms = MyEvents.GetCoalescing(argv[0]);
+    if (window_ms)
+      writer->printf("Event '%s' coalesced to max one signal per %" PRIu32 " ms\n", argv[0], window_ms);
+    else
+      writer->printf("Event '%s' not coalesced\n", argv[0]);
+    }
+  else
+    {
+    MyEvents.CoalesceStatus(writer);
+    }
+  }
+
+void event_lane(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  if (argc == 2)
+    {
+    int lane;
+    for (lane = 0; lane < EVENT_LANE_COUNT; lane++)
+      {
+      if (strcmp(argv[1], event_lane_names[lane]) == 0)
+        break;
+      }
+    if (lane == EVENT_LANE_COUNT)
+      {
+      cmd->PutUsage(writer);
+      return;
+      }
+    MyEvents.SetEventLane(argv[0], (event_lane_t)lane);
+    writer->printf("Event '%s' assigned to %s lane\n", argv[0], event_lane_names[lane]);
+    }
+  else if (argc == 1)
+    {
+    writer->printf("Event '%s' uses %s lane\n", argv[0], event_lane_names[MyEvents.GetEventLane(argv[0])]);
+    }
+  else
+    {
+    MyEvents.LaneStatus(writer);
+    }
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 
 static duk_ret_t DukOvmsRaiseEvent(duk_context *ctx)
@@ -201,6 +268,9 @@ OvmsEvents::OvmsEvents()
   ESP_LOGI(TAG, "Initialising EVENTS (1200)");
 
   m_current_callback = NULL;
+  m_current_count = 1;
+  m_coalesce_size = 0;
+  m_coalesced = 0;
 
 #ifdef CONFIG_OVMS_DEV_DEBUGEVENTS
   m_trace = true;
@@ -220,11 +290,46 @@ OvmsEvents::OvmsEvents()
   cmd_event->RegisterCommand("status","Show status of event system",event_status);
   cmd_event->RegisterCommand("list","List registered events",event_list,"[<key>]", 0, 1);
   cmd_event->RegisterCommand("raise","Raise a textual event",event_raise,"[-d<delay_ms>] <event>", 1, 2, true, event_validate);
+  cmd_event->RegisterCommand("coalesce","Show or set event coalescing",event_coalesce,
+    "[<event> [<window_ms>]]\n"
+    "Without arguments, list all coalesced events with statistics.\n"
+    "<window_ms> = minimum interval between deliveries of <event>, 0 = disable coalescing",
+    0, 2, true, event_validate);
+  cmd_event->RegisterCommand("lane","Show or set event priority lanes",event_lane,
+    "[<event> [critical|normal|bulk]]\n"
+    "Without arguments, show the lane assignments and statistics.\n"
+    "<event> may be a prefix pattern ending in '.*', e.g. 'power.*'\n"
+    "Bulk lane events are dropped on overflow, only assign expendable events to it.",
+    0, 2, true, event_validate);
   OvmsCommand* cmd_eventtrace = cmd_event->RegisterCommand("trace","EVENT trace framework");
   cmd_eventtrace->RegisterCommand("on","Turn event tracing ON",event_trace);
   cmd_eventtrace->RegisterCommand("off","Turn event tracing OFF",event_trace);
 
-  m_taskqueue = xQueueCreate(CONFIG_OVMS_HW_EVENT_QUEUE_SIZE,sizeof(event_queue_t));
+  m_lanes[EVENT_LANE_CRITICAL].m_size = CONFIG_OVMS_HW_EVENT_QUEUE_CRITICAL_SIZE;
+  m_lanes[EVENT_LANE_NORMAL].m_size = CONFIG_OVMS_HW_EVENT_QUEUE_SIZE;
+  m_lanes[EVENT_LANE_BULK].m_size = CONFIG_OVMS_HW_EVENT_QUEUE_BULK_SIZE;
+  int total = 0;
+  for (int i = 0; i < EVENT_LANE_COUNT; i++)
+    {
+    EventLane& lane = m_lanes[i];
+    lane.m_queue = xQueueCreate(lane.m_size,sizeof(event_queue_t));
+    lane.m_skipped = 0;
+    lane.m_depth_max = 0;
+    lane.m_latency_max = 0;
+    lane.m_delivered = 0;
+    lane.m_dropped = 0;
+    total += lane.m_size;
+    }
+  m_tasksignal = xSemaphoreCreateCounting(total, 0);
+
+  // Default lane assignments:
+  m_lanemap["system.shuttingdown"] = EVENT_LANE_CRITICAL;
+  m_lanemap["system.shutdown"] = EVENT_LANE_CRITICAL;
+  m_lanemap["vehicle.charge.stop"] = EVENT_LANE_CRITICAL;
+  m_lanemap["power.*"] = EVENT_LANE_CRITICAL;
+  m_lanemap["ticker.*"] = EVENT_LANE_BULK;
+
+  RegisterEvent(TAG, "ticker.60", std::bind(&OvmsEvents::LaneTicker, this, std::placeholders::_1, std::placeholders::_2));
   xTaskCreatePinnedToCore(EventLaunchTask, "OVMS Events", 8192, (void*)this, 8, &m_taskid, CORE(1));
   AddTaskToMap(m_taskid);
 
@@ -250,7 +355,7 @@ void OvmsEvents::EventTask()
   esp_task_wdt_add(NULL); // WATCHDOG is active for this task
   while(1)
     {
-    if (xQueueReceive(m_taskqueue, &msg, pdMS_TO_TICKS(5000)) == pdTRUE)
+    if (ReceiveEvent(&msg, pdMS_TO_TICKS(5000)))
       {
       esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
       switch(msg.type)
@@ -263,6 +368,12 @@ void OvmsEvents::EventTask()
           esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
           m_current_event.clear();
           break;
+        case EVENT_coalesced:
+          DeliverCoalescedEvent(&msg);
+          esp_task_wdt_reset(); // Reset WATCHDOG timer for this task
+          m_current_event.clear();
+          m_current_count = 1;
+          break;
         default:
           break;
         }
@@ -394,13 +505,16 @@ void OvmsEvents::DeregisterEvent(std::string caller)
     }
   }
 
-static void CheckQueueOverflow(const char* from, char* event)
+static void CheckQueueOverflow(const char* from, event_queue_t* msg)
   {
+  const char* event = msg->body.signal.event;
+  const char* lane = event_lane_names[msg->lane];
   EventCallbackEntry* cbe = MyEvents.m_current_callback;
   if (cbe != NULL)
     {
-    ESP_LOGE(TAG, "%s: queue overflow (running %s->%s for %" PRIu32 " sec), event '%s' dropped",
+    ESP_LOGE(TAG, "%s: %s queue overflow (running %s->%s for %" PRIu32 " sec), event '%s' dropped",
       from,
+      lane,
       MyEvents.m_current_event.c_str(),
       cbe->m_caller.c_str(),
       monotonictime-MyEvents.m_current_started,
@@ -408,9 +522,10 @@ static void CheckQueueOverflow(const char* from, char* event)
     }
   else
     {
-    ESP_LOGE(TAG, "%s: queue overflow, event '%s' dropped", from, event);
+    ESP_LOGE(TAG, "%s: %s queue overflow, event '%s' dropped", from, lane, event);
     }
-  if (strncmp(event, "ticker.", 7) != 0)
+  // Bulk lane events are expendable by assignment:
+  if (msg->lane != EVENT_LANE_BULK && strncmp(event, "ticker.", 7) != 0)
     {
     // We've dropped a potentially important event, system is instable now.
     // As the event queue is full, a normal reboot is no option, so…
@@ -442,10 +557,17 @@ void OvmsEvents::SignalScheduledEvent(TimerHandle_t timer)
     }
 
   // … and pass on to event task:
-  if (xQueueSend(MyEvents.m_taskqueue, msg, 0) != pdTRUE)
+  if (!MyEvents.QueueEvent(msg))
     {
-    CheckQueueOverflow("SignalScheduledEvent", msg->body.signal.event);
-    MyEvents.FreeQueueSignalEvent(msg);
+    if (msg->type == EVENT_coalesced)
+      {
+      MyEvents.ReleaseCoalescedEvent(msg);
+      }
+    else
+      {
+      CheckQueueOverflow("SignalScheduledEvent", msg);
+      MyEvents.FreeQueueSignalEvent(msg);
+      }
     }
 
   delete msg;
@@ -515,6 +637,7 @@ void OvmsEvents::SignalEvent(std::string event, void* data, event_signal_done_fn
   memset(&msg, 0, sizeof(msg));
 
   msg.type = EVENT_signal;
+  msg.lane = GetEventLane(event);
   msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
   strcpy(msg.body.signal.event, event.c_str());
   msg.body.signal.data = data;
@@ -522,9 +645,11 @@ void OvmsEvents::SignalEvent(std::string event, void* data, event_signal_done_fn
 
   if (delay_ms == 0)
     {
-    if (xQueueSend(m_taskqueue, &msg, 0) != pdTRUE)
+    if (m_coalesce_size && CoalesceEvent(&msg))
+      return;
+    if (!QueueEvent(&msg))
       {
-      CheckQueueOverflow("SignalEvent", msg.body.signal.event);
+      CheckQueueOverflow("SignalEvent", &msg);
       FreeQueueSignalEvent(&msg);
       }
     }
@@ -545,6 +670,7 @@ void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
   memset(&msg, 0, sizeof(msg));
 
   msg.type = EVENT_signal;
+  msg.lane = GetEventLane(event);
   msg.body.signal.event = (char*)ExternalRamMalloc(event.size()+1);
   strcpy(msg.body.signal.event, event.c_str());
   if (data != NULL)
@@ -561,9 +687,11 @@ void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
 
   if (delay_ms == 0)
     {
-    if (xQueueSend(m_taskqueue, &msg, 0) != pdTRUE)
+    if (m_coalesce_size && CoalesceEvent(&msg))
+      return;
+    if (!QueueEvent(&msg))
       {
-      CheckQueueOverflow("SignalEvent", msg.body.signal.event);
+      CheckQueueOverflow("SignalEvent", &msg);
       FreeQueueSignalEvent(&msg);
       }
     }
@@ -577,6 +705,331 @@ void OvmsEvents::SignalEvent(std::string event, void* data, size_t length,
     }
   }
 
+/**
+ * QueueEvent: pass a message to the event task in its lane
+ */
+bool OvmsEvents::QueueEvent(event_queue_t* msg)
+  {
+  EventLane& lane = m_lanes[msg->lane];
+  msg->queued = (uint32_t) esp_timer_get_time();
+  if (xQueueSend(lane.m_queue, msg, 0) != pdTRUE)
+    {
+    lane.m_dropped++;
+    return false;
+    }
+  xSemaphoreGive(m_tasksignal);
+  return true;
+  }
+
+/**
+ * ReceiveEvent: fetch the next message for the event task
+ *  Lanes are served in priority order, with starvation protection for
+ *  the lower lanes.
+ */
+bool OvmsEvents::ReceiveEvent(event_queue_t* msg, TickType_t timeout)
+  {
+  while (xSemaphoreTake(m_tasksignal, timeout) == pdTRUE)
+    {
+    int serve = -1, starved = -1;
+    for (int i = 0; i < EVENT_LANE_COUNT; i++)
+      {
+      EventLane& lane = m_lanes[i];
+      int depth = uxQueueMessagesWaiting(lane.m_queue);
+      if (depth == 0)
+        {
+        lane.m_skipped = 0;
+        continue;
+        }
+      if (depth > lane.m_depth_max)
+        lane.m_depth_max = depth;
+      if (serve < 0)
+        serve = i;
+      else if (++lane.m_skipped >= EVENT_LANE_MAXSKIP && starved < 0)
+        starved = i;
+      }
+    if (starved >= 0)
+      serve = starved;
+    if (serve < 0)
+      continue; // message has already been served on an earlier signal
+
+    EventLane& lane = m_lanes[serve];
+    if (xQueueReceive(lane.m_queue, msg, 0) != pdTRUE)
+      continue;
+    lane.m_skipped = 0;
+    lane.m_delivered++;
+    uint32_t latency = (uint32_t) esp_timer_get_time() - msg->queued;
+    if (latency > lane.m_latency_max)
+      lane.m_latency_max = latency;
+    return true;
+    }
+  return false;
+  }
+
+/**
+ * SetEventLane: assign an event or event prefix pattern ("power.*") to a lane
+ *  Note: bulk lane events are dropped on queue overflow, other events
+ *  (except ticker.*) cause an abort, so only assign expendable events to
+ *  the bulk lane.
+ */
+void OvmsEvents::SetEventLane(const std::string& pattern, event_lane_t lane)
+  {
+  OvmsMutexLock lock(&m_lanemap_mutex);
+  if (lane == EVENT_LANE_NORMAL)
+    m_lanemap.erase(pattern);
+  else
+    m_lanemap[pattern] = lane;
+  }
+
+/**
+ * GetEventLane: lookup lane for an event
+ *  An exact match takes precedence, then the longest matching prefix pattern.
+ */
+event_lane_t OvmsEvents::GetEventLane(const std::string& event)
+  {
+  OvmsMutexLock lock(&m_lanemap_mutex);
+  if (m_lanemap.empty())
+    return EVENT_LANE_NORMAL;
+  auto it = m_lanemap.find(event);
+  if (it != m_lanemap.end())
+    return it->second;
+  std::string::size_type pos = event.size();
+  while (pos > 0 && (pos = event.rfind('.', pos-1)) != std::string::npos)
+    {
+    it = m_lanemap.find(event.substr(0, pos+1) + "*");
+    if (it != m_lanemap.end())
+      return it->second;
+    }
+  return EVENT_LANE_NORMAL;
+  }
+
+void OvmsEvents::LaneStatus(OvmsWriter* writer)
+  {
+  writer->printf("%-10s %7s %10s %10s %10s %12s\n", "Lane", "Queue", "Delivered", "Dropped", "Max depth", "Max latency");
+  for (int i = 0; i < EVENT_LANE_COUNT; i++)
+    {
+    EventLane& lane = m_lanes[i];
+    writer->printf("%-10s %3d/%-3d %10" PRIu32 " %10" PRIu32 " %10d %9.3f ms\n",
+      event_lane_names[i], (int)uxQueueMessagesWaiting(lane.m_queue), lane.m_size,
+      lane.m_delivered, lane.m_dropped, lane.m_depth_max, (double)lane.m_latency_max / 1000);
+    }
+  writer->puts("(max values of the current minute)");
+
+  OvmsMutexLock lock(&m_lanemap_mutex);
+  writer->puts("\nAssignments (all other events: normal):");
+  for (auto it = m_lanemap.begin(); it != m_lanemap.end(); ++it)
+    writer->printf("  %-32s %s\n", it->first.c_str(), event_lane_names[it->second]);
+  }
+
+/**
+ * LaneTicker: publish lane metrics, start new max value window
+ */
+void OvmsEvents::LaneTicker(std::string event, void* data)
+  {
+  StandardMetrics.ms_m_event_critical_depth->SetValue(m_lanes[EVENT_LANE_CRITICAL].m_depth_max);
+  StandardMetrics.ms_m_event_critical_latency->SetValue((float) m_lanes[EVENT_LANE_CRITICAL].m_latency_max / 1000000);
+  StandardMetrics.ms_m_event_normal_depth->SetValue(m_lanes[EVENT_LANE_NORMAL].m_depth_max);
+  StandardMetrics.ms_m_event_normal_latency->SetValue((float) m_lanes[EVENT_LANE_NORMAL].m_latency_max / 1000000);
+  StandardMetrics.ms_m_event_bulk_depth->SetValue(m_lanes[EVENT_LANE_BULK].m_depth_max);
+  StandardMetrics.ms_m_event_bulk_latency->SetValue((float) m_lanes[EVENT_LANE_BULK].m_latency_max / 1000000);
+  for (int i = 0; i < EVENT_LANE_COUNT; i++)
+    {
+    m_lanes[i].m_depth_max = 0;
+    m_lanes[i].m_latency_max = 0;
+    }
+  }
+
+EventCoalesceEntry::EventCoalesceEntry()
+  {
+  m_window_ms = 0;
+  m_lastsent = 0;
+  m_pending = false;
+  memset(&m_msg, 0, sizeof(m_msg));
+  m_count = 0;
+  m_signalled = 0;
+  m_delivered = 0;
+  }
+
+/**
+ * SetCoalescing: enable/disable coalescing for an event
+ *  window_ms: minimum interval between deliveries, 0 = disable
+ *  A signal pending on disable is delivered immediately.
+ */
+void OvmsEvents::SetCoalescing(const std::string& event, uint32_t window_ms)
+  {
+  OvmsMutexLock lock(&m_coalesce_mutex);
+  auto it = m_coalesce.find(event);
+  if (window_ms)
+    {
+    EventCoalesceEntry& entry = m_coalesce[event];
+    if (entry.m_window_ms == 0)
+      entry.m_lastsent = xTaskGetTickCount() - pdMS_TO_TICKS(window_ms);
+    entry.m_window_ms = window_ms;
+    }
+  else if (it != m_coalesce.end())
+    {
+    if (it->second.m_pending)
+      {
+      if (!QueueEvent(&it->second.m_msg))
+        {
+        ESP_LOGE(TAG, "SetCoalescing: queue overflow, event '%s' dropped", event.c_str());
+        FreeQueueSignalEvent(&it->second.m_msg);
+        }
+      }
+    m_coalesce.erase(it);
+    }
+  m_coalesce_size = m_coalesce.size();
+  }
+
+uint32_t OvmsEvents::GetCoalescing(const std::string& event)
+  {
+  OvmsMutexLock lock(&m_coalesce_mutex);
+  auto it = m_coalesce.find(event);
+  return (it != m_coalesce.end()) ? it->second.m_window_ms : 0;
+  }
+
+void OvmsEvents::CoalesceStatus(OvmsWriter* writer)
+  {
+  OvmsMutexLock lock(&m_coalesce_mutex);
+  if (m_coalesce.empty())
+    {
+    writer->puts("No events coalesced.");
+    return;
+    }
+  writer->printf("%-32s %8s %10s %10s %s\n", "Event", "Window", "Signalled", "Delivered", "Pending");
+  for (auto it = m_coalesce.begin(); it != m_coalesce.end(); ++it)
+    {
+    EventCoalesceEntry& entry = it->second;
+    writer->printf("%-32s %6" PRIu32 "ms %10" PRIu32 " %10" PRIu32 " %" PRIu32 "\n",
+      it->first.c_str(), entry.m_window_ms, entry.m_signalled, entry.m_delivered,
+      entry.m_pending ? entry.m_count : 0);
+    }
+  writer->printf("Total signals coalesced: %" PRIu32 "\n", m_coalesced);
+  }
+
+/**
+ * CoalesceEvent: apply coalescing to a signal
+ *  Returns true if the signal has been taken over (held back or merged into
+ *  the pending signal), false if it shall be queued normally.
+ */
+bool OvmsEvents::CoalesceEvent(event_queue_t* msg)
+  {
+  OvmsMutexLock lock(&m_coalesce_mutex);
+  auto it = m_coalesce.find(msg->body.signal.event);
+  if (it == m_coalesce.end())
+    return false;
+
+  EventCoalesceEntry& entry = it->second;
+  TickType_t now = xTaskGetTickCount();
+  TickType_t window = pdMS_TO_TICKS(entry.m_window_ms);
+  entry.m_signalled++;
+
+  if (entry.m_pending)
+    {
+    // merge into pending signal, latest data wins:
+    FreeQueueSignalEvent(&entry.m_msg);
+    entry.m_msg = *msg;
+    entry.m_count++;
+    m_coalesced++;
+    return true;
+    }
+
+  TickType_t elapsed = now - entry.m_lastsent;
+  if (elapsed >= window)
+    {
+    // window expired, deliver now:
+    entry.m_lastsent = now;
+    entry.m_delivered++;
+    return false;
+    }
+
+  // hold back until the window expires:
+  event_queue_t flush;
+  memset(&flush, 0, sizeof(flush));
+  flush.type = EVENT_coalesced;
+  flush.lane = msg->lane;
+  flush.body.signal.event = (char*)ExternalRamMalloc(it->first.size()+1);
+  strcpy(flush.body.signal.event, it->first.c_str());
+  uint32_t delay_ms = (window - elapsed) * portTICK_PERIOD_MS;
+  if (!ScheduleEvent(&flush, delay_ms ? delay_ms : 1))
+    {
+    free(flush.body.signal.event);
+    entry.m_lastsent = now;
+    entry.m_delivered++;
+    return false;
+    }
+  entry.m_msg = *msg;
+  entry.m_pending = true;
+  entry.m_count = 1;
+  return true;
+  }
+
+/**
+ * DeliverCoalescedEvent: EventTask handler for the window expiry
+ */
+void OvmsEvents::DeliverCoalescedEvent(event_queue_t* msg)
+  {
+  event_queue_t pending;
+  uint32_t count = 0;
+  uint32_t coalesced;
+    {
+    OvmsMutexLock lock(&m_coalesce_mutex);
+    auto it = m_coalesce.find(msg->body.signal.event);
+    if (it != m_coalesce.end() && it->second.m_pending)
+      {
+      EventCoalesceEntry& entry = it->second;
+      pending = entry.m_msg;
+      count = entry.m_count;
+      entry.m_pending = false;
+      entry.m_count = 0;
+      entry.m_lastsent = xTaskGetTickCount();
+      entry.m_delivered++;
+      }
+    coalesced = m_coalesced;
+    }
+  free(msg->body.signal.event);
+  if (count == 0)
+    return;
+
+  if (StandardMetrics.ms_m_event_coalesced)
+    StandardMetrics.ms_m_event_coalesced->SetValue((int)coalesced);
+
+  m_current_event = pending.body.signal.event;
+  m_current_count = count;
+  HandleQueueSignalEvent(&pending);
+  }
+
+/**
+ * ReleaseCoalescedEvent: the window expiry message could not be queued
+ *  The pending signal is released from the coalescing entry (so later signals
+ *  won't be merged into a signal never to be delivered) and queued directly,
+ *  or dropped with the standard overflow handling if that fails as well.
+ */
+void OvmsEvents::ReleaseCoalescedEvent(event_queue_t* msg)
+  {
+  event_queue_t pending;
+  bool haspending = false;
+    {
+    OvmsMutexLock lock(&m_coalesce_mutex);
+    auto it = m_coalesce.find(msg->body.signal.event);
+    if (it != m_coalesce.end() && it->second.m_pending)
+      {
+      EventCoalesceEntry& entry = it->second;
+      pending = entry.m_msg;
+      haspending = true;
+      entry.m_pending = false;
+      entry.m_count = 0;
+      entry.m_lastsent = xTaskGetTickCount();
+      entry.m_delivered++;
+      }
+    }
+  free(msg->body.signal.event);
+  if (haspending && !QueueEvent(&pending))
+    {
+    CheckQueueOverflow("ReleaseCoalescedEvent", &pending);
+    FreeQueueSignalEvent(&pending);
+    }
+  }
+
 #if ESP_IDF_VERSION_MAJOR >= 4
 /* Handler for all events */
 void OvmsEvents::ReceiveSystemEvent(void* handler_args, esp_event_base_t base, int32_t id, void* event_data)
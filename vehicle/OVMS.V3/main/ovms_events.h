@@ -45,6 +45,7 @@
 #include "freertos/task.h"
 #include "freertos/queue.h"
 #include "freertos/timers.h"
+#include "freertos/semphr.h"
 #include "ovms_command.h"
 #include "ovms_mutex.h"
 
@@ -76,9 +77,21 @@ extern void EventStdFree(const char* event, void* data);
 typedef enum
   {
   EVENT_none = 0,             // Do nothing
-  EVENT_signal                // Raise a signal
+  EVENT_signal,               // Raise a signal
+  EVENT_coalesced             // Deliver pending coalesced signal (body.signal.event = name)
   } event_msg_t;
 
+typedef enum
+  {
+  EVENT_LANE_CRITICAL = 0,    // Time critical events, e.g. system.shuttingdown
+  EVENT_LANE_NORMAL,          // Default
+  EVENT_LANE_BULK,            // High frequency / expendable events, e.g. ticker.* (dropped on overflow)
+  EVENT_LANE_COUNT
+  } event_lane_t;
+
+// Max number of times a waiting lane gets skipped in favour of higher lanes:
+#define EVENT_LANE_MAXSKIP    8
+
 typedef struct
   {
   union
@@ -91,11 +104,56 @@ typedef struct
       } signal;
     } body;
   event_msg_t type;
+  event_lane_t lane;
+  uint32_t queued;            // queue entry time [us] (latency statistics)
   } event_queue_t;
 
 typedef std::list<TimerHandle_t> TimerList;
 typedef std::map<TimerHandle_t, bool> TimerStatusMap;
 
+/**
+ * EventCoalesceEntry: per event coalescing state
+ *  Signals of a coalesced event are delivered at most once per window.
+ *  Signals arriving within the window replace the pending one (latest
+ *  data wins), the pending signal is delivered at the end of the window
+ *  with the number of signals it represents in m_current_count.
+ */
+class EventCoalesceEntry
+  {
+  public:
+    EventCoalesceEntry();
+
+  public:
+    uint32_t m_window_ms;           // min delivery interval
+    TickType_t m_lastsent;          // time of last delivery [ticks]
+    bool m_pending;                 // m_msg holds a pending signal
+    event_queue_t m_msg;            // pending signal
+    uint32_t m_count;               // signals represented by m_msg
+    uint32_t m_signalled;           // statistics: signals received
+    uint32_t m_delivered;           // statistics: signals delivered
+  };
+
+typedef std::map<std::string, EventCoalesceEntry> EventCoalesceMap;
+
+/**
+ * EventLane: priority lane of the event task queue
+ *  The event task serves the lanes in priority order. A lower lane skipped
+ *  EVENT_LANE_MAXSKIP times while waiting gets served next (starvation protection).
+ */
+class EventLane
+  {
+  public:
+    QueueHandle_t m_queue;
+    int m_size;
+    int m_skipped;                  // consecutive skips while waiting
+    int m_depth_max;                // statistics: max depth in current minute
+    uint32_t m_latency_max;         // statistics: max latency in current minute [us]
+    uint32_t m_delivered;           // statistics: messages delivered since boot
+    uint32_t m_dropped;             // statistics: messages dropped since boot
+  };
+
+typedef std::map<std::string, event_lane_t> EventLaneMap;
+
 class OvmsEvents
   {
   public:
@@ -107,9 +165,14 @@ class OvmsEvents
     void DeregisterEvent(std::string caller);
     void SignalEvent(std::string event, void* data, event_signal_done_fn callback = NULL, uint32_t delay_ms = 0);
     void SignalEvent(std::string event, void* data, size_t length, uint32_t delay_ms = 0);
+    void SetCoalescing(const std::string& event, uint32_t window_ms);
+    uint32_t GetCoalescing(const std::string& event);
+    void SetEventLane(const std::string& pattern, event_lane_t lane);
+    event_lane_t GetEventLane(const std::string& event);
 
   public:
     void EventTask();
+    bool ReceiveEvent(event_queue_t* msg, TickType_t timeout);
     void HandleQueueSignalEvent(event_queue_t* msg);
     void FreeQueueSignalEvent(event_queue_t* msg);
 #if ESP_IDF_VERSION_MAJOR >= 4
@@ -123,12 +186,20 @@ class OvmsEvents
   protected:
     bool ScheduleEvent(event_queue_t* msg, uint32_t delay_ms);
     static void SignalScheduledEvent(TimerHandle_t timer);
+    bool QueueEvent(event_queue_t* msg);
+    bool CoalesceEvent(event_queue_t* msg);
+    void DeliverCoalescedEvent(event_queue_t* msg);
+    void ReleaseCoalescedEvent(event_queue_t* msg);
 
   protected:
     EventMap m_map;
     TimerList m_timers;
     TimerStatusMap m_timer_active;
     OvmsMutex m_timers_mutex;
+    EventCoalesceMap m_coalesce;
+    OvmsMutex m_coalesce_mutex;
+    EventLaneMap m_lanemap;         // exact names & prefix patterns ("ticker.*")
+    OvmsMutex m_lanemap_mutex;
 #if ESP_IDF_VERSION_MAJOR >= 4
     esp_event_handler_instance_t event_handler_instance;
 #endif
@@ -136,12 +207,21 @@ class OvmsEvents
   public:
     bool m_trace;
     TaskHandle_t m_taskid;
-    QueueHandle_t m_taskqueue;
+    EventLane m_lanes[EVENT_LANE_COUNT];
+    SemaphoreHandle_t m_tasksignal;  // counts messages queued in all lanes
+    volatile int m_coalesce_size;   // number of coalesced events
+    uint32_t m_coalesced;           // signals merged by coalescing since boot
 
   public:
     EventCallbackEntry* m_current_callback;
     std::string m_current_event;
     uint32_t m_current_started;
+    uint32_t m_current_count;       // number of signals represented by current event (coalescing)
+
+  public:
+    void CoalesceStatus(OvmsWriter* writer);
+    void LaneStatus(OvmsWriter* writer);
+    void LaneTicker(std::string event, void* data);
   };
 
 extern OvmsEvents MyEvents;
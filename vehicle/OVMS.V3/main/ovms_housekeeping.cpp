@@ -79,13 +79,27 @@ void HousekeepingUpdate12V()
   if (MyPeripherals == NULL)
     return;
 
-  // Allow the user to adjust the ADC conversion factor
-  float f = MyConfig.GetParamValueFloat("system.adc","factor12v");
-  if (f == 0) f = 195.7;
-  float v = (float)MyPeripherals->m_esp32adc->read() / f;
-  // smooth out ADC errors & noise:
-  if (m1->AsFloat() != 0)
-    v = (m1->AsFloat() * 4 + v) / 5;
+  esp32adc* adc = MyPeripherals->m_esp32adc;
+  esp32adc_stats_t stats;
+  float v;
+  if (adc->GetStats(stats))
+    {
+    // continuous sampling: average of the last second
+    v = adc->ToVoltage((float)stats.sum / stats.cnt);
+    }
+  else if (adc->IsSampling())
+    {
+    // sampling (re)started, first second not complete yet: keep the last value
+    return;
+    }
+  else
+    {
+    // single conversion (conversion factor is cached by the ADC from system.adc/factor12v):
+    v = adc->ReadVoltage();
+    // smooth out ADC errors & noise:
+    if (m1->AsFloat() != 0)
+      v = (m1->AsFloat() * 4 + v) / 5;
+    }
   v = trunc(v*100) / 100;
   if (v < 1.0) v=0;
   m1->SetValue(v);
@@ -42,12 +42,14 @@ static const char *TAG = "metrics";
 #include "ovms_events.h"
 #include "ovms_script.h"
 #include "ovms_config.h"
+#include "metrics_history.h"
 #include "rom/rtc.h"
 #include "string.h"
 #include <iomanip>
 #include <locale>
 #include <time.h>
 #include <math.h>
+#include <stdarg.h>
 
 using namespace std;
 
@@ -577,6 +579,7 @@ void metrics_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
         }
       }
     }
+  std::string v;
   for (OvmsMetric* m=MyMetrics.m_first; m != NULL; m=m->m_next)
     {
     if (only_persist && !m->m_persist)
@@ -603,7 +606,9 @@ void metrics_list(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
         use_unit = my_unit;
       }
 
-    std::string v = m->AsUnitString("", use_unit);
+    v.clear();
+    OvmsMetricBuffer buf(v);
+    m->AppendUnitTo(buf, use_unit);
     if (show_staleness)
       {
       int age = m->Age();
@@ -1083,6 +1088,9 @@ OvmsMetrics::OvmsMetrics()
   m_nextmodifier = 1;
   m_first = NULL;
   m_trace = false;
+  m_listeners_all = NULL;
+  m_index = new OvmsMetricIndex(METRICS_INDEX_SIZE, NULL);
+  m_idcount = 0;
 
   // Register our commands
   OvmsCommand* cmd_metric = MyCommandApp.RegisterCommand("metrics","METRICS framework");
@@ -1118,6 +1126,7 @@ OvmsMetrics::OvmsMetrics()
   dto->RegisterDuktapeFunction(DukOvmsMetricJSON, 1, "AsJSON");
   dto->RegisterDuktapeFunction(DukOvmsMetricFloat, 2, "AsFloat");
   dto->RegisterDuktapeFunction(DukOvmsMetricGetValues, 3, "GetValues");
+  dto->RegisterDuktapeFunction(DukOvmsMetricHistory, 3, "GetHistory");
   MyDuktape.RegisterDuktapeObject(dto);
 #endif //#ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 
@@ -1146,10 +1155,81 @@ OvmsMetrics::~OvmsMetrics()
     m = m->m_next;
     delete c;
     }
+  delete m_index.load();
   }
 
+OvmsMetricIndex::OvmsMetricIndex(size_t size, OvmsMetricIndex* previous)
+  {
+  capacity = size;
+  metric = (std::atomic<OvmsMetric*>*) ExternalRamMalloc(size * sizeof(std::atomic<OvmsMetric*>));
+  listeners = (std::atomic<MetricCallbackList*>*) ExternalRamMalloc(size * sizeof(std::atomic<MetricCallbackList*>));
+  for (size_t i = 0; i < size; i++)
+    {
+    new (&metric[i]) std::atomic<OvmsMetric*>(NULL);
+    new (&listeners[i]) std::atomic<MetricCallbackList*>(NULL);
+    }
+  retired = previous;
+  }
+
+OvmsMetricIndex::~OvmsMetricIndex()
+  {
+  free(metric);
+  free(listeners);
+  if (retired)
+    delete retired;
+  }
+
+// Metrics excluded from "metrics trace" output, as they change every second:
+static const char* const metrics_notrace[] =
+  {
+  "m.monotonic", "m.time.utc", "v.e.parktime", "v.e.drivetime", "v.c.time", NULL
+  };
+
 void OvmsMetrics::RegisterMetric(OvmsMetric* metric)
   {
+  // Assign a dense id, reusing ids of deregistered metrics, and attach
+  // listeners that have been registered by name before the metric existed.
+  // Readers use the index lock free, so entries are only written to the
+  // current index, and a full index is replaced by a larger copy:
+  m_index_mutex.Lock();
+  OvmsMetricIndex* index = m_index.load();
+  if (!m_freeids.empty())
+    {
+    metric->m_id = m_freeids.back();
+    m_freeids.pop_back();
+    }
+  else
+    {
+    metric->m_id = m_idcount;
+    if (metric->m_id >= index->capacity)
+      {
+      OvmsMetricIndex* grown = new OvmsMetricIndex(index->capacity * 2, index);
+      for (size_t i = 0; i < index->capacity; i++)
+        {
+        grown->metric[i].store(index->metric[i].load());
+        grown->listeners[i].store(index->listeners[i].load());
+        }
+      ESP_LOGW(TAG, "RegisterMetric: id index grown to %u entries", (unsigned) grown->capacity);
+      m_index.store(grown, std::memory_order_release);
+      index = grown;
+      }
+    m_idcount++;
+    }
+  auto k = m_listeners.find(metric->m_name);
+  index->listeners[metric->m_id].store((k != m_listeners.end()) ? k->second : NULL, std::memory_order_release);
+  index->metric[metric->m_id].store(metric, std::memory_order_release);
+  m_index_mutex.Unlock();
+
+  metric->m_notrace = false;
+  for (const char* const* n = metrics_notrace; *n; n++)
+    {
+    if (strcmp(metric->m_name, *n) == 0)
+      {
+      metric->m_notrace = true;
+      break;
+      }
+    }
+
   // Quick simple check for if we are the first metric.
   if (m_first == NULL)
     {
@@ -1184,6 +1264,18 @@ void OvmsMetrics::RegisterMetric(OvmsMetric* metric)
 
 void OvmsMetrics::DeregisterMetric(OvmsMetric* metric)
   {
+  MyMetricsHistory.MetricRemoved(metric);
+
+  m_index_mutex.Lock();
+  OvmsMetricIndex* index = m_index.load();
+  if (metric->m_id < index->capacity && index->metric[metric->m_id].load() == metric)
+    {
+    index->metric[metric->m_id].store(NULL, std::memory_order_release);
+    index->listeners[metric->m_id].store(NULL, std::memory_order_release);
+    m_freeids.push_back(metric->m_id);
+    }
+  m_index_mutex.Unlock();
+
   if (m_first == metric)
     {
     m_first = metric->m_next;
@@ -1383,8 +1475,18 @@ void OvmsMetrics::RegisterListener(std::string caller, std::string name, MetricC
   auto k = m_listeners.find(name);
   if (k == m_listeners.end())
     {
-    m_listeners[name] = new MetricCallbackList();
+    MetricCallbackList *ml = new MetricCallbackList();
+    m_listeners[name] = ml;
     k = m_listeners.find(name);
+    if (name == "*")
+      {
+      m_listeners_all = ml;
+      }
+    else
+      {
+      OvmsMetric* m = Find(name.c_str());
+      if (m) SetIndexListeners(m->m_id, ml);
+      }
     }
   if (k == m_listeners.end())
     {
@@ -1418,6 +1520,15 @@ void OvmsMetrics::DeregisterListener(std::string caller)
       }
     if (ml->empty())
       {
+      if (ml == m_listeners_all)
+        {
+        m_listeners_all = NULL;
+        }
+      else
+        {
+        OvmsMetric* m = Find(itm->first.c_str());
+        if (m) SetIndexListeners(m->m_id, NULL);
+        }
       itm = m_listeners.erase(itm);
       delete ml;
       }
@@ -1428,35 +1539,47 @@ void OvmsMetrics::DeregisterListener(std::string caller)
     }
   }
 
+void OvmsMetrics::SetIndexListeners(uint16_t id, MetricCallbackList* ml)
+  {
+  OvmsMutexLock lock(&m_index_mutex);
+  OvmsMetricIndex* index = m_index.load();
+  if (id < index->capacity)
+    index->listeners[id].store(ml, std::memory_order_release);
+  }
+
 void OvmsMetrics::NotifyModified(OvmsMetric* metric)
   {
-  if (m_trace &&
-      strcmp(metric->m_name, "m.monotonic") != 0 &&
-      strcmp(metric->m_name, "m.time.utc") != 0 &&
-      strcmp(metric->m_name, "v.e.parktime") != 0 &&
-      strcmp(metric->m_name, "v.e.drivetime") != 0 &&
-      strcmp(metric->m_name, "v.c.time") != 0)
+  if (m_trace && !metric->m_notrace)
     {
-    ESP_LOGI(TAG, "Modified metric %s: %s",
-      metric->m_name, metric->AsUnitString().c_str());
+    char val[64];
+    OvmsMetricBuffer buf(val, sizeof(val));
+    metric->AppendUnitTo(buf);
+    if (!buf.truncated())
+      ESP_LOGI(TAG, "Modified metric %s: %s", metric->m_name, val);
+    else
+      {
+      std::string sval;
+      OvmsMetricBuffer sbuf(sval);
+      metric->AppendUnitTo(sbuf);
+      ESP_LOGI(TAG, "Modified metric %s: %s", metric->m_name, sval.c_str());
+      }
     }
 
-  auto k = m_listeners.find("*");
+  // Wildcard listeners first, then the listeners of this metric, both
+  // without any name lookup, lock or allocation:
+  MetricCallbackList* ml = m_listeners_all;
   for (int x=0;x<2;x++)
     {
-    if (k != m_listeners.end())
+    if (ml)
       {
-      MetricCallbackList* ml = k->second;
-      if (ml)
+      for (MetricCallbackList::iterator itc=ml->begin(); itc!=ml->end(); ++itc)
         {
-        for (MetricCallbackList::iterator itc=ml->begin(); itc!=ml->end(); ++itc)
-          {
-          MetricCallbackEntry* ec = *itc;
-          ec->m_callback(metric);
-          }
+        MetricCallbackEntry* ec = *itc;
+        ec->m_callback(metric);
         }
       }
-    k = m_listeners.find(metric->m_name);
+    const OvmsMetricIndex* index = m_index.load(std::memory_order_acquire);
+    ml = (metric->m_id < index->capacity) ? index->listeners[metric->m_id].load(std::memory_order_acquire) : NULL;
     }
   }
 
@@ -1497,6 +1620,143 @@ unsigned long OvmsMetrics::GetUnitSendAll()
     ret |= m->m_sendunit;
   return ret;
   }
+OvmsMetricBuffer::OvmsMetricBuffer(char* buf, size_t size)
+  {
+  m_buf = buf;
+  m_size = size;
+  m_len = 0;
+  m_str = NULL;
+  m_xstr = NULL;
+  if (m_buf && m_size)
+    *m_buf = 0;
+  }
+
+OvmsMetricBuffer::OvmsMetricBuffer(std::string& str)
+  {
+  m_buf = NULL;
+  m_size = 0;
+  m_len = 0;
+  m_str = &str;
+  m_xstr = NULL;
+  }
+
+OvmsMetricBuffer::OvmsMetricBuffer(extram::string& str)
+  {
+  m_buf = NULL;
+  m_size = 0;
+  m_len = 0;
+  m_str = NULL;
+  m_xstr = &str;
+  }
+
+void OvmsMetricBuffer::append(const char* s, size_t len)
+  {
+  if (m_str)
+    m_str->append(s, len);
+  else if (m_xstr)
+    m_xstr->append(s, len);
+  else if (m_len + 1 < m_size)
+    {
+    size_t n = std::min(len, m_size - 1 - m_len);
+    memcpy(m_buf + m_len, s, n);
+    m_buf[m_len + n] = 0;
+    }
+  m_len += len;
+  }
+
+void OvmsMetricBuffer::append_json(const char* s, size_t len)
+  {
+  // Same encoding as json_encode(), plain character runs are copied in one go:
+  char hex[10];
+  size_t run = 0;
+  for (size_t i = 0; i < len; i++)
+    {
+    const char* esc;
+    char ch = s[i];
+    switch (ch)
+      {
+      case '\n':   esc = "\\n"; break;
+      case '\r':   esc = "\\r"; break;
+      case '\t':   esc = "\\t"; break;
+      case '\b':   esc = "\\b"; break;
+      case '\f':   esc = "\\f"; break;
+      case '\"':   esc = "\\\""; break;
+      case '\\':   esc = "\\\\"; break;
+      default:
+        if (iscntrl(ch))
+          {
+          sprintf(hex, "\\u%04x", (unsigned int)ch);
+          esc = hex;
+          }
+        else
+          esc = NULL;
+        break;
+      }
+    if (esc)
+      {
+      if (i > run)
+        append(s + run, i - run);
+      append(esc);
+      run = i + 1;
+      }
+    }
+  if (len > run)
+    append(s + run, len - run);
+  }
+
+template <class S>
+static void metric_buffer_vprintf(S* str, const char* fmt, va_list args, int len)
+  {
+  size_t pos = str->size();
+  str->resize(pos + len);
+  vsnprintf(&(*str)[pos], len + 1, fmt, args);
+  }
+
+void OvmsMetricBuffer::printf(const char* fmt, ...)
+  {
+  va_list args;
+  va_start(args, fmt);
+  if (m_buf)
+    {
+    size_t pos = std::min(m_len, m_size ? m_size - 1 : 0);
+    int len = vsnprintf(m_buf + pos, m_size - pos, fmt, args);
+    if (len > 0)
+      m_len += len;
+    }
+  else
+    {
+    // Format numbers etc. on the stack, fall back to formatting in place:
+    char tmp[64];
+    va_list args2;
+    va_copy(args2, args);
+    int len = vsnprintf(tmp, sizeof(tmp), fmt, args);
+    if (len > 0 && len < (int)sizeof(tmp))
+      append(tmp, len);
+    else if (len > 0)
+      {
+      if (m_str)
+        metric_buffer_vprintf(m_str, fmt, args2, len);
+      else
+        metric_buffer_vprintf(m_xstr, fmt, args2, len);
+      m_len += len;
+      }
+    va_end(args2);
+    }
+  va_end(args);
+  }
+
+std::ostream& operator<<(std::ostream& os, const OvmsMetricFormat& fmt)
+  {
+  if (!fmt.metric->IsDefined())
+    return os << fmt.defvalue;
+  char val[64];
+  OvmsMetricBuffer buf(val, sizeof(val));
+  fmt.metric->AppendTo(buf, fmt.units, fmt.precision);
+  if (buf.truncated())
+    return os << fmt.metric->AsString(fmt.defvalue, fmt.units, fmt.precision);
+  return os.write(val, buf.length());
+  }
+
 OvmsMetric::OvmsMetric(const char* name, uint16_t autostale, metric_unit_t units, bool persist)
   {
   m_defined = NeverDefined;
@@ -1508,6 +1768,7 @@ OvmsMetric::OvmsMetric(const char* name, uint16_t autostale, metric_unit_t units
   m_units = units;
   m_next = NULL;
   m_persist = false;          // only set by metrics supporting persistence
+  m_snapshots = NULL;
   MyMetrics.RegisterMetric(this);
   }
 
@@ -1515,6 +1776,17 @@ OvmsMetric::~OvmsMetric()
   {
   MyMetrics.DeregisterMetric(this);
 
+  if (m_snapshots)
+    {
+    OvmsRecMutexLock lock(&OvmsMetricSnapshot::GetLock());
+    for (OvmsMetricSnapshotLink* link = m_snapshots; link; link = link->next)
+      {
+      link->group->m_metrics[link->slot] = NULL;
+      link->group->Publish(link->slot, NULL);
+      }
+    m_snapshots = NULL;
+    }
+
   // Warning: pointers to a deleted OvmsMetric can still be held locally in
   //  other modules. If you delete metrics, take care to inform all readers
   //  (i.e. by broadcasting a module shutdown event).
@@ -1525,6 +1797,55 @@ std::string OvmsMetric::AsString(const char* defvalue, metric_unit_t units, int
   return std::string(defvalue);
   }
 
+void OvmsMetric::AppendTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  // Fallback for metric types without allocation free formatting:
+  if (IsDefined())
+    buf.append(AsString("", units, precision));
+  }
+
+void OvmsMetric::AppendUnitTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (!IsDefined())
+    return;
+
+  // Need the converted unit for putting the label.
+  auto currentUnits = GetUnits();
+  CheckTargetUnit(currentUnits, units, true);
+  AppendTo(buf, units, precision);
+  buf.append(OvmsMetricUnitLabel(units==Native ? currentUnits : units));
+  }
+
+void OvmsMetric::AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  buf.append('"');
+  if (IsDefined())
+    {
+    char val[64];
+    OvmsMetricBuffer vbuf(val, sizeof(val));
+    AppendTo(vbuf, units, precision);
+    if (!vbuf.truncated())
+      buf.append_json(val, vbuf.length());
+    else
+      {
+      std::string sval = AsString("", units, precision);
+      buf.append_json(sval.data(), sval.size());
+      }
+    }
+  buf.append('"');
+  }
+
+std::string OvmsMetric::AppendToString(metric_unit_t units, int precision, bool json)
+  {
+  std::string res;
+  OvmsMetricBuffer buf(res);
+  if (json)
+    AppendJSONTo(buf, units, precision);
+  else
+    AppendTo(buf, units, precision);
+  return res;
+  }
+
 std::string OvmsMetric::AsUnitString(const char* defvalue, metric_unit_t units, int precision)
   {
   if (!IsDefined())
@@ -1582,12 +1903,15 @@ uint32_t OvmsMetric::Age()
 
 void OvmsMetric::SetModified(bool changed)
   {
+  bool wasdefined = (m_defined != NeverDefined);
   if (m_defined == NeverDefined)
     m_defined = FirstDefined;
   else
     m_defined = Defined;
   m_stale = false;
   m_lastmodified = monotonictime;
+  if (m_snapshots && (changed || !wasdefined))
+    PublishSnapshots();
   if (changed)
     {
     m_modified = ULONG_MAX;
@@ -1700,6 +2024,30 @@ void OvmsMetric::Clear()
   SetValue("");
   m_defined = NeverDefined;
   m_stale = true;
+  if (m_snapshots)
+    PublishSnapshots();
+  }
+
+/**
+ * SnapshotTo: capture the current value for a snapshot group
+ *  - default: the string representation, numerical types override this
+ *  - called with the snapshot lock held, with str=NULL to probe the type
+ */
+void OvmsMetric::SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size)
+  {
+  value.type = SnapString;
+  if (str && size)
+    {
+    OvmsMetricBuffer buf(str, size);
+    AppendTo(buf);
+    }
+  }
+
+void OvmsMetric::PublishSnapshots()
+  {
+  OvmsRecMutexLock lock(&OvmsMetricSnapshot::GetLock());
+  for (OvmsMetricSnapshotLink* link = m_snapshots; link; link = link->next)
+    link->group->Publish(link->slot, this);
   }
 
 OvmsMetricInt::OvmsMetricInt(const char* name, uint16_t autostale, metric_unit_t units, bool persist)
@@ -1762,87 +2110,118 @@ void OvmsMetricInt::RefreshPersist()
     *m_valuep = m_value;
   }
 
-std::string OvmsMetricInt::AsString(const char* defvalue, metric_unit_t units, int precision)
+/**
+ * metric_append_int: format integer value in (resolved) unit, shared by Int & Int64
+ */
+static void metric_append_int(OvmsMetricBuffer& buf, metric_unit_t units, int64_t value)
   {
-  if (IsDefined())
+  switch (units)
     {
-    int value = m_value;
-    CheckTargetUnit(GetUnits(), units, false);
-    if (units == Native)
-      units = m_units;
-    else if (units != m_units)
-      value = UnitConvert(m_units,units,m_value);
-    std::stringstream os;
-    switch (units)
+    case TimeUTC:
+    case TimeLocal:
       {
-      case TimeUTC:
-      case TimeLocal:
-        {
-        int hours, minutes, seconds;
-        time_unit_split(value, hours, minutes, seconds);
-        os << std::setfill('0')
-          << std::setw(2) << hours << ':'
-          << std::setw(2) << minutes << ':'
-          << std::setw(2) << seconds;
-        }
-        break;
-      case DateUTC:
-        {
-        time_t tvalue = value;
-        std::tm ourtime;
-        gmtime_r(&tvalue, &ourtime);
-        os << std::put_time(&ourtime, "%F %T UTC");
-        }
-        break;
-      case DateLocal:
-        {
-        time_t tvalue = value;
-        std::tm ourtime;
-        localtime_r(&tvalue, &ourtime);
-        os << std::put_time(&ourtime, "%F %T %Z");
-        }
-        break;
-      default:
-        os << value;
-        break;
+      int hours, minutes, seconds;
+      time_unit_split(value, hours, minutes, seconds);
+      buf.printf("%02d:%02d:%02d", hours, minutes, seconds);
+      }
+      break;
+    case DateUTC:
+      {
+      char date[40];
+      time_t tvalue = value;
+      std::tm ourtime;
+      gmtime_r(&tvalue, &ourtime);
+      buf.append(date, strftime(date, sizeof(date), "%F %T UTC", &ourtime));
+      }
+      break;
+    case DateLocal:
+      {
+      char date[40];
+      time_t tvalue = value;
+      std::tm ourtime;
+      localtime_r(&tvalue, &ourtime);
+      buf.append(date, strftime(date, sizeof(date), "%F %T %Z", &ourtime));
       }
-    return os.str();
+      break;
+    default:
+      buf.printf("%lld", (long long) value);
+      break;
     }
+  }
+
+/**
+ * metric_append_json_date: format timestamp as JSON (ISO 8601) string
+ */
+static void metric_append_json_date(OvmsMetricBuffer& buf, int64_t value)
+  {
+  char date[40];
+  time_t tvalue = value;
+  std::tm ourtime;
+  gmtime_r(&tvalue, &ourtime);
+  buf.append(date, strftime(date, sizeof(date), "\"%FT%T.000Z\"", &ourtime));
+  }
+
+std::string OvmsMetricInt::AsString(const char* defvalue, metric_unit_t units, int precision)
+  {
+  if (IsDefined())
+    return AppendToString(units, precision);
   else
-    {
     return std::string(defvalue);
-    }
   }
 
 std::string OvmsMetricInt::AsJSON(const char* defvalue, metric_unit_t units, int precision)
   {
   if (IsDefined())
-    {
-    CheckTargetUnit(GetUnits(), units, false);
-    if (units == Native)
-      units = GetUnits();
-    switch (units)
-      {
-      case TimeUTC:
-      case TimeLocal:
-        return OvmsMetric::AsJSON(defvalue, units, precision);
-      case DateLocal:
-      case DateUTC:
-        {
-        time_t tvalue = m_value;
-        std::tm ourtime;
-        gmtime_r(&tvalue, &ourtime);
-        std::ostringstream os;
-        os << '"' << std::put_time(&ourtime, "%FT%T.000Z") << '"';
-        return os.str();
-        }
-      default: return AsString(defvalue, units, precision);
-      }
-    }
+    return AppendToString(units, precision, true);
   else
     return std::string((defvalue && *defvalue) ? defvalue : "0");
   }
 
+void OvmsMetricInt::AppendTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (!IsDefined())
+    return;
+  int value = m_value;
+  CheckTargetUnit(GetUnits(), units, false);
+  if (units == Native)
+    units = m_units;
+  else if (units != m_units)
+    value = UnitConvert(m_units,units,m_value);
+  metric_append_int(buf, units, value);
+  }
+
+void OvmsMetricInt::AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (!IsDefined())
+    {
+    buf.append('0');
+    return;
+    }
+  CheckTargetUnit(GetUnits(), units, false);
+  if (units == Native)
+    units = GetUnits();
+  switch (units)
+    {
+    case TimeUTC:
+    case TimeLocal:
+      OvmsMetric::AppendJSONTo(buf, units, precision);
+      break;
+    case DateLocal:
+    case DateUTC:
+      metric_append_json_date(buf, m_value);
+      break;
+    default:
+      AppendTo(buf, units, precision);
+      break;
+    }
+  }
+
+void OvmsMetricInt::SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size)
+  {
+  value.type = SnapInt;
+  value.i = m_value;
+  }
+
 float OvmsMetricInt::AsFloat(const float defvalue, metric_unit_t units)
   {
   return (float)AsInt((int)defvalue, units);
@@ -2074,6 +2453,23 @@ std::string OvmsMetricBool::AsString(const char* defvalue, metric_unit_t units,
     }
   }
 
+void OvmsMetricBool::AppendTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (IsDefined())
+    buf.append(m_value ? "yes" : "no");
+  }
+
+void OvmsMetricBool::AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  buf.append((IsDefined() && m_value) ? "true" : "false");
+  }
+
+void OvmsMetricBool::SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size)
+  {
+  value.type = SnapBool;
+  value.b = m_value;
+  }
+
 std::string OvmsMetricBool::AsJSON(const char* defvalue, metric_unit_t units, int precision)
   {
   if (IsDefined())
@@ -2223,43 +2619,55 @@ void OvmsMetricFloat::RefreshPersist()
 std::string OvmsMetricFloat::AsString(const char* defvalue, metric_unit_t units, int precision)
   {
   if (IsDefined())
-    {
-    std::ostringstream ss;
-    if (precision >= 0)
-      {
-      // Set desired fixed precision format:
-      ss.precision(precision);
-      ss << fixed;
-      }
-    else
-      {
-      // Set standard metric format:
-      if (m_fmt_prec >= 0)
-        ss.precision(m_fmt_prec);
-      if (m_fmt_fixed)
-        ss << fixed;
-      }
-    if ((units != Other)&&(units != m_units))
-      ss << UnitConvert(m_units,units,m_value);
-    else
-      ss << m_value;
-    std::string s(ss.str());
-    return s;
-    }
+    return AppendToString(units, precision);
   else
-    {
     return std::string(defvalue);
-    }
   }
 
 std::string OvmsMetricFloat::AsJSON(const char* defvalue, metric_unit_t units, int precision)
   {
   if (IsDefined())
-    return AsString(defvalue, units, precision);
+    return AppendToString(units, precision);
   else
     return std::string((defvalue && *defvalue) ? defvalue : "0");
   }
 
+void OvmsMetricFloat::AppendTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (!IsDefined())
+    return;
+  float value = m_value;
+  if ((units != Other)&&(units != m_units))
+    {
+    metric_unit_conversion_t conv;
+    GetUnitConversion(m_units, units, conv);
+    value = conv.Convert(value);
+    }
+  // Formats match std::ostream output in default / std::fixed mode:
+  if (precision >= 0)
+    buf.printf("%.*f", precision, value);
+  else if (m_fmt_prec >= 0)
+    buf.printf(m_fmt_fixed ? "%.*f" : "%.*g", m_fmt_prec, value);
+  else
+    buf.printf(m_fmt_fixed ? "%f" : "%g", value);
+  }
+
+void OvmsMetricFloat::AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (IsDefined())
+    AppendTo(buf, units, precision);
+  else
+    buf.append('0');
+  }
+
+void OvmsMetricFloat::SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size)
+  {
+  value.type = SnapFloat;
+  value.f = m_value;
+  value.fmtprec = m_fmt_prec;
+  value.fmtfixed = m_fmt_fixed;
+  }
+
 float OvmsMetricFloat::AsFloat(const float defvalue, metric_unit_t units)
   {
   if (IsDefined())
@@ -2345,6 +2753,26 @@ std::string OvmsMetricString::AsString(const char* defvalue, metric_unit_t units
     }
   }
 
+void OvmsMetricString::AppendTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (IsDefined())
+    {
+    OvmsMutexLock lock(&m_mutex);
+    buf.append(m_value);
+    }
+  }
+
+void OvmsMetricString::AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  buf.append('"');
+  if (IsDefined())
+    {
+    OvmsMutexLock lock(&m_mutex);
+    buf.append_json(m_value.data(), m_value.size());
+    }
+  buf.append('"');
+  }
+
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
 void OvmsMetricString::DukPush(DukContext &dc, metric_unit_t units)
   {
@@ -2485,12 +2913,28 @@ bool OvmsMetricInt64::SetValueParts( persistent_value_t value_low, persistent_va
 std::string OvmsMetricInt64::AsString(const char* defvalue, metric_unit_t units, int precision)
   {
   if (IsDefined())
-    {
-    int64_t value = m_value;
-    CheckTargetUnit(GetUnits(), units, false);
-    if (units == Native)
-      units = m_units;
-    else if (units != m_units)
+    return AppendToString(units, precision);
+  else
+    return std::string(defvalue);
+  }
+
+std::string OvmsMetricInt64::AsJSON(const char* defvalue, metric_unit_t units, int precision)
+  {
+  if (IsDefined())
+    return AppendToString(units, precision, true);
+  else
+    return std::string((defvalue && *defvalue) ? defvalue : "0");
+  }
+
+void OvmsMetricInt64::AppendTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (!IsDefined())
+    return;
+  int64_t value = m_value;
+  CheckTargetUnit(GetUnits(), units, false);
+  if (units == Native)
+    units = m_units;
+  else if (units != m_units)
     {
     switch (units)
       {
@@ -2502,75 +2946,39 @@ std::string OvmsMetricInt64::AsString(const char* defvalue, metric_unit_t units,
         value = static_cast<int64_t>(round(UnitConvert(m_units,units,static_cast<float>(m_value))));
       }
     }
-    std::stringstream os;
-    switch (units)
-      {
-      case TimeUTC:
-      case TimeLocal:
-        {
-        int hours, minutes, seconds;
-        time_unit_split(value, hours, minutes, seconds);
-        os << std::setfill('0')
-          << std::setw(2) << hours << ':'
-          << std::setw(2) << minutes << ':'
-          << std::setw(2) << seconds;
-        }
-        break;
-      case DateUTC:
-        {
-        time_t tvalue = value;
-        std::tm ourtime;
-        gmtime_r(&tvalue, &ourtime);
-        os << std::put_time(&ourtime, "%F %T UTC");
-        }
-        break;
-      case DateLocal:
-        {
-        time_t tvalue = value;
-        std::tm ourtime;
-        localtime_r(&tvalue, &ourtime);
-        os << std::put_time(&ourtime, "%F %T %Z");
-        }
-        break;
-      default:
-        os << value;
-        break;
-      }
-    return os.str();
+  metric_append_int(buf, units, value);
+  }
+
+void OvmsMetricInt64::AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units, int precision)
+  {
+  if (!IsDefined())
+    {
+    buf.append('0');
+    return;
     }
-  else
+  CheckTargetUnit(GetUnits(), units, false);
+  if (units == Native)
+    units = GetUnits();
+  switch (units)
     {
-    return std::string(defvalue);
+    case TimeUTC:
+    case TimeLocal:
+      OvmsMetric::AppendJSONTo(buf, units, precision);
+      break;
+    case DateLocal:
+    case DateUTC:
+      metric_append_json_date(buf, m_value);
+      break;
+    default:
+      AppendTo(buf, units, precision);
+      break;
     }
   }
 
-std::string OvmsMetricInt64::AsJSON(const char* defvalue, metric_unit_t units, int precision)
+void OvmsMetricInt64::SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size)
   {
-  if (IsDefined())
-    {
-    CheckTargetUnit(GetUnits(), units, false);
-    if (units == Native)
-      units = GetUnits();
-    switch (units)
-      {
-      case TimeUTC:
-      case TimeLocal:
-        return OvmsMetric::AsJSON(defvalue, units, precision);
-      case DateLocal:
-      case DateUTC:
-        {
-        time_t tvalue = m_value;
-        std::tm ourtime;
-        gmtime_r(&tvalue, &ourtime);
-        std::ostringstream os;
-        os << '"' << std::put_time(&ourtime, "%FT%T.000Z") << '"';
-        return os.str();
-        }
-      default: return AsString(defvalue, units, precision);
-      }
-    }
-  else
-    return std::string((defvalue && *defvalue) ? defvalue : "0");
+  value.type = SnapInt64;
+  value.l = m_value;
   }
 
 float OvmsMetricInt64::AsFloat(const float defvalue, metric_unit_t units)
@@ -2695,6 +3103,351 @@ void OvmsMetricInt64::Clear()
   OvmsMetric::Clear();
   }
 
+
+/**
+ * OvmsMetricSnapshot: consistent multi metric reads, see header for usage
+ */
+
+int OvmsMetricSnapshot::s_batchdepth = 0;
+OvmsMetricSnapshot* OvmsMetricSnapshot::s_batch = NULL;
+
+OvmsRecMutex& OvmsMetricSnapshot::GetLock()
+  {
+  // Serializes all snapshot writers and group (de)registrations:
+  static OvmsRecMutex lock;
+  return lock;
+  }
+
+OvmsMetricSnapshot::OvmsMetricSnapshot(std::initializer_list<OvmsMetric*> metrics, size_t strsize /*=32*/)
+  : m_metrics(metrics)
+  {
+  m_seq = 0;
+  m_strsize = strsize;
+  m_inbatch = false;
+  m_batchnext = NULL;
+
+  // Probe the value types to allocate the string pool:
+  size_t cnt = m_metrics.size();
+  size_t poolsize = 0;
+  m_links.resize(cnt);
+  m_values.resize(cnt);
+  for (size_t i = 0; i < cnt; i++)
+    {
+    OvmsMetricSnapshotValue& v = m_values[i];
+    memset(&v, 0, sizeof(v));
+    if (!m_metrics[i])
+      continue; // SnapString is 0, so NULL entries must not take a pool slot
+    m_metrics[i]->SnapshotTo(v, NULL, 0);
+    if (v.type == SnapString && poolsize + m_strsize <= UINT16_MAX)
+      {
+      v.stroffset = poolsize;
+      poolsize += m_strsize;
+      }
+    else if (v.type == SnapString)
+      {
+      ESP_LOGE(TAG, "OvmsMetricSnapshot: string pool exhausted, slot %u (%s) not captured",
+        (unsigned)i, m_metrics[i]->m_name);
+      m_metrics[i] = NULL;
+      }
+    }
+  m_strings.resize(poolsize, 0);
+
+  // Link to the metrics & capture the current values:
+  OvmsRecMutexLock lock(&GetLock());
+  for (size_t i = 0; i < cnt; i++)
+    {
+    OvmsMetric* metric = m_metrics[i];
+    if (!metric) continue;
+    m_links[i].group = this;
+    m_links[i].slot = i;
+    m_links[i].next = metric->m_snapshots;
+    metric->m_snapshots = &m_links[i];
+    Store(i, metric);
+    }
+  }
+
+OvmsMetricSnapshot::~OvmsMetricSnapshot()
+  {
+  OvmsRecMutexLock lock(&GetLock());
+  for (size_t i = 0; i < m_metrics.size(); i++)
+    {
+    OvmsMetric* metric = m_metrics[i];
+    if (!metric) continue;
+    OvmsMetricSnapshotLink** link = &metric->m_snapshots;
+    while (*link && *link != &m_links[i])
+      link = &(*link)->next;
+    if (*link)
+      *link = m_links[i].next;
+    }
+  if (m_inbatch)
+    {
+    OvmsMetricSnapshot** group = &s_batch;
+    while (*group && *group != this)
+      group = &(*group)->m_batchnext;
+    if (*group)
+      *group = m_batchnext;
+    }
+  }
+
+/**
+ * Store: capture the metric value into the slot (metric NULL = deleted)
+ *  - called with the lock held and the version odd
+ */
+void OvmsMetricSnapshot::Store(uint16_t slot, OvmsMetric* metric)
+  {
+  OvmsMetricSnapshotValue& v = m_values[slot];
+  if (!metric)
+    {
+    v.defined = false;
+    return;
+    }
+  if (v.type == SnapString && m_strsize)
+    metric->SnapshotTo(v, &m_strings[v.stroffset], m_strsize);
+  else
+    metric->SnapshotTo(v, NULL, 0);
+  v.defined = metric->IsDefined();
+  v.lastmodified = metric->m_lastmodified;
+  v.units = metric->m_units;
+  }
+
+/**
+ * Publish: seqlock write of a metric update
+ *  - called with the lock held
+ *  - within an OvmsMetricSnapshotUpdate, the group stays open (odd version)
+ *    until the update ends
+ */
+void OvmsMetricSnapshot::Publish(uint16_t slot, OvmsMetric* metric)
+  {
+  if (s_batchdepth > 0)
+    {
+    if (!m_inbatch)
+      {
+      m_seq.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      m_inbatch = true;
+      m_batchnext = s_batch;
+      s_batch = this;
+      }
+    Store(slot, metric);
+    }
+  else
+    {
+    m_seq.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Store(slot, metric);
+    m_seq.fetch_add(1, std::memory_order_release);
+    }
+  }
+
+void OvmsMetricSnapshot::Copy(OvmsMetricSnapshotRecord& record)
+  {
+  memcpy(record.values.data(), m_values.data(), m_values.size() * sizeof(OvmsMetricSnapshotValue));
+  if (!m_strings.empty())
+    memcpy(record.strings.data(), m_strings.data(), m_strings.size());
+  }
+
+/**
+ * Read: copy all values of the group into the record
+ *  - lock free unless writers keep interfering
+ *  - record.version tells if anything has changed since the last read
+ */
+void OvmsMetricSnapshot::Read(OvmsMetricSnapshotRecord& record)
+  {
+  if (record.values.size() != m_values.size())
+    record.values.resize(m_values.size());
+  if (record.strings.size() != m_strings.size())
+    record.strings.resize(m_strings.size());
+
+  for (int tries = 0; tries < 5; tries++)
+    {
+    unsigned int seq = m_seq.load(std::memory_order_acquire);
+    if ((seq & 1) == 0)
+      {
+      Copy(record);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (m_seq.load(std::memory_order_relaxed) == seq)
+        {
+        record.version = seq >> 1;
+        return;
+        }
+      }
+    taskYIELD();
+    }
+
+  // Updates keep interfering (or the writer has been preempted), wait for the writers:
+  OvmsRecMutexLock lock(&GetLock());
+  Copy(record);
+  record.version = m_seq.load(std::memory_order_relaxed) >> 1;
+  }
+
+OvmsMetricSnapshotUpdate::OvmsMetricSnapshotUpdate()
+  {
+  OvmsMetricSnapshot::GetLock().Lock();
+  OvmsMetricSnapshot::s_batchdepth++;
+  }
+
+OvmsMetricSnapshotUpdate::~OvmsMetricSnapshotUpdate()
+  {
+  if (--OvmsMetricSnapshot::s_batchdepth == 0)
+    {
+    OvmsMetricSnapshot* group = OvmsMetricSnapshot::s_batch;
+    while (group)
+      {
+      OvmsMetricSnapshot* next = group->m_batchnext;
+      group->m_inbatch = false;
+      group->m_batchnext = NULL;
+      group->m_seq.fetch_add(1, std::memory_order_release);
+      group = next;
+      }
+    OvmsMetricSnapshot::s_batch = NULL;
+    }
+  OvmsMetricSnapshot::GetLock().Unlock();
+  }
+
+static const char* snapshot_str(const OvmsMetricSnapshotRecord& record, const OvmsMetricSnapshotValue& v)
+  {
+  return record.strings.empty() ? "" : &record.strings[v.stroffset];
+  }
+
+static int64_t snapshot_int64(const OvmsMetricSnapshotValue& v, metric_unit_t units)
+  {
+  // Same as OvmsMetricInt64::AsInt():
+  if (units == Native || units == v.units || units == DateUTC || units == DateLocal)
+    return v.l;
+  return UnitConvert(v.units, units, static_cast<float>(v.l));
+  }
+
+bool OvmsMetricSnapshotRecord::AsBool(size_t i, bool defvalue /*=false*/) const
+  {
+  const OvmsMetricSnapshotValue& v = values[i];
+  if (!v.defined)
+    return defvalue;
+  switch (v.type)
+    {
+    case SnapBool:    return v.b;
+    case SnapString:  return strtobool(snapshot_str(*this, v));
+    default:          return AsInt(i) != 0;
+    }
+  }
+
+int OvmsMetricSnapshotRecord::AsInt(size_t i, int defvalue /*=0*/, metric_unit_t units /*=Native*/) const
+  {
+  const OvmsMetricSnapshotValue& v = values[i];
+  if (!v.defined)
+    return defvalue;
+  switch (v.type)
+    {
+    case SnapBool:
+      return v.b;
+    case SnapInt:
+      if ((units != Native)&&(units != v.units))
+        return UnitConvert(v.units, units, (int)v.i);
+      return v.i;
+    case SnapFloat:
+      return (int) AsFloat(i, (float) defvalue, units);
+    case SnapInt64:
+      return (int) snapshot_int64(v, units);
+    default:
+      return atoi(snapshot_str(*this, v));
+    }
+  }
+
+float OvmsMetricSnapshotRecord::AsFloat(size_t i, float defvalue /*=0*/, metric_unit_t units /*=Other*/) const
+  {
+  const OvmsMetricSnapshotValue& v = values[i];
+  if (!v.defined)
+    return defvalue;
+  switch (v.type)
+    {
+    case SnapBool:
+      return v.b ? 1 : 0;
+    case SnapInt:
+      return (float) AsInt(i, (int) defvalue, units);
+    case SnapFloat:
+      if ((units != Other)&&(units != v.units))
+        return UnitConvert(v.units, units, v.f);
+      return v.f;
+    case SnapInt64:
+      return (float) snapshot_int64(v, units);
+    default:
+      return atof(snapshot_str(*this, v));
+    }
+  }
+
+std::string OvmsMetricSnapshotRecord::AsString(size_t i, const char* defvalue /*=""*/,
+  metric_unit_t units /*=Other*/, int precision /*=-1*/) const
+  {
+  if (!values[i].defined)
+    return std::string(defvalue);
+  std::string res;
+  OvmsMetricBuffer buf(res);
+  AppendTo(buf, i, units, precision);
+  return res;
+  }
+
+/**
+ * AppendTo: format the value, output equals OvmsMetric…::AppendTo()
+ */
+void OvmsMetricSnapshotRecord::AppendTo(OvmsMetricBuffer& buf, size_t i,
+  metric_unit_t units /*=Other*/, int precision /*=-1*/) const
+  {
+  const OvmsMetricSnapshotValue& v = values[i];
+  if (!v.defined)
+    return;
+  switch (v.type)
+    {
+    case SnapBool:
+      buf.append(v.b ? "yes" : "no");
+      break;
+    case SnapInt:
+    case SnapInt64:
+      {
+      int64_t value = (v.type == SnapInt) ? v.i : v.l;
+      CheckTargetUnit(v.units, units, false);
+      if (units == Native)
+        units = v.units;
+      else if (units != v.units && v.type == SnapInt)
+        value = UnitConvert(v.units, units, (int)v.i);
+      else if (units != v.units && units != DateUTC && units != DateLocal)
+        value = static_cast<int64_t>(round(UnitConvert(v.units, units, static_cast<float>(v.l))));
+      metric_append_int(buf, units, value);
+      }
+      break;
+    case SnapFloat:
+      {
+      float value = v.f;
+      if ((units != Other)&&(units != v.units))
+        {
+        metric_unit_conversion_t conv;
+        GetUnitConversion(v.units, units, conv);
+        value = conv.Convert(value);
+        }
+      if (precision >= 0)
+        buf.printf("%.*f", precision, value);
+      else if (v.fmtprec >= 0)
+        buf.printf(v.fmtfixed ? "%.*f" : "%.*g", v.fmtprec, value);
+      else
+        buf.printf(v.fmtfixed ? "%f" : "%g", value);
+      }
+      break;
+    default:
+      buf.append(snapshot_str(*this, v));
+      break;
+    }
+  }
+
+std::ostream& operator<<(std::ostream& os, const OvmsMetricSnapshotFormat& fmt)
+  {
+  if (!fmt.record->IsDefined(fmt.index))
+    return os << fmt.defvalue;
+  char val[64];
+  OvmsMetricBuffer buf(val, sizeof(val));
+  fmt.record->AppendTo(buf, fmt.index, fmt.units, fmt.precision);
+  if (buf.truncated())
+    return os << fmt.record->AsString(fmt.index, fmt.defvalue, fmt.units, fmt.precision);
+  return os.write(val, buf.length());
+  }
+
 /// Get the label for the metric.
 const char* OvmsMetricUnitLabel(metric_unit_t units)
   {
@@ -3477,6 +4230,95 @@ float UnitConvert(metric_unit_t from, metric_unit_t to, float value)
   return value;
   }
 
+/**
+ * Unit conversion cache
+ *
+ * Formatting metrics in user units means resolving the user unit (config map lookup
+ * under lock) and checking the target unit for every value. GetUnitConversion() does
+ * this once per (unit, target unit) pair. The values themselves are still converted by
+ * UnitConvert(): a linear approximation of the conversion can differ from it in the
+ * last digit.
+ *
+ * Slots are read lock free, protected by their key (generation, from, to) in the style
+ * of a sequence lock: writers claim a slot by setting the key to 1 while updating it.
+ * UnitConversionReset() invalidates all entries by switching to a new generation.
+ */
+
+#define UNIT_CONVERSION_CACHE_SIZE    64
+#define UNIT_CONVERSION_CACHE_PROBE   4
+
+static struct
+  {
+  std::atomic<uint32_t> key;                  // 0 = empty, 1 = being written
+  metric_unit_conversion_t conv;
+  } unit_conversion_cache[UNIT_CONVERSION_CACHE_SIZE];
+
+static std::atomic<uint32_t> unit_conversion_gen(1);
+
+void UnitConversionReset()
+  {
+  uint32_t gen = (unit_conversion_gen + 1) & 0xffff;
+  unit_conversion_gen = gen ? gen : 1;
+  }
+
+static void UnitConversionCompute(metric_unit_t from, metric_unit_t to, metric_unit_conversion_t& conv)
+  {
+  metric_unit_t target = to;
+  CheckTargetUnit(from, target, false);
+  if (target == from || target == Other || target == UnitNotFound)
+    target = Native;
+  conv.target = target;
+  }
+
+void GetUnitConversion(metric_unit_t from, metric_unit_t to, metric_unit_conversion_t& conv)
+  {
+  conv.from = from;
+  conv.target = Native;
+  if (from == Other || to == Other || to == Native || to == from)
+    return;
+
+  uint32_t key = (unit_conversion_gen << 16) | (from << 8) | to;
+  int index = (from * 37 + to) % UNIT_CONVERSION_CACHE_SIZE;
+  int slot = -1;
+  uint32_t slotkey = 0;
+  for (int i = 0; i < UNIT_CONVERSION_CACHE_PROBE; i++)
+    {
+    int k = (index + i) % UNIT_CONVERSION_CACHE_SIZE;
+    uint32_t k1 = unit_conversion_cache[k].key.load(std::memory_order_acquire);
+    if (k1 == key)
+      {
+      metric_unit_conversion_t c = unit_conversion_cache[k].conv;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (unit_conversion_cache[k].key.load(std::memory_order_relaxed) == key)
+        {
+        conv = c;
+        return;
+        }
+      }
+    else if (slot < 0 && (k1 >> 16) != (key >> 16) && k1 != 1)
+      {
+      // empty or outdated slot:
+      slot = k;
+      slotkey = k1;
+      }
+    }
+
+  UnitConversionCompute(from, to, conv);
+
+  if (slot < 0)
+    {
+    slot = index;
+    slotkey = unit_conversion_cache[slot].key.load(std::memory_order_relaxed);
+    if (slotkey == 1)
+      return;
+    }
+  if (unit_conversion_cache[slot].key.compare_exchange_strong(slotkey, 1, std::memory_order_acquire))
+    {
+    unit_conversion_cache[slot].conv = conv;
+    unit_conversion_cache[slot].key.store(key, std::memory_order_release);
+    }
+  }
+
 UnitConfigMap::UnitConfigMap()
   {
   for (auto it = m_modified.begin(); it != m_modified.end(); ++it)
@@ -3510,6 +4352,7 @@ void UnitConfigMap::Load()
       if (m_map[igrp] != newValue)
         {
         m_map[igrp] = newValue;
+        UnitConversionReset();
         switch (*grpit)
           {
           case GrpNone:
@@ -37,6 +37,7 @@
 #include <string>
 #include <bitset>
 #include <stdint.h>
+#include <string.h>
 #include <sstream>
 #include <set>
 #include <vector>
@@ -48,11 +49,13 @@
 #endif
 
 #include "ovms_command.h"
+#include "ovms.h"
 
 #include "ovms_log.h"
 #define TAG ((const char*)"metric")
 
 #define METRICS_MAX_MODIFIERS 32
+#define METRICS_INDEX_SIZE    1024      // initial metric id index capacity (doubled on overflow)
 
 using namespace std;
 
@@ -179,6 +182,28 @@ bool CheckTargetUnit(metric_unit_t from, metric_unit_t &to, bool full_check);
 extern int UnitConvert(metric_unit_t from, metric_unit_t to, int value);
 extern float UnitConvert(metric_unit_t from, metric_unit_t to, float value);
 
+/**
+ * metric_unit_conversion_t: resolved conversion for a (unit, target unit) pair
+ *  - target is the resolved unit (ToUser/ToMetric/ToImperial applied), Native = no conversion
+ *  - values are converted by UnitConvert(), so results are identical to a direct call
+ */
+struct metric_unit_conversion_t
+  {
+  metric_unit_t from;
+  metric_unit_t target;
+
+  float Convert(float value) const
+    {
+    if (target == Native)
+      return value;
+    else
+      return UnitConvert(from, target, value);
+    }
+  };
+
+extern void GetUnitConversion(metric_unit_t from, metric_unit_t to, metric_unit_conversion_t& conv);
+extern void UnitConversionReset();
+
 typedef std::vector<metric_group_t> metric_group_list_t;
 typedef std::set<metric_unit_t> metric_unit_set_t;
 
@@ -219,6 +244,91 @@ extern persistent_values *pmetrics_find(const std::string &name);
 extern persistent_values *pmetrics_register(const char *name);
 extern persistent_values *pmetrics_register(const std::string &name);
 
+/**
+ * OvmsMetricBuffer: output target for allocation free metric formatting
+ *  - wraps a caller owned char array (output is truncated and always terminated)
+ *  - or appends to a std::string / extram::string (reusing its capacity)
+ */
+class OvmsMetricBuffer
+  {
+  public:
+    OvmsMetricBuffer(char* buf, size_t size);
+    OvmsMetricBuffer(std::string& str);
+    OvmsMetricBuffer(extram::string& str);
+
+  public:
+    void append(const char* s, size_t len);
+    void append(const char* s) { append(s, strlen(s)); }
+    void append(const std::string& s) { append(s.data(), s.size()); }
+    void append(char c) { append(&c, 1); }
+    void append_json(const char* s, size_t len);
+    void printf(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
+    size_t length() const { return m_len; }   // Length appended, including truncated output
+    bool truncated() const { return m_buf && m_len >= m_size; }
+
+  protected:
+    char* m_buf;
+    size_t m_size;
+    size_t m_len;
+    std::string* m_str;
+    extram::string* m_xstr;
+  };
+
+inline void metric_append_value(OvmsMetricBuffer& buf, bool value, int precision)                { buf.printf("%d", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, char value, int precision)                { buf.append(value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, signed char value, int precision)         { buf.append((char)value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, unsigned char value, int precision)       { buf.append((char)value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, short value, int precision)               { buf.printf("%d", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, unsigned short value, int precision)      { buf.printf("%u", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, int value, int precision)                 { buf.printf("%d", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, unsigned int value, int precision)        { buf.printf("%u", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, long value, int precision)                { buf.printf("%ld", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, unsigned long value, int precision)       { buf.printf("%lu", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, long long value, int precision)           { buf.printf("%lld", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, unsigned long long value, int precision)  { buf.printf("%llu", value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, const std::string& value, int precision)  { buf.append(value); }
+inline void metric_append_value(OvmsMetricBuffer& buf, double value, int precision)
+  {
+  // Same output as std::ostream without / with std::fixed & precision:
+  if (precision >= 0)
+    buf.printf("%.*f", precision, value);
+  else
+    buf.printf("%g", value);
+  }
+inline void metric_append_value(OvmsMetricBuffer& buf, float value, int precision)
+  {
+  metric_append_value(buf, (double)value, precision);
+  }
+
+class OvmsMetric;
+class OvmsMetricSnapshot;
+struct OvmsMetricSnapshotValue;
+
+/**
+ * OvmsMetricSnapshotLink: membership of a metric in a snapshot group
+ *  (owned by the group, chained per metric)
+ */
+struct OvmsMetricSnapshotLink
+  {
+  OvmsMetricSnapshot* group;
+  uint16_t slot;
+  OvmsMetricSnapshotLink* next;
+  };
+
+/**
+ * OvmsMetricFormat: stream inserter for metric values avoiding temporary strings
+ *  Usage: stream << metric->Format("0", Kilometers, 1)
+ */
+struct OvmsMetricFormat
+  {
+  OvmsMetric* metric;
+  const char* defvalue;
+  metric_unit_t units;
+  int precision;
+  };
+
+extern std::ostream& operator<<(std::ostream& os, const OvmsMetricFormat& fmt);
+
 class OvmsMetric
   {
   public:
@@ -233,6 +343,19 @@ class OvmsMetric
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     virtual void DukPush(DukContext &dc, metric_unit_t units = Other);
 #endif
+
+    // Allocation free formatting into caller buffers, undefined values append nothing
+    // (AppendJSONTo: the type default), output equals AsString() / AsUnitString() / AsJSON():
+    virtual void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1);
+    void AppendUnitTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1);
+    virtual void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1);
+    // Capture the value for a snapshot group, default: string representation into str:
+    virtual void SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size);
+    OvmsMetricFormat Format(const char* defvalue = "", metric_unit_t units = Other, int precision = -1)
+      {
+      return OvmsMetricFormat { this, defvalue, units, precision };
+      }
+
     virtual bool SetValue(std::string value, metric_unit_t units = Other);
     virtual bool SetValue(dbcNumber& value);
     virtual void operator=(std::string value);
@@ -271,6 +394,10 @@ class OvmsMetric
     void SetUnitSend(size_t modifier);
     void SetUnitSendAll();
 
+  protected:
+    std::string AppendToString(metric_unit_t units, int precision, bool json = false);
+    void PublishSnapshots();
+
   public:
     OvmsMetric* m_next;
     const char* m_name;
@@ -281,6 +408,9 @@ class OvmsMetric
     metric_defined_t m_defined;
     bool m_stale;
     bool m_persist;
+    bool m_notrace;             // excluded from "metrics trace" (high frequency)
+    uint16_t m_id;              // dense registry index, see OvmsMetrics::RegisterMetric()
+    OvmsMetricSnapshotLink* m_snapshots;  // snapshot groups containing this metric
   };
 
 class OvmsMetricBool : public OvmsMetric
@@ -292,6 +422,9 @@ class OvmsMetricBool : public OvmsMetric
   public:
     std::string AsString(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
     std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size) override;
     float AsFloat(const float defvalue = 0, metric_unit_t units = Other) override;
     int AsBool(const bool defvalue = false);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
@@ -320,6 +453,9 @@ class OvmsMetricInt : public OvmsMetric
   public:
     std::string AsString(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
     std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size) override;
     float AsFloat(const float defvalue = 0, metric_unit_t units = Other) override;
     int AsInt(const int defvalue = 0, metric_unit_t units = Other);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
@@ -349,6 +485,9 @@ class OvmsMetricFloat : public OvmsMetric
     void SetFormat(int precision = -1, bool fixed = false) { m_fmt_prec = precision; m_fmt_fixed = fixed; }
     std::string AsString(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
     std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size) override;
     float AsFloat(const float defvalue = 0, metric_unit_t units = Other) override;
     int AsInt(const int defvalue = 0, metric_unit_t units = Other);
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
@@ -378,6 +517,8 @@ class OvmsMetricString : public OvmsMetric
 
   public:
     std::string AsString(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
 #ifdef CONFIG_OVMS_SC_JAVASCRIPT_DUKTAPE
     void DukPush(DukContext &dc, metric_unit_t units = Other) override;
 #endif
@@ -413,26 +554,40 @@ class OvmsMetricBitset : public OvmsMetric
       {
       if (!IsDefined())
         return std::string(defvalue);
-      std::ostringstream ss;
+      return AppendToString(units, precision);
+      }
+
+    std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override
+      {
+      std::string json = "[";
+      json += AsString(defvalue, units, precision);
+      json += "]";
+      return json;
+      }
+
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override
+      {
+      if (!IsDefined())
+        return;
       OvmsMutexLock lock(&m_mutex);
+      bool first = true;
       for (int i = 0; i < N; i++)
         {
         if (m_value[i])
           {
-          if (ss.tellp() > 0)
-            ss << ',';
-          ss << startpos + i;
+          if (!first)
+            buf.append(',');
+          buf.printf("%d", startpos + i);
+          first = false;
           }
         }
-      return ss.str();
       }
 
-    std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override
       {
-      std::string json = "[";
-      json += AsString(defvalue, units, precision);
-      json += "]";
-      return json;
+      buf.append('[');
+      AppendTo(buf, units, precision);
+      buf.append(']');
       }
 
     bool SetValue(std::string value, metric_unit_t units = Other) override
@@ -531,15 +686,7 @@ class OvmsMetricSet : public OvmsMetric
       {
       if (!IsDefined())
         return std::string(defvalue);
-      std::ostringstream ss;
-      OvmsMutexLock lock(&m_mutex);
-      for (auto i = m_value.begin(); i != m_value.end(); i++)
-        {
-        if (ss.tellp() > 0)
-          ss << ',';
-        ss << *i;
-        }
-      return ss.str();
+      return AppendToString(units, precision);
       }
 
     std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override
@@ -550,6 +697,26 @@ class OvmsMetricSet : public OvmsMetric
       return json;
       }
 
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override
+      {
+      if (!IsDefined())
+        return;
+      OvmsMutexLock lock(&m_mutex);
+      for (auto i = m_value.begin(); i != m_value.end(); i++)
+        {
+        if (i != m_value.begin())
+          buf.append(',');
+        metric_append_value(buf, *i, -1);
+        }
+      }
+
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override
+      {
+      buf.append('[');
+      AppendTo(buf, units, precision);
+      buf.append(']');
+      }
+
     bool SetValue(std::string value, metric_unit_t units = Other) override
       {
       std::set<ElemType> n_value;
@@ -799,26 +966,32 @@ class OvmsMetricVector : public OvmsMetric
       {
       if (!IsDefined())
         return std::string(defvalue);
-      std::ostringstream ss;
-      if (precision >= 0)
-        {
-        ss.precision(precision);
-        ss << fixed;
-        }
-      CheckTargetUnit(m_units, units, false);
+      return AppendToString(units, precision);
+      }
+
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override
+      {
+      if (!IsDefined())
+        return;
+      metric_unit_conversion_t conv;
+      GetUnitConversion(m_units, units, conv);
+      OvmsMutexLock lock(&m_mutex);
+      for (auto i = m_value.begin(); i != m_value.end(); i++)
         {
-        OvmsMutexLock lock(&m_mutex);
-        for (auto i = m_value.begin(); i != m_value.end(); i++)
-          {
-          if (ss.tellp() > 0)
-            ss << ',';
-          if (units != Other && units != m_units)
-            ss << (ElemType) UnitConvert(m_units, units, (float)*i);
-          else
-            ss << *i;
-          }
+        if (i != m_value.begin())
+          buf.append(',');
+        if (conv.target != Native)
+          metric_append_value(buf, (ElemType) conv.Convert((float)*i), precision);
+        else
+          metric_append_value(buf, *i, precision);
         }
-      return ss.str();
+      }
+
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override
+      {
+      buf.append('[');
+      AppendTo(buf, units, precision);
+      buf.append(']');
       }
 
     std::string ElemAsString(size_t n, const char* defvalue = "", metric_unit_t units = Other, int precision = -1, bool addunitlabel = false)
@@ -1102,6 +1275,9 @@ class OvmsMetricInt64 : public OvmsMetric64
 
     std::string AsString(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
     std::string AsJSON(const char* defvalue = "", metric_unit_t units = Other, int precision = -1) override;
+    void AppendTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void AppendJSONTo(OvmsMetricBuffer& buf, metric_unit_t units = Other, int precision = -1) override;
+    void SnapshotTo(OvmsMetricSnapshotValue& value, char* str, size_t size) override;
 
     float AsFloat(const float defvalue = 0, metric_unit_t units = Other) override; // TODO !?!?!?
 
@@ -1123,6 +1299,152 @@ class OvmsMetricInt64 : public OvmsMetric64
 
   };
 
+/**
+ * OvmsMetricSnapshot: consistent multi metric reads
+ *
+ *  Declare a group of metrics once, then Read() a versioned copy of all values
+ *  into an OvmsMetricSnapshotRecord: one lock free copy instead of N virtual
+ *  calls and string locks, and no mix of old and new values of an update.
+ *
+ *  Writers publish value changes into the group seqlock style: the version is
+ *  odd while an update is in progress, readers retry if the version changed
+ *  during their copy, and fall back to the writer lock if updates keep
+ *  interfering. To publish updates of multiple metrics as one, e.g. all
+ *  values decoded from a poll response, wrap them in an OvmsMetricSnapshotUpdate.
+ *
+ *  Numerical metrics are captured by value, all other types by their string
+ *  representation (truncated to strsize-1 chars). The group does not keep
+ *  metrics alive: a deleted metric reads as undefined.
+ *
+ *  Usage:
+ *    enum { SOC, RANGE, STATE };
+ *    OvmsMetricSnapshot group({ StandardMetrics.ms_v_bat_soc,
+ *      StandardMetrics.ms_v_bat_range_est, StandardMetrics.ms_v_charge_state });
+ *    OvmsMetricSnapshotRecord rec;
+ *    group.Read(rec);
+ *    float soc = rec.AsFloat(SOC);
+ */
+
+typedef enum : uint8_t
+  {
+  SnapString = 0,
+  SnapBool,
+  SnapInt,
+  SnapFloat,
+  SnapInt64
+  } metric_snapshot_type_t;
+
+struct OvmsMetricSnapshotValue
+  {
+  union
+    {
+    bool b;
+    int32_t i;
+    float f;
+    int64_t l;
+    };
+  uint32_t lastmodified;      // monotonictime of the last change
+  uint16_t stroffset;         // SnapString: offset of the value in the string pool
+  metric_unit_t units;
+  metric_snapshot_type_t type;
+  bool defined;
+  int8_t fmtprec;             // SnapFloat: metric format, see OvmsMetricFloat::SetFormat()
+  bool fmtfixed;
+  };
+
+class OvmsMetricSnapshotRecord;
+
+struct OvmsMetricSnapshotFormat
+  {
+  const OvmsMetricSnapshotRecord* record;
+  size_t index;
+  const char* defvalue;
+  metric_unit_t units;
+  int precision;
+  };
+
+extern std::ostream& operator<<(std::ostream& os, const OvmsMetricSnapshotFormat& fmt);
+
+/**
+ * OvmsMetricSnapshotRecord: a copy of the values of a snapshot group
+ *  - accessors are indexed by the position of the metric in the group
+ *    and match the results of the respective OvmsMetric… methods
+ *  - reuse records to avoid allocations (storage is sized on the first Read())
+ */
+class OvmsMetricSnapshotRecord
+  {
+  public:
+    OvmsMetricSnapshotRecord() : version(0) {}
+
+  public:
+    size_t size() const { return values.size(); }
+    bool IsDefined(size_t i) const { return values[i].defined; }
+    uint32_t LastModified(size_t i) const { return values[i].lastmodified; }
+    bool AsBool(size_t i, bool defvalue = false) const;
+    int AsInt(size_t i, int defvalue = 0, metric_unit_t units = Native) const;
+    float AsFloat(size_t i, float defvalue = 0, metric_unit_t units = Other) const;
+    std::string AsString(size_t i, const char* defvalue = "", metric_unit_t units = Other, int precision = -1) const;
+    void AppendTo(OvmsMetricBuffer& buf, size_t i, metric_unit_t units = Other, int precision = -1) const;
+    OvmsMetricSnapshotFormat Format(size_t i, const char* defvalue = "", metric_unit_t units = Other, int precision = -1) const
+      {
+      return OvmsMetricSnapshotFormat { this, i, defvalue, units, precision };
+      }
+
+  public:
+    uint32_t version;                             // group version the values belong to
+    std::vector<OvmsMetricSnapshotValue> values;
+    std::vector<char> strings;                    // string pool
+  };
+
+class OvmsMetricSnapshot
+  {
+  friend class OvmsMetric;
+  friend class OvmsMetricSnapshotUpdate;
+
+  public:
+    OvmsMetricSnapshot(std::initializer_list<OvmsMetric*> metrics, size_t strsize = 32);
+    ~OvmsMetricSnapshot();
+
+  public:
+    size_t size() const { return m_values.size(); }
+    uint32_t GetVersion() const { return m_seq.load(std::memory_order_acquire) >> 1; }
+    void Read(OvmsMetricSnapshotRecord& record);
+
+  protected:
+    static OvmsRecMutex& GetLock();
+    void Store(uint16_t slot, OvmsMetric* metric);
+    void Publish(uint16_t slot, OvmsMetric* metric);
+    void Copy(OvmsMetricSnapshotRecord& record);
+
+  protected:
+    std::atomic_uint m_seq;                       // seqlock version, odd = update in progress
+    std::vector<OvmsMetric*> m_metrics;
+    std::vector<OvmsMetricSnapshotLink> m_links;
+    std::vector<OvmsMetricSnapshotValue> m_values;
+    std::vector<char> m_strings;
+    uint16_t m_strsize;
+    bool m_inbatch;                               // opened by the current batch update
+    OvmsMetricSnapshot* m_batchnext;              // next group opened by the batch update
+
+  protected:
+    static int s_batchdepth;                      // OvmsMetricSnapshotUpdate nesting level
+    static OvmsMetricSnapshot* s_batch;           // groups opened by the batch update
+  };
+
+/**
+ * OvmsMetricSnapshotUpdate: publish all metric updates in the scope as one
+ *  - blocks other snapshot writers and lets snapshot readers wait, so keep it short
+ *  - metric listeners run within the update: they must not wait for other
+ *    tasks setting metrics
+ *  - may be nested
+ */
+class OvmsMetricSnapshotUpdate
+  {
+  public:
+    OvmsMetricSnapshotUpdate();
+    ~OvmsMetricSnapshotUpdate();
+  };
+
 typedef std::function<void(OvmsMetric*)> MetricCallback;
 
 class MetricCallbackEntry
@@ -1165,6 +1487,23 @@ class UnitConfigMap
 typedef std::list<MetricCallbackEntry*> MetricCallbackList;
 typedef std::map<std::string, MetricCallbackList*> MetricCallbackMap;
 
+/**
+ * OvmsMetricIndex: fixed capacity metric id index
+ *  Readers access the index lock free via OvmsMetrics::m_index. On overflow,
+ *  the index is replaced by a copy of double capacity, the previous index is
+ *  retired but kept, as concurrent readers may still use it.
+ */
+struct OvmsMetricIndex
+  {
+  OvmsMetricIndex(size_t size, OvmsMetricIndex* previous);
+  ~OvmsMetricIndex();
+
+  size_t capacity;
+  std::atomic<OvmsMetric*>* metric;                 // metric by id
+  std::atomic<MetricCallbackList*>* listeners;      // lists of m_listeners by metric id
+  OvmsMetricIndex* retired;                         // previous index
+  };
+
 class OvmsMetrics
   {
   public:
@@ -1174,6 +1513,21 @@ class OvmsMetrics
   public:
     void RegisterMetric(OvmsMetric* metric);
     void DeregisterMetric(OvmsMetric* metric);
+    OvmsMetric* FindById(uint16_t id) const
+      {
+      const OvmsMetricIndex* index = m_index.load(std::memory_order_acquire);
+      return (id < index->capacity) ? index->metric[id].load(std::memory_order_acquire) : NULL;
+      }
+    size_t GetIdCount() const { return m_idcount.load(); }
+
+  protected:
+    void SetIndexListeners(uint16_t id, MetricCallbackList* ml);
+
+  protected:
+    std::atomic<OvmsMetricIndex*> m_index;        // metric id index, see OvmsMetricIndex
+    std::atomic<size_t> m_idcount;                // ids in use or free
+    OvmsMutex m_index_mutex;                      // serialises index writers
+    std::vector<uint16_t> m_freeids;              // ids released by DeregisterMetric
 
   public:
     bool Set(const char* metric, const char* value, const char *unit = NULL);
@@ -1230,7 +1584,8 @@ class OvmsMetrics
     void DeregisterListener(std::string caller);
     void NotifyModified(OvmsMetric* metric);
   protected:
-    MetricCallbackMap m_listeners;
+    MetricCallbackMap m_listeners;                // all listeners by metric name, owns the lists
+    MetricCallbackList* m_listeners_all;          // wildcard ("*") listeners, NULL if none
 
   public:
     size_t RegisterModifier();
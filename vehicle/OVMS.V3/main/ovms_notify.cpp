@@ -34,6 +34,8 @@ static const char *TAG = "notify";
 #include <stdlib.h>
 #include <stdio.h>
 #include <sstream>
+#include <algorithm>
+#include <sys/stat.h>
 #include "ovms.h"
 #include "ovms_notify.h"
 #include "ovms_command.h"
@@ -44,6 +46,8 @@ static const char *TAG = "notify";
 #include "buffered_shell.h"
 #include "string.h"
 #include "ovms_mutex.h"
+#include "ovms_malloc.h"
+#include "ovms_utils.h"
 
 using namespace std;
 
@@ -89,13 +93,14 @@ void notify_status(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc
       {
       OvmsNotifyType* mt = itm->second;
       OvmsRecMutexLock lock(&mt->m_mutex);
-      writer->printf("  %s: %d entries\n",
-        mt->m_name, mt->m_entries.size());
-      for (NotifyEntryMap_t::iterator ite=mt->m_entries.begin(); ite!=mt->m_entries.end(); ++ite)
+      writer->printf("  %s: %d entries (%d queue slots)\n",
+        mt->m_name, mt->CountEntries(), mt->m_entries.size());
+      for (NotifyEntryQueue_t::iterator ite=mt->m_entries.begin(); ite!=mt->m_entries.end(); ++ite)
         {
-        OvmsNotifyEntry* e = ite->second;
+        OvmsNotifyEntry* e = ite->entry;
+        if (!e) continue;
         writer->printf("    %" PRId32 ": [%d pending] %s\n",
-          ite->first, e->CountPending(), e->GetValue().c_str());
+          ite->id, e->CountPending(), e->GetValue().c_str());
         }
       }
     }
@@ -175,6 +180,15 @@ OvmsNotifyEntry::OvmsNotifyEntry(const char* subtype)
   m_subtype = strdup(subtype);
   }
 
+OvmsNotifyEntry::OvmsNotifyEntry()
+  {
+  m_pendingreaders = 0;
+  m_id = 0;
+  m_created = esp_log_timestamp();
+  m_type = NULL;
+  m_subtype = NULL;
+  }
+
 OvmsNotifyEntry::~OvmsNotifyEntry()
   {
   if (m_subtype) free(m_subtype);
@@ -214,12 +228,26 @@ const char* OvmsNotifyEntry::GetSubType()
 
 ////////////////////////////////////////////////////////////////////////
 // OvmsNotifyEntryString is the notification entry for a constant
-// string type.
+// string type. Subtype and value are stored in a single PSRAM block,
+// so queued entries (i.e. historical data records while the server
+// is offline) need two heap objects each.
 
 OvmsNotifyEntryString::OvmsNotifyEntryString(const char* subtype, const char* value)
-  : OvmsNotifyEntry(subtype)
+  : OvmsNotifyEntry()
   {
-  m_value = extram::string(value);
+  size_t sublen = strlen(subtype);
+  m_valuesize = strlen(value);
+  m_subtype = (char*) ExternalRamMalloc(sublen + 1 + m_valuesize + 1);
+  if (!m_subtype)
+    {
+    m_subtype = strdup(subtype);
+    m_value = NULL;
+    m_valuesize = 0;
+    return;
+    }
+  memcpy(m_subtype, subtype, sublen + 1);
+  m_value = m_subtype + sublen + 1;
+  memcpy(m_value, value, m_valuesize + 1);
   }
 
 OvmsNotifyEntryString::~OvmsNotifyEntryString()
@@ -228,7 +256,7 @@ OvmsNotifyEntryString::~OvmsNotifyEntryString()
 
 const extram::string OvmsNotifyEntryString::GetValue()
   {
-  return m_value;
+  return m_value ? extram::string(m_value, m_valuesize) : extram::string("");
   }
 
 ////////////////////////////////////////////////////////////////////////
@@ -273,6 +301,9 @@ OvmsNotifyType::OvmsNotifyType(const char* name)
   {
   m_name = name;
   m_nextid = 1;
+  m_count = 0;
+  for (int i=0; i<NOTIFY_MAX_READERS; i++)
+    m_cursor[i] = 1;
   }
 
 OvmsNotifyType::~OvmsNotifyType()
@@ -286,7 +317,8 @@ uint32_t OvmsNotifyType::QueueEntry(OvmsNotifyEntry* entry)
 
   entry->m_id = id;
   entry->m_type = this;
-  m_entries[id] = entry;
+  m_entries.push_back({ id, entry });
+  m_count++;
 
   if (strcmp(m_name, "data") != 0 &&
       strcmp(m_name, "stream") != 0)
@@ -302,7 +334,9 @@ uint32_t OvmsNotifyType::QueueEntry(OvmsNotifyEntry* entry)
   MyNotify.NotifyReaders(this, entry);
 
   // Check if we can cleanup...
-  Cleanup(entry);
+  auto it = Locate(id);
+  if (it != m_entries.end() && it->id == id)
+    Cleanup(it);
 
   return id;
   }
@@ -313,66 +347,111 @@ uint32_t OvmsNotifyType::AllocateNextID()
   return m_nextid++;
   }
 
+/**
+ * Locate: find the queue position of the first entry with an id >= id
+ *  (the queue is ordered by id)
+ */
+NotifyEntryQueue_t::iterator OvmsNotifyType::Locate(uint32_t id)
+  {
+  if (m_entries.empty() || id <= m_entries.front().id)
+    return m_entries.begin();
+  return std::lower_bound(m_entries.begin(), m_entries.end(), id,
+    [](const OvmsNotifyQueueItem_t& item, uint32_t id) { return item.id < id; });
+  }
+
+/**
+ * AdvanceCursor: move the reader cursor past entries not pending for the reader
+ */
+void OvmsNotifyType::AdvanceCursor(size_t reader)
+  {
+  auto it = Locate(m_cursor[reader]);
+  while (it != m_entries.end() && (!it->entry || it->entry->IsRead(reader)))
+    ++it;
+  m_cursor[reader] = (it != m_entries.end()) ? it->id : m_nextid;
+  }
+
 void OvmsNotifyType::ClearReader(size_t reader)
   {
   OvmsRecMutexLock lock(&m_mutex);
-  if (m_entries.size() > 0)
+  if (reader >= NOTIFY_MAX_READERS)
+    return;
+  for (auto it=Locate(m_cursor[reader]); it!=m_entries.end(); )
     {
-    NotifyEntryMap_t::iterator next;
-    for (NotifyEntryMap_t::iterator ite=m_entries.begin(); ite!=m_entries.end(); )
+    uint32_t id = it->id;
+    if (it->entry)
       {
-      OvmsNotifyEntry* e = ite->second;
-      ++ite;
-      e->m_pendingreaders &= ~(1ul << reader);
-      Cleanup(e, &ite);
+      it->entry->m_pendingreaders &= ~(1ul << reader);
+      Cleanup(it);
       }
+    // Cleanup may have removed front entries:
+    it = Locate(id + 1);
     }
+  m_cursor[reader] = m_nextid;
   }
 
 OvmsNotifyEntry* OvmsNotifyType::FirstUnreadEntry(size_t reader, uint32_t floor)
+  {
+  OvmsNotifyEntry* e;
+  return (FetchUnread(reader, floor, &e, 1) == 1) ? e : NULL;
+  }
+
+/**
+ * FetchUnread: get a batch of unread entries with an id > floor
+ *  - entries stay valid until marked as read by the reader
+ *  - returns the number of entries fetched
+ */
+size_t OvmsNotifyType::FetchUnread(size_t reader, uint32_t floor, OvmsNotifyEntry** entries, size_t max)
   {
   OvmsRecMutexLock lock(&m_mutex);
-  for (NotifyEntryMap_t::iterator ite=m_entries.begin(); ite!=m_entries.end(); ++ite)
+  if (reader >= NOTIFY_MAX_READERS)
+    return 0;
+  AdvanceCursor(reader);
+  size_t cnt = 0;
+  for (auto it=Locate(std::max(m_cursor[reader], floor+1)); it!=m_entries.end() && cnt < max; ++it)
     {
-    OvmsNotifyEntry* e = ite->second;
-    if ((!e->IsRead(reader))&&(e->m_id > floor))
-      return e;
+    OvmsNotifyEntry* e = it->entry;
+    if (e && !e->IsRead(reader))
+      entries[cnt++] = e;
     }
-  return NULL;
+  return cnt;
   }
 
 OvmsNotifyEntry* OvmsNotifyType::FindEntry(uint32_t id)
   {
   OvmsRecMutexLock lock(&m_mutex);
-  auto k = m_entries.find(id);
-  if (k == m_entries.end())
+  auto it = Locate(id);
+  if (it == m_entries.end() || it->id != id)
     return NULL;
   else
-    return k->second;
+    return it->entry;
   }
 
 void OvmsNotifyType::MarkRead(size_t reader, OvmsNotifyEntry* entry)
   {
   OvmsRecMutexLock lock(&m_mutex);
   entry->m_pendingreaders &= ~(1ul << reader);
-  Cleanup(entry);
+  auto it = Locate(entry->m_id);
+  if (it != m_entries.end() && it->entry == entry)
+    Cleanup(it);
   }
 
-void OvmsNotifyType::Cleanup(OvmsNotifyEntry* entry, NotifyEntryMap_t::iterator* next /*=NULL*/)
+/**
+ * Cleanup: delete the entry if read by all readers, drop read entries from the queue front
+ */
+void OvmsNotifyType::Cleanup(NotifyEntryQueue_t::iterator it)
   {
-  if (entry->IsAllRead())
-    {
-    // We can cleanup...
-    auto k = m_entries.find(entry->m_id);
-    if (k != m_entries.end())
-      {
-      NotifyEntryMap_t::iterator it = m_entries.erase(k);
-      if (next) *next = it;
-      }
-    if (DO_TRACE(m_name))
-      ESP_LOGD(TAG,"Cleanup type %s id %" PRId32,m_name,entry->m_id);
-    delete entry;
-    }
+  OvmsNotifyEntry* entry = it->entry;
+  if (!entry || !entry->IsAllRead())
+    return;
+
+  // We can cleanup...
+  if (DO_TRACE(m_name))
+    ESP_LOGD(TAG,"Cleanup type %s id %" PRId32,m_name,entry->m_id);
+  it->entry = NULL;
+  m_count--;
+  delete entry;
+  while (!m_entries.empty() && m_entries.front().entry == NULL)
+    m_entries.pop_front();
   }
 
 ////////////////////////////////////////////////////////////////////////
@@ -439,6 +518,7 @@ OvmsNotify::OvmsNotify()
   ESP_LOGI(TAG, "Initialising NOTIFICATIONS (1820)");
 
   m_nextreader = 1;
+  m_restore = true;
 
 #ifdef CONFIG_OVMS_DEV_DEBUGNOTIFICATIONS
   m_trace = 1;
@@ -448,6 +528,10 @@ OvmsNotify::OvmsNotify()
 
   MyConfig.RegisterParam("notify", "Notification filters", true, true);
 
+  using std::placeholders::_1;
+  using std::placeholders::_2;
+  MyEvents.RegisterEvent(TAG, "system.shuttingdown", std::bind(&OvmsNotify::EventHandler, this, _1, _2));
+
   // Register our commands
   OvmsCommand* cmd_notify = MyCommandApp.RegisterCommand("notify","NOTIFICATION framework", notify_status, "", 0, 0, false);
   cmd_notify->RegisterCommand("status","Show notification status",notify_status);
@@ -488,6 +572,8 @@ size_t OvmsNotify::RegisterReader(const char* caller, int verbosity, OvmsNotifyC
   size_t reader = m_nextreader++;
 
   m_readers[reader] = new OvmsNotifyCallbackEntry(caller, reader, verbosity, callback, configfiltered, filtercallback);
+  if (m_restore)
+    RestoreData();
 
   return reader;
   }
@@ -497,6 +583,8 @@ void OvmsNotify::RegisterReader(size_t reader, const char* caller, int verbosity
   {
   OvmsRecMutexLock lock(&m_mutex);
   m_readers[reader] = new OvmsNotifyCallbackEntry(caller, reader, verbosity, callback, configfiltered, filtercallback);
+  if (m_restore)
+    RestoreData();
   }
 
 void OvmsNotify::ClearReader(size_t reader)
@@ -792,3 +880,115 @@ void OvmsNotify::NotifyErrorCode(uint32_t code, uint32_t data, bool raised, bool
       data);
     }
   }
+
+void OvmsNotify::EventHandler(std::string event, void* data)
+  {
+  if (event == "system.shuttingdown")
+    {
+    if (MyConfig.GetParamValueBool("notify", "data.persist", false))
+      SaveData();
+    }
+  }
+
+/**
+ * SaveData: store unsent data notifications for delivery after the reboot
+ *  File format: records of [age:4][subtype length:2][value length:4][subtype][value],
+ *  age in seconds at the time of saving
+ */
+void OvmsNotify::SaveData()
+  {
+  OvmsNotifyType* mt = GetType("data");
+  if (!mt)
+    return;
+  OvmsRecMutexLock lock(&mt->m_mutex);
+  if (mt->CountEntries() == 0)
+    return;
+
+  mkpath(NOTIFY_PERSIST_DIR);
+  FILE* file = fopen(NOTIFY_PERSIST_PATH, "a");
+  if (!file)
+    {
+    ESP_LOGE(TAG, "SaveData: cannot open '%s'", NOTIFY_PERSIST_PATH);
+    return;
+    }
+  uint32_t now = esp_log_timestamp();
+  int cnt = 0;
+  for (auto it=mt->m_entries.begin(); it!=mt->m_entries.end(); ++it)
+    {
+    OvmsNotifyEntry* e = it->entry;
+    if (!e)
+      continue;
+    extram::string value = e->GetValue();
+    const char* subtype = e->GetSubType();
+    uint32_t age = (now - e->m_created) / 1000;
+    uint16_t sublen = strlen(subtype);
+    uint32_t len = value.size();
+    fwrite(&age, sizeof(age), 1, file);
+    fwrite(&sublen, sizeof(sublen), 1, file);
+    fwrite(&len, sizeof(len), 1, file);
+    fwrite(subtype, 1, sublen, file);
+    fwrite(value.data(), 1, len, file);
+    cnt++;
+    }
+  if (ferror(file))
+    ESP_LOGE(TAG, "SaveData: error writing to '%s'", NOTIFY_PERSIST_PATH);
+  else
+    ESP_LOGI(TAG, "SaveData: %d data notifications saved", cnt);
+  fclose(file);
+  }
+
+/**
+ * RestoreData: requeue saved data notifications once a reader accepts them
+ */
+void OvmsNotify::RestoreData()
+  {
+  struct stat st;
+  if (stat(NOTIFY_PERSIST_PATH, &st) != 0)
+    {
+    if (MyConfig.ismounted())
+      m_restore = false;
+    return;
+    }
+  FILE* file = fopen(NOTIFY_PERSIST_PATH, "r");
+  if (!file)
+    return;
+
+  OvmsNotifyType* mt = GetType("data");
+  OvmsRecMutexLock lock(&mt->m_mutex);
+  uint32_t now = esp_log_timestamp();
+  uint32_t age, len;
+  uint16_t sublen;
+  extram::string subtype, value;
+  int cnt = 0;
+  while (fread(&age, sizeof(age), 1, file) == 1 &&
+         fread(&sublen, sizeof(sublen), 1, file) == 1 &&
+         fread(&len, sizeof(len), 1, file) == 1)
+    {
+    long remaining = st.st_size - ftell(file);
+    if (remaining < 0 || len > NOTIFY_PERSIST_MAXVALUE || (long)sublen + (long)len > remaining)
+      {
+      ESP_LOGE(TAG, "RestoreData: invalid record length, '%s' is corrupt", NOTIFY_PERSIST_PATH);
+      break;
+      }
+    subtype.resize(sublen);
+    value.resize(len);
+    if ((sublen && fread(&subtype[0], 1, sublen, file) != sublen) ||
+        (len && fread(&value[0], 1, len, file) != len))
+      break;
+    if (cnt == 0 && !HasReader("data", subtype.c_str(), len))
+      {
+      // no reader yet, try again on the next registration:
+      fclose(file);
+      return;
+      }
+    uint32_t id = NotifyString("data", subtype.c_str(), value.c_str());
+    OvmsNotifyEntry* e = mt->FindEntry(id);
+    if (e)
+      e->m_created = now - age * 1000;
+    cnt++;
+    }
+  fclose(file);
+  unlink(NOTIFY_PERSIST_PATH);
+  m_restore = false;
+  ESP_LOGI(TAG, "RestoreData: %d data notifications restored", cnt);
+  }
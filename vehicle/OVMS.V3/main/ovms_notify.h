@@ -34,6 +34,7 @@
 #include <functional>
 #include <map>
 #include <list>
+#include <deque>
 #include <string>
 #include <bitset>
 #include <atomic>
@@ -44,6 +45,9 @@
 
 #define NOTIFY_MAX_READERS 32
 #define NOTIFY_ERROR_AUTOSUPPRESS 120 // Auto-suppress for 120 seconds
+#define NOTIFY_PERSIST_DIR "/store/notify"
+#define NOTIFY_PERSIST_PATH NOTIFY_PERSIST_DIR "/data.bin" // Unsent data notifications kept over reboots
+#define NOTIFY_PERSIST_MAXVALUE 65536                       // Max saved notification size restored
 
 using namespace std;
 
@@ -55,6 +59,9 @@ class OvmsNotifyEntry : public ExternalRamAllocated
     OvmsNotifyEntry(const char* subtype);
     virtual ~OvmsNotifyEntry();
 
+  protected:
+    OvmsNotifyEntry();
+
   public:
     virtual const extram::string GetValue();
     virtual size_t GetValueSize() { return 0; }
@@ -80,10 +87,12 @@ class OvmsNotifyEntryString : public OvmsNotifyEntry
 
   public:
     virtual const extram::string GetValue();
-    virtual size_t GetValueSize() { return m_value.size(); }
+    virtual size_t GetValueSize() { return m_valuesize; }
+    const char* GetValueText() { return m_value; }
 
   public:
-     extram::string m_value;
+     char* m_value;             // stored inline behind the subtype in a single PSRAM block
+     size_t m_valuesize;
   };
 
 class OvmsNotifyEntryCommand : public OvmsNotifyEntry
@@ -101,8 +110,13 @@ class OvmsNotifyEntryCommand : public OvmsNotifyEntry
      extram::string m_value;
   };
 
-typedef std::map<uint32_t, OvmsNotifyEntry*, std::less<uint32_t>,
-  ExtRamAllocator<std::pair<const uint32_t, OvmsNotifyEntry*>>> NotifyEntryMap_t;
+typedef struct
+  {
+  uint32_t id;
+  OvmsNotifyEntry* entry;       // NULL = entry has been read by all readers
+  } OvmsNotifyQueueItem_t;
+
+typedef std::deque<OvmsNotifyQueueItem_t, ExtRamAllocator<OvmsNotifyQueueItem_t>> NotifyEntryQueue_t;
 
 class OvmsNotifyType
   {
@@ -115,16 +129,22 @@ class OvmsNotifyType
     uint32_t AllocateNextID();
     void ClearReader(size_t reader);
     OvmsNotifyEntry* FirstUnreadEntry(size_t reader, uint32_t floor);
+    size_t FetchUnread(size_t reader, uint32_t floor, OvmsNotifyEntry** entries, size_t max);
     OvmsNotifyEntry* FindEntry(uint32_t id);
     void MarkRead(size_t reader, OvmsNotifyEntry* entry);
+    size_t CountEntries() { return m_count; }
 
   protected:
-    void Cleanup(OvmsNotifyEntry* entry, NotifyEntryMap_t::iterator* next=NULL);
+    NotifyEntryQueue_t::iterator Locate(uint32_t id);
+    void Cleanup(NotifyEntryQueue_t::iterator it);
+    void AdvanceCursor(size_t reader);
 
   public:
     const char* m_name;
     uint32_t m_nextid;
-    NotifyEntryMap_t m_entries;
+    NotifyEntryQueue_t m_entries;       // Ordered by id, read entries are removed from the front
+    size_t m_count;                     // Number of entries not yet read by all readers
+    uint32_t m_cursor[NOTIFY_MAX_READERS];  // Per reader: id of first entry possibly unread
     OvmsRecMutex m_mutex;
   };
 
@@ -189,6 +209,11 @@ class OvmsNotify : public ExternalRamAllocated
     uint32_t NotifyCommandf(const char* type, const char* subtype, const char* fmt, ...) __attribute__ ((format (printf, 4, 5)));
     void NotifyErrorCode(uint32_t code, uint32_t data, bool raised, bool force=false);
 
+  public:
+    void EventHandler(std::string event, void* data);
+    void SaveData();
+    void RestoreData();
+
   public:
     OvmsNotifyCallbackMap_t m_readers;
     OvmsRecMutex m_mutex;
@@ -200,6 +225,7 @@ class OvmsNotify : public ExternalRamAllocated
     OvmsNotifyTypeMap_t m_types;
     OvmsNotifyErrorCodeMap_t m_errorcodes;
     int m_trace;
+    bool m_restore;                     // Persisted data notifications waiting for a reader
   };
 
 extern OvmsNotify MyNotify;
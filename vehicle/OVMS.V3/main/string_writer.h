@@ -34,7 +34,6 @@
 #include <string>
 #include "ovms_command.h"
 
-class LogBuffers;
 class OvmsCommandMap;
 
 class StringWriter : public std::string, public OvmsWriter
@@ -47,9 +46,6 @@ class StringWriter : public std::string, public OvmsWriter
     int puts(const char* s);
     int printf(const char* fmt, ...) __attribute__ ((format (printf, 2, 3)));
     ssize_t write(const void *buf, size_t nbyte);
-
-  public:
-    void Log(LogBuffers* message) {}
     virtual bool IsInteractive() { return false; }
   };
 
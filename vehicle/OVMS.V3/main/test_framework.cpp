@@ -48,6 +48,9 @@ static const char *TAG = "test";
 #if ESP_IDF_VERSION_MAJOR < 4
 #include "strverscmp.h"
 #endif
+#ifdef CONFIG_HEAP_TRACING_STANDALONE
+#include "esp_heap_trace.h"
+#endif
 
 void test_deepsleep(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
@@ -380,6 +383,67 @@ void test_string(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc,
     (int)((esp_timer_get_time() - time_start_us) / 1000));
   }
 
+/**
+ * test_metricfmt: compare metric formatting via AsJSON() and AppendJSONTo()
+ *  Heap allocations are counted if heap tracing (standalone) is enabled in the build.
+ */
+static int metricfmt_run(int loops, bool append, size_t& len)
+  {
+  std::string buf;
+  buf.reserve(1024);
+  int64_t started = esp_timer_get_time();
+  for (int k = 0; k < loops; k++)
+    {
+    for (OvmsMetric* m = MyMetrics.m_first; m != NULL; m = m->m_next)
+      {
+      if (append)
+        {
+        buf.clear();
+        OvmsMetricBuffer out(buf);
+        m->AppendJSONTo(out);
+        len += buf.size();
+        }
+      else
+        len += m->AsJSON().size();
+      }
+    }
+  return esp_timer_get_time() - started;
+  }
+
+void test_metricfmt(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
+  {
+  int loops = (argc > 0) ? atoi(argv[0]) : 10;
+  if (loops < 1) loops = 1;
+  int count = 0;
+  for (OvmsMetric* m = MyMetrics.m_first; m != NULL; m = m->m_next)
+    count++;
+
+  for (int mode = 0; mode < 2; mode++)
+    {
+    size_t len = 0;
+    int us = metricfmt_run(loops, mode == 1, len);
+    writer->printf("%-12s %d x %d metrics: %d us = %d us/metric, %u bytes\n",
+      (mode == 1) ? "AppendJSONTo" : "AsJSON", loops, count, us, us / (loops * count), len);
+#ifdef CONFIG_HEAP_TRACING_STANDALONE
+    #define METRICFMT_TRACE_RECORDS 1000
+    heap_trace_record_t* records = (heap_trace_record_t*) calloc(METRICFMT_TRACE_RECORDS, sizeof(heap_trace_record_t));
+    if (records && heap_trace_init_standalone(records, METRICFMT_TRACE_RECORDS) == ESP_OK)
+      {
+      len = 0;
+      heap_trace_start(HEAP_TRACE_ALL);
+      metricfmt_run(1, mode == 1, len);
+      heap_trace_stop();
+      size_t allocs = heap_trace_get_count();
+      writer->printf("%-12s heap allocations per pass: %s%u\n",
+        (mode == 1) ? "AppendJSONTo" : "AsJSON",
+        (allocs >= METRICFMT_TRACE_RECORDS) ? ">=" : "", allocs);
+      heap_trace_init_standalone(NULL, 0);
+      }
+    free(records);
+#endif // CONFIG_HEAP_TRACING_STANDALONE
+    }
+  }
+
 void test_command(int verbosity, OvmsWriter* writer, OvmsCommand* cmd, int argc, const char* const* argv)
   {
   MyCommandApp.Display(writer);
@@ -412,5 +476,6 @@ TestFrameworkInit::TestFrameworkInit()
   cmd_test->RegisterCommand("mkstemp", "Test mkstemp function", test_mkstemp, "<file>", 1, 1);
   cmd_test->RegisterCommand("string", "Test std::string memory corruption", test_string, "<loopcnt> <mode>\n"
     "mode: 1=m.AsJSON, 2=m.AsString, 3=m.name, 4=const cfg string, 5=const local cstr, 6=const local string", 2, 2);
+  cmd_test->RegisterCommand("metricfmt", "Test metric formatting speed & allocations", test_metricfmt, "[<loops>]", 0, 1);
   cmd_test->RegisterCommand("commands", "List command tree", test_command);
   }